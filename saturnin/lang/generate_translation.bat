@@ -10,7 +10,7 @@ for /f "delims=" %%x in (config.txt) do (set "%%x")
 @set input_loc=-D %src_path%
 @set output_loc=--output=%lang_path%\po\saturnin.pot
 @set files=--files-from=%lang_path%\filelist.txt
-@set options=--keyword=tr  --sort-by-file --msgid-bugs-address=saturnin@runik.info --copyright-holder="Renaud TOUMAZET" --package-name=Saturnin
+@set options=--keyword=tr --keyword=internTr --sort-by-file --msgid-bugs-address=saturnin@runik.info --copyright-holder="Renaud TOUMAZET" --package-name=Saturnin
 if exist .\po\saturnin.pot (
     echo Updating template file
     %xgettext_path%\xgettext.exe %input_loc% %output_loc% %files% %options% --join-existing
@@ -2339,3 +2339,117 @@ void scsp_init(unsigned char* scsp_ram, void* sint_hand, void* mint_hand) {
 
     scsp_reset();
 }
+
+////////////////////////////////////////////////////////////////
+// Save states
+//
+// The state is the SCSP structure followed by the registers. Pointers of the structure are
+// stored as offsets in the sound ram or indexes in the tables built by scsp_init(), as they
+// change from one run to another.
+
+typedef struct scsp_table_t {
+    long*         base;
+    unsigned long len;
+} scsp_table_t;
+
+static const scsp_table_t scsp_rate_tables[] = {{scsp_attack_rate, 0x40 + 0x20}, {scsp_decay_rate, 0x40 + 0x20}, {scsp_null_rate, 0x20}};
+
+static const scsp_table_t scsp_lfo_f_tables[]
+    = {{scsp_lfo_sawt_f, SCSP_LFO_LEN}, {scsp_lfo_squa_f, SCSP_LFO_LEN}, {scsp_lfo_tri_f, SCSP_LFO_LEN}, {scsp_lfo_noi_f, SCSP_LFO_LEN}};
+
+static const scsp_table_t scsp_lfo_e_tables[]
+    = {{scsp_lfo_sawt_e, SCSP_LFO_LEN}, {scsp_lfo_squa_e, SCSP_LFO_LEN}, {scsp_lfo_tri_e, SCSP_LFO_LEN}, {scsp_lfo_noi_e, SCSP_LFO_LEN}};
+
+static void (*const scsp_env_next_functions[])(slot_t*)
+    = {scsp_attack_next, scsp_decay_next, scsp_substain_next, scsp_release_next, scsp_env_null_next};
+
+// Table number (starting at 1, 0 being NULL) in the upper bits, index in the lower 16 bits.
+static size_t scsp_table_encode(const long* ptr, const scsp_table_t* tables, unsigned long count) {
+    unsigned long i;
+
+    for (i = 0; i < count; i++) {
+        if ((ptr >= tables[i].base) && (ptr < tables[i].base + tables[i].len)) return ((i + 1) << 16) | (size_t)(ptr - tables[i].base);
+    }
+    return 0;
+}
+
+static long* scsp_table_decode(size_t value, const scsp_table_t* tables, unsigned long count) {
+    size_t table = value >> 16;
+
+    if ((table == 0) || (table > count)) return NULL;
+    return tables[table - 1].base + (value & 0xFFFF);
+}
+
+// Offset in the sound ram plus 1, 0 being NULL.
+static size_t scsp_ram_encode(const void* ptr) {
+    if (ptr == NULL) return 0;
+    return (size_t)((const unsigned char*)ptr - scsp.scsp_ram) + 1;
+}
+
+static void* scsp_ram_decode(size_t value) {
+    if (value == 0) return NULL;
+    return &scsp.scsp_ram[value - 1];
+}
+
+unsigned long scsp_get_state_size(void) { return sizeof(scsp_t) + sizeof(scsp_reg); }
+
+void scsp_get_state(void* dst) {
+    scsp_t        state = scsp;
+    unsigned long i, j;
+
+    state.scsp_ram = NULL;
+    state.mintf    = NULL;
+    state.sintf    = NULL;
+
+    for (i = 0; i < 32; i++) {
+        slot_t* slot = &state.slot[i];
+
+        slot->buf8   = (char*)scsp_ram_encode(slot->buf8);
+        slot->buf16  = (short*)scsp_ram_encode(slot->buf16);
+        slot->arp    = (long*)scsp_table_encode(slot->arp, scsp_rate_tables, 3);
+        slot->drp    = (long*)scsp_table_encode(slot->drp, scsp_rate_tables, 3);
+        slot->srp    = (long*)scsp_table_encode(slot->srp, scsp_rate_tables, 3);
+        slot->rrp    = (long*)scsp_table_encode(slot->rrp, scsp_rate_tables, 3);
+        slot->lfofmw = (long*)scsp_table_encode(slot->lfofmw, scsp_lfo_f_tables, 4);
+        slot->lfoemw = (long*)scsp_table_encode(slot->lfoemw, scsp_lfo_e_tables, 4);
+
+        for (j = 0; j < 5; j++) {
+            if (slot->enxt == scsp_env_next_functions[j]) break;
+        }
+        slot->enxt = (void (*)(slot_t*))(size_t)((j < 5) ? j + 1 : 0);
+    }
+
+    memcpy(dst, &state, sizeof(scsp_t));
+    memcpy((unsigned char*)dst + sizeof(scsp_t), scsp_reg, sizeof(scsp_reg));
+}
+
+void scsp_set_state(const void* src) {
+    unsigned char* scsp_ram = scsp.scsp_ram;
+    void (*mintf)(void)          = scsp.mintf;
+    void (*sintf)(unsigned long) = scsp.sintf;
+    unsigned long  i;
+    size_t         next;
+
+    memcpy(&scsp, src, sizeof(scsp_t));
+    memcpy(scsp_reg, (const unsigned char*)src + sizeof(scsp_t), sizeof(scsp_reg));
+
+    scsp.scsp_ram = scsp_ram;
+    scsp.mintf    = mintf;
+    scsp.sintf    = sintf;
+
+    for (i = 0; i < 32; i++) {
+        slot_t* slot = &scsp.slot[i];
+
+        slot->buf8   = (char*)scsp_ram_decode((size_t)slot->buf8);
+        slot->buf16  = (short*)scsp_ram_decode((size_t)slot->buf16);
+        slot->arp    = scsp_table_decode((size_t)slot->arp, scsp_rate_tables, 3);
+        slot->drp    = scsp_table_decode((size_t)slot->drp, scsp_rate_tables, 3);
+        slot->srp    = scsp_table_decode((size_t)slot->srp, scsp_rate_tables, 3);
+        slot->rrp    = scsp_table_decode((size_t)slot->rrp, scsp_rate_tables, 3);
+        slot->lfofmw = scsp_table_decode((size_t)slot->lfofmw, scsp_lfo_f_tables, 4);
+        slot->lfoemw = scsp_table_decode((size_t)slot->lfoemw, scsp_lfo_e_tables, 4);
+
+        next       = (size_t)slot->enxt;
+        slot->enxt = ((next == 0) || (next > 5)) ? scsp_env_null_next : scsp_env_next_functions[next - 1];
+    }
+}
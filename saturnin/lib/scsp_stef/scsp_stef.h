@@ -30,4 +30,8 @@ extern unsigned char scsp_midi_out_read(void);
 extern void          scsp_update(long* bufL, long* bufR, unsigned long len);
 extern void          scsp_update_timer(unsigned long len);
 
+extern unsigned long scsp_get_state_size(void);
+extern void          scsp_get_state(void* dst);
+extern void          scsp_set_state(const void* src);
+
 #endif
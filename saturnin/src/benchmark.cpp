@@ -0,0 +1,201 @@
+//
+// benchmark.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/benchmark.h>
+#include <filesystem> // path
+#include <fstream>    // ofstream
+#include <saturnin/src/config.h>
+#include <saturnin/src/emulator_context.h>
+#include <saturnin/src/log.h>
+#include <saturnin/src/thread_pool.h> // ThreadPool
+#include <saturnin/src/utilities.h>   // format
+#include <saturnin/src/sound/scsp.h>
+#include <saturnin/src/video/software_renderer.h>
+#include <saturnin/src/video/texture.h>
+#include <saturnin/src/video/vdp2/vdp2.h>
+
+namespace saturnin::core {
+
+namespace uti = saturnin::utilities;
+
+using video::Texture;
+
+constexpr auto modules_names = std::array<std::string_view, benchmarked_modules_number>{
+    "master_sh2",
+    "slave_sh2",
+    "smpc",
+    "vdp2",
+    "cdrom",
+    "scsp",
+    "scu"};
+
+inline auto toSeconds(const std::chrono::nanoseconds d) -> double { return std::chrono::duration<double>(d).count(); }
+
+inline auto perSecond(const u64 count, const std::chrono::nanoseconds d) -> double {
+    return (d.count() != 0) ? static_cast<double>(count) / toSeconds(d) : 0.0;
+}
+
+Benchmark::Benchmark(EmulatorContext* ec, const u32 frames_number, const std::string& report_path) :
+    context_(ec),
+    frames_number_(frames_number),
+    report_path_(report_path) {
+    frames_.reserve(frames_number);
+    context_->softwareRenderer()->frameHashing(true);
+}
+
+void Benchmark::run() {
+    const std::string sh2_core = context_->config()->readValue(AccessKeys::cfg_advanced_sh2_core);
+    const std::string renderer = context_->config()->readValue(AccessKeys::cfg_rendering_renderer);
+    configuration_sh2_core_    = sh2_core;
+    configuration_renderer_    = renderer;
+    Log::info(Logger::main, tr("Benchmarking {} frames"), frames_number_);
+
+    const auto counters   = Texture::cacheCounters();
+    texture_cache_hits_   = counters.hits;
+    texture_cache_misses_ = counters.misses;
+    start_time_           = Clock::now();
+    frame_start_time_     = start_time_;
+
+    // The steps are the ones of the standard loop, state requests, rewind and pause included.
+    auto sampled_timer = ModuleTimer<true>{*this};
+    auto timer         = ModuleTimer<false>{*this};
+    auto iteration     = u32{};
+    while (context_->emulationStatus() == EmulationStatus::running) {
+        if (++iteration % sampling_interval == 0) {
+            context_->stepEmulation(sampled_timer);
+        } else {
+            context_->stepEmulation(timer);
+        }
+    }
+}
+
+void Benchmark::onFrameEnd() {
+    const auto now = Clock::now();
+    frames_.push_back({now - frame_start_time_, context_->softwareRenderer()->lastFrameHash()});
+    frame_start_time_ = now;
+
+    if (frames_.size() >= frames_number_) {
+        writeReport();
+        context_->emulationStatus(EmulationStatus::stopped);
+        context_->scsp()->closeAudioSink();
+    }
+}
+
+void Benchmark::writeReport() const {
+    auto out = std::ofstream(report_path_, std::ios::trunc);
+    if (!out) {
+        Log::warning(Logger::main, tr("Could not open benchmark report {}"), report_path_);
+        return;
+    }
+    if (std::filesystem::path(report_path_).extension() == ".csv") {
+        writeCsvReport(out);
+    } else {
+        writeJsonReport(out);
+    }
+    Log::info(Logger::main, tr("Benchmark report written to {}"), report_path_);
+}
+
+void Benchmark::writeJsonReport(std::ostream& out) const {
+    const auto wall_time = frame_start_time_ - start_time_;
+    const auto counters  = Texture::cacheCounters();
+    const auto hits      = counters.hits - texture_cache_hits_;
+    const auto lookups   = hits + counters.misses - texture_cache_misses_;
+
+    out << "{\n";
+    out << "  \"configuration\": {\n";
+    out << uti::format("    \"sh2_core\": \"{}\",\n", configuration_sh2_core_);
+    out << uti::format("    \"renderer\": \"{}\",\n", configuration_renderer_);
+    out << uti::format("    \"threads\": {}\n", ThreadPool::threadsNumber());
+    out << "  },\n";
+    out << uti::format("  \"frames\": {},\n", frames_.size());
+    out << uti::format("  \"wall_time_s\": {:.6f},\n", toSeconds(wall_time));
+    out << uti::format("  \"frames_per_second\": {:.3f},\n", perSecond(frames_.size(), wall_time));
+    out << "  \"cpus\": {\n";
+    const auto writeCpu = [&](std::string_view name, const Cpu& cpu, std::string_view separator) {
+        out << uti::format("    \"{}\": {{ \"cycles\": {}, \"instructions\": {}, \"instructions_per_second\": {:.0f} }}{}\n",
+                           name,
+                           cpu.cycles,
+                           cpu.instructions,
+                           perSecond(cpu.instructions, wall_time),
+                           separator);
+    };
+    writeCpu("master_sh2", master_sh2_, ",");
+    writeCpu("slave_sh2", slave_sh2_, "");
+    out << "  },\n";
+    out << "  \"modules_time_s\": {\n";
+    for (auto i = std::size_t{}; i < benchmarked_modules_number; ++i) {
+        out << uti::format("    \"{}\": {:.6f}{}\n",
+                           modules_names[i],
+                           toSeconds(modules_time_[i]),
+                           (i + 1 < benchmarked_modules_number) ? "," : "");
+    }
+    out << "  },\n";
+    out << uti::format("  \"texture_cache\": {{ \"lookups\": {}, \"hits\": {}, \"hit_rate\": {:.4f} }},\n",
+                       lookups,
+                       hits,
+                       (lookups != 0) ? static_cast<double>(hits) / static_cast<double>(lookups) : 0.0);
+    out << "  \"frames_details\": [\n";
+    for (auto i = std::size_t{}; i < frames_.size(); ++i) {
+        out << uti::format("    {{ \"frame\": {}, \"wall_time_ms\": {:.3f}, \"hash\": \"{:016x}\" }}{}\n",
+                           i + 1,
+                           std::chrono::duration<double, std::milli>(frames_[i].wall_time).count(),
+                           frames_[i].hash,
+                           (i + 1 < frames_.size()) ? "," : "");
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+void Benchmark::writeCsvReport(std::ostream& out) const {
+    // Summary as key / value pairs, followed by the frames table.
+    const auto wall_time = frame_start_time_ - start_time_;
+    const auto counters  = Texture::cacheCounters();
+    const auto hits      = counters.hits - texture_cache_hits_;
+    const auto lookups   = hits + counters.misses - texture_cache_misses_;
+
+    out << "key,value\n";
+    out << uti::format("sh2_core,{}\n", configuration_sh2_core_);
+    out << uti::format("renderer,{}\n", configuration_renderer_);
+    out << uti::format("threads,{}\n", ThreadPool::threadsNumber());
+    out << uti::format("frames,{}\n", frames_.size());
+    out << uti::format("wall_time_s,{:.6f}\n", toSeconds(wall_time));
+    out << uti::format("frames_per_second,{:.3f}\n", perSecond(frames_.size(), wall_time));
+    out << uti::format("master_sh2_cycles,{}\n", master_sh2_.cycles);
+    out << uti::format("master_sh2_instructions,{}\n", master_sh2_.instructions);
+    out << uti::format("master_sh2_instructions_per_second,{:.0f}\n", perSecond(master_sh2_.instructions, wall_time));
+    out << uti::format("slave_sh2_cycles,{}\n", slave_sh2_.cycles);
+    out << uti::format("slave_sh2_instructions,{}\n", slave_sh2_.instructions);
+    out << uti::format("slave_sh2_instructions_per_second,{:.0f}\n", perSecond(slave_sh2_.instructions, wall_time));
+    for (auto i = std::size_t{}; i < benchmarked_modules_number; ++i) {
+        out << uti::format("{}_time_s,{:.6f}\n", modules_names[i], toSeconds(modules_time_[i]));
+    }
+    out << uti::format("texture_cache_lookups,{}\n", lookups);
+    out << uti::format("texture_cache_hits,{}\n", hits);
+    out << "\n";
+    out << "frame,wall_time_ms,hash\n";
+    for (auto i = std::size_t{}; i < frames_.size(); ++i) {
+        out << uti::format("{},{:.3f},{:016x}\n",
+                           i + 1,
+                           std::chrono::duration<double, std::milli>(frames_[i].wall_time).count(),
+                           frames_[i].hash);
+    }
+}
+
+} // namespace saturnin::core
@@ -0,0 +1,181 @@
+//
+// benchmark.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	benchmark.h
+///
+/// \brief	Declares the Benchmark class, used by the --bench command line option.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>   // array
+#include <chrono>  // steady_clock
+#include <iosfwd>  // ostream
+#include <string>  // string
+#include <vector>  // vector
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::core {
+
+class EmulatorContext;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   BenchmarkedModule
+///
+/// \brief  Modules run by the emulation loop. VDP1 and the software renderer are accounted in VDP2,
+///         which drives them at VBlank, and the SCU DMA in the SH2 accessing it. The SCU entry
+///         measures its DSP.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class BenchmarkedModule : u8 { master_sh2, slave_sh2, smpc, vdp2, cdrom, scsp, scu };
+
+constexpr auto benchmarked_modules_number = std::size_t{7};
+constexpr auto sampling_interval          = u32{16}; ///< Modules are timed on 1 emulation step out of 16.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct BenchmarkedFrame
+///
+/// \brief  Measures of one emulated frame.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct BenchmarkedFrame {
+    std::chrono::nanoseconds wall_time; ///< Host time spent emulating the frame.
+    u64                      hash;      ///< Hash of the rendered frame, 0 when the software renderer isn't used.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Benchmark
+///
+/// \brief  Runs the emulation as fast as possible for a given number of frames, and writes a report
+///         of the measures in JSON or CSV.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Benchmark {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \struct Benchmark::ModuleTimer
+    ///
+    /// \brief  Probe given to EmulatorContext::stepEmulation(), counting the SH2 instructions and, on
+    ///         sampled steps, timing the modules.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam is_sampled  True when the modules are timed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<bool is_sampled>
+    struct ModuleTimer {
+        Benchmark&        benchmark; ///< Benchmark receiving the measures.
+        Clock::time_point time{};    ///< End of the previous measure.
+
+        void onStepStart() {
+            if constexpr (is_sampled) { time = Clock::now(); }
+        }
+
+        void onModuleRun(const BenchmarkedModule m, const u32 cycles) {
+            if (m == BenchmarkedModule::master_sh2) {
+                benchmark.master_sh2_.cycles += cycles;
+                ++benchmark.master_sh2_.instructions;
+            } else if (m == BenchmarkedModule::slave_sh2) {
+                benchmark.slave_sh2_.cycles += cycles;
+                ++benchmark.slave_sh2_.instructions;
+            }
+            if constexpr (is_sampled) {
+                // The sampled time is extrapolated to the steps that aren't timed.
+                const auto now = Clock::now();
+                benchmark.modules_time_[static_cast<std::size_t>(m)] += (now - time) * sampling_interval;
+                time = now;
+            }
+        }
+    };
+
+    //@{
+    // Constructors / Destructors
+    Benchmark() = delete;
+    Benchmark(EmulatorContext* ec, const u32 frames_number, const std::string& report_path);
+    Benchmark(const Benchmark&)                      = delete;
+    Benchmark(Benchmark&&)                           = delete;
+    auto operator=(const Benchmark&) & -> Benchmark& = delete;
+    auto operator=(Benchmark&&) & -> Benchmark&      = delete;
+    ~Benchmark()                                     = default;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Benchmark::run();
+    ///
+    /// \brief  Emulation loop used instead of the standard one while benchmarking, running the same
+    ///         steps. Modules are timed on one step out of 16, the result being extrapolated, to keep
+    ///         the clock reads from weighting on the measures.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void run();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Benchmark::onFrameEnd();
+    ///
+    /// \brief  Records the measures of the frame. The report is written and the emulation is stopped
+    ///         once the requested number of frames is reached.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void onFrameEnd();
+
+  private:
+    void writeReport() const;
+    void writeJsonReport(std::ostream& out) const;
+    void writeCsvReport(std::ostream& out) const;
+
+    struct Cpu {
+        u64 cycles{};       ///< Emulated cycles.
+        u64 instructions{}; ///< Executed instructions.
+    };
+
+    EmulatorContext* context_;       ///< Context of the emulator.
+    u32              frames_number_; ///< Number of frames to emulate.
+    std::string      report_path_;   ///< Path of the report, written in CSV if the extension is .csv, JSON otherwise.
+
+    std::string configuration_sh2_core_; ///< SH2 core used.
+    std::string configuration_renderer_; ///< Renderer used.
+
+    Cpu                                                              master_sh2_{};           ///< Master SH2 measures.
+    Cpu                                                              slave_sh2_{};            ///< Slave SH2 measures.
+    std::array<std::chrono::nanoseconds, benchmarked_modules_number> modules_time_{};         ///< Sampled time by module.
+    std::vector<BenchmarkedFrame>                                    frames_;                 ///< Measures by frame.
+    Clock::time_point                                                start_time_{};           ///< Benchmark start.
+    Clock::time_point                                                frame_start_time_{};     ///< Current frame start.
+    u64                                                              texture_cache_hits_{};   ///< Hits at benchmark start.
+    u64                                                              texture_cache_misses_{}; ///< Misses at benchmark start.
+};
+
+} // namespace saturnin::core
@@ -24,9 +24,15 @@
 #include <saturnin/src/emulator_context.h>
 #include <saturnin/src/locale.h>
 #include <saturnin/src/log.h> // Log
+#include <saturnin/src/memory.h> // rawRead
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/smpc.h>
+#include <saturnin/src/timing.h>
+#include <saturnin/src/trace.h> // Trace
 #include <saturnin/src/utilities.h> // toUnderlying, format
+#include <saturnin/src/cdrom/disc_image.h>
 #include <saturnin/src/cdrom/scsi.h>
+#include <saturnin/src/sound/scsp.h>
 
 namespace saturnin::cdrom {
 
@@ -35,6 +41,8 @@ namespace uti = saturnin::utilities;
 using core::Log;
 using core::Logger;
 using core::tr;
+using core::Trace;
+using core::TraceEvent;
 
 using HIrqReq  = CdromRegs::HIrqReq;
 using HIrqMask = CdromRegs::HIrqMask;
@@ -51,6 +59,99 @@ using Bful     = HIrqReq::Bful;
 using Csct     = HIrqReq::Csct;
 using Drdy     = HIrqReq::Drdy;
 
+/// \name Raw sector layout
+//@{
+constexpr auto sector_sync_size       = u16{12};  ///< Sync pattern.
+constexpr auto sector_mode_position   = u16{15};  ///< Mode byte, last byte of the header.
+constexpr auto sub_header_position    = u16{16};  ///< Mode 2 sub header.
+constexpr auto mode_1_data_position   = u16{16};  ///< Mode 1 user data.
+constexpr auto mode_2_data_position   = u16{24};  ///< Mode 2 user data, after the sub header.
+constexpr auto sub_mode_form_2        = u8{0x20}; ///< Sub mode bit set for form 2 sectors.
+constexpr auto toc_control_data_track = u8{0x40}; ///< Control bit set in the control/adr byte of data tracks.
+//@}
+
+/// \name Saturn TOC layout
+//@{
+constexpr auto toc_max_tracks        = u8{99};        ///< Tracks entries, track n is at entry n-1.
+constexpr auto toc_first_track_entry = u8{99};        ///< First track number and control/adr.
+constexpr auto toc_last_track_entry  = u8{100};       ///< Last track number and control/adr.
+constexpr auto toc_lead_out_entry    = u8{101};       ///< Lead out FAD.
+constexpr auto toc_lead_out_track    = u8{0xAA};      ///< Track number of the lead out in the drive TOC.
+constexpr auto toc_fad_mask          = u32{0xFFFFFF}; ///< FAD part of an entry.
+constexpr auto frames_per_second     = u32{75};       ///< Sectors per second of the disc.
+constexpr auto seconds_per_minute    = u32{60};       ///< Seconds per minute.
+//@}
+
+/// \name Play and seek positions
+//@{
+constexpr auto position_no_change = u32{0xFFFFFF}; ///< Position is kept.
+constexpr auto position_is_fad    = u32{0x800000}; ///< Position is a FAD, otherwise a track and an index.
+constexpr auto position_fad_mask  = u32{0x7FFFFF}; ///< FAD part of a position.
+//@}
+
+constexpr auto copy_error_buffer_full = u8{0x01}; ///< Not enough free sectors to copy.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn inline auto isSectorAccepted(const Filter& filter, const Sector& sector) -> bool
+///
+/// \brief  Checks a sector against the conditions of a filter.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  filter  The filter.
+/// \param  sector  The sector.
+///
+/// \returns    True if the sector is sent to the true output of the filter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto isSectorAccepted(const Filter& filter, const Sector& sector) -> bool {
+    if (((filter.mode & FILTER_MODE_FAD_RANGE) != 0)
+        && ((sector.fad < filter.fad) || (sector.fad >= filter.fad + filter.fad_range))) {
+        return false;
+    }
+
+    constexpr auto sub_header_conditions
+        = u8{FILTER_MODE_FILE_NUMBER | FILTER_MODE_CHANNEL_NUMBER | FILTER_MODE_SUB_MODE | FILTER_MODE_CODING_INFO};
+    if ((filter.mode & sub_header_conditions) == 0) { return true; }
+
+    auto is_matching = true;
+    if ((filter.mode & FILTER_MODE_FILE_NUMBER) != 0) { is_matching = is_matching && (sector.file_number == filter.file_number); }
+    if ((filter.mode & FILTER_MODE_CHANNEL_NUMBER) != 0) {
+        is_matching = is_matching && (sector.channel_number == filter.channel_number);
+    }
+    if ((filter.mode & FILTER_MODE_SUB_MODE) != 0) {
+        is_matching = is_matching && ((sector.sub_mode & filter.sub_mode_mask) == filter.sub_mode_value);
+    }
+    if ((filter.mode & FILTER_MODE_CODING_INFO) != 0) {
+        is_matching = is_matching && ((sector.coding_info & filter.coding_info_mask) == filter.coding_info_value);
+    }
+    return ((filter.mode & FILTER_MODE_REVERSE) != 0) ? !is_matching : is_matching;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn inline void initializeFilterConditions(Filter& filter)
+///
+/// \brief  Resets the conditions of a filter, its connections are kept.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param [in,out] filter  The filter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void initializeFilterConditions(Filter& filter) {
+    filter.mode              = 0;
+    filter.fad               = 0;
+    filter.fad_range         = 0;
+    filter.file_number       = 0;
+    filter.channel_number    = 0;
+    filter.sub_mode_mask     = 0;
+    filter.sub_mode_value    = 0;
+    filter.coding_info_mask  = 0;
+    filter.coding_info_value = 0;
+}
+
 // Static variables initialization
 CdromAccessMethod Cdrom::access_method = CdromAccessMethod::spti;
 
@@ -176,230 +277,16 @@ auto Cdrom::getDriveIndice(const s8 path, const s8 target, const s8 lun) -> u8 {
 //
 //
 void Cdrom::executeCommand() {
+    Trace::record(TraceEvent::cdrom_command,
+                  static_cast<u32>(regs_.cr2.data()) << 16 | regs_.cr3.data(),
+                  static_cast<u8>(regs_.cr1 >> Cr::command_enum));
     switch (regs_.cr1 >> Cr::command_enum) {
         using enum Cr::Command;
         case get_status: getStatus(); break;
         case get_hardware_info: getHardwareInfo(); break;
-        //		case 0x2: // Get TOC
-        //			// Status(8) | Upper byte of word count(8)
-        //			// Lower word of word count(16) (Max 204 words)
-        //			// 0x0000
-        //			// 0x0000
-        //			cdDriveStatus|=STAT_TRNS;
-        //			CR1=cdDriveStatus<<8 | 0x00;
-        //			CR2=0x00CC;
-        //			CR3=0x0000;
-        //			CR4=0x0000;
-        //
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get TOC=- executed");
-        //			#endif
-        //
-        //			// building the saturn TOC
-        //			Scsi::readToc(TOCData);
-        //			//AspiTOC=(Aspi_TOC*)&TOCData;
-        //			AspiTOC=reinterpret_cast<Aspi_TOC*>(&TOCData);
-        //
-        //			BuildSaturnTOC();
-        //
-        //			dataBuffer = saturnTOC;
-        //			bytesTransfered = 0;
-        //			posInDataBuffer = 0;
-        //			dataBufferSize = 0xCC;
-        //
-        //			// flags setup
-        //			HIRQREQ|=CMOK|DRDY;
-        //
-        //			break;
-        //		case 0x3: // Get Session Info
-        //			// Status(8) | 0x00
-        //			// 0x0000
-        //			// Upper word of sesson info(16)
-        //			// Lower word of sesson info(16)
-        //
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get Session Info=- executed");
-        //			#endif
-        //
-        //			// only supports single session CD
-        //			switch (CR1&0xFF)
-        //			{
-        //				case 0:
-        //					{
-        //						// lead out is 2 sec after the last track
-        //						int32_t fad=(AspiTOC->track[AspiTOC->last].addr[1]<<16)|
-        //								(AspiTOC->track[AspiTOC->last].addr[1]<<8)|
-        //								AspiTOC->track[AspiTOC->last].addr[3];
-        //						fad+=150;
-        //						CR1=static_cast<uint16_t>(cdDriveStatus<<8);
-        //						CR2=0x0000;
-        //						CR3=0x0100|static_cast<uint16_t>(fad>>16);
-        //						CR4=static_cast<uint16_t>(fad);
-        //					}
-        //					break;
-        //				case 1:
-        //					CR1=cdDriveStatus<<8;
-        //					CR2=0x0000;
-        //					CR3=0x0100;
-        //					CR4=0x0000;
-        //					break;
-        //				default:
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Invalid session number");
-        //					#endif
-        //					CR1=cdDriveStatus<<8;
-        //					CR2=0x0000;
-        //					CR3=0xFFFF;
-        //					CR4=0xFFFF;
-        //					break;
-        //			}
-        //
-        //
-        //			// flags setup
-        //			HIRQREQ|=CMOK;
-        //			break;
-        //		case 0x4: // Initialize CD System
-        //			// Status(8) | Flags(4) | Rep Cnt(4)
-        //			// Ctrl Addr(8) | Track No(8)
-        //			// Index No(8) | Upper Byte of curre,t FAD (8)
-        //			// Lower word of current FAD
-        //
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Initialize CD System=- executed");
-        //
-        //			if(!(CR1 & 0x80))
-        //			{
-        //				EmuState::pLog->CdBlockWrite("change initialization flag");
-        //				(CR1&0x1) ? EmuState::pLog->CdBlockWrite("software reset"):EmuState::pLog->CdBlockWrite("no software
-        // reset"); 				(CR1&0x2) ? EmuState::pLog->CdBlockWrite("decode subcode
-        // RW"):EmuState::pLog->CdBlockWrite("no
-        // decode subcode RW"); 				(CR1&0x4) ? EmuState::pLog->CdBlockWrite("no recognize mode 2
-        // subheader"):EmuState::pLog->CdBlockWrite("recognize
-        // mode 2 subheader"); 				(CR1&0x8) ? EmuState::pLog->CdBlockWrite("retry form 2
-        // read"):EmuState::pLog->CdBlockWrite("no retry form 2 read"); 				(CR1&0x80) ?
-        // EmuState::pLog->CdBlockWrite("no change"):EmuState::pLog->CdBlockWrite("change"); }else
-        // EmuState::pLog->CdBlockWrite("don't change initialization flag"); #endif
-        //
-        //			switch(CR1 & 0x3)
-        //			{
-        //			case 0:
-        //			case 2:
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Drive speed : 2X");
-        //				#endif
-        //				driveSpeed = DBL_PLAY_SPEED;
-        //				UpdatePeriod();
-        //				break;
-        //			case 1:
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Drive speed : 1X");
-        //				#endif
-        //				driveSpeed = STD_PLAY_SPEED;
-        //				UpdatePeriod();
-        //				break;
-        //			default:
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Invalid drive speed");
-        //				#endif
-        //				break;
-        //			}
-        //
-        //			// standby time
-        //			switch (CR2)
-        //			{
-        //				case 0:
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Default standby time (180s)");
-        //					#endif
-        //					standbyTime=180;
-        //					break;
-        //				case 0xFFFF:
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("No standby time change");
-        //					#endif
-        //					break;
-        //				default:
-        //					standbyTime=CR2;
-        //					//log("new standby time: %ds\n",standbyTime);
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("New standby time : ",standbyTime);
-        //					#endif
-        //					break;
-        //			}
-        //
-        //			// ECC setup
-        //			switch (CR4>>8)
-        //			{
-        //				case 0:
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Default ECC setup frequency (1 time)");
-        //					#endif
-        //					ECCFreq=1;
-        //					break;
-        //				case 0x80:
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("No ECC setup");
-        //					#endif
-        //					ECCFreq=0;
-        //					break;
-        //				case 0xFF:
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("No ECC setup frequency change");
-        //					#endif
-        //					break;
-        //				default:
-        //					ECCFreq=CR4>>8;
-        //					if (ECCFreq<2) ECCFreq=2;
-        //					else if (ECCFreq>6) ECCFreq=6;
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("ECC setup frequency changed : ",ECCFreq);
-        //					#endif
-        //					break;
-        //			}
-        //
-        //			// retry frequency
-        //			if (!(CR4&0xF0))
-        //			{
-        //				if (!(CR4&0x0F)) {
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Stops data output without retrying when error");
-        //					#endif
-        //					retryFreq=RETRY_FREQ_NO_RETRY; }
-        //				else {
-        //					retryFreq=CR4&0xF;
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("No data output with new retry value when error");
-        //					#endif
-        //				}
-        //			}
-        //			else if (CR4&0x80)
-        //			{
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Infinite retry frequency");
-        //				#endif
-        //				retryFreq=RETRY_FREQ_INFINITE;
-        //			}
-        //			else if (CR4&0x40)
-        //			{
-        //				if (CR4==0x40) {
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Data output without retry when error");
-        //					#endif
-        //					retryFreq=RETRY_FREQ_DATA_OUT_NO_RETRY; }
-        //				else {
-        //					retryFreq=CR4&0xF;
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Data output with new retry value when error : ", retryFreq);
-        //					#endif
-        //				}
-        //			}
-        //			#ifdef _LOGS
-        //			else if ((CR4&0xFF)==0xFF) EmuState::pLog->CdBlockWrite("No retry frequency change");
-        //			#endif
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			break;
+        case get_toc: getToc(); break;
+        case get_session_info: getSessionInfo(); break;
+        case init_system: initializeCdSystem(); break;
         //		case 0x5: // Open CD Tray
         //			// Status(8) | Flags(4) | Rep Cnt(4)
         //			// Ctrl Addr(8) | Track No(8)
@@ -419,220 +306,8 @@ void Cdrom::executeCommand() {
             endDataTransfer();
             break;
         }
-        //		case 0x10: // Play Disc
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Play Disc=- executed");
-        //			#endif
-        //
-        //			if (CR1==0x1000)
-        //			{
-        //				// track mode
-        //				currentPlayMode=PLAY_MODE_TRACK;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("track mode");
-        //				EmuState::pLog->CdBlockU("track mode");
-        //				#endif
-        //
-        //				HIRQREQ&=~SCDQ;
-        //				HIRQREQ&=~CSCT;
-        //				HIRQREQ&=~PEND;
-        //				HIRQREQ&=~DRDY;
-        //				cdDriveStatus &=~STAT_TRNS;
-        //
-        //			}
-        //			else
-        //			{
-        //				// FAD mode
-        //				currentPlayMode=PLAY_MODE_FAD;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("FAD mode\n");
-        //				#endif
-        //				uint32_t newFAD=((CR1&0x7F)<<16)|CR2;
-        //				uint32_t numOfFAD=CR4;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("FAD: 0x",newFAD);
-        //				EmuState::pLog->CdBlockWrite("number of FADs to play through: ",numOfFAD);
-        //				#endif
-        //
-        //				if (numOfFAD==0xFFFF) MessageBox(NULL,L"unimplemented",L"unimplemented",MB_ICONWARNING);
-        //
-        //				if (numOfFAD)
-        //				{
-        //					// play
-        //					cdDriveStatus=STAT_PLAY;
-        //					flag=FLAG_CDROM;
-        //
-        //					HIRQREQ&=~SCDQ;
-        //					HIRQREQ&=~CSCT;
-        //					HIRQREQ&=~PEND;
-        //					HIRQREQ&=~DRDY;
-        //
-        //					remainingFADs=numOfFAD;
-        //					FAD=newFAD;
-        //					playFADStart=FAD;
-        //				}
-        //				else
-        //				{
-        //					// pause
-        //					cdDriveStatus=STAT_PAUSE;
-        //
-        //					HIRQREQ&=~SCDQ;
-        //					HIRQREQ&=~CSCT;
-        //					HIRQREQ|=PEND;
-        //				}
-        //			}
-        //
-        //			uint8_t playMode;
-        //			playMode=CR3>>8;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("play mode: 0x",playMode);
-        //			#endif
-        //
-        //			if (playMode==CDC_PM_NOCHG)
-        //			{
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("no change in play mode");
-        //				#endif
-        //			}
-        //			else
-        //			{
-        //				switch (playMode&0x7F)
-        //				{
-        //					case 0x00:
-        //						#ifdef _LOGS
-        //						EmuState::pLog->CdBlockWrite("no repeat (plays only one time)");
-        //						#endif
-        //						repCnt=0;
-        //						break;
-        //					case 0x0F:
-        //						#ifdef _LOGS
-        //						EmuState::pLog->CdBlockWrite("infinite repetition");
-        //						#endif
-        //						repCnt=0xF;
-        //						break;
-        //					case CDC_PM_REP_NOCHG:
-        //						#ifdef _LOGS
-        //						EmuState::pLog->CdBlockWrite("doesn't change maximum repeat count");
-        //						#endif
-        //						break;
-        //					default:
-        //						#ifdef _LOGS
-        //						EmuState::pLog->CdBlockWrite("repeat count: ",playMode&0xF);
-        //						#endif
-        //						repCnt=playMode&0xF;
-        //						break;
-        //				}
-        //				// pickup move?
-        //				#ifdef _LOGS
-        //				if (playMode&CDC_PM_PIC_NOCHG)
-        //				{
-        //					EmuState::pLog->CdBlockWrite("doesn't move pickup to start position");
-        //				}
-        //				else
-        //				{
-        //					EmuState::pLog->CdBlockWrite("play again");
-        //				}
-        //				#endif
-        //			}
-        //
-        //			HIRQREQ|=CMOK;
-        //			SendStatus();
-        //			break;
-        //		case 0x11: // Disc Seek
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Disc Seek=- executed");
-        //			#endif
-        //
-        //			if ((CR1&0xFF)==0xFF)
-        //			{
-        //				// pause
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("pause");
-        //				#endif
-        //				cdDriveStatus=STAT_PAUSE;
-        //				uint32_t  newFad=((CR1&0x7F)<<16)|CR2;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("fad mode");
-        //				EmuState::pLog->CdBlockWrite("fad: 0x",newFad);
-        //				#endif
-        //				if (newFad==0x7FFFFF)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("seek home directory");
-        //					#endif
-        //					//FAD=150;
-        //					FAD = 0;
-        //					// debug
-        //					tno=1;
-        //				}
-        //				else FAD=newFad;
-        //				// stop current transfert if any
-        //				if (remainingFADs)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("cancel current play!");
-        //					#endif
-        //					remainingFADs=0;
-        //				}
-        //				HIRQREQ|=PEND|DRDY;
-        //				HIRQREQ|=EHST|EFLS;
-        //				cdDriveStatus |=STAT_TRNS;
-        //			}
-        //			else if (CR1==0x1100)
-        //			{
-        //				cdDriveStatus=STAT_PAUSE;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("track mode");
-        //				EmuState::pLog->CdBlockWrite("start track: ",CR2>>8);
-        //				EmuState::pLog->CdBlockWrite("start index: ",CR2&0xFF);
-        //				#endif
-        //
-        //				tno=CR2>>8;
-        //				// set corresponding fad
-        //				uint32_t newFAD;
-        //				newFAD=saturnTOC[(tno-1)*4+1];
-        //				newFAD<<=8;
-        //				newFAD|=saturnTOC[(tno-1)*4+2];
-        //				newFAD<<=8;
-        //				newFAD|=saturnTOC[(tno-1)*4+3];
-        //
-        //				FAD=newFAD;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("start track: 0x",newFAD);
-        //				#endif
-        //			}
-        //			else
-        //			{
-        //				cdDriveStatus=STAT_PAUSE;
-        //				uint32_t newFad=((CR1&0x7F)<<16)|CR2;
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("fad mode");
-        //				EmuState::pLog->CdBlockWrite("fad: 0x",newFad);
-        //				#endif
-        //				if (newFad==0x7FFFFF)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("seek home directory");
-        //					#endif
-        //					FAD=150;
-        //				}
-        //				else FAD=newFad;
-        //				// stop current transfert if any
-        //				if (remainingFADs)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("cancel current play!");
-        //					#endif
-        //					remainingFADs=0;
-        //				}
-        //				HIRQREQ|=PEND|DRDY;
-        //				HIRQREQ|=EHST|EFLS;
-        //				cdDriveStatus |=STAT_TRNS;
-        //			}
-        //
-        //			HIRQREQ|=CMOK;
-        //			SendStatus();
-        //			break;
+        case cd_play: playDisc(); break;
+        case seek: seekDisc(); break;
         //		case 0x12: // CD Scan
         //			MessageBox(NULL,L"CDScan",L"unimplemented",MB_ICONWARNING);
         //			#ifdef _LOGS
@@ -661,660 +336,112 @@ void Cdrom::executeCommand() {
         //			}
         //
         //			break;
-        //		case 0x30: // Set CD Device Connection
-        //			currentFilter=CR3>>8;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("CD device connection set to filter no",currentFilter);
-        //			#endif
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set CD Device Connection=- executed");
-        //			#endif
-        //			break;
-        //		case 0x31: // Get CD Device Connection
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get CD Device Connection=- executed");
-        //			EmuState::pLog->CdBlockU("-=Get CD Device Connection=-");
-        //			#endif
-        //			break;
-        //		case 0x32: // Get Last Buffer Destination
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get Last Buffer Destination=- executed");
-        //			#endif
-        //
-        //			CR1=cdDriveStatus<<8;
-        //			CR2=0;
-        //			CR3=static_cast<uint16_t>(lastFetchedBuffer<<8);
-        //			CR4=0;
-        //
-        //			//HIRQREQ|=CMOK|ESEL;
-        //			HIRQREQ|=CMOK;
-        //			break;
-        //		case 0x40: // Set Filter Range
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set Filter Range=- executed");
-        //			#endif
-        //
-        //			uint8_t filterNum;
-        //			filterNum=CR3>>8;
-        //
-        //			filters[filterNum].FAD=((CR1&0xFF)<<16)|CR2;
-        //			filters[filterNum].FADRange=((CR3&0xFF)<<16)|CR4;
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			break;
-        //		case 0x41: // Get Filter Range
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get Filter Range=- executed");
-        //			EmuState::pLog->CdBlockU("-=Get Filter Range=-");
-        //			#endif
-        //			break;
-        //		case 0x42: // Set Filter Subheader Conditions
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set Filter Subheader Conditions=- executed");
-        //			#endif
-        //
-        //			filterNum=CR3>>8;
-        //
-        //			filters[filterNum].fileNumber=CR3&0xFF;
-        //			filters[filterNum].channelNumber=CR1&0xFF;
-        //			filters[filterNum].subModeMask=CR2>>8;
-        //			filters[filterNum].subModeCompValue=CR4>>8;
-        //			filters[filterNum].codingInfoMask=CR2&0xFF;
-        //			filters[filterNum].codingInfoCompValue=CR4&0xFF;
-        //
+        case set_connection: setCdDeviceConnection(); break;
+        case get_connection: getCdDeviceConnection(); break;
+        case get_last_buffer_destination: getLastBufferDestination(); break;
+        case set_filter_range: setFilterRange(); break;
+        case get_filter_range: getFilterRange(); break;
+        case set_filter_subheader_condition: setFilterSubheaderConditions(); break;
+        case get_filter_subheader_condition: getFilterSubheaderConditions(); break;
+        case set_filter_mode: setFilterMode(); break;
+        case get_filter_mode: getFilterMode(); break;
+        case set_filter_connection: setFilterConnection(); break;
+        case get_filter_connection: getFilterConnection(); break;
+        case reset_selector: resetSelector(); break;
+        case get_buffer_size: getBufferSize(); break;
+        case get_sector_number: getSectorNumber(); break;
+        case calculate_actual_size: calculateActualSize(); break;
+        case get_actual_size: getActualSize(); break;
+        case get_sector_info: getSectorInfo(); break;
+        //		case 0x55: // Execute FAD Search
         //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("conditions:");
-        //			EmuState::pLog->CdBlockWrite("fileNumber: 0x",filters[filterNum].fileNumber);
-        //			EmuState::pLog->CdBlockWrite("channelNumber: 0x",filters[filterNum].channelNumber);
-        //			EmuState::pLog->CdBlockWrite("subModeMask: 0x",filters[filterNum].subModeMask);
-        //			EmuState::pLog->CdBlockWrite("subModeCompValue: 0x",filters[filterNum].subModeCompValue);
-        //			EmuState::pLog->CdBlockWrite("codingInfoMask: 0x",filters[filterNum].codingInfoMask);
-        //			EmuState::pLog->CdBlockWrite("codingInfoCompValue: 0x",filters[filterNum].codingInfoCompValue);
+        //			EmuState::pLog->CdBlockU("-=Execute FAD Search=-");
+        //			EmuState::pLog->CdBlockWrite("-=Execute FAD Search=- executed (UNIMPLEMENTED)");
         //			#endif
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
         //			break;
-        //		case 0x43: // Get Filter Subheader Conditions
+        //		case 0x56: // Get FAD Search Results
         //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get Filter Subheader Conditions=- executed");
-        //			EmuState::pLog->CdBlockU("-=Get Filter Subheader Conditions=-");
+        //			EmuState::pLog->CdBlockU("-=Get FAD Search Results=-");
+        //			EmuState::pLog->CdBlockWrite("-=Get FAD Search Results=- executed  (UNIMPLEMENTEE)");
         //			#endif
         //			break;
-        //		case 0x44: // Set Filter Mode
+        case set_sector_length: setSectorLength(); break;
+        case get_sector_data: getSectorData(false); break;
+        case delete_sector_data: deleteSectorData(); break;
+        case get_then_delete_sector_data: getSectorData(true); break;
+        case copy_sector_data: copySectorData(false); break;
+        case move_sector_data: copySectorData(true); break;
+        case get_copy_error: getCopyError(); break;
+        //		case 0x70: // Change Directory
         //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set Filter Mode=- executed");
+        //			EmuState::pLog->CdBlockWrite("-=Change Directory=- executed");
         //			#endif
-        //			uint8_t mode;
-        //			mode=CR1&0xFF;
-        //			filterNum=CR3>>8;
+        //			int32_t fileId;
+        //			fileId=((CR3&0xFF)<<16)|CR4;
         //
-        //			if (mode&0x80)
+        //			switch (fileId)
         //			{
-        //				// initialise filter conditions
-        //				filters[filterNum].trueOutput=filterNum;
-        //				filters[filterNum].falseOutput=FILTER_NOT_CONNECTED;
-        //				filters[filterNum].mode=0;
-        //				filters[filterNum].FAD=0;
-        //				filters[filterNum].FADRange=0;
-        //				filters[filterNum].fileNumber=0;
-        //				filters[filterNum].channelNumber=0;
-        //				filters[filterNum].subModeMask=0;
-        //				filters[filterNum].subModeCompValue=0;
-        //				filters[filterNum].codingInfoMask=0;
-        //				filters[filterNum].codingInfoCompValue=0;
+        //				case 0xFFFFFF:
+        //					// move to root directory
+        //					SendStatus();
+        //					break;
+        //				default:
+        //					MessageBox(NULL,L"ChangeDirectory: change to another directory than root
+        // directory",L"warning",MB_ICONWARNING); 					break;
         //			}
-        //			else filters[filterNum].mode=mode;
         //
-        //			HIRQREQ|=CMOK|ESEL;
+        //			HIRQREQ|=CMOK|EFLS;
         //			SendStatus();
         //			break;
-        //		case 0x45: // Get Filter Mode
+        //		case 0x71: // Read Directory
         //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set Filter Mode=- executed");
-        //			EmuState::pLog->CdBlockU("-=Set Filter Mode=-");
+        //			EmuState::pLog->CdBlockU("-=Read Directory=-");
+        //			EmuState::pLog->CdBlockWrite("-=Read Directory=- executed (UNIMPLEMENTED)");
         //			#endif
         //			break;
-        //		case 0x46: // Set Filter Connection
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set Filter Connection=- executed");
-        //			#endif
-        //			uint8_t buffNum,falsec;
-        //			filterNum=CR3>>8;
-        //			buffNum=CR2>>8;
-        //			falsec=CR2&0xFF;
+        //		case 0x72: // Get File System Scope
+        //			CR1=cdDriveStatus<<8;
+        //			CR2=0x0063;
+        //			CR3=0x0100;
+        //			CR4=0x0002;
         //
-        //			if (CR1&0x1) filters[filterNum].trueOutput=buffNum;
-        //			if (CR1&0x1) filters[filterNum].falseOutput=falsec;
+        //			HIRQREQ|=CMOK|EFLS;
         //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			break;
-        //		case 0x47: // Get Filter Connection
         //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockU("-=Get Filter Connection=-");
-        //			EmuState::pLog->CdBlockWrite("-=Get Filter Connection=- executed");
+        //			EmuState::pLog->CdBlockWrite("-=Get File System Scope=- executed");
         //			#endif
         //			break;
-        //		case 0x48: // Reset Selector
-        //			// Status(8) | Flags(4) | Rep Cnt(4)
-        //			// Ctrl Addr(8) | Track No(8)
-        //			// Index No(8) | Upper Byte of curre,t FAD (8)
-        //			// Lower word of current FAD
-        //
+        //		case 0x73: // Get File Info
         //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Reset Selector=- executed");
+        //			EmuState::pLog->CdBlockWrite("-=Get File Info=- executed");
         //			#endif
         //
-        //			uint8_t resetFlag;
-        //			resetFlag=CR1&0xFF;
+        //			//uint32_t fileId;
+        //			fileId=((CR3&0xFF)<<16)|CR4;
         //
-        //			if (resetFlag==0)
+        //			if (fileId==0xFFFFFF)
         //			{
-        //				// all specified buffer partition data is cleared
-        //				int32_t buffPart=CR3>>8;
-        //
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Clearing buffer partition data of buffer no",buffPart);
-        //				#endif
-        //
-        //				for (int32_t j=0;j<MAX_SECTORS;j++)
-        //				{
-        //					if (bufferPartitions[buffPart].sectors[j])
-        //					{
-        //						// we erase corresponding sector in the sector buffer
-        //						#ifdef _LOGS
-        //						EmuState::pLog->CdBlockWrite("Erasing in sector buffer sector no",j);
-        //						#endif
-        //
-        //						memset(bufferPartitions[buffPart].sectors[j]->data,0,SECTOR_SIZE);
-        //						bufferPartitions[buffPart].sectors[j]->size=0;
-        //						bufferPartitions[buffPart].sectors[j]->FAD=INVALID_FAD;
-        //						bufferPartitions[buffPart].sectors[j]->fileNumber=0;
-        //						bufferPartitions[buffPart].sectors[j]->subMode=0;
-        //						bufferPartitions[buffPart].sectors[j]->codingInfo=0;
-        //
-        //						bufferPartitions[buffPart].sectors[j]=NULL;
-        //						bufferPartitions[buffPart].size--;
-        //					}
-        //				}
+        //				MessageBox(NULL,L"GetFileInfo: return all 256 files info",L"unimplemented",MB_ICONWARNING);
         //			}
         //			else
         //			{
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Buffer partition number is ignored");
-        //				#endif
-        //
-        //				if (resetFlag&0x4)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Initialize data of all buffer partitions");
-        //					#endif
-        //					for (int32_t i=0;i<MAX_SELECTORS;i++)
-        //					{
-        //						for (int32_t j=0;j<MAX_SECTORS;j++) bufferPartitions[i].sectors[j]=NULL;
-        //						bufferPartitions[i].size=0;
-        //					}
-        //					for (int32_t j=0;j<MAX_SECTORS;j++)
-        //					{
-        //						memset(sectorsBuffer[j].data,0,SECTOR_SIZE);
-        //						sectorsBuffer[j].size=0;
-        //						sectorsBuffer[j].FAD=INVALID_FAD;
-        //						sectorsBuffer[j].fileNumber=0;
-        //						sectorsBuffer[j].subMode=0;
-        //						sectorsBuffer[j].codingInfo=0;
-        //					}
-        //				}
-        //				if (resetFlag&0x8) EmuState::pLog->CdBlockWrite("Initialize data of all buffer partitions output
-        // connectors (unsupported)");// ?? 				if (resetFlag&0x10)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Initialize all filter conditions");
-        //					#endif
-        //					for (int32_t i=0;i<MAX_SELECTORS;i++)
-        //					{
-        //						filters[i].FAD=0;
-        //						filters[i].FADRange=0;
-        //						filters[i].fileNumber=0;
-        //						filters[i].channelNumber=0;
-        //						filters[i].subModeMask=0;
-        //						filters[i].subModeCompValue=0;
-        //						filters[i].codingInfoMask=0;
-        //						filters[i].codingInfoCompValue=0;
-        //					}
-        //				}
-        //				#ifdef _LOGS
-        //				if (resetFlag&0x20) EmuState::pLog->CdBlockWrite("Initialize all filter input connectors
-        //(unsupported)");//
-        //?? 				#endif 				if (resetFlag&0x40)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Initialize true output connectors of all filters");
-        //					#endif
-        //					for (int32_t i=0;i<MAX_SELECTORS;i++) filters[i].trueOutput=i;
-        //				}
-        //				if (resetFlag&0x80)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("Initialize false output connectors of all filters");
-        //					#endif
-        //					for (int32_t i=0;i<MAX_SELECTORS;i++) filters[i].falseOutput=FILTER_NOT_CONNECTED;
-        //				}
+        //				BuildFileInfos(fileId);
+        //				dataBufferSize=6;
         //			}
         //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			break;
-        //		case 0x50: // Get CD Block size
-        //			CR1=cdDriveStatus<<8;
-        //			CR2=static_cast<uint16_t>(FreeNumOfSectorsInBuffer());
-        //			CR3=0x18<<8;
-        //			CR4=0xC8;
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			//HIRQREQ|=CMOK;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get CD Block Size=- executed");
-        //			EmuState::pLog->CdBlockWrite("number of free sectors: 0x",CR2);
-        //			#endif
-        //			break;
-        //		case 0x51: // Get buffer size
-        //			int32_t buffNum2;
-        //			buffNum2=CR3>>8;
+        //			bytesTransfered=0;
+        //			posInDataBuffer=0;
+        //			dataBuffer=filesInfos;
         //
+        //			cdDriveStatus|=STAT_TRNS;
         //			CR1=cdDriveStatus<<8;
-        //			CR2=0x0000;
-        //			CR3=0x0000;
-        //			CR4=static_cast<uint16_t>(bufferPartitions[buffNum2].size);
+        //			CR2=6;
+        //			CR3=0;
+        //			CR4=0;
         //
-        //			if(CR4) cdDriveStatus |= STAT_TRNS;
-        //			//HIRQREQ|=CMOK|ESEL;
-        //			HIRQREQ|=CMOK;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get buffer size=- executed");
-        //			EmuState::pLog->CdBlockWrite("buffer no 0x",buffNum2);
-        //			EmuState::pLog->CdBlockWrite("size = 0x",bufferPartitions[buffNum2].size);
-        //			#endif
+        //			HIRQREQ|=CMOK|DRDY;
         //			break;
-        //		case 0x52: // Calculate actual size
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Calculate actual size=- executed");
-        //			#endif
-        //
-        //			uint16_t sectorPosInBuffer;
-        //			uint8_t buffer;
-        //			uint16_t numberOfSectors;
-        //
-        //			sectorPosInBuffer=CR2;
-        //			buffer=CR3>>8;
-        //			numberOfSectors=CR4;
-        //
-        //			if (sectorPosInBuffer==0xFFFF) MessageBox(NULL,L"CalculateActualSize:
-        // sectorPosInBuffer==0xFFFF",L"unimplemented",MB_ICONWARNING); 			if (numberOfSectors==0xFFFF)
-        // MessageBox(NULL,L"CalculateActualSize: numberOfSectors==0xFFFF",L"unimplemented",MB_ICONWARNING);
-        //
-        //			actualSize=0;
-        //
-        //			// Is the range included in one partition
-        //			int32_t i;
-        //			if((sectorPosInBuffer+numberOfSectors) <= bufferPartitions[buffer].size){
-        //				for(i=sectorPosInBuffer; i<(sectorPosInBuffer+numberOfSectors);i++){
-        //					if(bufferPartitions[buffer].sectors[i]) actualSize+=bufferPartitions[buffer].sectors[i]->size;
-        //				}
-        //			}else{
-        //				// Range exceeds one partition
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("Range exceeded !!!");
-        //				EmuState::pLog->CdBlockU("Range exceeded !!!");
-        //				#endif
-        //				if((sectorPosInBuffer+numberOfSectors) <= bufferPartitions[buffer].size){
-        //					for(i=sectorPosInBuffer; i<(sectorPosInBuffer+numberOfSectors);i++){
-        //						if(bufferPartitions[buffer].sectors[i]) actualSize+=bufferPartitions[buffer].sectors[i]->size;
-        //					}
-        //				}
-        //			}
-        //
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("buffer partition number: 0x",buffer);
-        //			EmuState::pLog->CdBlockWrite("sector position: 0x",sectorPosInBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector number: 0x",numberOfSectors);
-        //			EmuState::pLog->CdBlockWrite("actual size: 0x",actualSize);
-        //			#endif
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			break;
-        //		case 0x53: // Get actual block size
-        //			CR1=cdDriveStatus<<8;
-        //			CR1|=((actualSize/2)>>16)&0xFF;
-        //			//CR2=(actualSize/2)&0xFFFF;
-        //			CR2=static_cast<uint16_t>(actualSize/2);
-        //			CR3=0;
-        //			CR4=0;
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get actual block size=- executed");
-        //			#endif
-        //			break;
-        //		case 0x54: // Get sector info (added 09/01/2005)
-        //			uint8_t sectorNum;
-        //			sectorNum = CR2 & 0xFF;
-        //			uint8_t bufferNum;
-        //			bufferNum = CR3>>8;
-        //
-        //			CR1=cdDriveStatus<<8;
-        //			CR1|=bufferPartitions[bufferNum].sectors[sectorNum]->FAD>>16;
-        //			CR2=(uint16_t)(bufferPartitions[bufferNum].sectors[sectorNum]->FAD & 0xFFFF);
-        //			CR3=bufferPartitions[bufferNum].sectors[sectorNum]->fileNumber << 8 |
-        // bufferPartitions[bufferNum].sectors[sectorNum]->channelNumber;
-        // CR4=bufferPartitions[bufferNum].sectors[sectorNum]->subMode
-        // << 8 | bufferPartitions[bufferNum].sectors[sectorNum]->codingInfo;
-        //
-        //			HIRQREQ|=CMOK|ESEL;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get sector info=- executed");
-        //			#endif
-        //			break;
-        //		case 0x55: // Execute FAD Search
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockU("-=Execute FAD Search=-");
-        //			EmuState::pLog->CdBlockWrite("-=Execute FAD Search=- executed (UNIMPLEMENTED)");
-        //			#endif
-        //			break;
-        //		case 0x56: // Get FAD Search Results
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockU("-=Get FAD Search Results=-");
-        //			EmuState::pLog->CdBlockWrite("-=Get FAD Search Results=- executed  (UNIMPLEMENTEE)");
-        //			#endif
-        //			break;
-        //		case 0x60: // Set Sector Length
-        //			// Status(8) | Flags(4) | Rep Cnt(4)
-        //			// Ctrl Addr(8) | Track No(8)
-        //			// Index No(8) | Upper Byte of curre,t FAD (8)
-        //			// Lower word of current FAD
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Set Sector Length=- executed");
-        //			#endif
-        //
-        //			// get length
-        //			switch (CR1&0xFF)
-        //			{
-        //				case SLEN_2048:
-        //					getSectorLength=2048;
-        //					break;
-        //				case SLEN_2336:
-        //					getSectorLength=2336;
-        //					MessageBox(NULL,L"sector length set to 2336",L"unimplemented",MB_ICONWARNING);
-        //					break;
-        //				case SLEN_2340:
-        //					getSectorLength=2340;
-        //					MessageBox(NULL,L"sector length set to 2340",L"unimplemented",MB_ICONWARNING);
-        //					break;
-        //				case SLEN_2352:
-        //					getSectorLength=2352;
-        //					MessageBox(NULL,L"sector length set to 2352",L"unimplemented",MB_ICONWARNING);
-        //					break;
-        //				case 0xFF:
-        //					break;
-        //			}
-        //			// set length
-        //			switch (CR2>>8)
-        //			{
-        //				case SLEN_2048:
-        //					putSectorLength=2048;
-        //					break;
-        //				case SLEN_2336:
-        //					putSectorLength=2336;
-        //					break;
-        //				case SLEN_2340:
-        //					putSectorLength=2340;
-        //					break;
-        //				case SLEN_2352:
-        //					putSectorLength=2352;
-        //					break;
-        //				case 0xFF:
-        //					break;
-        //			}
-        //			EmuState::pLog->CdBlockWrite("Get sector length: ",getSectorLength);
-        //			EmuState::pLog->CdBlockWrite("put sector length: ",putSectorLength);
-        //
-        //			// flags setup
-        //			HIRQREQ|=CMOK|ESEL;
-        //			SendStatus();
-        //			break;
-        //		case 0x61: // Get Sector Data
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get Sector Data=- executed");
-        //			#endif
-        //
-        //			int32_t sectorNumber;
-        //
-        //			sectorNumInBuffer=CR2;
-        //			sectorNumber=CR4;
-        //			fetchedBuffer=CR3>>8;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("buffer partition number:0x",fetchedBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector position:0x",sectorNumInBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector number:0x",sectorNumber);
-        //			#endif
-        //
-        //			// initiate data transfert from CD block to host
-        //			posInSector=0;
-        //			bytesTransfered=0;
-        //
-        //			cdDriveStatus|=STAT_TRNS;
-        //			HIRQREQ|=CMOK|EHST|DRDY;// DRDY??
-        //			SendStatus();
-        //			break;
-        //		case 0x62: // Delete Sector Data
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Delete Sector Data=- executed");
-        //			#endif
-        //
-        //			sectorNumInBuffer=CR2;
-        //			sectorNumber=CR4;
-        //			fetchedBuffer=CR3>>8;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("buffer partition number:0x",fetchedBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector position:0x",sectorNumInBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector number:0x",sectorNumber);
-        //			#endif
-        //
-        //			// data must be deleted after
-        //			numberOfSectorsToDelete=sectorNumber;
-        //			posOfSectorsToDelete=sectorNumInBuffer;
-        //
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("*deleting sectors in buffer partition no0x",fetchedBuffer);
-        //			EmuState::pLog->CdBlockWrite("old buffer size (in sectors): 0x",bufferPartitions[fetchedBuffer].size);
-        //			EmuState::pLog->CdBlockWrite("position of sector to delete in buffer: 0x",posOfSectorsToDelete);
-        //			EmuState::pLog->CdBlockWrite("number of sectors to delete: 0x",numberOfSectorsToDelete);
-        //			#endif
-        //			int32_t oldSize;
-        //			oldSize=bufferPartitions[fetchedBuffer].size;
-        //
-        //			for (int32_t j=posOfSectorsToDelete; j<(posOfSectorsToDelete+numberOfSectorsToDelete); j++)
-        //			{
-        //				if (j>MAX_SECTORS)
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("end of buffer partition reached");
-        //					#endif
-        //					break;
-        //				}
-        //				if (bufferPartitions[fetchedBuffer].sectors[j])
-        //				{
-        //					#ifdef _LOGS
-        //					EmuState::pLog->CdBlockWrite("deleting in buffer partion sector no",j);
-        //					#endif
-        //					bufferPartitions[fetchedBuffer].sectors[j]->size=0;
-        //					bufferPartitions[fetchedBuffer].sectors[j]=NULL;
-        //					bufferPartitions[fetchedBuffer].size--;
-        //				}
-        //				else break;
-        //			}
-        //
-        //			// we shift the sectors in buffer partition if necessary
-        //			if (numberOfSectorsToDelete<oldSize)
-        //			{
-        //				// we did not erase all the sectors
-        //				// we check if there a hole in buffer partition
-        //				EmuState::pLog->CdBlockWrite("all sectors haven't been deleted, checking for hole");
-        //				int32_t holeStart=0;
-        //				for (;holeStart<MAX_SECTORS;holeStart++)
-        //				{
-        //					if (!bufferPartitions[fetchedBuffer].sectors[holeStart]) break;
-        //				}
-        //				// holeStart contains the position of the hole
-        //				// let's check if the hole is positioned before the end of used sectors
-        //				if (holeStart<bufferPartitions[fetchedBuffer].size)
-        //				{
-        //					//log("there is a hole at sector no%d\n",holeStart);
-        //					// let's get the position of the end of the hole
-        //					int32_t holeEnd=holeStart;
-        //					for (;holeEnd<MAX_SECTORS;holeEnd++)
-        //					{
-        //						if (bufferPartitions[fetchedBuffer].sectors[holeEnd]) break;
-        //					}
-        //					// we shift the sectors
-        //					int32_t k=0;
-        //					//for (i=0;(i+holeEnd)<MAX_SECTORS;i++)
-        //					for (k=0; (k+holeEnd)<(holeEnd+bufferPartitions[fetchedBuffer].size); k++)
-        //					{
-        //						if ((k+holeEnd)>MAX_SECTORS) break;
-        //						bufferPartitions[fetchedBuffer].sectors[holeStart+k]=bufferPartitions[fetchedBuffer].sectors[holeEnd+k];
-        //						//EmuState::pLog->CdBlockWrite("sector no%d shifted to sector no%d\n",holeEnd+i,holeStart+i);
-        //					}
-        //					for (;k<MAX_SECTORS;k++)
-        //					{
-        //						bufferPartitions[fetchedBuffer].sectors[k]=NULL;
-        //					}
-        //				}
-        //			}
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("new buffer size: 0x",bufferPartitions[fetchedBuffer].size);
-        //			#endif
-        //			// buffer should not be full
-        //			//HIRQREQ&=~BFUL;
-        //
-        //			HIRQREQ|=CMOK|EHST; //  DRDY ??
-        //			SendStatus();
-        //			break;
-        //		case 0x63: // Get Then Delete Sector Data
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get Then Delete Sector Data=- executed");
-        //			#endif
-        //
-        //			sectorNumInBuffer=CR2;
-        //			sectorNumber=CR4;
-        //			fetchedBuffer=CR3>>8;
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("Buffer partition number: ",fetchedBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector position: ",sectorNumInBuffer);
-        //			EmuState::pLog->CdBlockWrite("sector number: ",sectorNumber);
-        //			#endif
-        //
-        //			// initiate data transfert from CD block to host
-        //			posInSector=0;
-        //			bytesTransfered=0;
-        //
-        //			// data must be deleted after
-        //			DeleteSectorDataExecuted=true;
-        //			numberOfSectorsToDelete=sectorNumber;
-        //			posOfSectorsToDelete=sectorNumInBuffer;
-        //
-        //			HIRQREQ|=CMOK|EHST|DRDY;
-        //			cdDriveStatus|=STAT_TRNS;
-        //			SendStatus();
-        //			break;
-        //		case 0x65: // Copy Sector Data
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockU("-=Copy Sector Data=-");
-        //			EmuState::pLog->CdBlockWrite("-=Copy Sector Data=- executed (UNIMPLEMENTED)");
-        //			#endif
-        //			break;
-        //		case 0x66: // Move Sector Data
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockU("-=Move Sector Data=-");
-        //			EmuState::pLog->CdBlockWrite("-=Move Sector Data=- executed (UNIMPLEMENTED)");
-        //			#endif
-        //			break;
-        case get_copy_error: getCopyError(); break;
-        //		case 0x70: // Change Directory
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Change Directory=- executed");
-        //			#endif
-        //			int32_t fileId;
-        //			fileId=((CR3&0xFF)<<16)|CR4;
-        //
-        //			switch (fileId)
-        //			{
-        //				case 0xFFFFFF:
-        //					// move to root directory
-        //					SendStatus();
-        //					break;
-        //				default:
-        //					MessageBox(NULL,L"ChangeDirectory: change to another directory than root
-        // directory",L"warning",MB_ICONWARNING); 					break;
-        //			}
-        //
-        //			HIRQREQ|=CMOK|EFLS;
-        //			SendStatus();
-        //			break;
-        //		case 0x71: // Read Directory
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockU("-=Read Directory=-");
-        //			EmuState::pLog->CdBlockWrite("-=Read Directory=- executed (UNIMPLEMENTED)");
-        //			#endif
-        //			break;
-        //		case 0x72: // Get File System Scope
-        //			CR1=cdDriveStatus<<8;
-        //			CR2=0x0063;
-        //			CR3=0x0100;
-        //			CR4=0x0002;
-        //
-        //			HIRQREQ|=CMOK|EFLS;
-        //
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get File System Scope=- executed");
-        //			#endif
-        //			break;
-        //		case 0x73: // Get File Info
-        //			#ifdef _LOGS
-        //			EmuState::pLog->CdBlockWrite("-=Get File Info=- executed");
-        //			#endif
-        //
-        //			//uint32_t fileId;
-        //			fileId=((CR3&0xFF)<<16)|CR4;
-        //
-        //			if (fileId==0xFFFFFF)
-        //			{
-        //				MessageBox(NULL,L"GetFileInfo: return all 256 files info",L"unimplemented",MB_ICONWARNING);
-        //			}
-        //			else
-        //			{
-        //				BuildFileInfos(fileId);
-        //				dataBufferSize=6;
-        //			}
-        //
-        //			bytesTransfered=0;
-        //			posInDataBuffer=0;
-        //			dataBuffer=filesInfos;
-        //
-        //			cdDriveStatus|=STAT_TRNS;
-        //			CR1=cdDriveStatus<<8;
-        //			CR2=6;
-        //			CR3=0;
-        //			CR4=0;
-        //
-        //			HIRQREQ|=CMOK|DRDY;
-        //			break;
-        //		case 0x74: // Read File
+        //		case 0x74: // Read File
         //			#ifdef _LOGS
         //			EmuState::pLog->CdBlockWrite("-=Read File=- executed");
         //			#endif
@@ -1367,7 +494,7 @@ void Cdrom::executeCommand() {
             //			EmuState::pLog->CdBlockWrite("Unknown command : ",CR1>>8);
             //			EmuState::pLog->CdBlockU("Unknown command : ",CR1>>8);
             //			#endif
-            Log::unimplemented("Cdblock command {:04x}", regs_.cr1 >> Cr::command_shft);
+            LOG_UNIMPLEMENTED("Cdblock command {:04x}", regs_.cr1 >> Cr::command_shft);
             break;
     }
     executed_commands_++;
@@ -1397,6 +524,7 @@ auto Cdrom::isCdInserted() const -> bool {
     //// AspiTOC=(Aspi_TOC*)&TOCData;
     // AspiTOC = reinterpret_cast<Aspi_TOC*>(&TOCData);
     // return bReturn;
+    if (access_method == CdromAccessMethod::image) { return DiscImage::isOpened(); }
     return false;
 }
 //
@@ -1441,48 +569,6 @@ auto Cdrom::isCdInserted() const -> bool {
 //	HIRQREQ|=DCHG;
 //}
 //
-// void CCdRom::BuildSaturnTOC()
-//{
-//	int32_t i;
-//	// tracks
-//	for (i=0;i<(AspiTOC->last-AspiTOC->first+1);i++)
-//	{
-//		// ctrl|adr
-//		saturnTOC[4*i]=(AspiTOC->track[i].adr_ctrl<<4)|(AspiTOC->track[i].adr_ctrl>>4);
-//		// track start frame address
-//		uint32_t fad=(AspiTOC->track[i].addr[1]<<16)|(AspiTOC->track[i].addr[2]<<8)|AspiTOC->track[i].addr[3];
-//		fad+=150;
-//		saturnTOC[4*i+1]=static_cast<uint8_t>(fad>>16);
-//		saturnTOC[4*i+2]=static_cast<uint8_t>(fad>>8);
-//		saturnTOC[4*i+3]=static_cast<uint8_t>(fad);
-//	}
-//
-//	// unused tracks
-//	for (;i<99;i++) saturnTOC[4*i]=saturnTOC[4*i+1]=saturnTOC[4*i+2]=saturnTOC[4*i+3]=0xFF;
-//
-//	// first/last track infos
-//	// first
-//	saturnTOC[4*99]=(AspiTOC->track[AspiTOC->first-1].adr_ctrl<<4)|(AspiTOC->track[AspiTOC->first-1].adr_ctrl>>4);
-//	saturnTOC[4*99+1]=AspiTOC->first;
-//	saturnTOC[4*99+2]=0;// PSEC ??
-//	saturnTOC[4*99+3]=0;// PFRAME ??
-//	// last
-//	saturnTOC[4*100]=(AspiTOC->track[AspiTOC->last-1].adr_ctrl<<4)|(AspiTOC->track[AspiTOC->last-1].adr_ctrl>>4);
-//	saturnTOC[4*100+1]=AspiTOC->last;
-//	saturnTOC[4*100+2]=0;// PSEC ??
-//	saturnTOC[4*100+3]=0;// PFRAME ??
-//
-//	// read out infos
-//	saturnTOC[4*101]=(AspiTOC->track[AspiTOC->last].adr_ctrl<<4)|(AspiTOC->track[AspiTOC->last].adr_ctrl>>4);
-//	uint32_t fad=(AspiTOC->track[AspiTOC->last].addr[1]<<16)|
-//						(AspiTOC->track[AspiTOC->last].addr[1]<<8)|
-//						AspiTOC->track[AspiTOC->last].addr[3];
-//	fad+=150;
-//	saturnTOC[4*101+1]=static_cast<uint8_t>(fad>>16);
-//	saturnTOC[4*101+2]=static_cast<uint8_t>(fad>>8);
-//	saturnTOC[4*101+3]=static_cast<uint8_t>(fad);
-//}
-//
 // void CCdRom::BuildFileSystemTree()
 //{
 //	string strBuff;
@@ -1570,161 +656,25 @@ auto Cdrom::isCdInserted() const -> bool {
 //
 //
 
-//
-// void CCdRom::CdBlockReadSectors(int32_t num)
-//{
-//	if (FindFreeSector()==NO_FREE_SECTOR)
-//	{
-//		// full!
-//		#ifdef _LOGS
-//		EmuState::pLog->CdBlockWrite("*CD block buffer is full!*");
-//		#endif
-//
-//		cdDriveStatus=STAT_PAUSE|STAT_TRNS;
-//		HIRQREQ|=BFUL;
-//		HIRQREQ|=EHST;
-//	}
-//	else
-//	{
-//		// not full, we read one sector if in play range
-//		if (remainingFADs)
-//		{
-//			// read num sectors
-//			int32_t n=0;
-//			int32_t freeSector=FindFreeSector();
-//
-//			string strBuff;
-//			while ((n<num)&&(freeSector!=NO_FREE_SECTOR)&&remainingFADs)
-//			{
-//				// read one sector data
-//				strBuff = Scsi::readSector(FAD,1);
-//				memcpy_s(sectorsBuffer[freeSector].data,2352,strBuff.c_str(),2048);
-//				sectorsBuffer[freeSector].size=2048;
-//
-//				// we bind the sector with the current buffer partition connected with the current filter
-//				int32_t posInBufferPartition=0;
-//				for (;posInBufferPartition<MAX_SECTORS;posInBufferPartition++)
-//				{
-//					if (bufferPartitions[filters[currentFilter].trueOutput].sectors[posInBufferPartition]==NULL) break;
-//				}
-//				bufferPartitions[filters[currentFilter].trueOutput].sectors[posInBufferPartition]=&sectorsBuffer[freeSector];
-//				bufferPartitions[filters[currentFilter].trueOutput].size=posInBufferPartition+1;
-//
-//				#ifdef _LOGS
-//				EmuState::pLog->CdBlockWrite("remaining FADs to play: ",remainingFADs);
-//				#endif
-//
-//				FAD++;
-//				remainingFADs--;
-//
-//				// one sector has been read
-//				HIRQREQ|=CSCT;
-//
-//				freeSector=FindFreeSector();
-//				n++;
-//			}
-//
-//			// check if no more sectors have to be read
-//			if (remainingFADs==0)
-//			{
-//				#ifdef _LOGS
-//				EmuState::pLog->CdBlockWrite("**CD reading is stopped**");
-//				#endif
-//				// stops reading
-//				//cdDriveStatus=STAT_PAUSE;
-//				cdDriveStatus=STAT_TRNS|STAT_PAUSE;
-//				HIRQREQ|=PEND|DRDY;
-//				HIRQREQ|=EHST|EFLS;
-//				HIRQREQ&=~BFUL;
-//			}
-//			else
-//			{
-//				cdDriveStatus=STAT_PLAY;
-//				HIRQREQ|=DRDY;
-//				HIRQREQ&=~EFLS;
-//				HIRQREQ&=~EHST;
-//			}
-//		}
-//		else
-//		{
-//			#ifdef _LOGS
-//			EmuState::pLog->CdBlockWrite("**CD reading is stopped**");
-//			#endif
-//			// stops reading
-//			cdDriveStatus=STAT_PAUSE|STAT_TRNS;
-//			HIRQREQ|=PEND|DRDY;
-//			HIRQREQ|=EHST|EFLS;
-//			HIRQREQ&=~BFUL;
-//		}
-//	}
-//}
-//
-// int32_t CCdRom::FindCurrentTrack()
-//{
-//	uint32_t realFAD=FAD-150;
-//
-//	for (int32_t i=0;i<(AspiTOC->last-AspiTOC->first+1);i++)
-//	{
-//		// track start frame address
-//		uint32_t fad1=(AspiTOC->track[i].addr[1]<<16)|(AspiTOC->track[i].addr[2]<<8)|AspiTOC->track[i].addr[3];
-//		uint32_t fad2=(AspiTOC->track[i+1].addr[1]<<16)|(AspiTOC->track[i+1].addr[2]<<8)|AspiTOC->track[i+1].addr[3];
-//		if ((realFAD>=fad1)&&(realFAD<fad2)) return i+1;
-//	}
-//	return 0xFF;
-//}
-//
-// int32_t CCdRom::FindFreeSector()
-//{
-//	for (int32_t i=0;i<MAX_SECTORS;i++)
-//	{
-//		if (sectorsBuffer[i].size==0) return i;
-//	}
-//	return NO_FREE_SECTOR;
-//}
-//
-//
-
 void Cdrom::initialize() {
     Log::info(Logger::cdrom, tr("CD-ROM initialization"));
     reset();
 }
 
-auto Cdrom::read8(const u32 addr) const -> u8 {
-    //	address&=0xFFFFF;
-    //
+auto Cdrom::read8(const u32 addr) -> u8 {
     switch (addr) {
         case fetch_data_pointer_address:
         case fetch_data_pointer_address + 1:
         case fetch_data_pointer_address + 2:
-        case fetch_data_pointer_address + 3:
-            //			{
-            //				uint8_t data=0;
-            //				if (posInSector>=2048)
-            //				{
-            //					posInSector=0;
-            //					sectorNumInBuffer++;
-            //				}
-            //				if (bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer])
-            //				{
-            //					data|=bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer]->data[posInSector];
-            //					bytesTransfered++;
-            //					posInSector++;
-            //					lastFetchedBuffer=fetchedBuffer;
-            //				}
-            //				return data;
-            //			}
-            break;
-
+        case fetch_data_pointer_address + 3: return readTransferData<u8>();
         default: Log::warning(Logger::cdrom, "Unmapped access {:#010x}", addr); return 0;
     }
-
-    return 0;
-} // namespace saturnin::cdrom
+}
 
 auto Cdrom::read16(const u32 addr) -> u16 {
     switch (addr) {
         case hirq_register_address:
-            Log::debug(Logger::cdrom, "HIrqReg={:#06x}", regs_.hirqreq.data());
+            LOG_DEBUG(Logger::cdrom, "HIrqReg={:#06x}", regs_.hirqreq.data());
             return regs_.hirqreq.data();
         case hirq_mask_register_address: return regs_.hirqmask.data();
         case command_register_1_address: return regs_.cr1.data();
@@ -1734,54 +684,17 @@ auto Cdrom::read16(const u32 addr) -> u16 {
             // firstReading = false;
             is_initialization_done_ = true;
             return regs_.cr4.data();
-        case toc_data_pointer_address:
-            //			{
-            //				uint16_t data=0;
-            //				// reading in data buffer
-            //				if ((uint32_t)posInDataBuffer<dataBufferSize)
-            //				{
-            //					data=dataBuffer[posInDataBuffer*2]<<8|dataBuffer[posInDataBuffer*2+1];
-            //				}
-            //				posInDataBuffer++;
-            //				bytesTransfered+=2;
-            //				return data;
-            //			}
-            //			break;
+        case fetch_data_pointer_address:
+        case toc_data_pointer_address: return readTransferData<u16>();
         default: Log::warning(Logger::cdrom, "Unmapped access {:#010x}", addr); return 0;
     }
-    return 0;
 }
 
-auto Cdrom::read32(const u32 addr) const -> u32 {
+auto Cdrom::read32(const u32 addr) -> u32 {
     switch (addr) {
-        case fetch_data_pointer_address:
-            //			{
-            //				uint32_t data=0;
-            //				if (posInSector>=2048)
-            //				{
-            //					posInSector=0;
-            //					sectorNumInBuffer++;
-            //				}
-            //				if (bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer])
-            //				{
-            //					data=bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer]->data[posInSector];
-            //					data<<=8;
-            //					data|=bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer]->data[posInSector+1];
-            //					data<<=8;
-            //					data|=bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer]->data[posInSector+2];
-            //					data<<=8;
-            //					data|=bufferPartitions[fetchedBuffer].sectors[sectorNumInBuffer]->data[posInSector+3];
-            //					bytesTransfered+=4;
-            //					posInSector+=4;
-            //					lastFetchedBuffer=fetchedBuffer;
-            //				}
-            //				return data;
-            //			}
-            break;
-
+        case fetch_data_pointer_address: return readTransferData<u32>();
         default: Log::warning(Logger::cdrom, "Unmapped access {:#010x}", addr); return 0;
     }
-    return 0;
 }
 
 void Cdrom::write8(const u32 addr, const u8 data) const {
@@ -1872,70 +785,36 @@ void Cdrom::write32(const u32 addr, const u32 data) const {
 }
 
 void Cdrom::run(const u8 cycles) {
+    TIMING_ZONE(core::TimingZone::cdrom_run);
     // Periodic response musn't be issued before the initialisation string is read from CR registers
     if (!is_initialization_done_) { return; }
 
     elapsed_cycles_ -= cycles;
     if (elapsed_cycles_ <= 0) {
-        Log::debug(Logger::cdrom, "Sending periodic response");
+        LOG_DEBUG(Logger::cdrom, "Sending periodic response");
         executed_commands_ = 0;
 
         regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
 
         elapsed_cycles_ += periodic_response_duration_;
 
-        //		// Sector reading
-        //		if((cdDriveStatus & STAT_PLAY) == STAT_PLAY){
-        //			if(currentPlayMode == PLAY_MODE_FAD){
-        //				// Sector reading
-        //				#ifdef _LOGS
-        //				EmuState::pLog->CdBlockWrite("#read one sector");
-        //				#endif
-        //
-        //				CdBlockReadSectors(1);
-        //
-        //			}else if(currentPlayMode == PLAY_MODE_TRACK){
-        //				//EmuState::pLog->CdBlockWrite("PLAY MODE TRACK (NOT IMPLEMENTED)");
-        //			}
-        //		}else if((cdDriveStatus & STAT_PAUSE) == STAT_PAUSE){
-        //			if(FindFreeSector()==NO_FREE_SECTOR){
-        //				// Buffer is full
-        //				HIRQREQ|=BFUL;
-        //				//HIRQREQ|=BFUL|DRDY;
-        //				//HIRQREQ&=~EFLS;
-        //				HIRQREQ|=EHST;
-        //				cdDriveStatus|=STAT_TRNS;
-        //			}else{
-        //				// has play to be resumed ?
-        //				if(remainingFADs){
-        //					cdDriveStatus = STAT_PLAY|STAT_TRNS;
-        //					HIRQREQ|=DRDY;
-        //					HIRQREQ&=~EFLS;
-        //					HIRQREQ&=~EHST;
-        //				}
-        //				HIRQREQ&=~BFUL;
-        //			}
-        //		}
+        // One sector is read by periodic response, which matches the drive speed. CD-DA is always played at standard
+        // speed, at double speed audio sectors are only read every other periodic response.
+        if ((cd_drive_status_ == Cr::CdDriveStatus::playing) || is_waiting_for_buffer_) {
+            const auto is_double_speed_audio = (cd_drive_play_mode_ == CdDrivePlayMode::double_play_speed)
+                                               && ((ctrl_adr_ & toc_control_data_track) == 0);
+            is_audio_response_skipped_ = is_double_speed_audio && !is_audio_response_skipped_;
+            if (!is_audio_response_skipped_) { playSector(); }
+        }
 
         // Periodic response is not sent while a command is being initialized
         if (is_command_being_initialized_) { return; }
 
         sendStatus();
-        regs_.cr1.upd(Cr::status_enum, Cr::CdDriveStatus::periodical_response);
+        regs_.cr1.upd(Cr::hiByte(status() | toUnderlying(Cr::CdDriveStatus::periodical_response)));
 
         // periodic response timing is the same as SCDQ update timing
         regs_.hirqreq.upd(HIrqReq::scdq_enum, Scdq::subcode_q_decoded);
-
-        //		if (FindFreeSector()==NO_FREE_SECTOR){
-        //
-        //				// buffer is full
-        //				//HIRQREQ|=BFUL|DRDY;
-        //				HIRQREQ|=BFUL;
-        //				//HIRQREQ&=~EFLS;
-        //				HIRQREQ|=EHST;
-        //				cdDriveStatus|=STAT_TRNS;
-        //				CR1|=STAT_TRNS<<8;
-        //		}
     }
 }
 
@@ -2053,18 +932,6 @@ auto Cdrom::getRegisters() const -> std::vector<std::string> {
 //	}
 //}
 //
-// int32_t CCdRom::FreeNumOfSectorsInBuffer()
-//{
-//	int32_t num=0;
-//	for (int32_t i=0;i<MAX_SECTORS;i++)
-//	{
-//		if (sectorsBuffer[i].size) num++;
-//	}
-//	num=0xC8-num;
-//	if (num<0) return 0;
-//	else return num;
-//}
-//
 // void CCdRom::BuildFileInfos(uint32_t fileId)
 //{
 //	filesInfos[0]=static_cast<uint8_t>(filesOnCD[fileId].LSN>>24);
@@ -2112,8 +979,21 @@ void Cdrom::reset() {
     constexpr auto cr4_default = u16{0x434B}; // 'CK'
     regs_.cr4                  = cr4_default;
 
-    cd_drive_status_    = Cr::CdDriveStatus::no_disc_inserted;
+    resetSelectors();
+    get_sector_length_     = user_data_size;
+    put_sector_length_     = user_data_size;
+    flag_                      = 0;
+    rep_cnt_                   = 0;
+    track_number_              = 0;
+    current_fad_               = first_track_fad;
+    play_end_fad_              = first_track_fad;
+    is_waiting_for_buffer_     = false;
+    is_audio_response_skipped_ = false;
+    buildSaturnToc();
+
+    cd_drive_status_    = isCdInserted() ? Cr::CdDriveStatus::paused : Cr::CdDriveStatus::no_disc_inserted;
     cd_drive_play_mode_ = CdDrivePlayMode::standby;
+    updateSubcodeQ();
 
     periodic_response_duration_ = calculatePeriodicResponseDuration();
     elapsed_cycles_             = periodic_response_duration_;
@@ -2139,11 +1019,293 @@ auto Cdrom::calculatePeriodicResponseDuration() -> u32 {
     }
 }
 
+auto Cdrom::readTransferBlock(std::span<u8> destination) -> u32 {
+    auto copied = u32{};
+    switch (transfer_.type) {
+        using enum TransferType;
+        case sectors: {
+            // Copied one sector part at a time, the slots of a partition aren't contiguous.
+            while ((copied < destination.size()) && (transfer_.slot != no_sector)) {
+                const auto& sector = buffer_.sector(transfer_.slot);
+                const auto  length = std::min(static_cast<u32>(destination.size() - copied),
+                                             static_cast<u32>(sector.size - transfer_.offset));
+                std::copy_n(sector.data.begin() + sector.data_offset + transfer_.offset, length, destination.begin() + copied);
+                copied += length;
+                transfer_.offset = static_cast<u16>(transfer_.offset + length);
+                transfer_.bytes_transferred += length;
+                if (transfer_.offset >= sector.size) {
+                    transfer_.offset = 0;
+                    --transfer_.sectors_remaining;
+                    transfer_.slot = (transfer_.sectors_remaining == 0) ? no_sector : sector.next;
+                }
+            }
+            break;
+        }
+        case toc: {
+            const auto remaining = (transfer_.offset < saturn_toc_size) ? saturn_toc_size - transfer_.offset : u32{};
+            const auto length    = std::min(static_cast<u32>(destination.size()), remaining);
+            for (; copied < length; ++copied) {
+                destination[copied] = readTransferData<u8>();
+            }
+            break;
+        }
+        default: break;
+    }
+    std::fill(destination.begin() + copied, destination.end(), u8{});
+    return copied;
+}
+
+template<typename T>
+auto Cdrom::readTransferData() -> T {
+    switch (transfer_.type) {
+        using enum TransferType;
+        case sectors: {
+            if (transfer_.slot == no_sector) { return 0; }
+            const auto& sector = buffer_.sector(transfer_.slot);
+            const auto  data   = core::rawRead<T>(sector.data, sector.data_offset + transfer_.offset);
+            transfer_.offset += sizeof(T);
+            transfer_.bytes_transferred += sizeof(T);
+            if (transfer_.offset >= sector.size) {
+                transfer_.offset = 0;
+                --transfer_.sectors_remaining;
+                transfer_.slot = (transfer_.sectors_remaining == 0) ? no_sector : sector.next;
+            }
+            return data;
+        }
+        case toc: {
+            if (transfer_.offset >= saturn_toc_size) { return 0; }
+            auto data = T{};
+            for (u8 i = 0; i < sizeof(T); ++i) {
+                const auto entry = saturn_toc_[transfer_.offset / sizeof(u32)];
+                const auto shift = 8 * (sizeof(u32) - 1 - transfer_.offset % sizeof(u32));
+                data             = static_cast<T>((data << 8) | static_cast<u8>(entry >> shift));
+                ++transfer_.offset;
+            }
+            transfer_.bytes_transferred += sizeof(T);
+            return data;
+        }
+        default: return 0;
+    }
+}
+
+void Cdrom::playSector() {
+    if (current_fad_ >= play_end_fad_) {
+        if (cd_drive_status_ == Cr::CdDriveStatus::playing) {
+            cd_drive_status_ = Cr::CdDriveStatus::paused;
+            regs_.hirqreq.upd(HIrqReq::pend_enum, Pend::cd_play_has_ended);
+        }
+        is_waiting_for_buffer_ = false;
+        return;
+    }
+
+    const auto slot = buffer_.allocate();
+    if (slot == no_sector) {
+        cd_drive_status_       = Cr::CdDriveStatus::paused;
+        is_waiting_for_buffer_ = true;
+        regs_.hirqreq.upd(HIrqReq::bful_enum, Bful::buffer_full);
+        return;
+    }
+    is_waiting_for_buffer_ = false;
+    cd_drive_status_       = Cr::CdDriveStatus::playing;
+
+    updateSubcodeQ();
+    auto& sector = buffer_.sector(slot);
+    readDiscSector(current_fad_, sector);
+    ++current_fad_;
+
+    // Audio sectors are played as they are read, whether they are stored or not.
+    if ((ctrl_adr_ & toc_control_data_track) == 0) { modules_.scsp()->receiveCddaSector(sector.data); }
+
+    // The sector goes through the filters chain until one of them accepts it. Hops are limited, as
+    // false outputs can loop.
+    auto filter = cd_device_connection_;
+    for (u8 hops = 0; (hops < MAX_SELECTORS) && (filter < MAX_SELECTORS); ++hops) {
+        const auto& current = filters_[filter];
+        if (isSectorAccepted(current, sector)) {
+            if (current.true_output >= MAX_SELECTORS) { break; }
+            buffer_.append(current.true_output, slot);
+            last_buffer_destination_ = current.true_output;
+            regs_.hirqreq.upd(HIrqReq::csct_enum, Csct::sector_stored);
+            if (buffer_.freeSectorsNumber() == 0) { regs_.hirqreq.upd(HIrqReq::bful_enum, Bful::buffer_full); }
+            return;
+        }
+        filter = current.false_output;
+    }
+
+    // Discarded
+    buffer_.release(slot);
+}
+
+void Cdrom::readDiscSector(const u32 fad, Sector& sector) const {
+    sector.fad = fad;
+    if (access_method == CdromAccessMethod::image) {
+        const auto data = DiscImage::sectorData(fad, raw_sector_size, sector.data);
+        if (data.empty()) {
+            sector.data.fill(0);
+        } else if (data.data() != sector.data.data()) {
+            std::ranges::copy(data.first(std::min(data.size(), sector.data.size())), sector.data.begin());
+        }
+    } else {
+        // Drives only return the user data, the header is rebuilt as mode 1.
+        const auto user_data = Scsi::readSector(fad, 1);
+        sector.data.fill(0);
+        sector.data[sector_mode_position] = 1;
+        std::ranges::copy_n(user_data.begin(),
+                            std::min(user_data.size(), std::size_t{user_data_size}),
+                            sector.data.begin() + mode_1_data_position);
+    }
+
+    sector.file_number    = 0;
+    sector.channel_number = 0;
+    sector.sub_mode       = 0;
+    sector.coding_info    = 0;
+
+    // ctrl_adr_ was updated for this FAD by the caller.
+    if ((ctrl_adr_ & toc_control_data_track) == 0) {
+        sector.data_offset = 0;
+        sector.size        = raw_sector_size;
+        return;
+    }
+
+    const auto is_mode_2 = (sector.data[sector_mode_position] == 2);
+    if (is_mode_2) {
+        sector.file_number    = sector.data[sub_header_position];
+        sector.channel_number = sector.data[sub_header_position + 1];
+        sector.sub_mode       = sector.data[sub_header_position + 2];
+        sector.coding_info    = sector.data[sub_header_position + 3];
+    }
+
+    switch (get_sector_length_) {
+        case raw_sector_size:
+            sector.data_offset = 0;
+            sector.size        = raw_sector_size;
+            break;
+        case no_sync_data_size:
+            sector.data_offset = sector_sync_size;
+            sector.size        = no_sync_data_size;
+            break;
+        case mode_2_data_size:
+            sector.data_offset = sub_header_position;
+            sector.size        = mode_2_data_size;
+            break;
+        default:
+            if (is_mode_2) {
+                sector.data_offset = mode_2_data_position;
+                sector.size        = ((sector.sub_mode & sub_mode_form_2) != 0) ? form_2_data_size : user_data_size;
+            } else {
+                sector.data_offset = mode_1_data_position;
+                sector.size        = user_data_size;
+            }
+            break;
+    }
+}
+
+void Cdrom::buildSaturnToc() {
+    saturn_toc_.fill(u32_max);
+    if (!isCdInserted() || !Scsi::readToc(toc_data)) { return; }
+
+    // Drive entries hold adr/control and a MSF address, Saturn entries control/adr and a FAD.
+    const auto toSaturnEntry = [](const ScsiTocTrack& track) {
+        const auto ctrl_adr = static_cast<u8>((track.adr_ctrl << 4) | (track.adr_ctrl >> 4));
+        const auto fad      = (track.addr[1] * seconds_per_minute + track.addr[2]) * frames_per_second + track.addr[3];
+        return (static_cast<u32>(ctrl_adr) << 24) | static_cast<u32>(fad);
+    };
+
+    for (const auto& track : toc_data.track) {
+        if (track.trackno == toc_lead_out_track) {
+            saturn_toc_[toc_lead_out_entry] = toSaturnEntry(track);
+            break;
+        }
+        if ((track.trackno == 0) || (track.trackno > toc_max_tracks)) { break; }
+        saturn_toc_[track.trackno - 1] = toSaturnEntry(track);
+    }
+
+    const auto trackInfo = [this](const u8 track) {
+        constexpr auto ctrl_adr_mask = u32{0xFF000000};
+        return (saturn_toc_[track - 1] & ctrl_adr_mask) | (static_cast<u32>(track) << 16);
+    };
+    if ((toc_data.first != 0) && (toc_data.last <= toc_max_tracks) && (toc_data.first <= toc_data.last)) {
+        saturn_toc_[toc_first_track_entry] = trackInfo(toc_data.first);
+        saturn_toc_[toc_last_track_entry]  = trackInfo(toc_data.last);
+    }
+}
+
+auto Cdrom::trackStartFad(const u8 track) const -> u32 {
+    if ((track >= 1) && (track <= toc_max_tracks) && (saturn_toc_[track - 1] != u32_max)) {
+        return saturn_toc_[track - 1] & toc_fad_mask;
+    }
+    return saturn_toc_[toc_lead_out_entry] & toc_fad_mask;
+}
+
+void Cdrom::updateSubcodeQ() {
+    const auto isInTrack = [this](const u8 track) {
+        return (saturn_toc_[track - 1] != u32_max) && (current_fad_ >= trackStartFad(track))
+               && (current_fad_ < trackStartFad(track + 1));
+    };
+
+    // Play is sequential, the current track is checked first.
+    if ((track_number_ == 0) || (track_number_ > toc_max_tracks) || !isInTrack(track_number_)) {
+        track_number_ = 0;
+        for (u8 track = 1; track <= toc_max_tracks; ++track) {
+            if (isInTrack(track)) {
+                track_number_ = track;
+                break;
+            }
+        }
+    }
+
+    if (track_number_ == 0) {
+        ctrl_adr_     = 0;
+        index_number_ = 0;
+        return;
+    }
+    ctrl_adr_     = static_cast<u8>(saturn_toc_[track_number_ - 1] >> 24);
+    index_number_ = 1;
+    flag_         = ((ctrl_adr_ & toc_control_data_track) != 0) ? FLAG_CDROM : FLAG_CDDA;
+}
+
+void Cdrom::resetSelectors() {
+    buffer_.clear();
+    for (u8 i = 0; i < MAX_SELECTORS; ++i) {
+        filters_[i]              = {};
+        filters_[i].true_output  = i;
+        filters_[i].false_output = FILTER_NOT_CONNECTED;
+    }
+    cd_device_connection_    = FILTER_NOT_CONNECTED;
+    last_buffer_destination_ = 0;
+    actual_size_             = 0;
+    copy_error_              = 0;
+    transfer_                = {};
+}
+
+auto Cdrom::sectorRange(const u8 partition, u16& position, u16& number) const -> bool {
+    if (partition >= MAX_SELECTORS) { return false; }
+
+    const auto size = u16{buffer_.partition(partition).size};
+    if (position == SECTOR_POSITION_LAST) { position = static_cast<u16>(size - 1); }
+    if (position >= size) { return false; }
+    if ((number == SECTOR_NUMBER_ALL) || (position + number > size)) { number = static_cast<u16>(size - position); }
+    return true;
+}
+
+void Cdrom::rejectCommand() {
+    LOG_DEBUG(Logger::cdrom, "Command {:#04x} rejected", regs_.cr1 >> Cr::command_shft);
+
+    regs_.cr1.upd(Cr::status_enum, Cr::CdDriveStatus::command_rejected);
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+}
+
+auto Cdrom::status() const -> u8 {
+    auto status = toUnderlying(cd_drive_status_);
+    if (transfer_.type != TransferType::none) { status |= toUnderlying(Cr::CdDriveStatus::transfer_request); }
+    return status;
+}
+
 //--------------------------------------------------------------------------------------------------------------
 // CDBLOCK COMMANDS methods
 //--------------------------------------------------------------------------------------------------------------
 void Cdrom::sendStatus() {
-    regs_.cr1.upd(Cr::status_enum, cd_drive_status_);
+    regs_.cr1.upd(Cr::hiByte(status()));
     switch (cd_drive_status_) {
         using enum Cr::CdDriveStatus;
         case drive_is_open:
@@ -2156,10 +1318,10 @@ void Cdrom::sendStatus() {
             regs_.cr4 = u16_max;
             break;
         default:
-            // CR1 |= ((flag & 0xF) << 4) | (repCnt & 0xF);
-            // CR2 = (ctrlAdr << 8) | tno;
-            // CR3 = (uint16_t)((ino << 8) | (FAD >> 16));
-            // CR4 = (uint16_t)FAD;
+            regs_.cr1.upd(Cr::loByte(((flag_ & 0xF) << 4) | (rep_cnt_ & 0xF)));
+            regs_.cr2 = static_cast<u16>((ctrl_adr_ << 8) | track_number_);
+            regs_.cr3 = static_cast<u16>((index_number_ << 8) | ((current_fad_ >> 16) & 0xFF));
+            regs_.cr4 = static_cast<u16>(current_fad_);
             break;
     }
 }
@@ -2174,7 +1336,7 @@ void Cdrom::getStatus() {
 
     regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
 
-    Log::debug(Logger::cdrom, "Get Status executed");
+    LOG_DEBUG(Logger::cdrom, "Get Status executed");
 }
 
 void Cdrom::getHardwareInfo() {
@@ -2191,7 +1353,101 @@ void Cdrom::getHardwareInfo() {
 
     regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
 
-    Log::debug(Logger::cdrom, "Get Hardware Info executed");
+    LOG_DEBUG(Logger::cdrom, "Get Hardware Info executed");
+}
+
+void Cdrom::getToc() {
+    // Status(8) | 0x00
+    // TOC size in words(16)
+    // 0x0000
+    // 0x0000
+
+    buildSaturnToc();
+    transfer_      = {};
+    transfer_.type = TransferType::toc;
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr2 = static_cast<u16>(saturn_toc_size / 2);
+    regs_.cr3 = u16{0};
+    regs_.cr4 = u16{0};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::drdy_enum, Drdy::setup_complete);
+
+    LOG_DEBUG(Logger::cdrom, "Get TOC executed");
+}
+
+void Cdrom::getSessionInfo() {
+    // Status(8) | 0x00
+    // 0x0000
+    // Session number(8) | Upper byte of session start FAD(8)
+    // Lower word of session start FAD
+
+    // Saturn discs hold a single session, session 0 returns the lead out.
+    const auto session = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr2 = u16{0};
+    switch (session) {
+        case 0: {
+            const auto lead_out_fad = trackStartFad(0);
+            regs_.cr3               = static_cast<u16>(0x0100 | ((lead_out_fad >> 16) & 0xFF));
+            regs_.cr4               = static_cast<u16>(lead_out_fad);
+            break;
+        }
+        case 1:
+            regs_.cr3 = u16{0x0100};
+            regs_.cr4 = u16{0};
+            break;
+        default:
+            regs_.cr3 = u16_max;
+            regs_.cr4 = u16_max;
+            break;
+    }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Session Info executed");
+}
+
+void Cdrom::initializeCdSystem() {
+    // 0x04(8) | Initialization flags(8)
+    // Standby time(16)
+    // 0x0000
+    // ECC frequency(8) | Retry frequency(8)
+
+    constexpr auto soft_reset     = u8{0x01};
+    constexpr auto standard_speed = u8{0x10};
+    constexpr auto no_change      = u8{0x80};
+
+    const auto flags = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+    if ((flags & no_change) == 0) {
+        if ((flags & soft_reset) != 0) {
+            resetSelectors();
+            get_sector_length_     = user_data_size;
+            put_sector_length_     = user_data_size;
+            current_fad_           = first_track_fad;
+            play_end_fad_          = first_track_fad;
+            is_waiting_for_buffer_ = false;
+        }
+        cd_drive_play_mode_
+            = ((flags & standard_speed) != 0) ? CdDrivePlayMode::standard_play_speed : CdDrivePlayMode::double_play_speed;
+        periodic_response_duration_ = calculatePeriodicResponseDuration();
+    }
+
+    if (isCdInserted()) {
+        cd_drive_status_  = Cr::CdDriveStatus::paused;
+        updateSubcodeQ();
+    }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Initialize CD System executed");
 }
 
 void Cdrom::endDataTransfer() {
@@ -2200,127 +1456,622 @@ void Cdrom::endDataTransfer() {
     // 0x0000
     // 0x0000
 
-    //
-    //			cdDriveStatus &=~STAT_TRNS;
-    //
-    //			CR1=cdDriveStatus<<8;
-    //			CR1|=((bytesTransfered/2)>>16)&0xFF;
-    //			CR2=static_cast<uint16_t>(bytesTransfered/2);
-    //			CR3=0;
-    //			CR4=0;
-    //
-    //			#ifdef _LOGS
-    //			EmuState::pLog->CdBlockWrite("Bytes transfered : 0x",bytesTransfered);
-    //			#endif
-    //
-    //			// data fetching is finished
-    //			// check if sectors must be erased
-    //			if (DeleteSectorDataExecuted)
-    //			{
-    //				#ifdef _LOGS
-    //				EmuState::pLog->CdBlockWrite("*Deleting sectors in buffer partition no0x",fetchedBuffer);
-    //				EmuState::pLog->CdBlockWrite("Old buffer size: 0x",bufferPartitions[fetchedBuffer].size);
-    //				EmuState::pLog->CdBlockWrite("Position of sector to delete in buffer: 0x",posOfSectorsToDelete);
-    //				EmuState::pLog->CdBlockWrite("Number of sectors to delete: 0x",numberOfSectorsToDelete);
-    //				#endif
-    //				int32_t oldSize=bufferPartitions[fetchedBuffer].size;
-    //
-    //				for (int32_t i=posOfSectorsToDelete;i<(posOfSectorsToDelete+numberOfSectorsToDelete);i++)
-    //				{
-    //					if (i>MAX_SECTORS)
-    //					{
-    //						#ifdef _LOGS
-    //						EmuState::pLog->CdBlockWrite("End of buffer partition reached");
-    //						#endif
-    //						break;
-    //					}
-    //					if (bufferPartitions[fetchedBuffer].sectors[i])
-    //					{
-    //						#ifdef _LOGS
-    //						EmuState::pLog->CdBlockWrite("Deleting in buffer partition sector no ",i);
-    //						#endif
-    //						bufferPartitions[fetchedBuffer].sectors[i]->size=0;
-    //						bufferPartitions[fetchedBuffer].sectors[i]=NULL;
-    //						bufferPartitions[fetchedBuffer].size--;
-    //					}
-    //					else break;
-    //				}
-    //
-    //				// we shift the sectors in buffer partition if necessary
-    //				if (numberOfSectorsToDelete<oldSize)
-    //				{
-    //					// we did not erase all the sectors
-    //					// we check if there a hole in buffer partition
-    //					#ifdef _LOGS
-    //					EmuState::pLog->CdBlockWrite("All sectors haven't been deleted, checking for hole");
-    //					#endif
-    //					int32_t holeStart=0;
-    //					for (;holeStart<MAX_SECTORS;holeStart++)
-    //					{
-    //						if (!bufferPartitions[fetchedBuffer].sectors[holeStart]) break;
-    //					}
-    //					// holeStart contains the position of the hole
-    //					// let's check if the hole is positioned before the end of used sectors
-    //					if (holeStart<bufferPartitions[fetchedBuffer].size)
-    //					{
-    //						EmuState::pLog->CdBlockWrite("There is a hole at sector no",holeStart);
-    //						// let's get the position of the end of the hole
-    //						int32_t holeEnd=holeStart;
-    //						for (;holeEnd<MAX_SECTORS;holeEnd++)
-    //						{
-    //							if (bufferPartitions[fetchedBuffer].sectors[holeEnd]) break;
-    //						}
-    //						// we shift the sectors
-    //						int32_t i=0;
-    //						//for (i=0;(i+holeEnd)<MAX_SECTORS;i++)
-    //						for (i=0;(i+holeEnd)<(holeEnd+bufferPartitions[fetchedBuffer].size);i++)
-    //						{
-    //							if ((i+holeEnd)>MAX_SECTORS) break;
-    //							bufferPartitions[fetchedBuffer].sectors[holeStart+i]=bufferPartitions[fetchedBuffer].sectors[holeEnd+i];
-    //							#ifdef _LOGS
-    //							EmuState::pLog->CdBlockWrite("Sector no",holeEnd+i);
-    //							EmuState::pLog->CdBlockWrite("shifted to sector no",holeStart+i);
-    //							#endif
-    //						}
-    //						for (;i<MAX_SECTORS;i++)
-    //						{
-    //							bufferPartitions[fetchedBuffer].sectors[i]=NULL;
-    //						}
-    //					}
-    //				}
-    //
-    //				DeleteSectorDataExecuted=false;
-    //				// update buffer partition size
-    //				/*bufferPartitions[fetchedBuffer].size=0;
-    //				for (int32_t i=0;i<MAX_SECTORS;i++)
-    //				{
-    //					if (bufferPartitions[fetchedBuffer].sectors[i]) bufferPartitions[fetchedBuffer].size++;
-    //					else break;
-    //				}*/
-    //
-    //				#ifdef _LOGS
-    //				EmuState::pLog->CdBlockWrite("New buffer size in sectors: 0x",bufferPartitions[fetchedBuffer].size);
-    //				#endif
-    //				// buffer should not be full
-    //				HIRQREQ&=~BFUL;
-    //			}
-    //
-    //			bytesTransfered=0;
-    //
-    //			// flags setup
-    //			HIRQREQ|=CMOK | EHST;
-    //			//HIRQREQ|=DRDY;
+    // Get then delete sector data : the sectors are freed once read
+    if ((transfer_.type == TransferType::sectors) && transfer_.is_delete_pending) {
+        buffer_.remove(transfer_.partition, transfer_.position, transfer_.sectors_number);
+        regs_.hirqreq.upd(HIrqReq::bful_enum, Bful::buffer_not_full);
+    }
 
-    regs_.cr1.upd(Cr::status_enum, cd_drive_status_);
+    const auto is_transfer_set_up = (transfer_.type != TransferType::none);
+    const auto words_transferred  = transfer_.bytes_transferred / 2;
+    transfer_                     = {};
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    if (is_transfer_set_up) {
+        regs_.cr1.upd(Cr::loByte((words_transferred >> 16) & 0xFF));
+        regs_.cr2 = static_cast<u16>(words_transferred);
+    } else {
+        regs_.cr1.upd(Cr::loByte(u8_max));
+        regs_.cr2 = u16_max;
+    }
+    regs_.cr3 = u16{0};
+    regs_.cr4 = u16{0};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::drdy_enum, Drdy::setup_complete);
+    regs_.hirqreq.upd(HIrqReq::ehst_enum, Ehst::host_io_finished);
+
+    LOG_DEBUG(Logger::cdrom, "End Data Transfer executed");
+}
+
+void Cdrom::playDisc() {
+    // 0x10(8) | Upper byte of start position(8)
+    // Lower word of start position(16)
+    // Play mode(8) | Upper byte of end position(8)
+    // Lower word of end position(16)
+
+    const auto start = (static_cast<u32>(regs_.cr1 >> Cr::LO_BYTE_SHFT) << 16) | regs_.cr2.data();
+    const auto end   = (static_cast<u32>(regs_.cr3 >> Cr::LO_BYTE_SHFT) << 16) | regs_.cr4.data();
+    const auto mode  = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+
+    if (!isCdInserted()) {
+        regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+        sendStatus();
+        return;
+    }
+
+    // Positions are either a FAD, or a track and index. 0 is the default position.
+    if (start != position_no_change) {
+        if ((start & position_is_fad) != 0) {
+            current_fad_ = start & position_fad_mask;
+        } else {
+            current_fad_ = trackStartFad((start == 0) ? 1 : static_cast<u8>(start >> 8));
+        }
+    }
+    if (end != position_no_change) {
+        if ((end & position_is_fad) != 0) {
+            play_end_fad_ = current_fad_ + (end & position_fad_mask);
+        } else {
+            // The end track is played, up to the start of the following one.
+            play_end_fad_ = (end == 0) ? trackStartFad(0) : trackStartFad(static_cast<u8>(((end >> 8) & 0xFF) + 1));
+        }
+    }
+    if ((mode != CDC_PM_NOCHG) && ((mode & CDC_PM_REP_NOCHG) != CDC_PM_REP_NOCHG)) { rep_cnt_ = mode & 0xF; }
+
+    cd_drive_status_       = Cr::CdDriveStatus::playing;
+    is_waiting_for_buffer_ = false;
+    updateSubcodeQ();
+
+    regs_.hirqreq.upd(HIrqReq::pend_enum, Pend::cd_play_in_progress);
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Play Disc executed, FAD {:#x} to {:#x}", current_fad_, play_end_fad_);
+}
+
+void Cdrom::seekDisc() {
+    // 0x11(8) | Upper byte of seek position(8)
+    // Lower word of seek position(16)
+    // 0x0000
+    // 0x0000
+
+    const auto position = (static_cast<u32>(regs_.cr1 >> Cr::LO_BYTE_SHFT) << 16) | regs_.cr2.data();
+
+    is_waiting_for_buffer_ = false;
+    if (!isCdInserted()) {
+        cd_drive_status_ = Cr::CdDriveStatus::no_disc_inserted;
+    } else if (position == position_no_change) {
+        // Pause, a play command without position change resumes.
+        cd_drive_status_  = Cr::CdDriveStatus::paused;
+    } else if (position == 0) {
+        cd_drive_status_ = Cr::CdDriveStatus::standby;
+    } else {
+        const auto is_fad = ((position & position_is_fad) != 0);
+        current_fad_      = is_fad ? (position & position_fad_mask) : trackStartFad(static_cast<u8>(position >> 8));
+        play_end_fad_     = current_fad_;
+        cd_drive_status_  = Cr::CdDriveStatus::paused;
+        updateSubcodeQ();
+    }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Seek Disc executed");
+}
+
+void Cdrom::setCdDeviceConnection() {
+    // 0x30(8) | 0x00
+    // 0x0000
+    // Filter number(8) | 0x00
+    // 0x0000
+
+    cd_device_connection_ = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Set CD Device Connection executed");
+}
+
+void Cdrom::getCdDeviceConnection() {
+    // Status(8) | 0x00
+    // 0x0000
+    // Filter number(8) | 0x00
+    // 0x0000
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr2 = u16{0};
+    regs_.cr3 = static_cast<u16>(cd_device_connection_ << 8);
+    regs_.cr4 = u16{0};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get CD Device Connection executed");
+}
+
+void Cdrom::getLastBufferDestination() {
+    // Status(8) | 0x00
+    // 0x0000
+    // Buffer partition number(8) | 0x00
+    // 0x0000
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr2 = u16{0};
+    regs_.cr3 = static_cast<u16>(last_buffer_destination_ << 8);
+    regs_.cr4 = u16{0};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Last Buffer Destination executed");
+}
+
+void Cdrom::setFilterRange() {
+    // 0x40(8) | Upper byte of FAD(8)
+    // Lower word of FAD(16)
+    // Filter number(8) | Upper byte of range(8)
+    // Lower word of range(16)
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+    filters_[filter].fad       = (static_cast<u32>(regs_.cr1 >> Cr::LO_BYTE_SHFT) << 16) | regs_.cr2.data();
+    filters_[filter].fad_range = (static_cast<u32>(regs_.cr3 >> Cr::LO_BYTE_SHFT) << 16) | regs_.cr4.data();
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Set Filter Range executed");
+}
+
+void Cdrom::getFilterRange() {
+    // Status(8) | Upper byte of FAD(8)
+    // Lower word of FAD(16)
+    // Filter number(8) | Upper byte of range(8)
+    // Lower word of range(16)
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+    const auto& current = filters_[filter];
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte((current.fad >> 16) & 0xFF));
+    regs_.cr2 = static_cast<u16>(current.fad);
+    regs_.cr3 = static_cast<u16>((filter << 8) | ((current.fad_range >> 16) & 0xFF));
+    regs_.cr4 = static_cast<u16>(current.fad_range);
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Filter Range executed");
+}
+
+void Cdrom::setFilterSubheaderConditions() {
+    // 0x42(8) | Channel number(8)
+    // Sub mode mask(8) | Coding information mask(8)
+    // Filter number(8) | File number(8)
+    // Sub mode comparison value(8) | Coding information comparison value(8)
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+    auto& current             = filters_[filter];
+    current.channel_number    = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+    current.sub_mode_mask     = static_cast<u8>(regs_.cr2 >> Cr::HI_BYTE_SHFT);
+    current.coding_info_mask  = static_cast<u8>(regs_.cr2 >> Cr::LO_BYTE_SHFT);
+    current.file_number       = static_cast<u8>(regs_.cr3 >> Cr::LO_BYTE_SHFT);
+    current.sub_mode_value    = static_cast<u8>(regs_.cr4 >> Cr::HI_BYTE_SHFT);
+    current.coding_info_value = static_cast<u8>(regs_.cr4 >> Cr::LO_BYTE_SHFT);
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Set Filter Subheader Conditions executed");
+}
+
+void Cdrom::getFilterSubheaderConditions() {
+    // Status(8) | Channel number(8)
+    // Sub mode mask(8) | Coding information mask(8)
+    // Filter number(8) | File number(8)
+    // Sub mode comparison value(8) | Coding information comparison value(8)
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+    const auto& current = filters_[filter];
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(current.channel_number));
+    regs_.cr2 = static_cast<u16>((current.sub_mode_mask << 8) | current.coding_info_mask);
+    regs_.cr3 = static_cast<u16>((filter << 8) | current.file_number);
+    regs_.cr4 = static_cast<u16>((current.sub_mode_value << 8) | current.coding_info_value);
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Filter Subheader Conditions executed");
+}
+
+void Cdrom::setFilterMode() {
+    // 0x44(8) | Mode(8)
+    // 0x0000
+    // Filter number(8) | 0x00
+    // 0x0000
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+    const auto mode = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+    if ((mode & FILTER_MODE_INITIALIZE) != 0) {
+        initializeFilterConditions(filters_[filter]);
+    } else {
+        filters_[filter].mode = mode;
+    }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Set Filter Mode executed");
+}
+
+void Cdrom::getFilterMode() {
+    // Status(8) | Mode(8)
+    // 0x0000
+    // Filter number(8) | 0x00
+    // 0x0000
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(filters_[filter].mode));
+    regs_.cr2 = u16{0};
+    regs_.cr3 = static_cast<u16>(filter << 8);
+    regs_.cr4 = u16{0};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Filter Mode executed");
+}
+
+void Cdrom::setFilterConnection() {
+    // 0x46(8) | Connection flags(8)
+    // True output connection(8) | False output connection(8)
+    // Filter number(8) | 0x00
+    // 0x0000
+
+    constexpr auto set_true_output  = u8{0x01};
+    constexpr auto set_false_output = u8{0x02};
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+    const auto flags = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+    if ((flags & set_true_output) != 0) { filters_[filter].true_output = static_cast<u8>(regs_.cr2 >> Cr::HI_BYTE_SHFT); }
+    if ((flags & set_false_output) != 0) { filters_[filter].false_output = static_cast<u8>(regs_.cr2 >> Cr::LO_BYTE_SHFT); }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Set Filter Connection executed");
+}
+
+void Cdrom::getFilterConnection() {
+    // Status(8) | 0x00
+    // True output connection(8) | False output connection(8)
+    // 0x0000
+    // 0x0000
+
+    const auto filter = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (filter >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr2 = static_cast<u16>((filters_[filter].true_output << 8) | filters_[filter].false_output);
+    regs_.cr3 = u16{0};
+    regs_.cr4 = u16{0};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Filter Connection executed");
+}
+
+void Cdrom::resetSelector() {
+    // 0x48(8) | Reset flags(8)
+    // 0x0000
+    // Buffer partition number(8) | 0x00
+    // 0x0000
+
+    constexpr auto clear_all_partitions    = u8{0x04};
+    constexpr auto initialize_conditions   = u8{0x10};
+    constexpr auto initialize_input        = u8{0x20};
+    constexpr auto initialize_true_output  = u8{0x40};
+    constexpr auto initialize_false_output = u8{0x80};
+
+    const auto flags = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+    if (flags == 0) {
+        // Only the partition is cleared
+        const auto partition = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+        if (partition >= MAX_SELECTORS) {
+            rejectCommand();
+            return;
+        }
+        buffer_.clearPartition(partition);
+    }
+    if ((flags & clear_all_partitions) != 0) { buffer_.clear(); }
+    for (u8 i = 0; i < MAX_SELECTORS; ++i) {
+        if ((flags & initialize_conditions) != 0) { initializeFilterConditions(filters_[i]); }
+        if ((flags & initialize_true_output) != 0) { filters_[i].true_output = i; }
+        if ((flags & initialize_false_output) != 0) { filters_[i].false_output = FILTER_NOT_CONNECTED; }
+    }
+    if ((flags & initialize_input) != 0) { cd_device_connection_ = FILTER_NOT_CONNECTED; }
+
+    // Sectors being transferred may have been freed
+    if (transfer_.type == TransferType::sectors) { transfer_ = {}; }
+
+    regs_.hirqreq.upd(HIrqReq::bful_enum, Bful::buffer_not_full);
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Reset Selector executed");
+}
+
+void Cdrom::getBufferSize() {
+    // Status(8) | 0x00
+    // Number of free sectors(16)
+    // Number of selectors(8) | 0x00
+    // Number of sectors in the buffer(16)
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr2 = u16{buffer_.freeSectorsNumber()};
+    regs_.cr3 = static_cast<u16>(MAX_SELECTORS << 8);
+    regs_.cr4 = u16{MAX_SECTORS};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Buffer Size executed");
+}
+
+void Cdrom::getSectorNumber() {
+    // Status(8) | 0x00
+    // 0x0000
+    // 0x0000
+    // Number of sectors in the partition(16)
+
+    const auto partition = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    if (partition >= MAX_SELECTORS) {
+        rejectCommand();
+        return;
+    }
+
+    regs_.cr1.upd(Cr::hiByte(status()));
     regs_.cr1.upd(Cr::loByte(0));
     regs_.cr2 = u16{0};
     regs_.cr3 = u16{0};
+    regs_.cr4 = u16{buffer_.partition(partition).size};
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Sector Number executed");
+}
+
+void Cdrom::calculateActualSize() {
+    // 0x52(8) | 0x00
+    // Sector position(16)
+    // Buffer partition number(8) | 0x00
+    // Number of sectors(16)
+
+    const auto partition = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    auto       position  = regs_.cr2.data();
+    auto       number    = regs_.cr4.data();
+    if (!sectorRange(partition, position, number)) {
+        rejectCommand();
+        return;
+    }
+
+    actual_size_ = 0;
+    auto slot    = buffer_.find(partition, static_cast<u8>(position));
+    for (u16 i = 0; (i < number) && (slot != no_sector); ++i) {
+        actual_size_ += buffer_.sector(slot).size;
+        slot = buffer_.sector(slot).next;
+    }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Calculate Actual Size executed");
+}
+
+void Cdrom::getActualSize() {
+    // Status(8) | Upper byte of size in words(8)
+    // Lower word of size in words(16)
+    // 0x0000
+    // 0x0000
+
+    const auto words = actual_size_ / 2;
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte((words >> 16) & 0xFF));
+    regs_.cr2 = static_cast<u16>(words);
+    regs_.cr3 = u16{0};
     regs_.cr4 = u16{0};
 
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Actual Size executed");
+}
+
+void Cdrom::getSectorInfo() {
+    // Status(8) | Upper byte of sector FAD(8)
+    // Lower word of sector FAD(16)
+    // File number(8) | Channel number(8)
+    // Sub mode(8) | Coding information(8)
+
+    const auto partition = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    const auto position  = static_cast<u8>(regs_.cr2 >> Cr::LO_BYTE_SHFT);
+    const auto slot      = (partition < MAX_SELECTORS) ? buffer_.find(partition, position) : no_sector;
+    if (slot == no_sector) {
+        rejectCommand();
+        return;
+    }
+    const auto& sector = buffer_.sector(slot);
+
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte((sector.fad >> 16) & 0xFF));
+    regs_.cr2 = static_cast<u16>(sector.fad);
+    regs_.cr3 = static_cast<u16>((sector.file_number << 8) | sector.channel_number);
+    regs_.cr4 = static_cast<u16>((sector.sub_mode << 8) | sector.coding_info);
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+
+    LOG_DEBUG(Logger::cdrom, "Get Sector Info executed");
+}
+
+void Cdrom::setSectorLength() {
+    // 0x60(8) | Get sector length(8)
+    // Put sector length(8) | 0x00
+    // 0x0000
+    // 0x0000
+
+    const auto toLength = [](const u8 length, const u16 current) -> u16 {
+        switch (length) {
+            case SLEN_2048: return user_data_size;
+            case SLEN_2336: return mode_2_data_size;
+            case SLEN_2340: return no_sync_data_size;
+            case SLEN_2352: return raw_sector_size;
+            default: return current; // No change
+        }
+    };
+    get_sector_length_ = toLength(static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT), get_sector_length_);
+    put_sector_length_ = toLength(static_cast<u8>(regs_.cr2 >> Cr::HI_BYTE_SHFT), put_sector_length_);
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::esel_enum, Esel::soft_reset_or_selector_set_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Set Sector Length executed");
+}
+
+void Cdrom::getSectorData(const bool is_delete_requested) {
+    // 0x61 or 0x63(8) | 0x00
+    // Sector position(16)
+    // Buffer partition number(8) | 0x00
+    // Number of sectors(16)
+
+    const auto partition = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    auto       position  = regs_.cr2.data();
+    auto       number    = regs_.cr4.data();
+    if (!sectorRange(partition, position, number)) {
+        rejectCommand();
+        return;
+    }
+
+    transfer_                   = {};
+    transfer_.type              = TransferType::sectors;
+    transfer_.partition         = partition;
+    transfer_.position          = static_cast<u8>(position);
+    transfer_.sectors_number    = static_cast<u8>(number);
+    transfer_.sectors_remaining = static_cast<u8>(number);
+    transfer_.slot              = (number == 0) ? no_sector : buffer_.find(partition, static_cast<u8>(position));
+    transfer_.is_delete_pending = is_delete_requested;
+
     regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
     regs_.hirqreq.upd(HIrqReq::drdy_enum, Drdy::setup_complete);
+    regs_.hirqreq.upd(HIrqReq::ehst_enum, Ehst::host_io_in_progress);
 
-    Log::debug(Logger::cdrom, "End Data Transfer executed");
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Get Sector Data executed, {} sectors from partition {}", number, partition);
+}
+
+void Cdrom::deleteSectorData() {
+    // 0x62(8) | 0x00
+    // Sector position(16)
+    // Buffer partition number(8) | 0x00
+    // Number of sectors(16)
+
+    const auto partition = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    auto       position  = regs_.cr2.data();
+    auto       number    = regs_.cr4.data();
+    if (!sectorRange(partition, position, number)) {
+        rejectCommand();
+        return;
+    }
+    buffer_.remove(partition, static_cast<u8>(position), static_cast<u8>(number));
+
+    regs_.hirqreq.upd(HIrqReq::bful_enum, Bful::buffer_not_full);
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::ehst_enum, Ehst::host_io_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "Delete Sector Data executed");
+}
+
+void Cdrom::copySectorData(const bool is_move) {
+    // 0x65 or 0x66(8) | Destination partition number(8)
+    // Sector position(16)
+    // Source partition number(8) | 0x00
+    // Number of sectors(16)
+
+    const auto destination = static_cast<u8>(regs_.cr1 >> Cr::LO_BYTE_SHFT);
+    const auto source      = static_cast<u8>(regs_.cr3 >> Cr::HI_BYTE_SHFT);
+    auto       position    = regs_.cr2.data();
+    auto       number      = regs_.cr4.data();
+    if ((destination >= MAX_SELECTORS) || !sectorRange(source, position, number)) {
+        rejectCommand();
+        return;
+    }
+
+    copy_error_ = 0;
+    if (is_move) {
+        buffer_.move(destination, source, static_cast<u8>(position), static_cast<u8>(number));
+    } else if (!buffer_.copy(destination, source, static_cast<u8>(position), static_cast<u8>(number))) {
+        copy_error_ = copy_error_buffer_full;
+    }
+
+    regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
+    regs_.hirqreq.upd(HIrqReq::ecpy_enum, Ecpy::sector_copy_or_move_finished);
+
+    sendStatus();
+
+    LOG_DEBUG(Logger::cdrom, "{} Sector Data executed", is_move ? "Move" : "Copy");
 }
 
 void Cdrom::abortFile() {
@@ -2336,7 +2087,7 @@ void Cdrom::abortFile() {
 
     sendStatus();
 
-    Log::debug(Logger::cdrom, "Abort File executed");
+    LOG_DEBUG(Logger::cdrom, "Abort File executed");
 }
 
 void Cdrom::getCopyError() {
@@ -2345,8 +2096,8 @@ void Cdrom::getCopyError() {
     // Zero
     // Zero
 
-    regs_.cr1.upd(Cr::status_enum, cd_drive_status_);
-    regs_.cr1.upd(Cr::loByte(0));
+    regs_.cr1.upd(Cr::hiByte(status()));
+    regs_.cr1.upd(Cr::loByte(copy_error_));
     regs_.cr2 = u16{0};
     regs_.cr3 = u16{0};
     regs_.cr4 = u16{0};
@@ -2354,7 +2105,7 @@ void Cdrom::getCopyError() {
     regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
     regs_.hirqreq.upd(HIrqReq::ecpy_enum, Ecpy::sector_copy_or_move_finished);
 
-    Log::debug(Logger::cdrom, "Get Copy Error executed");
+    LOG_DEBUG(Logger::cdrom, "Get Copy Error executed");
 }
 
 void Cdrom::getDeviceAuthenticationStatus() {
@@ -2366,6 +2117,41 @@ void Cdrom::getDeviceAuthenticationStatus() {
 
     regs_.hirqreq.upd(HIrqReq::cmok_enum, Cmok::ready);
 
-    Log::debug(Logger::cdrom, "Get Device Authentication Status executed");
+    LOG_DEBUG(Logger::cdrom, "Get Device Authentication Status executed");
 }
+
+template<typename Archive>
+void Cdrom::serialize(Archive& ar) {
+    ar.value(regs_);
+    ar.value(elapsed_cycles_);
+    ar.value(is_command_being_initialized_);
+    ar.value(is_initialization_done_);
+    ar.value(cd_drive_status_);
+    ar.value(cd_drive_play_mode_);
+    ar.value(max_number_of_commands_);
+    ar.value(executed_commands_);
+    ar.value(periodic_response_duration_);
+    ar.value(flag_);
+    ar.value(rep_cnt_);
+    ar.value(ctrl_adr_);
+    ar.value(track_number_);
+    ar.value(index_number_);
+    ar.value(current_fad_);
+    ar.value(play_end_fad_);
+    ar.value(is_waiting_for_buffer_);
+    ar.value(is_audio_response_skipped_);
+    buffer_.serialize(ar);
+    ar.value(filters_);
+    ar.value(cd_device_connection_);
+    ar.value(last_buffer_destination_);
+    ar.value(get_sector_length_);
+    ar.value(put_sector_length_);
+    ar.value(actual_size_);
+    ar.value(copy_error_);
+    ar.value(transfer_);
+    ar.value(saturn_toc_);
+}
+
+template void Cdrom::serialize(core::StateWriter&);
+template void Cdrom::serialize(core::StateReader&);
 } // namespace saturnin::cdrom
@@ -27,6 +27,7 @@
 
 #include <array>  // array
 #include <chrono> // duration
+#include <span>   // span
 #include <vector>
 #include <string>
 #include <saturnin/src/emulator_defs.h>
@@ -34,6 +35,8 @@
 #include <saturnin/src/emulator_modules.h>
 #include <saturnin/src/utilities.h>
 #include <saturnin/src/cdrom/cdrom_registers.h>
+#include <saturnin/src/cdrom/disc_image.h> // user_data_size
+#include <saturnin/src/cdrom/sector_buffer.h>
 
 // Forward declarations
 // namespace saturnin::core {
@@ -121,11 +124,11 @@ constexpr auto PLAY_MODE_FAD   = u8{0}; ///< FAD mode.
 constexpr auto PLAY_MODE_TRACK = u8{1}; ///< Track mode.
 //@}
 
-constexpr auto MAX_SELECTORS = u8{24};    ///< Selectors (filter+buffer partition) number.
-constexpr auto MAX_SECTORS   = u8{200};   ///< Number of sectors that can be stored.
-constexpr auto sector_size   = u16{2352}; ///< Sector size in bytes.
-
-constexpr auto NO_FREE_SECTOR = u8{0xFF}; ///< No free sector remaining in buffer.
+/// \name Sector position and number special values
+//@{
+constexpr auto SECTOR_POSITION_LAST = u16{0xFFFF}; ///< Last sector of the partition.
+constexpr auto SECTOR_NUMBER_ALL    = u16{0xFFFF}; ///< All the sectors up to the end of the partition.
+//@}
 
 /// \name Valid sector lengths
 //@{
@@ -137,6 +140,17 @@ constexpr auto SLEN_2352 = u8{3};
 
 constexpr auto FILTER_NOT_CONNECTED = u8{0xFF}; ///< No filter connexion.
 
+/// \name Filter modes
+//@{
+constexpr auto FILTER_MODE_FILE_NUMBER    = u8{0x01}; ///< File number is checked.
+constexpr auto FILTER_MODE_CHANNEL_NUMBER = u8{0x02}; ///< Channel number is checked.
+constexpr auto FILTER_MODE_SUB_MODE       = u8{0x04}; ///< Sub mode is checked.
+constexpr auto FILTER_MODE_CODING_INFO    = u8{0x08}; ///< Coding information is checked.
+constexpr auto FILTER_MODE_REVERSE        = u8{0x10}; ///< Sub header conditions are reversed.
+constexpr auto FILTER_MODE_FAD_RANGE      = u8{0x40}; ///< FAD range is checked.
+constexpr auto FILTER_MODE_INITIALIZE     = u8{0x80}; ///< Filter conditions are initialized.
+//@}
+
 constexpr auto INVALID_FAD = u32{0xFFFFFF}; ///< Invalid FAD.
 
 /// \name Number of cycles to read a sector
@@ -145,32 +159,9 @@ constexpr auto SECTOR_READ_1X = u32{439560};
 constexpr auto SECTOR_READ_2X = u32{219580};
 //@}
 
-constexpr auto file_info_size  = u32{12 * 256};
-constexpr auto saturn_toc_size = u32{4 * 102};
-
-////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \struct	Sector
-///
-/// \brief	Defines a sector.
-///
-/// \author	Runik
-/// \date	01/03/2010
-////////////////////////////////////////////////////////////////////////////////////////////////////
-struct Sector {
-    std::array<u8, sector_size> data; ///< Sector data.
-    u32                         size; ///< Size of user data held.
-    u32                         FAD;  ///< Sector FAD.
-
-    /// \name Sub header
-    //@{
-    u8 fileNumber;
-    u8 channelNumber;
-    u8 subMode;
-    u8 codingInfo;
-    //@}
-
-    u32 trackNum; ///< Track number to which the sector belongs (avoids useless computing).
-};
+constexpr auto file_info_size     = u32{12 * 256};
+constexpr auto saturn_toc_size    = u32{4 * 102};
+constexpr auto saturn_toc_entries = u8{102}; ///< 99 tracks, first track, last track and lead out.
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \struct	Filter
@@ -183,40 +174,59 @@ struct Sector {
 struct Filter {
     /// \name Filter connections
     //@{
-    u32 trueOutput;
-    u32 falseOutput;
-    u8  mode; ///< Filter mode.
-              //@}
+    u8 true_output;  ///< Buffer partition receiving the sectors meeting the conditions.
+    u8 false_output; ///< Filter receiving the other sectors.
+    u8 mode;         ///< Filter mode.
+    //@}
 
-    // filter conditions
     /// \name FAD
     //@{
-    u32 FAD;      ///< Filter FAD start.
-    u32 FADRange; ///< FAD range.
-                  //@}
+    u32 fad;       ///< Filter FAD start.
+    u32 fad_range; ///< FAD range.
+    //@}
 
     /// \name Sub header
     //@{
-    u8 fileNumber;
-    u8 channelNumber;
-    u8 subModeMask;
-    u8 subModeCompValue;
-    u8 codingInfoMask;
-    u8 codingInfoCompValue;
+    u8 file_number;
+    u8 channel_number;
+    u8 sub_mode_mask;
+    u8 sub_mode_value;
+    u8 coding_info_mask;
+    u8 coding_info_value;
     //@}
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \struct	BufferPartition
+/// \enum	TransferType
 ///
-/// \brief	Defines a buffer partition.
+/// \brief	Data read by the host from the data transfer register.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class TransferType : u8 {
+    none,    ///< No transfer set up.
+    sectors, ///< Sectors of a buffer partition.
+    toc      ///< Saturn TOC.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct	DataTransfer
+///
+/// \brief	State of the current transfer from the CD block to the host.
 ///
 /// \author	Runik
-/// \date	01/03/2010
+/// \date	19/10/2026
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-struct BufferPartition {
-    u32                              size;    ///< Partition size in sectors.
-    std::array<Sector*, MAX_SECTORS> sectors; ///< Sectors in sector buffer used by this partition.
+
+struct DataTransfer {
+    TransferType type;              ///< Data transferred.
+    u8           partition;         ///< Partition read.
+    u8           position;          ///< Position of the first sector in the partition.
+    u8           sectors_number;    ///< Number of sectors requested.
+    u8           sectors_remaining; ///< Sectors left to transfer, current one included.
+    u8           slot;              ///< Slot being read, no_sector once all the sectors are read.
+    u16          offset;            ///< Offset in the current sector, or in the TOC.
+    u32          bytes_transferred; ///< Bytes read by the host.
+    bool         is_delete_pending; ///< True when the sectors are deleted at the end of the transfer.
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -244,8 +254,9 @@ struct DirFileInfos {
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 enum class CdromAccessMethod {
-    aspi = 0, ///< Aspi mode access.
-    spti = 1  ///< SPTI mode access.
+    aspi  = 0, ///< Aspi mode access.
+    spti  = 1, ///< SPTI mode access.
+    image = 2  ///< Disc image file access.
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -438,6 +449,23 @@ class Cdrom {
         return read32(addr);
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Cdrom::readTransferBlock(std::span<u8> destination) -> u32;
+    ///
+    /// \brief  Reads the next bytes of the current transfer in a single block, as a DMA reading the
+    ///         data transfer register would. The transfer position and the transferred bytes counter
+    ///         are updated the same way successive register reads would update them.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  destination Where the data is copied. The part left once the transfer ends is zeroed.
+    ///
+    /// \returns    The number of bytes read from the transfer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto readTransferBlock(std::span<u8> destination) -> u32;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Cdrom::run(const u8 cycles);
     ///
@@ -453,6 +481,21 @@ class Cdrom {
 
     auto getRegisters() const -> std::vector<std::string>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Cdrom::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the registers, the drive status and the command processing state.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
     //--------------------------------------------------------------------------------------------------------------
     // PRIVATE section
     //--------------------------------------------------------------------------------------------------------------
@@ -462,11 +505,143 @@ class Cdrom {
     void               write8(u32 addr, u8 data) const;
     void               write16(u32 addr, u16 data);
     void               write32(u32 addr, u32 data) const;
-    [[nodiscard]] auto read8(u32 addr) const -> u8;
+    [[nodiscard]] auto read8(u32 addr) -> u8;
     [[nodiscard]] auto read16(u32 addr) -> u16;
-    [[nodiscard]] auto read32(u32 addr) const -> u32;
+    [[nodiscard]] auto read32(u32 addr) -> u32;
     //@}
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename T> auto Cdrom::readTransferData() -> T;
+    ///
+    /// \brief  Reads the next bytes of the current transfer, big endian. Sector data is read directly
+    ///         from the buffer slot.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam T   Type of the data read.
+    ///
+    /// \returns    The data, 0 when there's nothing left to transfer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename T>
+    auto readTransferData() -> T;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::playSector();
+    ///
+    /// \brief  Reads the sector at the current FAD, and sends it through the filters connected to the
+    ///         CD device. Play is paused while the buffer is full, and resumes when sectors are freed.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void playSector();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::readDiscSector(const u32 fad, Sector& sector) const;
+    ///
+    /// \brief  Reads a raw sector from the disc, and fills its sub header and host data range.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          fad     The FAD of the sector.
+    /// \param [in,out] sector  The slot receiving the sector.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void readDiscSector(const u32 fad, Sector& sector) const;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::buildSaturnToc();
+    ///
+    /// \brief  Builds the Saturn TOC from the disc TOC.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void buildSaturnToc();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Cdrom::trackStartFad(const u8 track) const -> u32;
+    ///
+    /// \brief  Gets the FAD of a track from the Saturn TOC.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  track   The track number, the lead out FAD is returned past the last track.
+    ///
+    /// \returns    The FAD of the track.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto trackStartFad(const u8 track) const -> u32;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::updateSubcodeQ();
+    ///
+    /// \brief  Updates the track number and the control/adr byte of the current FAD.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void updateSubcodeQ();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::resetSelectors();
+    ///
+    /// \brief  Empties the buffer, and initializes the filters and the CD device connection.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void resetSelectors();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Cdrom::sectorRange(const u8 partition, u16& position, u16& number) const -> bool;
+    ///
+    /// \brief  Resolves the special position and number values of a command on a partition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          partition   The partition.
+    /// \param [in,out] position    Position of the first sector.
+    /// \param [in,out] number      Number of sectors, clamped to the end of the partition.
+    ///
+    /// \returns    False if the range is outside the partition.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto sectorRange(const u8 partition, u16& position, u16& number) const -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::rejectCommand();
+    ///
+    /// \brief  Answers a command with invalid parameters.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void rejectCommand();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Cdrom::status() const -> u8;
+    ///
+    /// \brief  Gets the drive status returned by the commands, flagged when a transfer is set up.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The status byte.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto status() const -> u8;
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Cdrom::reset();
     ///
@@ -529,6 +704,39 @@ class Cdrom {
 
     void getHardwareInfo();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::getToc();
+    ///
+    /// \brief  Gets the TOC (Command 0x02).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void getToc();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::getSessionInfo();
+    ///
+    /// \brief  Gets session information (Command 0x03).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void getSessionInfo();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::initializeCdSystem();
+    ///
+    /// \brief  Initializes the CD system (Command 0x04).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void initializeCdSystem();
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Cdrom::endDataTransfer();
     ///
@@ -540,6 +748,141 @@ class Cdrom {
 
     void endDataTransfer();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::playDisc();
+    ///
+    /// \brief  Plays the disc (Command 0x10).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void playDisc();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::seekDisc();
+    ///
+    /// \brief  Seeks the disc (Command 0x11).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void seekDisc();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::setCdDeviceConnection();
+    ///
+    /// \brief  Sets the filter receiving the sectors read (Command 0x30).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setCdDeviceConnection();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::getCdDeviceConnection();
+    ///
+    /// \brief  Gets the filter receiving the sectors read (Command 0x31).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void getCdDeviceConnection();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::getLastBufferDestination();
+    ///
+    /// \brief  Gets the partition which received the last sector (Command 0x32).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void getLastBufferDestination();
+
+    /// \name Filter commands (0x40 to 0x47)
+    //@{
+    void setFilterRange();
+    void getFilterRange();
+    void setFilterSubheaderConditions();
+    void getFilterSubheaderConditions();
+    void setFilterMode();
+    void getFilterMode();
+    void setFilterConnection();
+    void getFilterConnection();
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::resetSelector();
+    ///
+    /// \brief  Resets a partition, or parts of all the selectors (Command 0x48).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void resetSelector();
+
+    /// \name Buffer information commands (0x50 to 0x54)
+    //@{
+    void getBufferSize();
+    void getSectorNumber();
+    void calculateActualSize();
+    void getActualSize();
+    void getSectorInfo();
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::setSectorLength();
+    ///
+    /// \brief  Sets the length of the sectors transferred (Command 0x60).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setSectorLength();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::getSectorData(const bool is_delete_requested);
+    ///
+    /// \brief  Sets up the transfer of sectors to the host (Commands 0x61 and 0x63).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  is_delete_requested True when the sectors are deleted at the end of the transfer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void getSectorData(const bool is_delete_requested);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::deleteSectorData();
+    ///
+    /// \brief  Deletes sectors of a partition (Command 0x62).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void deleteSectorData();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Cdrom::copySectorData(const bool is_move);
+    ///
+    /// \brief  Copies or moves sectors to another partition (Commands 0x65 and 0x66).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  is_move True when the sectors are moved.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void copySectorData(const bool is_move);
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Cdrom::abortFile();
     ///
@@ -586,10 +929,6 @@ class Cdrom {
     // u16          CR4{};
     ////@}
 
-    // std::array<Sector, MAX_SECTORS>            sectorsBuffer{};    ///< Sector buffer.
-    // std::array<Filter, MAX_SELECTORS>          filters{};          ///< Filters.
-    // std::array<BufferPartition, MAX_SELECTORS> bufferPartitions{}; ///< Buffer partitions.
-
     // u32 driveSpeed{};     ///< 1x speed, 2x speed or standby.
     // u32 cyclesPerMs{};    ///< number of SH2 cycles per millisecond.
     // u32 standbyTime{};    ///< Santdby time.
@@ -597,26 +936,6 @@ class Cdrom {
     // u32 ECCFreq{};        ///< ECC frequency update.
     // u32 retryFreq{};      ///< Retry frequency when sector reading error occurs.
 
-    ///// \name Sector length accessors (in bytes)
-    ////@{
-    // u32 getSectorLength{};
-    // u32 putSectorLength{};
-    ////@}
-
-    ///// \name CD block status and report
-    ////@{
-    // u8  status{};          ///< Status.
-    // u8  flag{};            ///< Flag.
-    // u8  repCnt{};          ///< Repeat frequency.
-    // u8  ctrlAdr{};         ///< Control/adr byte of subcode Q.
-    // u8  tno{};             ///< Track number of subcode Q.
-    // u8  ino{};             ///< Index number of subcode Q.
-    // u32 FAD{};             ///< Frame address.
-    // u32 currentPlayMode{}; ///< Track mode or fad mode.
-    // u32 playFADStart{};    ///< Initial position at the beginning of last play disk command.
-    // u32 remainingFADs{};   ///< Remaining number of FADS to play in FAD mode.
-    //                       //@}
-
     //////////////////////////////////////////////////////////////////////////////////////////////////////
     ///// \fn     u32 FindCurrentTrack()
     /////
@@ -629,59 +948,6 @@ class Cdrom {
     //////////////////////////////////////////////////////////////////////////////////////////////////////
     // auto FindCurrentTrack() -> u32;
 
-    // bool DeleteSectorDataExecuted{}; ///< To know if sectors must be deleted in sectors buffer.
-    // u32  numberOfSectorsToDelete{};  ///< Number of sectors to delete.
-    // u32  posOfSectorsToDelete{};     ///< Position of sectors to delete.
-    // u32  currentFilter{};            ///< Current filter connection.
-
-    ///// \name Current fetching parameters
-    ////@{
-    // u32 fetchedBuffer{};     ///< Fetched buffer.
-    // u32 sectorNumInBuffer{}; ///< Sector number in buffer.
-    // u32 posInSector{};       ///< Posiiton in sector.
-    // u32 bytesTransfered{};   ///< Number of bytes transfered by the CD block.
-    // u32 actualSize{};        ///< Actual size command variable.
-    // u32 lastFetchedBuffer{}; ///< Last buffer partition fetched (for GetLastBufferDestination).
-    //                         //@}
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///// \fn     u32 FreeNumOfSectorsInBuffer()
-    /////
-    ///// \brief	Free number of sectors in buffer.
-    /////
-    ///// \author	Runik
-    ///// \date	01/03/2010
-    /////
-    ///// \return	The number of available sectors in sector buffer.
-    //////////////////////////////////////////////////////////////////////////////////////////////////////
-    // auto FreeNumOfSectorsInBuffer() -> u32;
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///// \fn auto Cdrom::FindFreeSector() -> u32;
-    /////
-    ///// \brief  Searches for the first free sector.
-    /////
-    ///// \author Runik
-    ///// \date   01/03/2010
-    /////
-    ///// \returns    The first free sector found, or -1 if no free sector available.
-    //////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    // auto FindFreeSector() -> u32;
-
-    //////////////////////////////////////////////////////////////////////////////////////////////////////
-    ///// \fn	void CdBlockReadSectors(std::int32_t num)
-    /////
-    ///// \brief	Requests the reading of num sector at current FAD and outputs data to current filter.
-    /////
-    ///// \author	Runik
-    ///// \date	01/03/2010
-    /////
-    ///// \param	num	Number of the sector to read.
-    //////////////////////////////////////////////////////////////////////////////////////////////////////
-    // void CdBlockReadSectors(u32 num);
-    // u32  sectorBurstSize{}; ///< Sector burst read size.
-
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn auto Cdrom::isCdInserted() const -> bool;
     ///
@@ -697,9 +963,6 @@ class Cdrom {
 
     // AspiToc* AspiTOC{}; ///< ASPI TOC.
 
-    // std::array<u8, saturn_toc_size> saturnTOC;        ///< Current saturn game disk TOC.
-    // void                            BuildSaturnTOC(); ///< Builds the TOC.
-
     // std::array<u8, file_info_size> filesInfos; ///< Buffer holding saturn files infos.
 
     //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -752,6 +1015,35 @@ class Cdrom {
     u8  max_number_of_commands_{};     ///< The maximum number of executable commands by the cd block.
     u8  executed_commands_{};          ///< Number of commands executed.
     u32 periodic_response_duration_{}; ///< Periodic response duration.
+
+    /// \name CD block status and report
+    //@{
+    u8  flag_{};         ///< Flag.
+    u8  rep_cnt_{};      ///< Repeat frequency.
+    u8  ctrl_adr_{};     ///< Control/adr byte of subcode Q.
+    u8  track_number_{}; ///< Track number of subcode Q.
+    u8  index_number_{}; ///< Index number of subcode Q.
+    u32 current_fad_{};  ///< Frame address.
+    u32 play_end_fad_{}; ///< FAD following the last sector to play, play is pending while current_fad_ is lower.
+    //@}
+
+    bool is_waiting_for_buffer_{false};     ///< True when play is paused until sectors are freed.
+    bool is_audio_response_skipped_{false}; ///< True when the last periodic response didn't read a CD-DA sector.
+
+    /// \name Selectors
+    //@{
+    SectorBuffer                      buffer_;                                     ///< Sector buffer and its partitions.
+    std::array<Filter, MAX_SELECTORS> filters_{};                                  ///< Filters.
+    u8                                cd_device_connection_{FILTER_NOT_CONNECTED}; ///< Filter receiving the sectors read.
+    u8                                last_buffer_destination_{};                  ///< Partition which received the last sector.
+    u16                               get_sector_length_{user_data_size};          ///< Length of the sectors sent to the host.
+    u16                               put_sector_length_{user_data_size};          ///< Length of the sectors sent by the host.
+    u32                               actual_size_{};                              ///< Last actual size calculated, in bytes.
+    u8                                copy_error_{};                               ///< Result of the last copy or move.
+    //@}
+
+    DataTransfer                        transfer_{};   ///< Current transfer to the host.
+    std::array<u32, saturn_toc_entries> saturn_toc_{}; ///< Current disc TOC, control/adr byte and FAD.
 };
 
 } // namespace saturnin::cdrom
@@ -0,0 +1,665 @@
+//
+// chd.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/cdrom/chd.h>
+#include <algorithm> // any_of, copy, copy_n, fill, find, max, min, sort
+#include <cstring>   // memcmp
+#include <map>       // map
+#include <sstream>   // istringstream
+#include <FLAC/stream_decoder.h>
+#include <lzma.h>
+#include <zlib.h>
+#include <saturnin/src/locale.h>      // tr
+#include <saturnin/src/log.h>         // Log
+#include <saturnin/src/thread_pool.h> // ThreadPool
+#include <saturnin/src/timing.h>
+
+namespace saturnin::cdrom {
+
+using core::Log;
+using core::Logger;
+using core::ThreadPool;
+using core::tr;
+
+constexpr auto chd_header_size     = u32{124};
+constexpr auto chd_version         = u32{5};
+constexpr auto chd_map_header_size = u32{16};
+constexpr auto chd_sha1_size       = u32{20};
+constexpr auto chd_tag             = std::array<char, 8>{'M', 'C', 'o', 'm', 'p', 'r', 'H', 'D'};
+constexpr auto meta_header_size    = u32{16};
+constexpr auto sector_data_size    = u32{2352};
+constexpr auto subcode_size        = u32{96};
+constexpr auto invalid_hunk        = u32{0xFFFFFFFF};
+constexpr auto no_slot             = std::size_t{chd_cache_size};
+
+constexpr auto codec_zlib   = u32{0x7A6C6962}; // "zlib"
+constexpr auto codec_lzma   = u32{0x6C7A6D61}; // "lzma"
+constexpr auto codec_cd_zl  = u32{0x63647A6C}; // "cdzl"
+constexpr auto codec_cd_lz  = u32{0x63646C7A}; // "cdlz"
+constexpr auto codec_cd_fl  = u32{0x6364666C}; // "cdfl"
+constexpr auto meta_track_2 = u32{0x43485432}; // "CHT2"
+constexpr auto meta_track   = u32{0x43485452}; // "CHTR"
+
+// Hunk compression types of the v5 map.
+constexpr auto compression_type_3  = u8{3};
+constexpr auto compression_none    = u8{4};
+constexpr auto compression_self    = u8{5};
+constexpr auto compression_parent  = u8{6};
+constexpr auto compression_rle_sm  = u8{7};
+constexpr auto compression_rle_lg  = u8{8};
+constexpr auto compression_self_0  = u8{9};
+constexpr auto compression_self_1  = u8{10};
+constexpr auto compression_par_sf  = u8{11};
+constexpr auto compression_par_0   = u8{12};
+constexpr auto compression_par_1   = u8{13};
+constexpr auto compression_zeroed  = u8{0xFF}; // Uncompressed file hunk never written.
+constexpr auto huffman_codes       = u8{16};
+constexpr auto huffman_max_bits    = u8{8};
+constexpr auto flac_header_size    = std::size_t{0x2A};
+constexpr auto flac_max_block_size = u32{sector_data_size}; // cdfl hunks are encoded with blocks of at most a sector.
+constexpr auto cd_sync_header      = std::array<u8, 12>{0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+
+inline auto readBigEndian(std::span<const u8> data, const std::size_t offset, const u8 bytes) -> u64 {
+    auto value = u64{};
+    for (u8 i = 0; i < bytes; ++i) {
+        value = (value << 8) | data[offset + i];
+    }
+    return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  BitReader
+///
+/// \brief  Reads a bitstream MSB first. Reads past the end return zeros and flag the overflow.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class BitReader {
+  public:
+    explicit BitReader(std::span<const u8> data) : data_(data) {}
+
+    auto read(const u8 bits) -> u64 {
+        const auto value = peek(bits);
+        position_ += bits;
+        return value;
+    }
+
+    [[nodiscard]] auto peek(const u8 bits) const -> u64 {
+        auto value = u64{};
+        for (auto position = position_; position < position_ + bits; ++position) {
+            const auto byte = position / 8;
+            const auto bit  = (byte < data_.size()) ? ((data_[byte] >> (7 - position % 8)) & 1) : 0;
+            value           = (value << 1) | bit;
+        }
+        return value;
+    }
+
+    void skip(const u8 bits) { position_ += bits; }
+
+    [[nodiscard]] auto isOverflowed() const -> bool { return position_ > data_.size() * 8; }
+
+  private:
+    std::span<const u8> data_;       ///< Bitstream.
+    std::size_t         position_{}; ///< Position in bits.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  HuffmanDecoder
+///
+/// \brief  Canonical Huffman decoder of the CHD map, the tree is stored run length encoded.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class HuffmanDecoder {
+  public:
+    auto importTree(BitReader& reader) -> bool {
+        constexpr auto length_bits = u8{4}; // Code lengths are stored on 4 bits for 8 bits codes.
+        auto           code        = std::size_t{};
+        while (code < huffman_codes) {
+            auto length = static_cast<u8>(reader.read(length_bits));
+            if (length != 1) {
+                lengths_[code++] = length;
+                continue;
+            }
+            // 1 is an escape : 1 1 is a single 1, 1 n c is n repeated c + 3 times.
+            length = static_cast<u8>(reader.read(length_bits));
+            if (length == 1) {
+                lengths_[code++] = length;
+                continue;
+            }
+            const auto repeat = reader.read(length_bits) + 3;
+            if (code + repeat > huffman_codes) { return false; }
+            std::fill_n(lengths_.begin() + code, repeat, length);
+            code += repeat;
+        }
+
+        // Canonical codes, starting from the longest ones.
+        auto lengths_count = std::array<u32, huffman_max_bits + 1>{};
+        for (const auto length : lengths_) {
+            if (length > huffman_max_bits) { return false; }
+            ++lengths_count[length];
+        }
+        auto start = u32{};
+        for (u8 length = huffman_max_bits; length > 0; --length) {
+            const auto next_start = (start + lengths_count[length]) >> 1;
+            if ((length != 1) && (next_start * 2 != start + lengths_count[length])) { return false; }
+            lengths_count[length] = start;
+            start                 = next_start;
+        }
+
+        for (u8 symbol = 0; symbol < huffman_codes; ++symbol) {
+            const auto length = lengths_[symbol];
+            if (length == 0) { continue; }
+            const auto code_value = lengths_count[length]++;
+            const auto shift      = huffman_max_bits - length;
+            std::fill(lookup_.begin() + (code_value << shift), lookup_.begin() + ((code_value + 1) << shift), Entry{symbol, length});
+        }
+        return !reader.isOverflowed();
+    }
+
+    auto decode(BitReader& reader) const -> u8 {
+        const auto& entry = lookup_[reader.peek(huffman_max_bits)];
+        reader.skip(entry.length);
+        return entry.symbol;
+    }
+
+  private:
+    struct Entry {
+        u8 symbol;
+        u8 length;
+    };
+    std::array<u8, huffman_codes>            lengths_{}; ///< Code length of each symbol.
+    std::array<Entry, 1 << huffman_max_bits> lookup_{};  ///< Symbol for each value of the next 8 bits.
+};
+
+inline auto inflateRaw(std::span<const u8> in, std::span<u8> out) -> bool {
+    auto stream = z_stream{};
+    if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) { return false; }
+    stream.next_in   = const_cast<Bytef*>(in.data());
+    stream.avail_in  = static_cast<uInt>(in.size());
+    stream.next_out  = out.data();
+    stream.avail_out = static_cast<uInt>(out.size());
+    inflate(&stream, Z_SYNC_FLUSH);
+    const auto is_complete = (stream.total_out == out.size());
+    inflateEnd(&stream);
+    return is_complete;
+}
+
+// LZMA streams are raw LZMA1 data without end marker, decoding stops once the output is filled.
+inline auto decompressLzma(std::span<const u8> in, std::span<u8> out) -> bool {
+    auto options = lzma_options_lzma{};
+    lzma_lzma_preset(&options, 0);
+    options.dict_size = std::max(static_cast<u32>(out.size()), u32{LZMA_DICT_SIZE_MIN});
+    options.lc        = 3;
+    options.lp        = 0;
+    options.pb        = 2;
+    const auto filters = std::array<lzma_filter, 2>{
+        {{LZMA_FILTER_LZMA1, &options}, {LZMA_VLI_UNKNOWN, nullptr}}
+    };
+
+    lzma_stream stream = LZMA_STREAM_INIT;
+    if (lzma_raw_decoder(&stream, filters.data()) != LZMA_OK) { return false; }
+    stream.next_in   = in.data();
+    stream.avail_in  = in.size();
+    stream.next_out  = out.data();
+    stream.avail_out = out.size();
+    const auto status      = lzma_code(&stream, LZMA_RUN);
+    const auto is_complete = ((status == LZMA_OK) || (status == LZMA_STREAM_END)) && (stream.avail_out == 0);
+    lzma_end(&stream);
+    return is_complete;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct FlacStream
+///
+/// \brief  FLAC frames of a hunk, decoded as 16 bits big endian stereo samples. CHD files don't
+///         store the stream header, it's rebuilt from the block size.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct FlacStream {
+    std::array<u8, flac_header_size> header;            ///< Synthesized stream header.
+    std::span<const u8>              data;              ///< Compressed frames.
+    std::size_t                      position{};        ///< Read position, header included.
+    std::span<u8>                    out;               ///< Decoded samples.
+    std::size_t                      samples_written{}; ///< Stereo samples written.
+    bool                             is_valid{true};    ///< False after a decoding error.
+};
+
+inline auto flacRead(const FLAC__StreamDecoder*, FLAC__byte buffer[], std::size_t* bytes, void* client)
+    -> FLAC__StreamDecoderReadStatus {
+    auto& stream = *static_cast<FlacStream*>(client);
+    auto  count  = std::size_t{};
+    if (stream.position < stream.header.size()) {
+        count = std::min(*bytes, stream.header.size() - stream.position);
+        std::copy_n(stream.header.begin() + stream.position, count, buffer);
+    } else if (const auto data_position = stream.position - stream.header.size(); data_position < stream.data.size()) {
+        count = std::min(*bytes, stream.data.size() - data_position);
+        std::copy_n(stream.data.begin() + data_position, count, buffer);
+    }
+    stream.position += count;
+    *bytes = count;
+    return (count == 0) ? FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM : FLAC__STREAM_DECODER_READ_STATUS_CONTINUE;
+}
+
+inline auto flacTell(const FLAC__StreamDecoder*, FLAC__uint64* offset, void* client) -> FLAC__StreamDecoderTellStatus {
+    *offset = static_cast<FlacStream*>(client)->position;
+    return FLAC__STREAM_DECODER_TELL_STATUS_OK;
+}
+
+inline auto flacWrite(const FLAC__StreamDecoder*, const FLAC__Frame* frame, const FLAC__int32* const buffer[], void* client)
+    -> FLAC__StreamDecoderWriteStatus {
+    auto&      stream    = *static_cast<FlacStream*>(client);
+    const auto max_count = stream.out.size() / 4;
+    for (u32 i = 0; (i < frame->header.blocksize) && (stream.samples_written < max_count); ++i) {
+        for (u8 channel = 0; channel < 2; ++channel) {
+            const auto sample      = static_cast<u16>(buffer[channel][i]);
+            const auto offset      = (stream.samples_written * 2 + channel) * 2;
+            stream.out[offset]     = static_cast<u8>(sample >> 8);
+            stream.out[offset + 1] = static_cast<u8>(sample);
+        }
+        ++stream.samples_written;
+    }
+    return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+inline void flacError(const FLAC__StreamDecoder*, FLAC__StreamDecoderErrorStatus, void* client) {
+    static_cast<FlacStream*>(client)->is_valid = false;
+}
+
+// Decodes CD audio, returns the compressed size used, or 0 on error.
+inline auto decompressFlac(std::span<const u8> in, std::span<u8> out) -> std::size_t {
+    auto block_size = static_cast<u32>(out.size() / 4);
+    while (block_size > flac_max_block_size) {
+        block_size /= 2;
+    }
+    constexpr auto sample_rate = u32{44100};
+    constexpr auto channels    = u32{2};
+
+    // STREAMINFO as the single metadata block : block sizes, sample rate, 2 channels of 16 bits.
+    auto stream   = FlacStream{};
+    stream.header = {0x66, 0x4C, 0x61, 0x43, 0x80, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                     0x00, 0x00, 0x00, 0x00, 0x0A, 0xC4, 0x42, 0xF0, 0x00, 0x00, 0x00, 0x00};
+    stream.header[0x08] = stream.header[0x0A] = static_cast<u8>(block_size >> 8);
+    stream.header[0x09] = stream.header[0x0B] = static_cast<u8>(block_size);
+    stream.header[0x12]                       = static_cast<u8>(sample_rate >> 12);
+    stream.header[0x13]                       = static_cast<u8>(sample_rate >> 4);
+    stream.header[0x14]                       = static_cast<u8>((sample_rate << 4) | ((channels - 1) << 1));
+    stream.data                               = in;
+    stream.out                                = out;
+
+    auto decoder = FLAC__stream_decoder_new();
+    if (decoder == nullptr) { return 0; }
+    auto used = std::size_t{};
+    if (FLAC__stream_decoder_init_stream(decoder, flacRead, nullptr, flacTell, nullptr, nullptr, flacWrite, nullptr, flacError, &stream)
+        == FLAC__STREAM_DECODER_INIT_STATUS_OK) {
+        auto is_decoding = FLAC__stream_decoder_process_until_end_of_metadata(decoder) != 0;
+        while (is_decoding && stream.is_valid && (stream.samples_written < out.size() / 4)) {
+            is_decoding = FLAC__stream_decoder_process_single(decoder) != 0;
+        }
+        auto position = FLAC__uint64{};
+        if (stream.is_valid && (stream.samples_written == out.size() / 4) && FLAC__stream_decoder_get_decode_position(decoder, &position)) {
+            used = static_cast<std::size_t>(position) - stream.header.size();
+        }
+        FLAC__stream_decoder_finish(decoder);
+    }
+    FLAC__stream_decoder_delete(decoder);
+    return used;
+}
+
+ChdFile::ChdFile(const std::string& path) : file_(path) {
+    if (!file_.isOpened()) {
+        Log::warning(Logger::cdrom, tr("Could not open CHD file {}"), path);
+        return;
+    }
+    if (!parseHeader()) {
+        Log::warning(Logger::cdrom, tr("{} isn't a supported CHD file"), path);
+        return;
+    }
+    for (auto& slot : cache_) {
+        slot.hunk  = invalid_hunk;
+        slot.state = HunkState::empty;
+        slot.data.resize(hunk_bytes_);
+    }
+    last_hunk_ = invalid_hunk;
+    is_opened_ = true;
+}
+
+ChdFile::~ChdFile() {
+    auto lock = std::unique_lock(cache_mutex_);
+    hunk_decoded_.wait(lock, [this] { return pending_tasks_ == 0; });
+}
+
+auto ChdFile::parseHeader() -> bool {
+    const auto data = file_.data();
+    if ((data.size() < chd_header_size) || (std::memcmp(data.data(), chd_tag.data(), chd_tag.size()) != 0)) { return false; }
+    if (readBigEndian(data, 12, 4) != chd_version) {
+        Log::warning(Logger::cdrom, tr("Only CHD version 5 is supported"));
+        return false;
+    }
+    for (u8 i = 0; i < compressors_.size(); ++i) {
+        compressors_[i] = static_cast<u32>(readBigEndian(data, 16 + i * 4, 4));
+    }
+    logical_bytes_        = readBigEndian(data, 32, 8);
+    const auto map_offset = readBigEndian(data, 40, 8);
+    meta_offset_          = readBigEndian(data, 48, 8);
+    hunk_bytes_           = static_cast<u32>(readBigEndian(data, 56, 4));
+    unit_bytes_           = static_cast<u32>(readBigEndian(data, 60, 4));
+
+    const auto parent_sha1 = data.subspan(104, chd_sha1_size);
+    if (std::ranges::any_of(parent_sha1, [](const u8 b) { return b != 0; })) {
+        Log::warning(Logger::cdrom, tr("CHD files depending on a parent aren't supported"));
+        return false;
+    }
+    if ((hunk_bytes_ == 0) || (hunk_bytes_ % chd_frame_size != 0) || (unit_bytes_ != chd_frame_size)) {
+        Log::warning(Logger::cdrom, tr("The CHD file doesn't hold a CD"));
+        return false;
+    }
+    return parseMap(map_offset);
+}
+
+auto ChdFile::parseMap(const u64 map_offset) -> bool {
+    const auto data         = file_.data();
+    const auto hunks_number = static_cast<u32>((logical_bytes_ + hunk_bytes_ - 1) / hunk_bytes_);
+    map_.resize(hunks_number);
+
+    // Uncompressed files : a table of 32 bits hunk offsets, in hunk units.
+    if (compressors_[0] == 0) {
+        if (map_offset + u64{hunks_number} * 4 > data.size()) { return false; }
+        for (u32 hunk = 0; hunk < hunks_number; ++hunk) {
+            const auto offset = readBigEndian(data, map_offset + hunk * 4, 4) * hunk_bytes_;
+            map_[hunk]        = {(offset == 0) ? compression_zeroed : compression_none, hunk_bytes_, offset};
+        }
+        return true;
+    }
+
+    if (map_offset + chd_map_header_size > data.size()) { return false; }
+    const auto map_bytes    = readBigEndian(data, map_offset, 4);
+    const auto first_offset = readBigEndian(data, map_offset + 4, 6);
+    const auto length_bits  = data[map_offset + 12];
+    const auto self_bits    = data[map_offset + 13];
+    const auto parent_bits  = data[map_offset + 14];
+    if (map_offset + chd_map_header_size + map_bytes > data.size()) { return false; }
+
+    auto reader  = BitReader(data.subspan(map_offset + chd_map_header_size, map_bytes));
+    auto decoder = HuffmanDecoder{};
+    if (!decoder.importTree(reader)) { return false; }
+
+    // Compression types, with runs of the previous type.
+    auto repeat    = u32{};
+    auto last_type = u8{};
+    for (auto& hunk : map_) {
+        if (repeat > 0) {
+            hunk.compression = last_type;
+            --repeat;
+            continue;
+        }
+        const auto type = decoder.decode(reader);
+        if (type == compression_rle_sm) {
+            repeat = 2 + decoder.decode(reader);
+        } else if (type == compression_rle_lg) {
+            repeat = 2 + 16 + (decoder.decode(reader) << 4);
+            repeat += decoder.decode(reader);
+        } else {
+            last_type = type;
+        }
+        hunk.compression = last_type;
+    }
+
+    // Then lengths and offsets, CRCs aren't checked.
+    constexpr auto crc_bits    = u8{16};
+    auto           offset      = first_offset;
+    auto           last_self   = u64{};
+    auto           last_parent = u64{};
+    for (u32 i = 0; i < hunks_number; ++i) {
+        auto& hunk = map_[i];
+        switch (hunk.compression) {
+            case compression_none: {
+                hunk.length = hunk_bytes_;
+                hunk.offset = offset;
+                offset += hunk.length;
+                reader.skip(crc_bits);
+                break;
+            }
+            case compression_self: last_self = hunk.offset = reader.read(self_bits); break;
+            case compression_parent: last_parent = hunk.offset = reader.read(parent_bits); break;
+            case compression_self_1: ++last_self; [[fallthrough]];
+            case compression_self_0: {
+                hunk.compression = compression_self;
+                hunk.offset      = last_self;
+                break;
+            }
+            case compression_par_sf: {
+                hunk.compression = compression_parent;
+                last_parent = hunk.offset = u64{i} * hunk_bytes_ / unit_bytes_;
+                break;
+            }
+            case compression_par_1: last_parent += hunk_bytes_ / unit_bytes_; [[fallthrough]];
+            case compression_par_0: {
+                hunk.compression = compression_parent;
+                hunk.offset      = last_parent;
+                break;
+            }
+            default: {
+                if (hunk.compression > compression_type_3) { return false; }
+                hunk.length = static_cast<u32>(reader.read(length_bits));
+                hunk.offset = offset;
+                offset += hunk.length;
+                reader.skip(crc_bits);
+            }
+        }
+        if ((hunk.compression <= compression_none) && (hunk.offset + hunk.length > data.size())) { return false; }
+    }
+    return !reader.isOverflowed();
+}
+
+auto ChdFile::tracksMetadata() const -> std::vector<ChdTrackMetadata> {
+    auto       tracks = std::vector<ChdTrackMetadata>{};
+    const auto data   = file_.data();
+    auto       offset = meta_offset_;
+    while ((offset != 0) && (offset + meta_header_size <= data.size())) {
+        const auto tag    = static_cast<u32>(readBigEndian(data, offset, 4));
+        const auto length = static_cast<u32>(readBigEndian(data, offset + 5, 3));
+        const auto next   = readBigEndian(data, offset + 8, 8);
+        if (((tag == meta_track_2) || (tag == meta_track)) && (offset + meta_header_size + length <= data.size())) {
+            // "TRACK:1 TYPE:MODE1_RAW SUBTYPE:NONE FRAMES:1234 PREGAP:0 PGTYPE:MODE1 PGSUB:NONE POSTGAP:0"
+            const auto text   = data.subspan(offset + meta_header_size, length);
+            auto       stream = std::istringstream{std::string(text.begin(), std::ranges::find(text, u8{0}))};
+            auto       values = std::map<std::string, std::string>{};
+            auto       field  = std::string{};
+            while (stream >> field) {
+                if (const auto separator = field.find(':'); separator != std::string::npos) {
+                    values[field.substr(0, separator)] = field.substr(separator + 1);
+                }
+            }
+            const auto value = [&values](const std::string& key) -> u32 {
+                const auto it = values.find(key);
+                return (it != values.end()) ? static_cast<u32>(std::stoul(it->second)) : 0;
+            };
+            tracks.push_back({static_cast<u8>(value("TRACK")),
+                              values["TYPE"],
+                              value("FRAMES"),
+                              value("PREGAP"),
+                              values["PGTYPE"].starts_with('V'),
+                              value("POSTGAP")});
+        }
+        offset = next;
+    }
+    std::ranges::sort(tracks, {}, &ChdTrackMetadata::number);
+    return tracks;
+}
+
+auto ChdFile::read(const u64 offset, const u32 length) -> std::span<const u8> {
+    const auto hunk = static_cast<u32>(offset / hunk_bytes_);
+    if ((hunk >= map_.size()) || (offset % hunk_bytes_ + length > hunk_bytes_)) { return {}; }
+
+    auto lock = std::unique_lock(cache_mutex_);
+    auto slot = findSlot(hunk);
+    if (slot == no_slot) {
+        // Cache miss : the emulation thread decodes the hunk itself.
+        slot               = freeSlot();
+        cache_[slot].hunk  = hunk;
+        cache_[slot].state = HunkState::decoding;
+        lock.unlock();
+        decodeHunk(hunk, cache_[slot].data);
+        lock.lock();
+        cache_[slot].state = HunkState::ready;
+    } else {
+        hunk_decoded_.wait(lock, [this, slot] { return cache_[slot].state == HunkState::ready; });
+    }
+    cache_[slot].last_used = ++uses_counter_;
+    current_slot_          = slot;
+
+    const auto is_sequential = (last_hunk_ != invalid_hunk) && ((hunk == last_hunk_) || (hunk == last_hunk_ + 1));
+    last_hunk_               = hunk;
+    if (is_sequential) { prefetch(hunk); }
+    lock.unlock();
+
+    return std::span<const u8>{cache_[slot].data}.subspan(static_cast<std::size_t>(offset % hunk_bytes_), length);
+}
+
+auto ChdFile::findSlot(const u32 hunk) const -> std::size_t {
+    const auto it = std::ranges::find(cache_, hunk, &HunkSlot::hunk);
+    return (it != cache_.end()) ? static_cast<std::size_t>(it - cache_.begin()) : no_slot;
+}
+
+auto ChdFile::freeSlot() const -> std::size_t {
+    // Least recently used slot, except the one returned by the last read and the ones being decoded.
+    auto slot = no_slot;
+    for (std::size_t i = 0; i < cache_.size(); ++i) {
+        if ((i == current_slot_) || (cache_[i].state == HunkState::decoding)) { continue; }
+        if (cache_[i].state == HunkState::empty) { return i; }
+        if ((slot == no_slot) || (cache_[i].last_used < cache_[slot].last_used)) { slot = i; }
+    }
+    return slot;
+}
+
+void ChdFile::prefetch(const u32 hunk) {
+    const auto last = std::min(hunk + chd_prefetch_hunks, static_cast<u32>(map_.size() - 1));
+    for (auto next = hunk + 1; next <= last; ++next) {
+        if (findSlot(next) != no_slot) { continue; }
+        const auto slot = freeSlot();
+        if (slot == no_slot) { return; }
+        cache_[slot].hunk      = next;
+        cache_[slot].state     = HunkState::decoding;
+        cache_[slot].last_used = uses_counter_;
+        ++pending_tasks_;
+        ThreadPool::pool_.detach_task([this, next, slot] {
+            decodeHunk(next, cache_[slot].data);
+
+            // Notified under the lock : the destructor can't see the last task done before it stops using the file.
+            auto lock          = std::scoped_lock(cache_mutex_);
+            cache_[slot].state = HunkState::ready;
+            --pending_tasks_;
+            hunk_decoded_.notify_all();
+        });
+    }
+}
+
+auto ChdFile::decodeHunk(const u32 hunk, std::span<u8> out) const -> bool {
+    TIMING_ZONE(core::TimingZone::chd_decompression);
+
+    const auto& entry      = map_[hunk];
+    auto        is_decoded = false;
+    switch (entry.compression) {
+        case compression_zeroed: {
+            std::ranges::fill(out, u8{});
+            is_decoded = true;
+            break;
+        }
+        case compression_none: {
+            std::ranges::copy(file_.data().subspan(entry.offset, hunk_bytes_), out.begin());
+            is_decoded = true;
+            break;
+        }
+        case compression_self: {
+            is_decoded = (entry.offset < hunk) && decodeHunk(static_cast<u32>(entry.offset), out);
+            break;
+        }
+        case compression_parent: break;
+        default: {
+            const auto in    = file_.data().subspan(entry.offset, entry.length);
+            const auto codec = compressors_[entry.compression];
+            switch (codec) {
+                case codec_zlib: is_decoded = inflateRaw(in, out); break;
+                case codec_lzma: is_decoded = decompressLzma(in, out); break;
+                default: is_decoded = decodeCdHunk(codec, in, out);
+            }
+        }
+    }
+
+    if (!is_decoded) {
+        Log::warning(Logger::cdrom, tr("Could not decode CHD hunk {}"), hunk);
+        std::ranges::fill(out, u8{});
+    }
+    return is_decoded;
+}
+
+auto ChdFile::decodeCdHunk(const u32 codec, std::span<const u8> in, std::span<u8> out) const -> bool {
+    // Sectors and subcodes are compressed separately. Except for FLAC, the data starts with a bit
+    // per frame flagging the sectors whose sync header was removed, and the size of the sectors data.
+    const auto frames       = hunk_bytes_ / chd_frame_size;
+    const auto ecc_bytes    = (frames + 7) / 8;
+    const auto length_bytes = static_cast<u8>((hunk_bytes_ < 65536) ? 2 : 3);
+    const auto header_bytes = ecc_bytes + length_bytes;
+
+    thread_local auto sectors = std::vector<u8>{};
+    thread_local auto subcode = std::vector<u8>{};
+    sectors.resize(frames * sector_data_size);
+    subcode.resize(frames * subcode_size);
+    auto is_done = false;
+    if (codec == codec_cd_fl) {
+        // FLAC frames don't store their size, the subcodes follow the last frame decoded.
+        const auto used = decompressFlac(in, sectors);
+        is_done         = (used != 0) && inflateRaw(in.subspan(used), subcode);
+    } else {
+        if (in.size() < header_bytes) { return false; }
+        const auto data           = in.subspan(header_bytes);
+        const auto sectors_length = static_cast<std::size_t>(readBigEndian(in, ecc_bytes, length_bytes));
+        if (sectors_length > data.size()) { return false; }
+        const auto sectors_data = data.first(sectors_length);
+        const auto subcode_data = data.subspan(sectors_length);
+        switch (codec) {
+            case codec_cd_zl: is_done = inflateRaw(sectors_data, sectors) && inflateRaw(subcode_data, subcode); break;
+            case codec_cd_lz: is_done = decompressLzma(sectors_data, sectors) && inflateRaw(subcode_data, subcode); break;
+            default: Log::warning(Logger::cdrom, tr("Unsupported CHD codec {:08x}"), codec);
+        }
+    }
+    if (!is_done) { return false; }
+
+    // Error correction codes aren't rebuilt, they are not used by the CD block.
+    for (u32 frame = 0; frame < frames; ++frame) {
+        const auto destination = out.subspan(frame * chd_frame_size, chd_frame_size);
+        std::ranges::copy(std::span{sectors}.subspan(frame * sector_data_size, sector_data_size), destination.begin());
+        std::ranges::copy(std::span{subcode}.subspan(frame * subcode_size, subcode_size), destination.begin() + sector_data_size);
+        if ((codec != codec_cd_fl) && ((in[frame / 8] & (1 << (frame % 8))) != 0)) {
+            std::ranges::copy(cd_sync_header, destination.begin());
+        }
+    }
+    return true;
+}
+
+} // namespace saturnin::cdrom
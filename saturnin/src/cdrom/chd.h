@@ -0,0 +1,191 @@
+//
+// chd.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	chd.h
+///
+/// \brief	Declares the ChdFile class, reading CD images stored as CHD v5 files.
+///
+/// The CHD file is memory mapped, compressed hunks are decoded from the mapping into a small LRU
+/// cache. Sequential reads queue the decoding of the following hunks on the thread pool, so the
+/// emulation thread finds them ready.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>              // array
+#include <condition_variable> // condition_variable
+#include <mutex>              // mutex
+#include <span>               // span
+#include <string>             // string
+#include <vector>             // vector
+#include <saturnin/src/emulator_defs.h>
+#include <saturnin/src/cdrom/disc_image.h> // MappedFile
+
+namespace saturnin::cdrom {
+
+constexpr auto chd_frame_size     = u16{2448}; ///< A CD frame in a CHD file : sector followed by 96 bytes of subcode.
+constexpr auto chd_track_padding  = u32{4};    ///< Tracks are padded to a multiple of 4 frames.
+constexpr auto chd_cache_size     = u8{16};    ///< Hunks kept decoded.
+constexpr auto chd_prefetch_hunks = u8{4};     ///< Hunks decoded ahead of a sequential read.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct ChdTrackMetadata
+///
+/// \brief  Track description, read from the CHT2 (or older CHTR) metadata.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ChdTrackMetadata {
+    u8          number;           ///< Track number.
+    std::string type;             ///< Track type (MODE1_RAW, AUDIO ...).
+    u32         frames;           ///< Frames stored, pregap included when it's stored.
+    u32         pregap;           ///< Pregap length in frames.
+    bool        is_pregap_stored; ///< True when the pregap frames are part of the stored frames.
+    u32         postgap;          ///< Postgap length in frames, never stored.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct ChdHunk
+///
+/// \brief  Location of a hunk in the file, decoded from the hunk map.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ChdHunk {
+    u8  compression; ///< Compression type : a codec index, none, self or parent.
+    u32 length;      ///< Compressed length.
+    u64 offset;      ///< Offset in the file, or referenced hunk for self hunks.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   HunkState
+///
+/// \brief  State of a cache slot.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class HunkState : u8 {
+    empty,    ///< Slot unused.
+    decoding, ///< Hunk being decoded, the slot can't be reused.
+    ready     ///< Hunk decoded.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct HunkSlot
+///
+/// \brief  Entry of the decoded hunks cache.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct HunkSlot {
+    u32             hunk;      ///< Hunk held.
+    HunkState       state;     ///< Slot state.
+    u64             last_used; ///< Last use, the oldest ready slot is reused first.
+    std::vector<u8> data;      ///< Decoded hunk, allocated once.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  ChdFile
+///
+/// \brief  CD image stored in a CHD v5 file. Hunks compressed with zlib, LZMA, or the CD codecs
+///         (cdzl, cdlz, cdfl) are supported, parent CHD files aren't.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ChdFile {
+  public:
+    //@{
+    // Constructors / Destructors
+    ChdFile() = delete;
+    explicit ChdFile(const std::string& path);
+    ChdFile(const ChdFile&)                      = delete;
+    ChdFile(ChdFile&&)                           = delete;
+    auto operator=(const ChdFile&) & -> ChdFile& = delete;
+    auto operator=(ChdFile&&) & -> ChdFile&      = delete;
+    ~ChdFile();
+    //@}
+
+    [[nodiscard]] auto isOpened() const -> bool { return is_opened_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto ChdFile::tracksMetadata() const -> std::vector<ChdTrackMetadata>;
+    ///
+    /// \brief  Reads the tracks description from the metadata.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The tracks, ordered by number. Empty if the file doesn't hold a CD.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto tracksMetadata() const -> std::vector<ChdTrackMetadata>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto ChdFile::read(const u64 offset, const u32 length) -> std::span<const u8>;
+    ///
+    /// \brief  Reads decompressed data, which must be part of a single hunk. The hunk is decoded
+    ///         first if it isn't in the cache, or waited for if it's being prefetched.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  offset  Offset in the decompressed data.
+    /// \param  length  Length to read.
+    ///
+    /// \returns    Span into the cache, valid until the next call. Empty if outside the data.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto read(const u64 offset, const u32 length) -> std::span<const u8>;
+
+  private:
+    auto parseHeader() -> bool;
+    auto parseMap(const u64 map_offset) -> bool;
+    auto decodeHunk(const u32 hunk, std::span<u8> out) const -> bool;
+    auto decodeCdHunk(const u32 codec, std::span<const u8> in, std::span<u8> out) const -> bool;
+    auto findSlot(const u32 hunk) const -> std::size_t;
+    auto freeSlot() const -> std::size_t;
+    void prefetch(const u32 hunk);
+
+    MappedFile           file_;             ///< Mapped CHD file.
+    bool                 is_opened_{false}; ///< True when the file is a valid CD CHD.
+    std::array<u32, 4>   compressors_{};    ///< Codecs used by the file, indexed by compression type.
+    u64                  logical_bytes_{};  ///< Size of the decompressed data.
+    u64                  meta_offset_{};    ///< Offset of the first metadata entry.
+    u32                  hunk_bytes_{};     ///< Size of a hunk.
+    u32                  unit_bytes_{};     ///< Size of a unit.
+    std::vector<ChdHunk> map_;              ///< Hunks location.
+
+    std::mutex                           cache_mutex_;     ///< Protects the cache slots state.
+    std::condition_variable              hunk_decoded_;    ///< Signaled when a prefetched hunk is ready.
+    std::array<HunkSlot, chd_cache_size> cache_;           ///< Decoded hunks.
+    std::size_t                          current_slot_{};  ///< Slot returned by the last read, never reused by the next prefetch.
+    u32                                  last_hunk_{};     ///< Hunk of the last read, to detect sequential reads.
+    u64                                  uses_counter_{};  ///< Incremented on each read.
+    u32                                  pending_tasks_{}; ///< Prefetches queued or running on the pool.
+};
+
+} // namespace saturnin::cdrom
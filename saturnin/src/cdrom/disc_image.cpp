@@ -0,0 +1,524 @@
+//
+// disc_image.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/cdrom/disc_image.h>
+#ifdef _WIN32
+    #include <Windows.h>
+#else
+    #include <fcntl.h>    // open
+    #include <sys/mman.h> // mmap, munmap
+    #include <sys/stat.h> // fstat
+    #include <unistd.h>   // close
+#endif
+#include <algorithm>  // copy, equal, fill, transform
+#include <cctype>     // tolower
+#include <filesystem> // path
+#include <fstream>    // ifstream
+#include <iomanip>    // quoted
+#include <map>        // map
+#include <optional>   // optional
+#include <sstream>    // istringstream
+#include <utility>    // exchange
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>    // Log
+#include <saturnin/src/cdrom/chd.h>
+#include <saturnin/src/cdrom/iso9660.h>
+#include <saturnin/src/cdrom/scsi.h>
+
+namespace fs = std::filesystem;
+
+namespace saturnin::cdrom {
+
+using core::Log;
+using core::Logger;
+using core::tr;
+
+constexpr auto sync_pattern       = std::array<u8, 12>{0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+constexpr auto header_end         = u16{16};  // Sync and header (MSF + mode).
+constexpr auto sub_header_end     = u16{24};  // Mode 2 sub header, written twice.
+constexpr auto submode_offset     = u16{18};  // Submode byte of the mode 2 sub header.
+constexpr auto submode_form_2     = u8{0x20}; // Form bit of the submode.
+constexpr auto frames_per_second  = u32{75};  // Sectors per second of the disc.
+constexpr auto seconds_per_minute = u32{60};  // Seconds per minute.
+constexpr auto lead_out_track     = u8{0xAA}; // Track number of the lead out in the TOC.
+constexpr auto toc_adr_position   = u8{0x10}; // ADR field of a TOC entry, holding a position.
+constexpr auto toc_control_data   = u8{0x04}; // Control field of a data track TOC entry.
+constexpr auto toc_entry_size     = u16{8};   // Size of a TOC entry.
+
+std::string              DiscImage::path_;
+std::vector<MappedFile>  DiscImage::files_;
+std::unique_ptr<ChdFile> DiscImage::chd_;
+std::vector<DiscTrack>   DiscImage::tracks_;
+u32                      DiscImage::lead_out_fad_{};
+std::size_t              DiscImage::current_track_{};
+IsoFileSystem            DiscImage::file_system_;
+
+inline auto toBcd(const u32 value) -> u8 { return static_cast<u8>(((value / 10) << 4) | (value % 10)); }
+
+// Converts a "mm:ss:ff" CUE time to sectors.
+inline auto parseMsf(const std::string& msf) -> std::optional<u32> {
+    auto minutes = u32{};
+    auto seconds = u32{};
+    auto frames  = u32{};
+    auto sep_1   = char{};
+    auto sep_2   = char{};
+    auto stream  = std::istringstream{msf};
+    if (!(stream >> minutes >> sep_1 >> seconds >> sep_2 >> frames) || (sep_1 != ':') || (sep_2 != ':')) { return std::nullopt; }
+    return (minutes * seconds_per_minute + seconds) * frames_per_second + frames;
+}
+
+inline auto parseTrackFormat(const std::string& type) -> std::optional<TrackFormat> {
+    if (type == "MODE1/2048") { return TrackFormat::mode1_2048; }
+    if (type == "MODE1/2352") { return TrackFormat::mode1_2352; }
+    if (type == "MODE2/2336") { return TrackFormat::mode2_2336; }
+    if (type == "MODE2/2352") { return TrackFormat::mode2_2352; }
+    if (type == "AUDIO") { return TrackFormat::audio; }
+    return std::nullopt;
+}
+
+inline auto sectorSize(const TrackFormat format) -> u16 {
+    switch (format) {
+        using enum TrackFormat;
+        case mode1_2048: return user_data_size;
+        case mode2_2336: return mode_2_data_size;
+        default: return raw_sector_size;
+    }
+}
+
+// Writes the sync pattern and the header of a sector, the rest of the buffer is cleared.
+inline void writeHeader(std::span<u8, raw_sector_size> buffer, const u32 fad, const u8 mode) {
+    std::ranges::fill(buffer, u8{});
+    std::ranges::copy(sync_pattern, buffer.begin());
+    buffer[12] = toBcd(fad / frames_per_second / seconds_per_minute);
+    buffer[13] = toBcd((fad / frames_per_second) % seconds_per_minute);
+    buffer[14] = toBcd(fad % frames_per_second);
+    buffer[15] = mode;
+}
+
+// Returns the requested part of a full sector.
+inline auto sectorPart(std::span<const u8> raw, const u16 length, const bool is_mode_2) -> std::span<const u8> {
+    switch (length) {
+        case raw_sector_size: return raw;
+        case no_sync_data_size: return raw.subspan(sync_pattern.size());
+        case mode_2_data_size: return raw.subspan(header_end);
+        default: {
+            if (!is_mode_2) { return raw.subspan(header_end, user_data_size); }
+            const auto is_form_2 = (raw[submode_offset] & submode_form_2) != 0;
+            return raw.subspan(sub_header_end, is_form_2 ? form_2_data_size : user_data_size);
+        }
+    }
+}
+
+MappedFile::MappedFile(const std::string& path) {
+#ifdef _WIN32
+    file_ = CreateFileW(fs::path(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file_ == INVALID_HANDLE_VALUE) {
+        file_ = nullptr;
+        return;
+    }
+
+    auto size = LARGE_INTEGER{};
+    if ((GetFileSizeEx(file_, &size) == 0) || (size.QuadPart == 0)) {
+        unmap();
+        return;
+    }
+
+    mapping_ = CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping_ == nullptr) {
+        unmap();
+        return;
+    }
+
+    data_ = static_cast<const u8*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr) {
+        unmap();
+        return;
+    }
+    size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+    // The mapping keeps its own reference to the file, the descriptor isn't needed once it's done.
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor == -1) { return; }
+
+    struct stat status {};
+    if ((fstat(descriptor, &status) == 0) && (status.st_size > 0)) {
+        const auto size = static_cast<std::size_t>(status.st_size);
+        if (auto* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0); view != MAP_FAILED) {
+            data_ = static_cast<const u8*>(view);
+            size_ = size;
+        }
+    }
+    ::close(descriptor);
+#endif
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    data_(std::exchange(other.data_, nullptr)),
+    size_(std::exchange(other.size_, 0)),
+    file_(std::exchange(other.file_, nullptr)),
+    mapping_(std::exchange(other.mapping_, nullptr)) {}
+
+auto MappedFile::operator=(MappedFile&& other) & noexcept -> MappedFile& {
+    if (this != &other) {
+        unmap();
+        data_    = std::exchange(other.data_, nullptr);
+        size_    = std::exchange(other.size_, 0);
+        file_    = std::exchange(other.file_, nullptr);
+        mapping_ = std::exchange(other.mapping_, nullptr);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+void MappedFile::unmap() {
+#ifdef _WIN32
+    if (data_ != nullptr) { UnmapViewOfFile(data_); }
+    if (mapping_ != nullptr) { CloseHandle(mapping_); }
+    if (file_ != nullptr) { CloseHandle(file_); }
+#else
+    if (data_ != nullptr) { munmap(const_cast<u8*>(data_), size_); }
+#endif
+    data_    = nullptr;
+    size_    = 0;
+    mapping_ = nullptr;
+    file_    = nullptr;
+}
+
+auto DiscImage::open(const std::string& path) -> bool {
+    close();
+
+    auto extension = fs::path(path).extension().string();
+    std::ranges::transform(extension, extension.begin(), [](const char c) { return static_cast<char>(std::tolower(c)); });
+
+    if ((extension == ".cue") || (extension == ".chd")) {
+        if (!((extension == ".cue") ? parseCue(path) : openChd(path))) {
+            close();
+            return false;
+        }
+    } else {
+        // Single track image, raw sectors are recognized by their sync pattern.
+        auto& file = files_.emplace_back(path);
+        if (!file.isOpened()) {
+            Log::warning(Logger::cdrom, tr("Could not open disc image {}"), path);
+            close();
+            return false;
+        }
+        const auto data   = file.data();
+        const auto is_raw = (data.size() % raw_sector_size == 0) && (data.size() >= sync_pattern.size())
+                            && std::equal(sync_pattern.begin(), sync_pattern.end(), data.begin());
+        auto track           = DiscTrack{};
+        track.number         = 1;
+        track.format         = is_raw ? TrackFormat::mode1_2352 : TrackFormat::mode1_2048;
+        track.sector_size    = sectorSize(track.format);
+        track.frame_size     = track.sector_size;
+        track.pregap_fad     = first_track_fad;
+        track.start_fad      = first_track_fad;
+        track.sectors_number = static_cast<u32>(data.size() / track.sector_size);
+        track.file_index     = 0;
+        track.file_offset    = 0;
+        if (is_raw && (data[header_end - 1] == 2)) { track.format = TrackFormat::mode2_2352; }
+        tracks_.push_back(track);
+        lead_out_fad_ = track.start_fad + track.sectors_number;
+    }
+
+    path_ = path;
+    Log::info(Logger::cdrom, tr("Disc image {} opened, {} track(s)"), path, tracks_.size());
+    file_system_.build();
+    return true;
+}
+
+void DiscImage::close() {
+    tracks_.clear();
+    files_.clear();
+    chd_.reset();
+    path_.clear();
+    lead_out_fad_  = 0;
+    current_track_ = 0;
+    file_system_.clear();
+}
+
+auto DiscImage::parseCue(const std::string& path) -> bool {
+    auto cue = std::ifstream(path);
+    if (!cue) {
+        Log::warning(Logger::cdrom, tr("Could not open disc image {}"), path);
+        return false;
+    }
+
+    // Index times are relative to the start of their file, they are converted to FADs once all the files are known.
+    struct CueTrack {
+        DiscTrack          track;
+        u32                pregap{};
+        std::optional<u32> index_0;
+        std::optional<u32> index_1;
+    };
+    auto cue_tracks = std::vector<CueTrack>{};
+
+    const auto directory = fs::path(path).parent_path();
+    auto       line      = std::string{};
+    auto       line_nb   = u32{};
+    while (std::getline(cue, line)) {
+        ++line_nb;
+        auto stream  = std::istringstream{line};
+        auto command = std::string{};
+        stream >> command;
+
+        if (command == "FILE") {
+            auto name = std::string{};
+            stream >> std::quoted(name);
+            const auto file_path = (directory / name).string();
+            if (!files_.emplace_back(file_path).isOpened()) {
+                Log::warning(Logger::cdrom, tr("Could not open disc image file {}"), file_path);
+                return false;
+            }
+        } else if (command == "TRACK") {
+            auto number = u32{};
+            auto type   = std::string{};
+            stream >> number >> type;
+            const auto format = parseTrackFormat(type);
+            if (files_.empty() || !format) {
+                Log::warning(Logger::cdrom, tr("Unsupported track at line {} of {}"), line_nb, path);
+                return false;
+            }
+            auto& cue_track             = cue_tracks.emplace_back();
+            cue_track.track.number      = static_cast<u8>(number);
+            cue_track.track.format      = *format;
+            cue_track.track.sector_size = sectorSize(*format);
+            cue_track.track.frame_size  = cue_track.track.sector_size;
+            cue_track.track.file_index  = files_.size() - 1;
+        } else if ((command == "INDEX") || (command == "PREGAP")) {
+            auto index = u32{};
+            if (command == "INDEX") { stream >> index; }
+            auto time = std::string{};
+            stream >> time;
+            const auto sectors = parseMsf(time);
+            if (cue_tracks.empty() || !sectors) {
+                Log::warning(Logger::cdrom, tr("Invalid index at line {} of {}"), line_nb, path);
+                return false;
+            }
+            auto& cue_track = cue_tracks.back();
+            if (command == "PREGAP") {
+                cue_track.pregap = *sectors;
+            } else if (index == 0) {
+                cue_track.index_0 = sectors;
+            } else if (index == 1) {
+                cue_track.index_1 = sectors;
+            }
+        }
+    }
+
+    auto fad = first_track_fad;
+    for (std::size_t i = 0; i < cue_tracks.size(); ++i) {
+        auto& [track, pregap, index_0, index_1] = cue_tracks[i];
+        if (!index_1) {
+            Log::warning(Logger::cdrom, tr("Track {} has no index 1 in {}"), track.number, path);
+            return false;
+        }
+
+        // The track ends where the next track of the same file begins, or at the end of the file.
+        const auto file_sectors = static_cast<u32>(files_[track.file_index].data().size() / track.sector_size);
+        auto       end          = file_sectors;
+        if ((i + 1 < cue_tracks.size()) && (cue_tracks[i + 1].track.file_index == track.file_index)) {
+            const auto& next = cue_tracks[i + 1];
+            end              = next.index_0.value_or(next.index_1.value_or(file_sectors));
+        }
+        if ((*index_1 > end) || (end > file_sectors)) {
+            Log::warning(Logger::cdrom, tr("Track {} is outside of its file in {}"), track.number, path);
+            return false;
+        }
+
+        track.pregap_fad = fad;
+        fad += pregap + (index_0 ? *index_1 - std::min(*index_0, *index_1) : 0);
+        track.start_fad      = fad;
+        track.sectors_number = end - *index_1;
+        track.file_offset    = static_cast<u64>(*index_1) * track.sector_size;
+        fad += track.sectors_number;
+        tracks_.push_back(track);
+    }
+    lead_out_fad_ = fad;
+
+    if (tracks_.empty()) {
+        Log::warning(Logger::cdrom, tr("No track found in {}"), path);
+        return false;
+    }
+    return true;
+}
+
+auto DiscImage::openChd(const std::string& path) -> bool {
+    chd_ = std::make_unique<ChdFile>(path);
+    if (!chd_->isOpened()) { return false; }
+
+    const auto formats = std::map<std::string, TrackFormat>{
+        {"MODE1",     TrackFormat::mode1_2048},
+        {"MODE1_RAW", TrackFormat::mode1_2352},
+        {"MODE2",     TrackFormat::mode2_2336},
+        {"MODE2_RAW", TrackFormat::mode2_2352},
+        {"AUDIO",     TrackFormat::audio     }
+    };
+
+    // Each track is stored as whole frames, padded to a multiple of chd_track_padding frames.
+    auto fad   = first_track_fad;
+    auto frame = u64{};
+    for (const auto& metadata : chd_->tracksMetadata()) {
+        const auto format = formats.find(metadata.type);
+        if (format == formats.end()) {
+            Log::warning(Logger::cdrom, tr("Unsupported track type {} in {}"), metadata.type, path);
+            return false;
+        }
+        const auto stored_pregap = metadata.is_pregap_stored ? metadata.pregap : 0;
+
+        auto track        = DiscTrack{};
+        track.number      = metadata.number;
+        track.format      = format->second;
+        track.sector_size = sectorSize(track.format);
+        track.frame_size  = chd_frame_size;
+        track.pregap_fad  = fad;
+        fad += metadata.pregap;
+        track.start_fad      = fad;
+        track.sectors_number = metadata.frames - std::min(stored_pregap, metadata.frames);
+        track.file_index     = 0;
+        track.file_offset    = (frame + stored_pregap) * chd_frame_size;
+        fad += track.sectors_number + metadata.postgap;
+        frame += metadata.frames + (chd_track_padding - metadata.frames % chd_track_padding) % chd_track_padding;
+        tracks_.push_back(track);
+    }
+    if (tracks_.empty()) {
+        Log::warning(Logger::cdrom, tr("No track found in {}"), path);
+        return false;
+    }
+    lead_out_fad_ = tracks_.back().start_fad + tracks_.back().sectors_number;
+    return true;
+}
+
+auto DiscImage::findTrack(const u32 fad) -> const DiscTrack* {
+    const auto contains = [fad](const DiscTrack& t) { return (fad >= t.pregap_fad) && (fad < t.start_fad + t.sectors_number); };
+
+    if (current_track_ < tracks_.size() && contains(tracks_[current_track_])) { return &tracks_[current_track_]; }
+    for (std::size_t i = 0; i < tracks_.size(); ++i) {
+        if (contains(tracks_[i])) {
+            current_track_ = i;
+            return &tracks_[i];
+        }
+    }
+    return nullptr;
+}
+
+auto DiscImage::rawSector(const u32 fad) -> std::span<const u8> {
+    const auto track = findTrack(fad);
+    if ((track == nullptr) || (fad < track->start_fad)) { return {}; }
+
+    const auto offset = track->file_offset + static_cast<u64>(fad - track->start_fad) * track->frame_size;
+    if (chd_) { return chd_->read(offset, track->sector_size); }
+    return files_[track->file_index].data().subspan(static_cast<std::size_t>(offset), track->sector_size);
+}
+
+auto DiscImage::sectorData(const u32 fad, const u16 length, std::span<u8, raw_sector_size> buffer) -> std::span<const u8> {
+    const auto track = findTrack(fad);
+    if (track == nullptr) { return {}; }
+
+    const auto raw = rawSector(fad);
+    switch (track->format) {
+        using enum TrackFormat;
+        case audio: {
+            if (raw.empty()) {
+                std::ranges::fill(buffer, u8{});
+                return buffer;
+            }
+            if (!chd_) { return raw; }
+            for (std::size_t i = 0; i < raw_sector_size; i += 2) {
+                buffer[i]     = raw[i + 1];
+                buffer[i + 1] = raw[i];
+            }
+            return buffer;
+        }
+        case mode1_2352:
+        case mode2_2352: {
+            const auto is_mode_2 = (track->format == mode2_2352);
+            if (!raw.empty()) { return sectorPart(raw, length, is_mode_2); }
+            writeHeader(buffer, fad, is_mode_2 ? 2 : 1);
+            return sectorPart(buffer, length, is_mode_2);
+        }
+        case mode1_2048: {
+            if ((length == user_data_size) && !raw.empty()) { return raw; }
+            writeHeader(buffer, fad, 1);
+            if (!raw.empty()) { std::ranges::copy(raw, buffer.begin() + header_end); }
+            return sectorPart(buffer, length, false);
+        }
+        case mode2_2336: {
+            if ((length == mode_2_data_size) && !raw.empty()) { return raw; }
+            writeHeader(buffer, fad, 2);
+            if (!raw.empty()) { std::ranges::copy(raw, buffer.begin() + header_end); }
+            return sectorPart(buffer, length, true);
+        }
+    }
+    return {};
+}
+
+auto DiscImage::initialize() -> bool { return true; }
+
+void DiscImage::shutdown() { close(); }
+
+auto DiscImage::scanBus() -> std::vector<ScsiDriveInfo> {
+    auto drives = std::vector<ScsiDriveInfo>{};
+    if (isOpened()) { drives.push_back({0, 0, 0, fs::path(path_).filename().string(), path_}); }
+    return drives;
+}
+
+auto DiscImage::readSector(const u32& fad, const s32& nb) -> std::string {
+    auto sector_data = std::string{};
+    auto buffer      = std::array<u8, raw_sector_size>{};
+    for (s32 i = 0; i < nb; ++i) {
+        const auto data = sectorData(fad + i, user_data_size, buffer);
+        sector_data.append(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+    return sector_data;
+}
+
+auto DiscImage::readToc(ScsiToc& toc_data) -> bool {
+    if (!isOpened()) { return false; }
+
+    // Same layout as the drive answer : MSF addresses, 2 seconds lead in included.
+    const auto setEntry = [](ScsiTocTrack& entry, const u8 number, const u8 control, const u32 fad) {
+        entry = {0,
+                 static_cast<u8>(toc_adr_position | control),
+                 number,
+                 0,
+                 {0,
+                  static_cast<u8>(fad / frames_per_second / seconds_per_minute),
+                  static_cast<u8>((fad / frames_per_second) % seconds_per_minute),
+                  static_cast<u8>(fad % frames_per_second)}};
+    };
+
+    toc_data = {};
+    const auto tracks_number = std::min(tracks_.size(), std::size_t{scsi_max_toc_tracks - 1});
+    for (std::size_t i = 0; i < tracks_number; ++i) {
+        const auto& track = tracks_[i];
+        setEntry(toc_data.track[i], track.number, (track.format == TrackFormat::audio) ? 0 : toc_control_data, track.start_fad);
+    }
+    setEntry(toc_data.track[tracks_number], lead_out_track, 0, lead_out_fad_);
+
+    const auto size = static_cast<u16>(2 + toc_entry_size * (tracks_number + 1));
+    toc_data.size   = {static_cast<u8>(size >> 8), static_cast<u8>(size)};
+    toc_data.first  = tracks_.front().number;
+    toc_data.last   = tracks_[tracks_number - 1].number;
+    return true;
+}
+
+} // namespace saturnin::cdrom
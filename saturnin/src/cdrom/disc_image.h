@@ -0,0 +1,305 @@
+//
+// disc_image.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	disc_image.h
+///
+/// \brief	Declares the DiscImage class, reading discs from ISO, BIN/CUE or CHD image files.
+///
+/// Image files are memory mapped when the disc is opened, nothing is read until a sector is
+/// requested. Sectors are returned as spans into the mapping (or into the decoded hunks cache for
+/// CHD files) : no allocation nor system call is done while streaming. A sector is only rebuilt, in
+/// a buffer given by the caller, when the requested format isn't the one stored in the image.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <memory> // unique_ptr
+#include <span>   // span
+#include <string> // string
+#include <vector> // vector
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::cdrom {
+
+//@{
+// Forward declarations
+class ChdFile;
+class IsoFileSystem;
+struct ScsiDriveInfo;
+struct ScsiToc;
+//@}
+
+constexpr auto raw_sector_size   = u16{2352}; ///< Full sector size, including sync, header and error correction.
+constexpr auto user_data_size    = u16{2048}; ///< Mode 1 / mode 2 form 1 user data size.
+constexpr auto form_2_data_size  = u16{2324}; ///< Mode 2 form 2 user data size.
+constexpr auto mode_2_data_size  = u16{2336}; ///< Mode 2 data size, sub header included.
+constexpr auto no_sync_data_size = u16{2340}; ///< Sector size without the sync pattern.
+constexpr auto first_track_fad   = u32{150};  ///< FAD of the first track, after the 2 seconds lead in.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   TrackFormat
+///
+/// \brief  Format of the sectors of a track in the image file.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class TrackFormat : u8 {
+    mode1_2048, ///< Mode 1, user data only (ISO).
+    mode1_2352, ///< Mode 1, raw sectors.
+    mode2_2336, ///< Mode 2, sub header and data.
+    mode2_2352, ///< Mode 2, raw sectors.
+    audio       ///< CD-DA, 2352 bytes of samples.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct DiscTrack
+///
+/// \brief  A track of the disc, and where its sectors are stored.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct DiscTrack {
+    u8          number;         ///< Track number, from 1.
+    TrackFormat format;         ///< Sectors format.
+    u16         sector_size;    ///< Sector size in the image file.
+    u16         frame_size;     ///< Distance between two sectors in the image file.
+    u32         pregap_fad;     ///< FAD of index 0, same as start_fad when the track has no pregap.
+    u32         start_fad;      ///< FAD of index 1.
+    u32         sectors_number; ///< Sectors stored from index 1.
+    std::size_t file_index;     ///< Image file holding the track.
+    u64         file_offset;    ///< Offset of index 1 in the file.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  MappedFile
+///
+/// \brief  Read only memory mapping of a whole file.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class MappedFile {
+  public:
+    //@{
+    // Constructors / Destructors
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    auto operator=(const MappedFile&) & -> MappedFile& = delete;
+    auto operator=(MappedFile&& other) & noexcept -> MappedFile&;
+    ~MappedFile();
+    //@}
+
+    [[nodiscard]] auto isOpened() const -> bool { return data_ != nullptr; }
+    [[nodiscard]] auto data() const -> std::span<const u8> { return {data_, size_}; }
+
+  private:
+    void unmap();
+
+    const u8*   data_{nullptr};    ///< Mapped content.
+    std::size_t size_{};           ///< Size of the file.
+    void*       file_{nullptr};    ///< File handle, Windows only.
+    void*       mapping_{nullptr}; ///< File mapping handle, Windows only.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  DiscImage
+///
+/// \brief  Disc image access. Follows the Spti / Aspi interface, so it can be used through the Scsi
+///         function pointers, and adds direct sector access.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class DiscImage {
+  public:
+    //@{
+    // Constructors / Destructors
+    DiscImage()                                      = delete;
+    DiscImage(const DiscImage&)                      = delete;
+    DiscImage(DiscImage&&)                           = delete;
+    auto operator=(const DiscImage&) & -> DiscImage& = delete;
+    auto operator=(DiscImage&&) & -> DiscImage&      = delete;
+    ~DiscImage()                                     = delete;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::open(const std::string& path) -> bool;
+    ///
+    /// \brief  Opens a disc image. CUE sheets are parsed and their files mapped, CHD files are
+    ///         described by their metadata, any other file is handled as an ISO (a single mode 1
+    ///         track of 2048 bytes sectors).
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the image.
+    ///
+    /// \returns    False if the image couldn't be opened.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto open(const std::string& path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static void DiscImage::close();
+    ///
+    /// \brief  Closes the current image.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void close();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::isOpened() -> bool
+    ///
+    /// \brief  Checks if an image is opened.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if an image is opened.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto isOpened() -> bool { return !tracks_.empty(); }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::tracks() -> const std::vector<DiscTrack>&
+    ///
+    /// \brief  Returns the tracks of the current image.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The tracks, ordered by FAD.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto tracks() -> const std::vector<DiscTrack>& { return tracks_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::leadOutFad() -> u32
+    ///
+    /// \brief  Returns the FAD of the lead out, following the last sector of the last track.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The lead out FAD.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto leadOutFad() -> u32 { return lead_out_fad_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::fileSystem() -> const IsoFileSystem&
+    ///
+    /// \brief  Returns the index of the ISO9660 file system, built when the image is opened.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The file system index, empty if the disc has no ISO9660 file system.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto fileSystem() -> const IsoFileSystem& { return file_system_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::findTrack(const u32 fad) -> const DiscTrack*;
+    ///
+    /// \brief  Finds the track holding a FAD, pregap included. The last found track is checked first,
+    ///         so sequential reads don't search.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  fad The FAD.
+    ///
+    /// \returns    The track, or nullptr if the FAD is outside the disc.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto findTrack(const u32 fad) -> const DiscTrack*;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::rawSector(const u32 fad) -> std::span<const u8>;
+    ///
+    /// \brief  Returns a sector as stored in the image file.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  fad The FAD of the sector.
+    ///
+    /// \returns    Span into the mapped file, or into the CHD cache until the next read. Empty for
+    ///             pregaps and FADs outside the disc.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto rawSector(const u32 fad) -> std::span<const u8>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto DiscImage::sectorData(const u32 fad, const u16 length, std::span<u8, raw_sector_size> buffer)
+    /// -> std::span<const u8>;
+    ///
+    /// \brief  Returns the sector data in the requested length, as sent by the CD drive : 2048
+    ///         (user data, 2324 for mode 2 form 2 sectors), 2336, 2340 or 2352 bytes. The span points
+    ///         into the mapped file when the image holds the data as is, otherwise the sector is
+    ///         rebuilt in the buffer. Error correction codes aren't generated. CHD audio, stored big
+    ///         endian, is swapped in the buffer.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          fad     The FAD of the sector.
+    /// \param          length  The requested length.
+    /// \param [in,out] buffer  Buffer used when the sector has to be rebuilt.
+    ///
+    /// \returns    The sector data, empty for FADs outside the disc.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto sectorData(const u32 fad, const u16 length, std::span<u8, raw_sector_size> buffer) -> std::span<const u8>;
+
+    /// \name Scsi interface
+    ///
+    /// Used through the Scsi function pointers when the image access method is selected.
+    //@{
+    static auto initialize() -> bool;
+    static void shutdown();
+    static auto scanBus() -> std::vector<ScsiDriveInfo>;
+    static auto readSector(const u32& fad, const s32& nb) -> std::string;
+    static auto readToc(ScsiToc& toc_data) -> bool;
+    //@}
+
+  private:
+    static auto parseCue(const std::string& path) -> bool;
+    static auto openChd(const std::string& path) -> bool;
+
+    static std::string              path_;          ///< Path of the opened image.
+    static std::vector<MappedFile>  files_;         ///< Mapped image files.
+    static std::unique_ptr<ChdFile> chd_;           ///< CHD file, instead of the mapped files.
+    static std::vector<DiscTrack>   tracks_;        ///< Tracks of the disc.
+    static u32                      lead_out_fad_;  ///< Lead out FAD.
+    static std::size_t              current_track_; ///< Last track found, checked first by findTrack().
+    static IsoFileSystem            file_system_;   ///< ISO9660 file system of the disc.
+};
+
+} // namespace saturnin::cdrom
@@ -0,0 +1,202 @@
+//
+// iso9660.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/cdrom/iso9660.h>
+#include <algorithm> // copy_n, equal, transform
+#include <array>     // array
+#include <cctype>    // toupper
+#include <vector>    // vector
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>    // Log
+
+namespace saturnin::cdrom {
+
+using core::Log;
+using core::Logger;
+using core::tr;
+
+// Multi bytes values are read from the big endian half of the both-endian fields, and from the type M path table.
+constexpr auto standard_identifier       = std::array<u8, 5>{'C', 'D', '0', '0', '1'};
+constexpr auto descriptor_primary        = u8{1};      // Primary volume descriptor type.
+constexpr auto descriptor_terminator     = u8{255};    // Volume descriptor set terminator type.
+constexpr auto max_volume_descriptors    = u8{16};     // Descriptors read before giving up.
+constexpr auto volume_identifier_offset  = u16{40};    // Volume identifier in the primary volume descriptor.
+constexpr auto volume_identifier_size    = u16{32};    // Volume identifier size.
+constexpr auto path_table_size_offset    = u16{136};   // Path table size in the primary volume descriptor.
+constexpr auto type_m_path_table_offset  = u16{148};   // Type M path table block in the primary volume descriptor.
+constexpr auto max_path_table_size       = u32{65536}; // Larger path tables are considered corrupted.
+constexpr auto path_extent_offset        = u16{2};     // Extent of a path table entry.
+constexpr auto path_parent_offset        = u16{6};     // Parent directory number of a path table entry.
+constexpr auto path_identifier_offset    = u16{8};     // Identifier of a path table entry.
+constexpr auto record_min_size           = u16{34};    // Directory record size with a 1 byte identifier.
+constexpr auto record_extent_offset      = u16{6};     // Extent of a directory record.
+constexpr auto record_size_offset        = u16{14};    // Data length of a directory record.
+constexpr auto record_flags_offset       = u16{25};    // File flags of a directory record.
+constexpr auto record_identifier_length  = u16{32};    // Identifier length of a directory record.
+constexpr auto record_identifier_offset  = u16{33};    // Identifier of a directory record.
+constexpr auto record_flag_directory     = u8{0x02};   // Entry is a directory.
+constexpr auto max_directory_blocks      = u32{256};   // Larger directories are considered corrupted.
+
+inline auto readBigEndian16(std::span<const u8> data, const std::size_t offset) -> u16 {
+    return static_cast<u16>((data[offset] << 8) | data[offset + 1]);
+}
+
+inline auto readBigEndian32(std::span<const u8> data, const std::size_t offset) -> u32 {
+    return (static_cast<u32>(data[offset]) << 24) | (static_cast<u32>(data[offset + 1]) << 16)
+           | (static_cast<u32>(data[offset + 2]) << 8) | static_cast<u32>(data[offset + 3]);
+}
+
+// Uppercases an identifier and removes its version suffix, and the dot of files without extension.
+inline auto normalizeIdentifier(std::string identifier) -> std::string {
+    if (const auto version = identifier.find(';'); version != std::string::npos) { identifier.resize(version); }
+    if (!identifier.empty() && (identifier.back() == '.')) { identifier.pop_back(); }
+    std::ranges::transform(identifier, identifier.begin(), [](const char c) { return static_cast<char>(std::toupper(c)); });
+    return identifier;
+}
+
+auto IsoFileSystem::build() -> bool {
+    clear();
+
+    auto block = std::array<u8, user_data_size>{};
+    auto lba   = u32{system_area_blocks};
+    for (; lba < system_area_blocks + max_volume_descriptors; ++lba) {
+        if (!readBlock(lba, block)) { return false; }
+        if (!std::equal(standard_identifier.begin(), standard_identifier.end(), block.begin() + 1)) { return false; }
+        if (block[0] == descriptor_primary) { break; }
+        if (block[0] == descriptor_terminator) { return false; }
+    }
+    if (block[0] != descriptor_primary) { return false; }
+
+    const auto identifier = std::string(block.begin() + volume_identifier_offset,
+                                        block.begin() + volume_identifier_offset + volume_identifier_size);
+    volume_identifier_    = identifier.substr(0, identifier.find_last_not_of(' ') + 1);
+
+    // The path table lists every directory, parents first : the directories are indexed without walking the tree.
+    const auto path_table_size = readBigEndian32(block, path_table_size_offset);
+    const auto path_table_lba  = readBigEndian32(block, type_m_path_table_offset);
+    if ((path_table_size == 0) || (path_table_size > max_path_table_size)) { return false; }
+
+    auto path_table = std::vector<u8>((path_table_size + user_data_size - 1) / user_data_size * user_data_size);
+    for (u32 i = 0; i < path_table.size() / user_data_size; ++i) {
+        if (!readBlock(path_table_lba + i, std::span(path_table).subspan(i * user_data_size).first<user_data_size>())) {
+            return false;
+        }
+    }
+
+    auto directories = std::vector<std::pair<std::string, u32>>{}; // Path and extent, by directory number - 1.
+    auto offset      = u32{};
+    while (offset + path_identifier_offset < path_table_size) {
+        const auto identifier_length = path_table[offset];
+        if ((identifier_length == 0) || (offset + path_identifier_offset + identifier_length > path_table_size)) { break; }
+
+        const auto extent = readBigEndian32(path_table, offset + path_extent_offset);
+        const auto parent = readBigEndian16(path_table, offset + path_parent_offset);
+        if (directories.empty()) {
+            directories.emplace_back("", extent); // Root directory, its identifier is a 0 byte.
+        } else {
+            if ((parent == 0) || (parent > directories.size())) { break; }
+            const auto name = std::string(path_table.begin() + offset + path_identifier_offset,
+                                          path_table.begin() + offset + path_identifier_offset + identifier_length);
+            directories.emplace_back(directories[parent - 1].first + "/" + normalizeIdentifier(name), extent);
+        }
+        offset += path_identifier_offset + identifier_length + (identifier_length & 1);
+    }
+    if (directories.empty()) { return false; }
+
+    for (const auto& [path, extent] : directories) {
+        if (!readDirectory(path, extent)) {
+            Log::warning(Logger::cdrom, tr("ISO9660 directory {} couldn't be read"), path.empty() ? "/" : path);
+        }
+    }
+
+    Log::info(Logger::cdrom, tr("ISO9660 volume {} indexed, {} entries"), volume_identifier_, files_.size());
+    return isValid();
+}
+
+void IsoFileSystem::clear() {
+    files_.clear();
+    volume_identifier_.clear();
+    first_file_.clear();
+}
+
+auto IsoFileSystem::find(const std::string& path) const -> const IsoFile* {
+    auto key = normalizeIdentifier(path);
+    std::ranges::replace(key, '\\', '/');
+    if (key.empty() || (key.front() != '/')) { key.insert(key.begin(), '/'); }
+
+    const auto it = files_.find(key);
+    return (it != files_.end()) ? &it->second : nullptr;
+}
+
+auto IsoFileSystem::firstFile() const -> const IsoFile* { return first_file_.empty() ? nullptr : find(first_file_); }
+
+auto IsoFileSystem::readBlock(const u32 lba, std::span<u8, user_data_size> block) -> bool {
+    if (!DiscImage::isOpened() || (DiscImage::tracks().front().format == TrackFormat::audio)) { return false; }
+
+    auto       buffer = std::array<u8, raw_sector_size>{};
+    const auto data   = DiscImage::sectorData(DiscImage::tracks().front().start_fad + lba, user_data_size, buffer);
+    if (data.size() < user_data_size) { return false; }
+    std::copy_n(data.begin(), user_data_size, block.begin());
+    return true;
+}
+
+auto IsoFileSystem::readDirectory(const std::string& path, const u32 lba) -> bool {
+    auto block = std::array<u8, user_data_size>{};
+    if (!readBlock(lba, block) || (block[0] < record_min_size)) { return false; }
+
+    // The first record of a directory is the directory itself, giving the extent size.
+    const auto blocks_number = (readBigEndian32(block, record_size_offset) + user_data_size - 1) / user_data_size;
+    if (blocks_number > max_directory_blocks) { return false; }
+
+    files_.try_emplace(path.empty() ? "/" : path, IsoFile{lba, blocks_number * user_data_size, true});
+
+    for (u32 i = 0; i < blocks_number; ++i) {
+        if ((i != 0) && !readBlock(lba + i, block)) { return false; }
+
+        // Records don't cross block boundaries, the end of a block is padded with zeros.
+        auto offset = u32{};
+        while (offset + record_min_size <= user_data_size) {
+            const auto length            = block[offset];
+            const auto identifier_length = block[offset + record_identifier_length];
+            if ((length < record_min_size) || (offset + length > user_data_size)
+                || (record_identifier_offset + identifier_length > length)) {
+                break;
+            }
+
+            // Identifiers 0 and 1 are the current and the parent directories.
+            const auto identifier = block[offset + record_identifier_offset];
+            if ((identifier_length != 1) || (identifier > 1)) {
+                const auto name = std::string(block.begin() + offset + record_identifier_offset,
+                                              block.begin() + offset + record_identifier_offset + identifier_length);
+                const auto full_path    = path + "/" + normalizeIdentifier(name);
+                const auto is_directory = (block[offset + record_flags_offset] & record_flag_directory) != 0;
+                files_.try_emplace(full_path,
+                                   IsoFile{readBigEndian32(block, offset + record_extent_offset),
+                                           readBigEndian32(block, offset + record_size_offset),
+                                           is_directory});
+                if (path.empty() && !is_directory && first_file_.empty()) { first_file_ = full_path; }
+            }
+            offset += length;
+        }
+    }
+    return true;
+}
+
+} // namespace saturnin::cdrom
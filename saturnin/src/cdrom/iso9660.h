@@ -19,12 +19,18 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \file:	iso9660.h
 ///
-/// \brief: Structures encapsulating a CD's TOC informations
+/// \brief: Structures encapsulating a CD's TOC informations, and the index of the ISO9660 file
+///         system of the disc image.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
 
 #include <cstdint>
+#include <span>          // span
+#include <string>        // string
+#include <unordered_map> // unordered_map
+#include <saturnin/src/emulator_defs.h>
+#include <saturnin/src/cdrom/disc_image.h> // user_data_size
 
 namespace saturnin::cdrom {
 
@@ -220,4 +226,127 @@ struct PrimaryVolumeDescriptor {
     uint8_t reserved_for_future_standardization2[653];   ///< 0
 };
 
+constexpr auto system_area_blocks = u8{16}; ///< Blocks before the volume descriptors, holding IP.BIN on a Saturn disc.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct IsoFile
+///
+/// \brief  A file or a directory of the ISO9660 file system.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct IsoFile {
+    u32  lba;          ///< Logical block of the extent.
+    u32  size;         ///< Size in bytes.
+    bool is_directory; ///< True for directories.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  IsoFileSystem
+///
+/// \brief  Index of the ISO9660 file system of the disc image, built once when the image is
+///         opened. Directories are listed from the path table, then each directory extent is read
+///         once : files are then found by their path without reading the disc.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class IsoFileSystem {
+  public:
+    //@{
+    // Constructors / Destructors
+    IsoFileSystem()                                          = default;
+    IsoFileSystem(const IsoFileSystem&)                      = delete;
+    IsoFileSystem(IsoFileSystem&&)                           = delete;
+    auto operator=(const IsoFileSystem&) & -> IsoFileSystem& = delete;
+    auto operator=(IsoFileSystem&&) & -> IsoFileSystem&      = delete;
+    ~IsoFileSystem()                                         = default;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto IsoFileSystem::build() -> bool;
+    ///
+    /// \brief  Reads the primary volume descriptor, the path table and the directories of the
+    ///         opened disc image.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    False if the disc doesn't hold a valid ISO9660 file system, the index is empty then.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto build() -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void IsoFileSystem::clear();
+    ///
+    /// \brief  Empties the index.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void clear();
+
+    [[nodiscard]] auto isValid() const -> bool { return !files_.empty(); }
+    [[nodiscard]] auto volumeIdentifier() const -> const std::string& { return volume_identifier_; }
+    [[nodiscard]] auto files() const -> const std::unordered_map<std::string, IsoFile>& { return files_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto IsoFileSystem::find(const std::string& path) const -> const IsoFile*;
+    ///
+    /// \brief  Finds a file or a directory.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path from the root directory, case insensitive. The leading separator and the
+    ///                 version suffix (";1") are optional.
+    ///
+    /// \returns    The file, or nullptr if it isn't part of the disc.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto find(const std::string& path) const -> const IsoFile*;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto IsoFileSystem::firstFile() const -> const IsoFile*;
+    ///
+    /// \brief  Returns the first file recorded in the root directory, which is the first read file of
+    ///         a Saturn disc.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The file, or nullptr if the root directory holds no file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto firstFile() const -> const IsoFile*;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto IsoFileSystem::readBlock(const u32 lba, std::span<u8, user_data_size> block) -> bool;
+    ///
+    /// \brief  Reads a logical block of the data track.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          lba     The logical block, relative to the start of the first track.
+    /// \param [in,out] block   Where the block is copied.
+    ///
+    /// \returns    False if the block is outside the disc.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto readBlock(const u32 lba, std::span<u8, user_data_size> block) -> bool;
+
+  private:
+    auto readDirectory(const std::string& path, const u32 lba) -> bool;
+
+    std::unordered_map<std::string, IsoFile> files_;             ///< Files and directories, by full path.
+    std::string                              volume_identifier_; ///< Volume identifier.
+    std::string                              first_file_;        ///< Path of the first file of the root directory.
+};
+
 } // namespace saturnin::cdrom
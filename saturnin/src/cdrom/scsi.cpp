@@ -20,6 +20,7 @@
 #include <saturnin/src/pch.h>
 #include <saturnin/src/cdrom/scsi.h>
 #include <saturnin/src/cdrom/aspi.h>
+#include <saturnin/src/cdrom/disc_image.h>
 #include <saturnin/src/cdrom/spti.h>
 
 namespace saturnin::cdrom {
@@ -64,4 +65,12 @@ void Scsi::settingUpSptiFunctions() {
     readToc    = &Spti::readToc;
 }
 
+void Scsi::settingUpImageFunctions() {
+    initialize = &DiscImage::initialize;
+    scanBus    = &DiscImage::scanBus;
+    readSector = &DiscImage::readSector;
+    shutdown   = &DiscImage::shutdown;
+    readToc    = &DiscImage::readToc;
+}
+
 } // namespace saturnin::cdrom
@@ -132,9 +132,19 @@ class Scsi {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     static void settingUpSptiFunctions();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn	static void settingUpImageFunctions()
+    ///
+    /// \brief	Fills the function pointers with disc image functions.
+    ///
+    /// \author	Runik
+    /// \date	19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    static void settingUpImageFunctions();
+
     /// \name Function pointers
     ///
-    /// Will hold the pointer to the Spti or Aspi functions
+    /// Will hold the pointer to the Spti, Aspi or disc image functions
     //@{
     static std::function<bool(void)>                            initialize;
     static std::function<std::vector<ScsiDriveInfo>(void)>      scanBus;
@@ -0,0 +1,168 @@
+//
+// sector_buffer.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/cdrom/sector_buffer.h>
+#include <algorithm> // copy, min
+#include <saturnin/src/save_state.h>
+
+namespace saturnin::cdrom {
+
+void SectorBuffer::clear() {
+    for (u8 i = 0; i < MAX_SECTORS; ++i) {
+        sectors_[i].size     = 0;
+        sectors_[i].next     = (i + 1 < MAX_SECTORS) ? static_cast<u8>(i + 1) : no_sector;
+        sectors_[i].previous = no_sector;
+    }
+    free_first_  = 0;
+    free_number_ = MAX_SECTORS;
+
+    partitions_.fill({no_sector, no_sector, 0});
+}
+
+void SectorBuffer::clearPartition(const u8 partition) { remove(partition, 0, partitions_[partition].size); }
+
+auto SectorBuffer::allocate() -> u8 {
+    const auto slot = free_first_;
+    if (slot == no_sector) { return no_sector; }
+
+    free_first_ = sectors_[slot].next;
+    --free_number_;
+
+    sectors_[slot].next     = no_sector;
+    sectors_[slot].previous = no_sector;
+    return slot;
+}
+
+void SectorBuffer::release(const u8 slot) {
+    sectors_[slot].size     = 0;
+    sectors_[slot].next     = free_first_;
+    sectors_[slot].previous = no_sector;
+    free_first_             = slot;
+    ++free_number_;
+}
+
+void SectorBuffer::append(const u8 partition, const u8 slot) {
+    auto& part              = partitions_[partition];
+    sectors_[slot].next     = no_sector;
+    sectors_[slot].previous = part.last;
+    if (part.last == no_sector) {
+        part.first = slot;
+    } else {
+        sectors_[part.last].next = slot;
+    }
+    part.last                          = slot;
+    positions_[partition][part.size++] = slot;
+}
+
+auto SectorBuffer::find(const u8 partition, const u8 position) const -> u8 {
+    return (position < partitions_[partition].size) ? positions_[partition][position] : no_sector;
+}
+
+void SectorBuffer::remove(const u8 partition, const u8 position, const u8 number) {
+    const auto& part = partitions_[partition];
+    if (position >= part.size) { return; }
+    const auto removed = std::min(number, static_cast<u8>(part.size - position));
+
+    for (u8 i = 0; i < removed; ++i) {
+        const auto slot = positions_[partition][position + i];
+        unlink(partition, slot);
+        release(slot);
+    }
+    erasePositions(partition, position, removed);
+}
+
+void SectorBuffer::move(const u8 destination, const u8 source, const u8 position, const u8 number) {
+    const auto& part = partitions_[source];
+    if (position >= part.size) { return; }
+    const auto moved = std::min(number, static_cast<u8>(part.size - position));
+
+    // Slots are unlinked before being appended, the destination may be the source partition.
+    auto slots = std::array<u8, MAX_SECTORS>{};
+    for (u8 i = 0; i < moved; ++i) {
+        slots[i] = positions_[source][position + i];
+        unlink(source, slots[i]);
+    }
+    erasePositions(source, position, moved);
+    for (u8 i = 0; i < moved; ++i) {
+        append(destination, slots[i]);
+    }
+}
+
+auto SectorBuffer::copy(const u8 destination, const u8 source, const u8 position, const u8 number) -> bool {
+    const auto& part = partitions_[source];
+    if (position >= part.size) { return true; }
+    const auto copied = std::min(number, static_cast<u8>(part.size - position));
+    if (copied > free_number_) { return false; }
+
+    // Appended positions follow the copied ones, even when the destination is the source partition.
+    for (u8 i = 0; i < copied; ++i) {
+        const auto new_slot = allocate();
+        sectors_[new_slot]  = sectors_[positions_[source][position + i]];
+        append(destination, new_slot);
+    }
+    return true;
+}
+
+template<typename Archive>
+void SectorBuffer::serialize(Archive& ar) {
+    ar.bytes(std::span(sectors_));
+    ar.value(partitions_);
+    ar.value(free_first_);
+    ar.value(free_number_);
+    if constexpr (Archive::is_loading) { rebuildPositions(); }
+}
+
+template void SectorBuffer::serialize(core::StateWriter&);
+template void SectorBuffer::serialize(core::StateReader&);
+
+void SectorBuffer::unlink(const u8 partition, const u8 slot) {
+    auto&       part   = partitions_[partition];
+    const auto& sector = sectors_[slot];
+    if (sector.previous == no_sector) {
+        part.first = sector.next;
+    } else {
+        sectors_[sector.previous].next = sector.next;
+    }
+    if (sector.next == no_sector) {
+        part.last = sector.previous;
+    } else {
+        sectors_[sector.next].previous = sector.previous;
+    }
+    --part.size;
+}
+
+void SectorBuffer::erasePositions(const u8 partition, const u8 position, const u8 number) {
+    // The partition size was already decreased when the slots were unlinked.
+    auto&      positions = positions_[partition];
+    const auto end       = partitions_[partition].size + number;
+    std::copy(positions.begin() + position + number, positions.begin() + end, positions.begin() + position);
+}
+
+void SectorBuffer::rebuildPositions() {
+    for (u8 partition = 0; partition < MAX_SELECTORS; ++partition) {
+        auto slot = partitions_[partition].first;
+        for (u8 position = 0; (position < partitions_[partition].size) && (slot != no_sector); ++position) {
+            positions_[partition][position] = slot;
+            slot                            = sectors_[slot].next;
+        }
+    }
+}
+
+} // namespace saturnin::cdrom
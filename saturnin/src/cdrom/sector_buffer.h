@@ -0,0 +1,273 @@
+//
+// sector_buffer.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	sector_buffer.h
+///
+/// \brief	Declares the SectorBuffer class, the 200 sectors memory of the CD block.
+///
+/// Sectors never move once stored : partitions are lists linked through the slots themselves, so
+/// appending, deleting or moving a sector between partitions only updates a few indices. Free slots
+/// are chained the same way. Each partition also keeps its slots by position, so a sector is found
+/// without walking the list.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array> // array
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::cdrom {
+
+constexpr auto MAX_SELECTORS = u8{24};    ///< Selectors (filter+buffer partition) number.
+constexpr auto MAX_SECTORS   = u8{200};   ///< Number of sectors that can be stored.
+constexpr auto sector_size   = u16{2352}; ///< Sector size in bytes.
+
+constexpr auto no_sector = u8{0xFF}; ///< End of a list of slots, or no free slot remaining.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct	Sector
+///
+/// \brief	A slot of the sector buffer.
+///
+/// \author	Runik
+/// \date	01/03/2010
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Sector {
+    std::array<u8, sector_size> data;        ///< Raw sector, as read from the disc.
+    u16                         data_offset; ///< Offset of the data sent to the host.
+    u16                         size;        ///< Size of the data sent to the host.
+    u32                         fad;         ///< Sector FAD.
+
+    /// \name Sub header
+    //@{
+    u8 file_number;
+    u8 channel_number;
+    u8 sub_mode;
+    u8 coding_info;
+    //@}
+
+    u8 next;     ///< Next slot of the partition, or of the free list.
+    u8 previous; ///< Previous slot of the partition.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct	BufferPartition
+///
+/// \brief	Defines a buffer partition.
+///
+/// \author	Runik
+/// \date	01/03/2010
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct BufferPartition {
+    u8 first; ///< First slot, no_sector when the partition is empty.
+    u8 last;  ///< Last slot.
+    u8 size;  ///< Partition size in sectors.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  SectorBuffer
+///
+/// \brief  Pool of sector slots shared by the buffer partitions.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SectorBuffer {
+  public:
+    //@{
+    // Constructors / Destructors
+    SectorBuffer() { clear(); }
+    SectorBuffer(const SectorBuffer&)                      = delete;
+    SectorBuffer(SectorBuffer&&)                           = delete;
+    auto operator=(const SectorBuffer&) & -> SectorBuffer& = delete;
+    auto operator=(SectorBuffer&&) & -> SectorBuffer&      = delete;
+    ~SectorBuffer()                                        = default;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SectorBuffer::clear();
+    ///
+    /// \brief  Empties all the partitions.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void clear();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SectorBuffer::clearPartition(const u8 partition);
+    ///
+    /// \brief  Frees the sectors of a partition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  partition   The partition.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void clearPartition(const u8 partition);
+
+    [[nodiscard]] auto freeSectorsNumber() const -> u8 { return free_number_; }
+    [[nodiscard]] auto partition(const u8 partition) const -> const BufferPartition& { return partitions_[partition]; }
+    [[nodiscard]] auto sector(const u8 slot) -> Sector& { return sectors_[slot]; }
+    [[nodiscard]] auto sector(const u8 slot) const -> const Sector& { return sectors_[slot]; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SectorBuffer::allocate() -> u8;
+    ///
+    /// \brief  Takes a slot from the free list. The slot belongs to no partition until append() is
+    ///         called, or has to be given back with release().
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The slot, or no_sector if the buffer is full.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto allocate() -> u8;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SectorBuffer::release(const u8 slot);
+    ///
+    /// \brief  Gives back to the free list a slot which isn't part of a partition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  slot    The slot.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void release(const u8 slot);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SectorBuffer::append(const u8 partition, const u8 slot);
+    ///
+    /// \brief  Adds an allocated slot at the end of a partition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  partition   The partition.
+    /// \param  slot        The slot.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void append(const u8 partition, const u8 slot);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SectorBuffer::find(const u8 partition, const u8 position) const -> u8;
+    ///
+    /// \brief  Gets the slot at a position of a partition, from the positions index.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  partition   The partition.
+    /// \param  position    Position of the sector in the partition.
+    ///
+    /// \returns    The slot, or no_sector if the position is outside the partition.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto find(const u8 partition, const u8 position) const -> u8;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SectorBuffer::remove(const u8 partition, const u8 position, const u8 number);
+    ///
+    /// \brief  Frees sectors of a partition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  partition   The partition.
+    /// \param  position    Position of the first sector.
+    /// \param  number      Number of sectors, clamped to the end of the partition.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void remove(const u8 partition, const u8 position, const u8 number);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SectorBuffer::move(const u8 destination, const u8 source, const u8 position, const u8 number);
+    ///
+    /// \brief  Moves sectors at the end of another partition, without copying their data.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  destination Destination partition.
+    /// \param  source      Source partition.
+    /// \param  position    Position of the first sector in the source partition.
+    /// \param  number      Number of sectors, clamped to the end of the source partition.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void move(const u8 destination, const u8 source, const u8 position, const u8 number);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SectorBuffer::copy(const u8 destination, const u8 source, const u8 position, const u8 number) -> bool;
+    ///
+    /// \brief  Copies sectors at the end of another partition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  destination Destination partition.
+    /// \param  source      Source partition.
+    /// \param  position    Position of the first sector in the source partition.
+    /// \param  number      Number of sectors, clamped to the end of the source partition.
+    ///
+    /// \returns    False if there isn't enough free slots, nothing is copied then.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto copy(const u8 destination, const u8 source, const u8 position, const u8 number) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void SectorBuffer::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the slots and the lists linking them.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
+  private:
+    void unlink(const u8 partition, const u8 slot);
+
+    // Removes a range of positions from the index of a partition, once its slots were unlinked.
+    void erasePositions(const u8 partition, const u8 position, const u8 number);
+
+    // Rebuilds the positions index from the lists, after a state load.
+    void rebuildPositions();
+
+    std::array<Sector, MAX_SECTORS>                        sectors_;     ///< Sector slots.
+    std::array<BufferPartition, MAX_SELECTORS>             partitions_;  ///< Buffer partitions.
+    std::array<std::array<u8, MAX_SECTORS>, MAX_SELECTORS> positions_;   ///< Slots of each partition, by position.
+    u8                                                     free_first_;  ///< First free slot.
+    u8                                                     free_number_; ///< Number of free slots.
+};
+
+} // namespace saturnin::cdrom
@@ -43,11 +43,17 @@ Config::Config(std::string_view configuration_filename) : filename_(configuratio
         {cfg_global_stv_bios_bypass,              "global.stv_bios_bypass"             },
         {cfg_rendering_renderer,                  "rendering.renderer"                 },
         {cfg_rendering_tv_standard,               "rendering.tv_standard"              },
+        {cfg_rendering_fast_forward_frame_skip,   "rendering.fast_forward_frame_skip"  },
+        {cfg_rewind_enabled,                      "rewind.enabled"                     },
+        {cfg_rewind_interval,                     "rewind.interval"                    },
+        {cfg_rewind_memory_budget,                "rewind.memory_budget"               },
         {cfg_paths_roms_stv,                      "paths.roms_stv"                     },
         {cfg_paths_bios_stv,                      "paths.bios_stv"                     },
         {cfg_paths_bios_saturn,                   "paths.bios_saturn"                  },
         {cfg_cdrom_drive,                         "cdrom.drive"                        },
         {cfg_cdrom_access_method,                 "cdrom.access_method"                },
+        {cfg_cdrom_image,                         "cdrom.image"                        },
+        {cfg_cdrom_fast_boot,                     "cdrom.fast_boot"                    },
         {cfg_sound_soundcard,                     "sound.soundcard"                    },
         {cfg_sound_disabled,                      "sound.disabled"                     },
         {cfg_controls_saturn_player_1,            "controls.saturn.player_1"           },
@@ -87,11 +93,17 @@ Config::Config(std::string_view configuration_filename) : filename_(configuratio
         {cfg_global_stv_bios_bypass,              true                            },
         {cfg_rendering_tv_standard,               std::string("pal")              },
         {cfg_rendering_renderer,                  std::string("opengl")           },
+        {cfg_rendering_fast_forward_frame_skip,   s32{5}                          },
+        {cfg_rewind_enabled,                      true                            },
+        {cfg_rewind_interval,                     s32{10}                         },
+        {cfg_rewind_memory_budget,                s32{256}                        },
         {cfg_paths_roms_stv,                      std::string("")                 },
         {cfg_paths_bios_stv,                      std::string("")                 },
         {cfg_paths_bios_saturn,                   std::string("")                 },
         {cfg_cdrom_drive,                         std::string("-1:-1:-1")         },
         {cfg_cdrom_access_method,                 std::string("spti")             },
+        {cfg_cdrom_image,                         std::string("")                 },
+        {cfg_cdrom_fast_boot,                     false                           },
         {cfg_sound_soundcard,                     std::string("")                 },
         {cfg_sound_disabled,                      false                           },
         {cfg_controls_saturn_player_1_connection, std::string("direct")           },
@@ -124,8 +136,9 @@ Config::Config(std::string_view configuration_filename) : filename_(configuratio
     };
 
     cdrom_access_ = {
-        {"aspi", cdrom::CdromAccessMethod::aspi},
-        {"spti", cdrom::CdromAccessMethod::spti}
+        {"aspi",  cdrom::CdromAccessMethod::aspi },
+        {"spti",  cdrom::CdromAccessMethod::spti },
+        {"image", cdrom::CdromAccessMethod::image}
     };
 
     hardware_mode_ = {
@@ -171,7 +184,8 @@ Config::Config(std::string_view configuration_filename) : filename_(configuratio
         {"opengl_legacy",         video::RendererType::renderer_opengl_legacy        },
         {"opengl_modern",         video::RendererType::renderer_opengl_modern        },
         {"opengl_compute_shader", video::RendererType::renderer_opengl_compute_shader},
-        {"vulkan",                video::RendererType::renderer_vulkan               }
+        {"vulkan",                video::RendererType::renderer_vulkan               },
+        {"software",              video::RendererType::renderer_software             }
     };
 };
 
@@ -209,11 +223,17 @@ void Config::generateConfigurationTree(const bool isModernOpenglCapable) {
     add(full_keys_[cfg_global_stv_bios_bypass],              std::any_cast<const bool>(default_keys_[cfg_global_stv_bios_bypass]));
     add(full_keys_[cfg_rendering_tv_standard],               std::any_cast<const std::string&>(default_keys_[cfg_rendering_tv_standard]));
     add(full_keys_[cfg_rendering_renderer],                 std::any_cast<const std::string&>(default_keys_[cfg_rendering_renderer]));
+    add(full_keys_[cfg_rendering_fast_forward_frame_skip],   std::any_cast<const s32>(default_keys_[cfg_rendering_fast_forward_frame_skip]));
+    add(full_keys_[cfg_rewind_enabled],                      std::any_cast<const bool>(default_keys_[cfg_rewind_enabled]));
+    add(full_keys_[cfg_rewind_interval],                     std::any_cast<const s32>(default_keys_[cfg_rewind_interval]));
+    add(full_keys_[cfg_rewind_memory_budget],                std::any_cast<const s32>(default_keys_[cfg_rewind_memory_budget]));
     add(full_keys_[cfg_paths_roms_stv],                      std::any_cast<const std::string&>(default_keys_[cfg_paths_roms_stv]));
     add(full_keys_[cfg_paths_bios_stv],                      std::any_cast<const std::string&>(default_keys_[cfg_paths_bios_stv]));
     add(full_keys_[cfg_paths_bios_saturn],                   std::any_cast<const std::string&>(default_keys_[cfg_paths_bios_saturn]));
     add(full_keys_[cfg_cdrom_drive],                         std::any_cast<const std::string&>(default_keys_[cfg_cdrom_drive]));
     add(full_keys_[cfg_cdrom_access_method],                 std::any_cast<const std::string&>(default_keys_[cfg_cdrom_access_method]));
+    add(full_keys_[cfg_cdrom_image],                         std::any_cast<const std::string&>(default_keys_[cfg_cdrom_image]));
+    add(full_keys_[cfg_cdrom_fast_boot],                     std::any_cast<const bool>(default_keys_[cfg_cdrom_fast_boot]));
     add(full_keys_[cfg_sound_disabled],                      std::any_cast<const bool>(default_keys_[cfg_sound_disabled]));
     add(full_keys_[cfg_controls_saturn_player_1_connection], std::any_cast<const std::string&>(default_keys_[cfg_controls_saturn_player_1_connection]));
     add(full_keys_[cfg_controls_saturn_player_1],            SaturnDigitalPad().toConfig(PeripheralLayout::default_layout));
@@ -279,6 +299,7 @@ void Config::createDefault(const AccessKeys& key) {
     using enum AccessKeys;
     auto createStringDefault = [this, &key]() { add(full_keys_[key], std::any_cast<const std::string>(default_keys_[key])); };
     auto createBoolDefault   = [this, &key]() { add(full_keys_[key], std::any_cast<const bool>(default_keys_[key])); };
+    auto createIntDefault    = [this, &key]() { add(full_keys_[key], std::any_cast<const s32>(default_keys_[key])); };
     auto createSaturnControlDefault
         = [this, &key]() { add(full_keys_[key], SaturnDigitalPad().toConfig(PeripheralLayout::default_layout)); };
     auto createSaturnControlEmpty
@@ -296,11 +317,16 @@ void Config::createDefault(const AccessKeys& key) {
             {cfg_global_area_code,                    createStringDefault          },
             {cfg_rendering_tv_standard,               createStringDefault          },
             {cfg_rendering_renderer,                  createStringDefault          },
+            {cfg_rendering_fast_forward_frame_skip,   createIntDefault             },
+            {cfg_rewind_enabled,                      createBoolDefault            },
+            {cfg_rewind_interval,                     createIntDefault             },
+            {cfg_rewind_memory_budget,                createIntDefault             },
             {cfg_paths_roms_stv,                      createStringDefault          },
             {cfg_paths_bios_stv,                      createStringDefault          },
             {cfg_paths_bios_saturn,                   createStringDefault          },
             {cfg_cdrom_drive,                         createStringDefault          },
             {cfg_cdrom_access_method,                 createStringDefault          },
+            {cfg_cdrom_image,                         createStringDefault          },
             {cfg_sound_soundcard,                     createStringDefault          },
             {cfg_controls_saturn_player_1_connection, createStringDefault          },
             {cfg_controls_saturn_player_2_connection, createStringDefault          },
@@ -318,6 +344,7 @@ void Config::createDefault(const AccessKeys& key) {
             {cfg_log_unimplemented,                   createStringDefault          },
             {cfg_global_set_time,                     createBoolDefault            },
             {cfg_global_stv_bios_bypass,              createBoolDefault            },
+            {cfg_cdrom_fast_boot,                     createBoolDefault            },
             {cfg_sound_disabled,                      createBoolDefault            },
             {cfg_controls_saturn_player_1,            createSaturnControlDefault   },
             {cfg_controls_saturn_player_2,            createSaturnControlEmpty     },
@@ -395,18 +422,18 @@ auto Config::getRenderer(const std::string& key) -> video::RendererType {
 
 void Config::updateLogLevel() {
     using enum AccessKeys;
-    Log::setLogLevel("cdrom", getLogLevel(readValue(cfg_log_cdrom)));
-    Log::setLogLevel("config", getLogLevel(readValue(cfg_log_config)));
-    Log::setLogLevel("main", getLogLevel(readValue(cfg_log_main)));
-    Log::setLogLevel("memory", getLogLevel(readValue(cfg_log_memory)));
-    Log::setLogLevel("opengl", getLogLevel(readValue(cfg_log_opengl)));
-    Log::setLogLevel("scu", getLogLevel(readValue(cfg_log_scu)));
-    Log::setLogLevel("scsp", getLogLevel(readValue(cfg_log_scsp)));
-    Log::setLogLevel("sh2", getLogLevel(readValue(cfg_log_sh2)));
-    Log::setLogLevel("smpc", getLogLevel(readValue(cfg_log_smpc)));
-    Log::setLogLevel("vdp1", getLogLevel(readValue(cfg_log_vdp1)));
-    Log::setLogLevel("vdp2", getLogLevel(readValue(cfg_log_vdp2)));
-    Log::setLogLevel("unimplemented", getLogLevel(readValue(cfg_log_unimplemented)));
+    Log::setLogLevel(Logger::cdrom, getLogLevel(readValue(cfg_log_cdrom)));
+    Log::setLogLevel(Logger::config, getLogLevel(readValue(cfg_log_config)));
+    Log::setLogLevel(Logger::main, getLogLevel(readValue(cfg_log_main)));
+    Log::setLogLevel(Logger::memory, getLogLevel(readValue(cfg_log_memory)));
+    Log::setLogLevel(Logger::opengl, getLogLevel(readValue(cfg_log_opengl)));
+    Log::setLogLevel(Logger::scu, getLogLevel(readValue(cfg_log_scu)));
+    Log::setLogLevel(Logger::scsp, getLogLevel(readValue(cfg_log_scsp)));
+    Log::setLogLevel(Logger::sh2, getLogLevel(readValue(cfg_log_sh2)));
+    Log::setLogLevel(Logger::smpc, getLogLevel(readValue(cfg_log_smpc)));
+    Log::setLogLevel(Logger::vdp1, getLogLevel(readValue(cfg_log_vdp1)));
+    Log::setLogLevel(Logger::vdp2, getLogLevel(readValue(cfg_log_vdp2)));
+    Log::setLogLevel(Logger::unimplemented, getLogLevel(readValue(cfg_log_unimplemented)));
 }
 
 auto Config::getLogLevel(const std::string& key) -> LogLevel { return log_level_[key]; }
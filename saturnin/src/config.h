@@ -55,11 +55,17 @@ enum class AccessKeys : u8 {
     cfg_rendering_tv_standard,
     // cfg_rendering_legacy_opengl,
     cfg_rendering_renderer,
+    cfg_rendering_fast_forward_frame_skip,
+    cfg_rewind_enabled,
+    cfg_rewind_interval,
+    cfg_rewind_memory_budget,
     cfg_paths_roms_stv,
     cfg_paths_bios_stv,
     cfg_paths_bios_saturn,
     cfg_cdrom_drive,
     cfg_cdrom_access_method,
+    cfg_cdrom_image,
+    cfg_cdrom_fast_boot,
     cfg_sound_soundcard,
     cfg_sound_disabled,
     cfg_controls_saturn_player_1,
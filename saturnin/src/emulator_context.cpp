@@ -23,20 +23,30 @@
 #include <Windows.h> // removes C4005 warning
 #include <GLFW/glfw3.h>
 #include <argagg/argagg.hpp>
+#include <saturnin/src/benchmark.h>
 #include <saturnin/src/config.h>
+#include <saturnin/src/headless.h>
 #include <saturnin/src/log.h>
 #include <saturnin/src/memory.h>
+#include <saturnin/src/rewind.h>
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/scu.h>
 #include <saturnin/src/sh2/basic_interpreter/sh2_instructions.h>
 #include <saturnin/src/sh2/fast_interpreter/opcodes_generator.h>
 #include <saturnin/src/sh2/sh2.h>
 #include <saturnin/src/smpc.h>
+#include <saturnin/src/tests.h>
+#include <saturnin/src/timing.h>
+#include <saturnin/src/trace.h>
 #include <saturnin/src/cdrom/cdrom.h>
+#include <saturnin/src/cdrom/disc_image.h>
 #include <saturnin/src/cdrom/scsi.h>
+#include <saturnin/src/sound/audio_sink.h>
 #include <saturnin/src/sound/scsp.h>
 #include <saturnin/src/video/opengl/opengl_utilities.h>
 #include <saturnin/src/video/vdp1.h>
 #include <saturnin/src/video/vdp2/vdp2.h>
+#include <saturnin/src/video/software_renderer.h>
 
 namespace saturnin::core {
 
@@ -45,21 +55,24 @@ using sh2::Sh2;
 using sh2::Sh2Type;
 using sound::Scsp;
 using video::Opengl;
+using video::SoftwareRenderer;
 using video::Vdp1;
 using video::Vdp2;
 
 EmulatorContext::EmulatorContext() {
-    config_     = std::make_unique<Config>("saturnin.cfg");
-    master_sh2_ = std::make_unique<Sh2>(Sh2Type::master, this);
-    slave_sh2_  = std::make_unique<Sh2>(Sh2Type::slave, this);
-    memory_     = std::make_unique<Memory>(this);
-    scu_        = std::make_unique<Scu>(this);
-    smpc_       = std::make_unique<Smpc>(this);
-    scsp_       = std::make_unique<Scsp>(this);
-    cdrom_      = std::make_unique<Cdrom>(this);
-    vdp1_       = std::make_unique<Vdp1>(this);
-    vdp2_       = std::make_unique<Vdp2>(this);
-    opengl_     = std::make_unique<Opengl>(config_.get());
+    config_            = std::make_unique<Config>("saturnin.cfg");
+    master_sh2_        = std::make_unique<Sh2>(Sh2Type::master, this);
+    slave_sh2_         = std::make_unique<Sh2>(Sh2Type::slave, this);
+    memory_            = std::make_unique<Memory>(this);
+    scu_               = std::make_unique<Scu>(this);
+    smpc_              = std::make_unique<Smpc>(this);
+    scsp_              = std::make_unique<Scsp>(this);
+    cdrom_             = std::make_unique<Cdrom>(this);
+    vdp1_              = std::make_unique<Vdp1>(this);
+    vdp2_              = std::make_unique<Vdp2>(this);
+    opengl_            = std::make_unique<Opengl>(config_.get());
+    software_renderer_ = std::make_unique<SoftwareRenderer>(this);
+    rewind_            = std::make_unique<Rewind>(this);
 }
 
 EmulatorContext::~EmulatorContext() = default;
@@ -75,6 +88,10 @@ auto EmulatorContext::cdrom() -> Cdrom* { return cdrom_.get(); };
 auto EmulatorContext::vdp1() -> Vdp1* { return vdp1_.get(); };
 auto EmulatorContext::vdp2() -> Vdp2* { return vdp2_.get(); };
 auto EmulatorContext::opengl() -> Opengl* { return opengl_.get(); };
+auto EmulatorContext::softwareRenderer() -> SoftwareRenderer* { return software_renderer_.get(); };
+auto EmulatorContext::headless() -> Headless* { return headless_.get(); };
+auto EmulatorContext::benchmark() -> Benchmark* { return benchmark_.get(); };
+auto EmulatorContext::rewind() -> Rewind* { return rewind_.get(); };
 
 auto EmulatorContext::initialize(int argc, char* argv[]) -> bool {
     // Locale is defaulted to english to handle the case when there's no config file created yet.
@@ -89,11 +106,25 @@ auto EmulatorContext::initialize(int argc, char* argv[]) -> bool {
         {"set-pc", {"-s", "--set-pc"}, tr("Address to set the PC after loading the binary file, in hex. Default is 0x6004000."), 1},
         {"load-address", {"-l", "--load-address"}, tr("Saturn memory address to load the binary file to, in hex. Default is 0x6004000."), 1},
         {"auto-start", {"-a", "--auto-start"}, tr("Will auto start the emulator after loading when present."),},
-        {"generate-sh2-opcodes", {"-g", "--generate-sh2-opcodes"}, tr("Generates a file containing SH2 opcodes."),}
+        {"generate-sh2-opcodes", {"-g", "--generate-sh2-opcodes"}, tr("Generates a file containing SH2 opcodes."),},
+        {"trace", {"-t", "--trace"}, tr("Records emulation events in the binary trace file logs/saturnin.trace."),},
+        {"decode-trace", {"-d", "--decode-trace"}, tr("Converts a binary trace file to text, in the same directory with the .txt extension."), 1},
+        {"headless", {"--headless"}, tr("Runs the emulation without window, frames are rendered by the software renderer."),},
+        {"input-script", {"--input-script"}, tr("Input script used in headless mode."), 1},
+        {"dump-directory", {"--dump-directory"}, tr("Directory where frames are written in headless mode. Default is 'frames'."), 1},
+        {"audio-dump", {"--audio-dump"}, tr("WAV file where the sound output is written."), 1},
+        {"bench", {"--bench"}, tr("Runs the given number of frames as fast as possible, then writes a benchmark report."), 1},
+        {"bench-report", {"--bench-report"}, tr("Path of the benchmark report, in CSV if the extension is .csv, JSON otherwise. Default is 'bench.json'."), 1},
+        {"microbenchmarks", {"--microbenchmarks"}, tr("Runs the microbenchmarks suite and writes the results to the given JSON file."), 1},
+        {"load-state", {"--load-state"}, tr("Loads the given save state once the emulation is started."), 1},
+        {"cd-image", {"--cd-image"}, tr("Disc image (ISO, BIN/CUE or CHD) to use, overrides the CD-ROM configuration."), 1}
 
     }};
     // clang-format on
     argagg::parser_results args;
+    auto                   cd_image             = std::string{};
+    auto                   microbenchmarks_path = std::string{};
+    auto                   is_audio_dumped      = false;
     try {
         args = parser.parse(argc, argv);
         if (args["help"]) {
@@ -121,12 +152,34 @@ auto EmulatorContext::initialize(int argc, char* argv[]) -> bool {
                 Log::info(Logger::main, tr("SH2 opcodes were generated"));
             }
         }
+        if (args["trace"]) { Trace::start("logs/saturnin.trace"); }
+        if (args["headless"]) {
+            headless_ = std::make_unique<Headless>(this);
+            headless_->dumpDirectory(args["dump-directory"].as<std::string>("frames"));
+            if (args["input-script"]) { headless_->loadInputScript(args["input-script"]); }
+        }
+        if (args["audio-dump"]) {
+            scsp()->audioSink(std::make_unique<sound::WavFileSink>(args["audio-dump"].as<std::string>()));
+            is_audio_dumped = true;
+        }
+        if (args["bench"]) {
+            benchmark_ = std::make_unique<Benchmark>(this,
+                                                     args["bench"].as<u32>(),
+                                                     args["bench-report"].as<std::string>("bench.json"));
+        }
+        if (args["decode-trace"]) {
+            const std::string trace_path = args["decode-trace"];
+            Trace::decode(trace_path, trace_path + ".txt");
+        }
+        if (args["microbenchmarks"]) { microbenchmarks_path = args["microbenchmarks"].as<std::string>(); }
+        if (args["load-state"]) { requestStateLoad(args["load-state"].as<std::string>()); }
+        if (args["cd-image"]) { cd_image = args["cd-image"].as<std::string>(); }
     } catch (const std::exception& e) {
         Log::error(Logger::main, tr("Error while parsing command line"));
         Log::error(Logger::main, "{}", e.what());
     }
 
-    if (!this->config()->initialize(video::isModernOpenglCapable())) { return false; }
+    if (!this->config()->initialize(!isHeadless() && video::isModernOpenglCapable())) { return false; }
 
     std::string country = config()->readValue(core::AccessKeys::cfg_global_language);
     if (!Locale::getInstance().initialize(country)) { return false; }
@@ -134,11 +187,32 @@ auto EmulatorContext::initialize(int argc, char* argv[]) -> bool {
     std::string hm = config()->readValue(core::AccessKeys::cfg_global_hardware_mode);
     hardwareMode(config()->getHardwareMode(hm));
 
+    if (!microbenchmarks_path.empty()) {
+        // The program exits once the report is written, the interface isn't started.
+        tests::runMicrobenchmarks(microbenchmarks_path);
+        renderingStatus(core::RenderingStatus::stopped);
+        return true;
+    }
+
+    // Headless runs and benchmarks aren't played, they must not be slowed down to the host audio rate.
+    const bool is_sound_disabled = config()->readValue(core::AccessKeys::cfg_sound_disabled);
+    is_host_audio_used_          = !is_sound_disabled && !is_audio_dumped && !isHeadless() && (benchmark_ == nullptr);
+
     memory()->selectedStvGame(core::defaultStvGame());
 
     this->smpc()->initializePeripheralMappings();
 
-    cdrom::Scsi::settingUpSptiFunctions();
+    // ASPI isn't supported, SPTI is used instead.
+    std::string access_method   = config()->readValue(core::AccessKeys::cfg_cdrom_access_method);
+    cdrom::Cdrom::access_method = cd_image.empty() ? config()->getCdromAccess(access_method) : cdrom::CdromAccessMethod::image;
+    if (cdrom::Cdrom::access_method == cdrom::CdromAccessMethod::image) {
+        cdrom::Scsi::settingUpImageFunctions();
+        std::string image_path = config()->readValue(core::AccessKeys::cfg_cdrom_image);
+        if (!cd_image.empty()) { image_path = cd_image; }
+        if (!image_path.empty()) { cdrom::DiscImage::open(image_path); }
+    } else {
+        cdrom::Scsi::settingUpSptiFunctions();
+    }
 
     return cdrom::Scsi::initialize();
 }
@@ -153,6 +227,8 @@ void EmulatorContext::startEmulation() {
             return;
         }
         case stopped: {
+            // The device is closed when the emulation stops, it's opened again for each run.
+            if (is_host_audio_used_) { scsp()->audioSink(std::make_unique<sound::WaveOutSink>(scsp()->outputSamples())); }
             emulationStatus(EmulationStatus::running);
 
             emulation_main_thread_ = std::jthread(&EmulatorContext::emulationMainThread, this);
@@ -166,10 +242,49 @@ void EmulatorContext::startEmulation() {
 void EmulatorContext::stopEmulation() {
     emulation_status_ = core::EmulationStatus::stopped;
     if (emulation_main_thread_.joinable()) { emulation_main_thread_.join(); }
+
+    // The program exits without destroying the context, the audio dump has to be completed here.
+    scsp()->closeAudioSink();
 }
 
 void EmulatorContext::pauseEmulation() { debugStatus(DebugStatus::paused); }
 
+template<typename Probe>
+void EmulatorContext::stepEmulation(Probe& probe) {
+    if (is_state_request_pending_) { processStateRequests(); }
+    if (rewind_->isCaptureDue()) { rewind_->capture(); }
+    if (debugStatus() == DebugStatus::paused) { return; }
+
+    probe.onStepStart();
+    const auto cycles = masterSh2()->run();
+    Trace::advanceCycles(cycles);
+    probe.onModuleRun(BenchmarkedModule::master_sh2, cycles);
+    if (smpc()->isSlaveSh2On()) { probe.onModuleRun(BenchmarkedModule::slave_sh2, slaveSh2()->run()); }
+    smpc()->run(cycles);
+    probe.onModuleRun(BenchmarkedModule::smpc, cycles);
+    vdp2()->run(cycles);
+    probe.onModuleRun(BenchmarkedModule::vdp2, cycles);
+    scu()->run(cycles);
+    probe.onModuleRun(BenchmarkedModule::scu, cycles);
+    cdrom()->run(cycles);
+    probe.onModuleRun(BenchmarkedModule::cdrom, cycles);
+    scsp()->run(cycles);
+    probe.onModuleRun(BenchmarkedModule::scsp, cycles);
+}
+
+template void EmulatorContext::stepEmulation(Benchmark::ModuleTimer<true>&);
+template void EmulatorContext::stepEmulation(Benchmark::ModuleTimer<false>&);
+
+void EmulatorContext::stepEmulation() {
+    // Calls to the empty probe are optimized out.
+    struct NoProbe {
+        void onStepStart() {}
+        void onModuleRun(BenchmarkedModule, u32) {}
+    };
+    auto probe = NoProbe{};
+    stepEmulation(probe);
+}
+
 void EmulatorContext::emulationSetup() {
     memory()->initialize(hardware_mode_);
 
@@ -181,30 +296,71 @@ void EmulatorContext::emulationSetup() {
     vdp1()->initialize();
     vdp2()->initialize();
     scsp()->initialize();
+    rewind()->initialize();
 }
 
 void EmulatorContext::emulationMainThread() {
     Log::info(Logger::main, tr("Emulation main thread started"));
+    if constexpr (are_timing_zones_compiled) { Timing::nameThread("emulation"); }
     try {
         emulationSetup();
+        if (is_state_request_pending_) { processStateRequests(); }
 
+        if (benchmark_ != nullptr) { benchmark_->run(); }
         while (emulationStatus() == EmulationStatus::running) {
-            if (debugStatus() != DebugStatus::paused) {
-                const auto cycles = masterSh2()->run();
-                if (smpc()->isSlaveSh2On()) { slaveSh2()->run(); }
-                smpc()->run(cycles);
-                vdp2()->run(cycles);
-                cdrom()->run(cycles);
-                scsp()->run(cycles);
-            }
+            stepEmulation();
         }
-    } catch (...) { Log::error(Logger::main, tr("Exception raised in emulation thread !")); }
+    } catch (...) {
+        Log::error(Logger::main, tr("Exception raised in emulation thread !"));
+        emulationStatus(EmulationStatus::stopped);
+    }
     Log::info(Logger::main, tr("Emulation main thread finished"));
-    dumpTrace();
+}
+
+void EmulatorContext::requestStateSave(const std::string& path) {
+    auto lock                 = std::scoped_lock(state_requests_mutex_);
+    state_save_path_          = path;
+    is_state_request_pending_ = true;
+}
+
+void EmulatorContext::requestStateLoad(const std::string& path) {
+    auto lock                 = std::scoped_lock(state_requests_mutex_);
+    state_load_path_          = path;
+    is_state_request_pending_ = true;
+}
+
+void EmulatorContext::requestRewind() {
+    auto lock = std::scoped_lock(state_requests_mutex_);
+    ++rewind_requests_;
+    is_state_request_pending_ = true;
+}
+
+void EmulatorContext::processStateRequests() {
+    auto save_path       = std::string{};
+    auto load_path       = std::string{};
+    auto rewind_requests = u32{};
+    {
+        auto lock = std::scoped_lock(state_requests_mutex_);
+        std::swap(save_path, state_save_path_);
+        std::swap(load_path, state_load_path_);
+        std::swap(rewind_requests, rewind_requests_);
+        is_state_request_pending_ = false;
+    }
+    if (!save_path.empty()) { SaveState::save(*this, save_path); }
+    if (!load_path.empty()) { SaveState::load(*this, load_path); }
+    for (u32 i = 0; i < rewind_requests; ++i) {
+        if (!rewind_->stepBack()) { break; }
+    }
 }
 
 void EmulatorContext::startInterface() {
+    if (renderingStatus() == core::RenderingStatus::stopped) { return; }
+    if (isHeadless()) {
+        headless_->run();
+        return;
+    }
     renderingStatus(core::RenderingStatus::running);
+    if constexpr (are_timing_zones_compiled) { Timing::nameThread("render"); }
     video::runOpengl(*this);
 }
 
@@ -286,28 +442,4 @@ void EmulatorContext::openglWindow(GLFWwindow* window) { opengl_window_ = window
 
 auto EmulatorContext::openglWindow() const -> GLFWwindow* { return opengl_window_; }
 
-void EmulatorContext::addToTrace(const u32 pc) { trace_.emplace_back(pc); }
-
-void EmulatorContext::dumpTrace() const {
-    if (trace_.empty()) { return; }
-
-    auto counter     = u32{};
-    auto previous_pc = trace_[0];
-
-    for (const auto pc : trace_) {
-        if (pc == previous_pc) {
-            ++counter;
-        } else {
-            if (counter > 0) {
-                Log::info(Logger::sh2, "{:#0x} (looped {:d} time(s))", pc, counter);
-            } else {
-                Log::info(Logger::sh2, "{:#0x}", pc);
-            }
-
-            previous_pc = pc;
-            counter     = 0;
-        }
-    }
-}
-
 } // namespace saturnin::core
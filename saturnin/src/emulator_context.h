@@ -27,7 +27,9 @@
 
 #pragma once
 
+#include <atomic> // atomic
 #include <memory> // unique_ptr
+#include <mutex>  // mutex
 #include <string> // string
 #include <thread> // jthread
 #include <saturnin/src/emulator_enums.h>
@@ -52,13 +54,17 @@ namespace saturnin::video {
 class Vdp1;
 class Vdp2;
 class Opengl;
+class SoftwareRenderer;
 } // namespace saturnin::video
 
 namespace saturnin::core {
 
 // Forward declarations
+class Benchmark;
 class Config;
+class Headless;
 class Memory;
+class Rewind;
 class Scu;
 class Smpc;
 
@@ -163,10 +169,30 @@ class EmulatorContext {
 
     void pauseEmulation();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Probe> void EmulatorContext::stepEmulation(Probe& probe);
+    ///
+    /// \brief  Runs one step of the emulation loop : pending state requests and rewind capture are
+    ///         processed, then unless the emulation is paused the master SH2 runs one instruction and
+    ///         the other modules the cycles it spent.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Probe           Type of the probe.
+    /// \param [in,out] probe   Notified before the modules run and after each of them, used by the
+    ///                         benchmark.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Probe>
+    void stepEmulation(Probe& probe);
+
+    void stepEmulation();
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void EmulatorContext::startInterface();
     ///
-    /// \brief  Starts the emulator GUI.
+    /// \brief  Starts the emulator GUI, or runs the emulation directly in headless mode.
     ///
     /// \author Runik
     /// \date   24/10/2019
@@ -187,8 +213,25 @@ class EmulatorContext {
     auto vdp1() -> video::Vdp1*;
     auto vdp2() -> video::Vdp2*;
     auto opengl() -> video::Opengl*;
+    auto softwareRenderer() -> video::SoftwareRenderer*;
+    auto headless() -> Headless*;
+    auto benchmark() -> Benchmark*;
+    auto rewind() -> Rewind*;
     //@}
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto EmulatorContext::isHeadless() const -> bool
+    ///
+    /// \brief  Checks if the emulator runs without GUI, set by the --headless command line option.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True in headless mode.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto isHeadless() const -> bool { return headless_ != nullptr; };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn auto EmulatorContext::hardwareMode() const -> HardwareMode
     ///
@@ -292,6 +335,73 @@ class EmulatorContext {
 
     [[nodiscard]] auto debugStatus() const -> DebugStatus { return debug_status_; };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void EmulatorContext::fastForward(const bool is_enabled)
+    ///
+    /// \brief  Enables or disables the fast forward mode : emulation isn't throttled anymore and only one frame out of
+    ///         'rendering.fast_forward_frame_skip' + 1 is rendered.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  is_enabled  True to enable fast forward.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void fastForward(const bool is_enabled) { is_fast_forward_enabled_ = is_enabled; };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto EmulatorContext::isFastForwardEnabled() const -> bool
+    ///
+    /// \brief  Checks if the fast forward mode is enabled.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if fast forward is enabled.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto isFastForwardEnabled() const -> bool { return is_fast_forward_enabled_; };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void EmulatorContext::requestStateSave(const std::string& path);
+    ///
+    /// \brief  Requests a save state, written by the emulation thread between two steps of the
+    ///         emulation loop. Can be called from any thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the state file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void requestStateSave(const std::string& path);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void EmulatorContext::requestStateLoad(const std::string& path);
+    ///
+    /// \brief  Requests a state load, done by the emulation thread between two steps of the emulation
+    ///         loop. Can be called from any thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the state file.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void requestStateLoad(const std::string& path);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void EmulatorContext::requestRewind();
+    ///
+    /// \brief  Requests a step back in the rewind buffer, done by the emulation thread between two
+    ///         steps of the emulation loop. Can be called from any thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void requestRewind();
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn	void EmulatorContext::updateDebugStatus(const DebugPosition pos, const sh2::Sh2Type type);
     ///
@@ -332,9 +442,6 @@ class EmulatorContext {
 
     [[nodiscard]] auto openglWindow() const -> GLFWwindow*;
 
-    void addToTrace(const u32 pc);
-    void dumpTrace() const;
-
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn	void EmulatorContext::emulationSetup();
@@ -358,23 +465,51 @@ class EmulatorContext {
 
     void emulationMainThread();
 
-    std::unique_ptr<Config>        config_;     ///< Configuration object
-    std::unique_ptr<Memory>        memory_;     ///< Memory object
-    std::unique_ptr<sh2::Sh2>      master_sh2_; ///< Master SH2 object
-    std::unique_ptr<sh2::Sh2>      slave_sh2_;  ///< Slave SH2 object
-    std::unique_ptr<Scu>           scu_;        ///< SCU object
-    std::unique_ptr<Smpc>          smpc_;       ///< SMPC object
-    std::unique_ptr<sound::Scsp>   scsp_;       ///< SCSP object
-    std::unique_ptr<cdrom::Cdrom>  cdrom_;      ///< CDROM object
-    std::unique_ptr<video::Vdp1>   vdp1_;       ///< Vdp1 object
-    std::unique_ptr<video::Vdp2>   vdp2_;       ///< Vdp2 object
-    std::unique_ptr<video::Opengl> opengl_;     ///< Opengl object
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void EmulatorContext::processStateRequests();
+    ///
+    /// \brief  Processes the pending save, load and rewind requests. Called from the emulation thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void processStateRequests();
+
+    std::unique_ptr<Config>                  config_;            ///< Configuration object
+    std::unique_ptr<Memory>                  memory_;            ///< Memory object
+    std::unique_ptr<sh2::Sh2>                master_sh2_;        ///< Master SH2 object
+    std::unique_ptr<sh2::Sh2>                slave_sh2_;         ///< Slave SH2 object
+    std::unique_ptr<Scu>                     scu_;               ///< SCU object
+    std::unique_ptr<Smpc>                    smpc_;              ///< SMPC object
+    std::unique_ptr<sound::Scsp>             scsp_;              ///< SCSP object
+    std::unique_ptr<cdrom::Cdrom>            cdrom_;             ///< CDROM object
+    std::unique_ptr<video::Vdp1>             vdp1_;              ///< Vdp1 object
+    std::unique_ptr<video::Vdp2>             vdp2_;              ///< Vdp2 object
+    std::unique_ptr<video::Opengl>           opengl_;            ///< Opengl object
+    std::unique_ptr<video::SoftwareRenderer> software_renderer_; ///< Software renderer object
+    std::unique_ptr<Headless>                headless_;          ///< Headless mode object, null when the GUI is used.
+    std::unique_ptr<Benchmark>               benchmark_;         ///< Benchmark object, null when not benchmarking.
+    std::unique_ptr<Rewind>                  rewind_;            ///< Rewind buffer.
 
     HardwareMode    hardware_mode_{HardwareMode::saturn};        ///< Hardware mode
     EmulationStatus emulation_status_{EmulationStatus::stopped}; ///< Emulation status
     RenderingStatus rendering_status_{RenderingStatus::running}; ///< Rendering status.
     DebugStatus     debug_status_{DebugStatus::disabled};        ///< Debug status.
 
+    std::atomic<bool> is_fast_forward_enabled_{false}; ///< True when fast forward is enabled, set from the GUI thread.
+    bool              is_host_audio_used_{false};      ///< True when the sound is played on the host audio device.
+
+    /// \name Save states requests
+    ///
+    //@{
+    std::mutex        state_requests_mutex_;            ///< Protects the requests paths.
+    std::string       state_save_path_{};               ///< Path of the requested save, empty if none.
+    std::string       state_load_path_{};               ///< Path of the requested load, empty if none.
+    u32               rewind_requests_{};               ///< Number of requested steps back.
+    std::atomic<bool> is_state_request_pending_{false}; ///< True when a request waits for the emulation thread.
+    //@}
+
     /// \name Command line variables
     ///
     //@{
@@ -388,8 +523,6 @@ class EmulatorContext {
     std::jthread emulation_main_thread_; ///< The emulation main thread.
 
     GLFWwindow* opengl_window_; ///< The OpenGL window.
-
-    std::vector<u32> trace_;
 };
 
 } // namespace saturnin::core
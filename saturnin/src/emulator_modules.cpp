@@ -29,6 +29,7 @@
 #include <saturnin/src/video/vdp1.h>
 #include <saturnin/src/video/vdp2/vdp2.h>
 #include <saturnin/src/video/opengl/opengl.h>
+#include <saturnin/src/video/software_renderer.h>
 
 namespace saturnin::core {
 
@@ -44,5 +45,6 @@ auto EmulatorModules::cdrom() const -> cdrom::Cdrom* { return context_->cdrom();
 auto EmulatorModules::vdp1() const -> video::Vdp1* { return context_->vdp1(); };
 auto EmulatorModules::vdp2() const -> video::Vdp2* { return context_->vdp2(); };
 auto EmulatorModules::opengl() const -> video::Opengl* { return context_->opengl(); };
+auto EmulatorModules::softwareRenderer() const -> video::SoftwareRenderer* { return context_->softwareRenderer(); };
 
 } // namespace saturnin::core
@@ -57,6 +57,7 @@ class EmulatorModules {
     [[nodiscard]] auto vdp1() const -> video::Vdp1*;
     [[nodiscard]] auto vdp2() const -> video::Vdp2*;
     [[nodiscard]] auto opengl() const -> video::Opengl*;
+    [[nodiscard]] auto softwareRenderer() const -> video::SoftwareRenderer*;
     ///@}
 
   private:
@@ -0,0 +1,162 @@
+//
+// headless.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/headless.h>
+#include <algorithm> // stable_sort
+#include <chrono>    // milliseconds
+#include <fstream>   // ifstream
+#include <sstream>   // istringstream
+#include <thread>    // sleep_for
+#include <lodepng.h>
+#include <saturnin/src/emulator_context.h>
+#include <saturnin/src/log.h>
+#include <saturnin/src/smpc.h>                   // PeripheralKey, getKeyFromName
+#include <saturnin/src/sound/scsp.h>
+#include <saturnin/src/utilities.h>              // format
+#include <saturnin/src/video/opengl/opengl.h>
+#include <saturnin/src/video/opengl/opengl_texturing.h>
+#include <saturnin/src/video/software_renderer.h> // SoftwareRenderer
+#include <saturnin/src/video/vdp1.h>
+
+namespace saturnin::core {
+
+namespace uti = saturnin::utilities;
+
+constexpr auto status_polling_period = std::chrono::milliseconds(100);
+
+auto Headless::loadInputScript(const std::string& path) -> bool {
+    auto file = std::ifstream(path);
+    if (!file) {
+        Log::warning(Logger::main, tr("Could not open input script {}"), path);
+        return false;
+    }
+
+    const auto commands = std::map<std::string, ScriptCommand, std::less<>>{
+        {"press",   ScriptCommand::press  },
+        {"release", ScriptCommand::release},
+        {"dump",    ScriptCommand::dump   },
+        {"save",    ScriptCommand::save   },
+        {"load",    ScriptCommand::load   },
+        {"rewind",  ScriptCommand::rewind },
+        {"quit",    ScriptCommand::quit   }
+    };
+
+    events_.clear();
+    auto line_number = u32{};
+    auto line        = std::string{};
+    while (std::getline(file, line)) {
+        ++line_number;
+        if (const auto comment = line.find('#'); comment != std::string::npos) { line.erase(comment); }
+
+        auto stream  = std::istringstream(line);
+        auto event   = ScriptEvent{.key = PeripheralKey::key_unknown};
+        auto command = std::string{};
+        auto key     = std::string{};
+        if (!(stream >> event.frame >> command)) { continue; }
+
+        const auto it = commands.find(command);
+        if (it == commands.end()) {
+            Log::warning(Logger::main, tr("Input script line {} : unknown command '{}'"), line_number, command);
+            continue;
+        }
+        event.command = it->second;
+        if (event.command == ScriptCommand::press || event.command == ScriptCommand::release) {
+            stream >> key;
+            event.key = getKeyFromName(key);
+            if (event.key == PeripheralKey::key_unknown) {
+                Log::warning(Logger::main, tr("Input script line {} : unknown key '{}'"), line_number, key);
+                continue;
+            }
+        }
+        if (event.command == ScriptCommand::save || event.command == ScriptCommand::load) {
+            if (!(stream >> event.path)) {
+                Log::warning(Logger::main, tr("Input script line {} : missing state path"), line_number);
+                continue;
+            }
+        }
+        events_.push_back(event);
+    }
+    std::ranges::stable_sort(events_, {}, &ScriptEvent::frame);
+    next_event_ = 0;
+
+    Log::info(Logger::main, tr("Input script loaded, {} event(s)"), events_.size());
+    return true;
+}
+
+void Headless::dumpDirectory(const std::string& path) {
+    dump_directory_ = path;
+    auto error      = std::error_code{};
+    std::filesystem::create_directories(dump_directory_, error);
+    if (error) { Log::warning(Logger::main, tr("Could not create directory {}"), path); }
+}
+
+void Headless::run() {
+    Log::info(Logger::main, tr("Running in headless mode"));
+    context_->renderingStatus(RenderingStatus::running);
+    context_->startEmulation();
+    while (context_->emulationStatus() == EmulationStatus::running) {
+        std::this_thread::sleep_for(status_polling_period);
+    }
+    context_->renderingStatus(RenderingStatus::stopped);
+}
+
+void Headless::onFrameEnd() {
+    while (next_event_ < events_.size() && events_[next_event_].frame <= frame_) {
+        const auto& event = events_[next_event_++];
+        switch (event.command) {
+            using enum ScriptCommand;
+            case press: pressed_keys_.insert(event.key); break;
+            case release: pressed_keys_.erase(event.key); break;
+            case dump: dumpFrame(); break;
+            case save: context_->requestStateSave(event.path); break;
+            case load: context_->requestStateLoad(event.path); break;
+            case rewind: context_->requestRewind(); break;
+            case quit:
+                context_->emulationStatus(EmulationStatus::stopped);
+                context_->scsp()->closeAudioSink();
+                break;
+        }
+    }
+
+    // Texture updates are queued by the VDPs for the OpenGL thread, which doesn't exist here.
+    static_cast<void>(context_->opengl()->texturing()->takeTextureUpdates());
+    ++frame_;
+}
+
+void Headless::dumpFrame() const {
+    auto* renderer = context_->softwareRenderer();
+    if (!renderer->acquireFrame()) {
+        Log::warning(Logger::main, tr("Frame {} wasn't rendered, it can't be dumped"), frame_);
+        return;
+    }
+
+    if (context_->vdp1()->hasParts()) {
+        Log::warning(Logger::main, tr("Frame {} has VDP1 sprites, they aren't rendered in headless mode"), frame_);
+    }
+
+    const auto& frame = renderer->frame();
+    const auto  path  = dump_directory_ / uti::format("frame_{:06d}.png", frame_);
+    if (const auto error = lodepng_encode32_file(path.string().c_str(), frame.rgba.data(), frame.size.w, frame.size.h);
+        error != 0) {
+        Log::warning(Logger::main, "{}", lodepng_error_text(error));
+    }
+}
+
+} // namespace saturnin::core
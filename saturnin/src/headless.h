@@ -0,0 +1,183 @@
+//
+// headless.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	headless.h
+///
+/// \brief	Declares the Headless class, running the emulation without window nor OpenGL context.
+///
+/// Frames are rendered by the software renderer, input comes from a script file and frames are
+/// written to disk when the script requests it. VDP1 isn't rasterized without OpenGL : the dumped
+/// frames only hold the VDP2 layers, a warning is logged when a dumped frame had VDP1 parts. Script lines have the form
+/// "<frame> <command> [<key>|<path>]", '#' starting a comment. Key names are the ones used in
+/// saturnin.cfg.
+///     120 press enter
+///     126 release enter
+///     600 dump
+///     900 save states/title.sst
+///     960 rewind
+///     3600 quit
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <filesystem> // path
+#include <set>        // set
+#include <string>     // string
+#include <vector>     // vector
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::core {
+
+class EmulatorContext;
+enum class PeripheralKey : u16;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   ScriptCommand
+///
+/// \brief  Commands available in the input script.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class ScriptCommand : u8 {
+    press,   ///< Presses a key.
+    release, ///< Releases a key.
+    dump,    ///< Writes the current frame to disk.
+    save,    ///< Saves the state of the machine.
+    load,    ///< Loads a state.
+    rewind,  ///< Steps back in the rewind buffer.
+    quit     ///< Stops the emulation.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct ScriptEvent
+///
+/// \brief  An input script line.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ScriptEvent {
+    u32           frame;   ///< Frame at the end of which the command is executed.
+    ScriptCommand command; ///< The command.
+    PeripheralKey key;     ///< Key used by press and release commands.
+    std::string   path;    ///< State file used by save and load commands.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Headless
+///
+/// \brief  Drives the emulation when no GUI is available.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Headless {
+  public:
+    //@{
+    // Constructors / Destructors
+    Headless() = delete;
+    explicit Headless(EmulatorContext* ec) : context_(ec) {};
+    Headless(const Headless&)                      = delete;
+    Headless(Headless&&)                           = delete;
+    auto operator=(const Headless&) & -> Headless& = delete;
+    auto operator=(Headless&&) & -> Headless&      = delete;
+    ~Headless()                                    = default;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Headless::loadInputScript(const std::string& path) -> bool;
+    ///
+    /// \brief  Loads the input script.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the script file.
+    ///
+    /// \returns    False if the file couldn't be read.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto loadInputScript(const std::string& path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Headless::dumpDirectory(const std::string& path);
+    ///
+    /// \brief  Sets the directory where frames are written, creating it if needed.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the directory.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void dumpDirectory(const std::string& path);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Headless::run();
+    ///
+    /// \brief  Starts the emulation and waits for it to stop. Replaces the GUI main loop.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void run();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Headless::onFrameEnd();
+    ///
+    /// \brief  Executes the script commands of the current frame. Called by the emulation thread when
+    ///         a frame has been rendered.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void onFrameEnd();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Headless::isKeyPressed(const PeripheralKey pk) const -> bool;
+    ///
+    /// \brief  Query if a key is pressed by the input script.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  pk  The peripheral key to test.
+    ///
+    /// \returns    True if key is pressed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto isKeyPressed(const PeripheralKey pk) const -> bool { return pressed_keys_.contains(pk); }
+
+  private:
+    // Writes the last rendered frame as a PNG file, without the VDP1 sprites.
+    void dumpFrame() const;
+
+    EmulatorContext*         context_;        ///< Context of the emulator.
+    std::vector<ScriptEvent> events_;         ///< Input script events, sorted by frame.
+    std::size_t              next_event_{};   ///< Index of the next event to execute.
+    std::set<PeripheralKey>  pressed_keys_;   ///< Keys currently pressed by the script.
+    std::filesystem::path    dump_directory_; ///< Directory where frames are written.
+    u32                      frame_{};        ///< Number of the current frame.
+};
+
+} // namespace saturnin::core
@@ -19,7 +19,9 @@
 
 #include <saturnin/src/pch.h>
 #include <saturnin/src/locale.h> // NOLINT(modernize-deprecated-headers)
+#include <algorithm>             // find
 #include <fstream>               // ifstream
+#include <stdexcept>             // length_error
 #include <string>
 #include <saturnin/lib/spiritless_po/include/spiritless_po/spiritless_po.h>
 
@@ -41,9 +43,37 @@ auto Locale::initialize(const std::string& country = "") -> bool { // NOLINT(rea
         // No error handling for now
     }
 
+    // Interned strings are translated again for the new language.
+    auto lock = std::scoped_lock(intern_mutex_);
+    for (u16 i = 0; i < msgids_.size(); ++i) {
+        translate(TrId{i});
+    }
+
     return true;
 }
 
+auto Locale::intern(std::string_view msgid) -> TrId {
+    auto lock = std::scoped_lock(intern_mutex_);
+    if (const auto it = std::ranges::find(msgids_, msgid); it != msgids_.end()) {
+        return TrId{static_cast<u16>(it - msgids_.begin())};
+    }
+    if (msgids_.size() == max_interned_strings) { throw std::length_error("Interned translations table is full"); }
+
+    msgids_.emplace_back(msgid);
+    const auto id = TrId{static_cast<u16>(msgids_.size() - 1)};
+    translate(id);
+    return id;
+}
+
+void Locale::translate(const TrId id) {
+    // Previous translations are kept alive, views handed out before a language change stay valid.
+    const auto& msgid = msgids_[id.index];
+    translations_storage_.emplace_back((cat_ != nullptr) ? cat_->gettext(msgid) : msgid);
+    translations_[id.index] = translations_storage_.back();
+}
+
 auto tr(const std::string& str) -> std::string { return Locale::getInstance().catalog()->gettext(str); }
 
+auto internTr(std::string_view str) -> TrId { return Locale::getInstance().intern(str); }
+
 }; // namespace saturnin::core
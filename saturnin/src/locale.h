@@ -24,8 +24,14 @@
 
 #pragma once
 
+#include <array>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <vector>
+#include <saturnin/src/emulator_defs.h> // u16
 
 // Forward declaration
 namespace spiritless_po {
@@ -33,6 +39,21 @@ class Catalog;
 }
 namespace saturnin::core {
 
+constexpr auto max_interned_strings = std::size_t{4096}; ///< Capacity of the interned translations table.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct TrId
+///
+/// \brief  Handle to an interned translatable string, returned by internTr().
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TrId {
+    u16 index; ///< Index of the string in the translations table.
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \class  Locale
 ///
@@ -93,6 +114,36 @@ class Locale {
 
     auto catalog() -> spiritless_po::Catalog*;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Locale::intern(std::string_view msgid) -> TrId;
+    ///
+    /// \brief  Adds a string to the interned translations table, and translates it using the current catalog.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  msgid   The string to translate.
+    ///
+    /// \returns    The handle of the string, the same string interned twice gets the same handle.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto intern(std::string_view msgid) -> TrId;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Locale::translation(const TrId id) const -> std::string_view
+    ///
+    /// \brief  Returns the translation of an interned string. The view is null terminated.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  id  The handle of the string.
+    ///
+    /// \returns    The translated string.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto translation(const TrId id) const -> std::string_view { return translations_[id.index]; }
+
   private:
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn Locale::Locale() = default;
@@ -105,8 +156,18 @@ class Locale {
 
     Locale() = default;
 
+    // Translates the interned string using the current catalog.
+    void translate(const TrId id);
+
     std::unique_ptr<spiritless_po::Catalog> cat_; ///< Catalog of translated strings
 
+    // Translations are resolved when a string is interned and when the language changes, which happens before the
+    // emulation threads are started. The table is never reallocated, so reads don't need locking.
+    std::array<std::string_view, max_interned_strings> translations_{}; ///< Interned strings translations.
+    std::vector<std::string> msgids_;               ///< Interned strings, indexed by TrId.
+    std::deque<std::string>  translations_storage_; ///< Storage of the translations, views stay valid when it grows.
+    std::mutex               intern_mutex_;         ///< Protects interning from concurrent call sites.
+
 }; // class Locale
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,4 +185,35 @@ class Locale {
 
 auto tr(const std::string& str) -> std::string;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn auto internTr(std::string_view str) -> TrId;
+///
+/// \brief  Interns a translatable string. Meant to initialize a static local, used later with tr(TrId) :
+///         static const auto header = internTr("Polygon draw");
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  str The string to translate.
+///
+/// \returns    The handle of the string.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+auto internTr(std::string_view str) -> TrId;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn inline auto tr(const TrId id) -> std::string_view
+///
+/// \brief  Returns the translation of an interned string, without lookup nor allocation.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  id  The handle of the string.
+///
+/// \returns    The translated string, null terminated.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline auto tr(const TrId id) -> std::string_view { return Locale::getInstance().translation(id); }
+
 }; // namespace saturnin::core
@@ -30,8 +30,8 @@ namespace saturnin::core {
 
 constexpr auto max_messages = u16{500};
 
-MapLogger                                          Log::loggers_;
-MapLoggerName                                      Log::loggers_names_;
+std::array<Log::LoggerData, loggers_number>        Log::loggers_;
+std::shared_ptr<spdlog::logger>                    Log::console_;
 std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> Log::ringbuffer_sink_;
 
 // static //
@@ -42,44 +42,11 @@ auto Log::initialize() -> bool {
 
     spdlog::sinks_init_list sink_list = {file_sink, ringbuffer_sink_};
 
-    const auto loggers_names = std::vector<std::string>{"cdrom",
-                                                        "config",
-                                                        "generic",
-                                                        "gui",
-                                                        "main",
-                                                        "memory",
-                                                        "sh2",
-                                                        "scu",
-                                                        "vdp1",
-                                                        "vdp2",
-                                                        "opengl",
-                                                        "smpc",
-                                                        "scsp",
-                                                        "test",
-                                                        "texture",
-                                                        "unimplemented"};
-    for (auto& n : loggers_names) {
-        createLogger(n, sink_list);
+    for (std::size_t i = 0; i < loggers_number; ++i) {
+        createLogger(static_cast<Logger>(i), sink_list);
     }
     spdlog::flush_every(std::chrono::seconds(3));
 
-    loggers_names_ = {{Logger::cdrom, "cdrom"},
-                      {Logger::config, "config"},
-                      {Logger::generic, "generic"},
-                      {Logger::gui, "gui"},
-                      {Logger::main, "main"},
-                      {Logger::memory, "memory"},
-                      {Logger::sh2, "sh2"},
-                      {Logger::scu, "scu"},
-                      {Logger::vdp1, "vdp1"},
-                      {Logger::vdp2, "vdp2"},
-                      {Logger::opengl, "opengl"},
-                      {Logger::smpc, "smpc"},
-                      {Logger::scsp, "scsp"},
-                      {Logger::test, "test"},
-                      {Logger::texture, "texture"},
-                      {Logger::unimplemented, "unimplemented"}};
-
     return true;
 }
 
@@ -112,12 +79,15 @@ auto Log::createRingbufferSink() -> std::shared_ptr<spdlog::sinks::ringbuffer_si
 }
 
 // static //
-void Log::createLogger(const std::string& logger_name, const spdlog::sinks_init_list& sinks_list) {
-    auto       logger  = std::make_shared<spdlog::logger>(logger_name, sinks_list.begin(), sinks_list.end());
+void Log::createLogger(const Logger logger, const spdlog::sinks_init_list& sinks_list) {
+    auto new_logger = std::make_shared<spdlog::logger>(std::string{loggerName(logger)}, sinks_list.begin(), sinks_list.end());
     const auto pattern = std::string{"[%X][%n][%l] %v"};
-    logger->set_pattern(pattern);
-    loggers_[logger_name] = logger;
-    spdlog::register_logger(logger);
+    new_logger->set_pattern(pattern);
+    spdlog::register_logger(new_logger);
+
+    auto& data  = loggers_[utilities::toUnderlying(logger)];
+    data.logger = new_logger;
+    data.level.store(new_logger->level(), std::memory_order_relaxed);
 }
 
 // static //
@@ -125,7 +95,7 @@ void Log::createConsole() {
     auto       console = spdlog::stdout_color_mt("console");
     const auto pattern = std::string{"[%X][%l] %v"};
     console->set_pattern(pattern);
-    loggers_["console"] = console;
+    console_ = console;
     // no need to register the console as it already exists
 }
 
@@ -150,27 +120,28 @@ void Log::removeFile(const std::string& path) {
 // static //
 void Log::flush() {
     for (auto const& l : loggers_) {
-        l.second->flush();
+        if (l.logger) { l.logger->flush(); }
     }
+    if (console_) { console_->flush(); }
 }
 
 // static //
-void Log::dumpBacktraceToConsole() { core::Log::loggers_.at("console")->dump_backtrace(); }
+void Log::dumpBacktraceToConsole() { console_->dump_backtrace(); }
 
 // static
-void Log::setLogLevel(const std::string& logger, const LogLevel level) {
+void Log::setLogLevel(const Logger logger, const LogLevel level) {
+    auto spdlog_level = spdlog::level::level_enum{};
     switch (level) {
         using enum LogLevel;
-        case off: {
-            loggers_.at(logger)->set_level(spdlog::level::level_enum::off);
-            break;
-        }
-        case debug: {
-            loggers_.at(logger)->set_level(spdlog::level::level_enum::debug);
-            break;
-        }
-        default: loggers_.at(logger)->set_level(spdlog::level::level_enum::info);
+        case off: spdlog_level = spdlog::level::level_enum::off; break;
+        case debug: spdlog_level = spdlog::level::level_enum::debug; break;
+        default: spdlog_level = spdlog::level::level_enum::info;
     }
+
+    auto& data = loggers_[utilities::toUnderlying(logger)];
+    if (!data.logger) { return; }
+    data.logger->set_level(spdlog_level);
+    data.level.store(spdlog_level, std::memory_order_relaxed);
 }
 
 } // namespace saturnin::core
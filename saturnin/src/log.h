@@ -25,9 +25,12 @@
 
 #pragma once
 
-#include <iosfwd> // ostringstream
-#include <map>    // map
-#include <string> // string
+#include <array>       // array
+#include <atomic>      // atomic
+#include <iosfwd>      // ostringstream
+#include <memory>      // shared_ptr
+#include <string>      // string
+#include <string_view> // string_view
 // #define SPDLOG_FMT_EXTERNAL
 // #define FMT_HEADER_ONLY
 #include <spdlog/spdlog.h>
@@ -78,11 +81,50 @@ enum class Logger {
     texture,
     unimplemented,
     generic,
-    test
+    test // Must stay the last value, used to size the loggers array.
 };
 
-using MapLogger     = std::map<std::string, std::shared_ptr<spdlog::logger>>; ///< MapLogger alias definition.
-using MapLoggerName = std::map<const Logger, const std::string>;              ///< MapLoggerName alias definition.
+constexpr auto loggers_number = static_cast<std::size_t>(Logger::test) + 1; ///< Number of loggers.
+
+/// Loggers names, indexed by the Logger enum.
+constexpr auto loggers_names = std::array<std::string_view, loggers_number>{"cdrom",
+                                                                            "config",
+                                                                            "gui",
+                                                                            "main",
+                                                                            "memory",
+                                                                            "sh2",
+                                                                            "scu",
+                                                                            "vdp1",
+                                                                            "vdp2",
+                                                                            "opengl",
+                                                                            "smpc",
+                                                                            "scsp",
+                                                                            "texture",
+                                                                            "unimplemented",
+                                                                            "generic",
+                                                                            "test"};
+
+// Lowest level compiled in, using spdlog level values. Release builds define it to SPDLOG_LEVEL_INFO, which strips
+// every debug message.
+#ifndef SATURNIN_LOG_ACTIVE_LEVEL
+    #define SATURNIN_LOG_ACTIVE_LEVEL SPDLOG_LEVEL_DEBUG
+#endif
+
+// Logs a debug message. The logger level is checked before the message arguments are evaluated, so a disabled message
+// costs a single test.
+#if SATURNIN_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG
+    #define LOG_DEBUG(logger, ...)                                                                   \
+        do {                                                                                         \
+            if (saturnin::core::Log::isEnabled(logger, spdlog::level::debug)) {                      \
+                saturnin::core::Log::debug(logger, __VA_ARGS__);                                     \
+            }                                                                                        \
+        } while (false)
+#else
+    #define LOG_DEBUG(logger, ...) static_cast<void>(0)
+#endif
+
+// Logs a debug message to the unimplemented logger, with the same guarantees as LOG_DEBUG.
+#define LOG_UNIMPLEMENTED(...) LOG_DEBUG(saturnin::core::Logger::unimplemented, __VA_ARGS__)
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \class  Log
@@ -147,16 +189,13 @@ class Log {
     template<typename... Args>
     static inline void error(const Logger logger, std::string_view value, const Args&... args) {
         try {
-            const auto& logger_name = loggers_names_[logger];
-            if (loggerExists(logger_name)) {
-                loggers_.at(logger_name)->error(fmt::runtime(value), args...);
-
-                // Errors are also logged to console, using original logger name.
-                // Using append() here as operator '+' isn't available for string_view.
-                const auto& message = std::string{"[{}] "}.append(value);
-                loggers_.at("console")->error(fmt::runtime(message.c_str()), logger_name, args...);
-            }
-        } catch (const std::runtime_error& e) { loggers_.at("console")->warn(e.what()); }
+            if (isEnabled(logger, spdlog::level::err)) { getLogger(logger)->error(fmt::runtime(value), args...); }
+
+            // Errors are also logged to console, using original logger name, whatever the logger level.
+            // Using append() here as operator '+' isn't available for string_view.
+            const auto& message = std::string{"[{}] "}.append(value);
+            console_->error(fmt::runtime(message.c_str()), loggerName(logger), args...);
+        } catch (const std::runtime_error& e) { console_->warn(e.what()); }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -177,36 +216,33 @@ class Log {
     template<typename... Args>
     [[noreturn]] static inline void exception(const Logger logger, std::string_view value, const Args&... args) {
         try {
-            const auto& logger_name = loggers_names_[logger];
-            if (loggerExists(logger_name)) {
-                loggers_.at(logger_name)->critical(fmt::runtime(value), args...);
-
-                // Errors are also logged to console, using original logger name.
-                // Using append() here as operator '+' isn't available for string_view.
-                const auto& message = std::string{"[{}] "}.append(value);
-                loggers_.at("console")->critical(fmt::runtime(message.c_str()), logger_name, args...);
-
-                // Throwing the linked exception.
-                const auto str = utilities::format(value, args...);
-                switch (logger) {
-                    using enum Logger;
-                    case cdrom: throw excpt::CdromError(str);
-                    case config: throw excpt::ConfigError(str);
-                    case gui: throw excpt::GuiError(str);
-                    case generic: throw excpt::GenericError(str);
-                    case main: throw excpt::MainError(str);
-                    case memory: throw excpt::MemoryError(str);
-                    case opengl: throw excpt::OpenglError(str);
-                    case scsp: throw excpt::ScspError(str);
-                    case scu: throw excpt::ScuError(str);
-                    case sh2: throw excpt::Sh2Error(str);
-                    case smpc: throw excpt::SmpcError(str);
-                    case test: throw excpt::TestError(str);
-                    case texture: throw excpt::TextureError(str);
-                    case unimplemented: throw excpt::UnimplementedError(str);
-                    case vdp1: throw excpt::Vdp1Error(str);
-                    case vdp2: throw excpt::Vdp2Error(str);
-                }
+            if (isEnabled(logger, spdlog::level::critical)) { getLogger(logger)->critical(fmt::runtime(value), args...); }
+
+            // Errors are also logged to console, using original logger name, whatever the logger level.
+            // Using append() here as operator '+' isn't available for string_view.
+            const auto& message = std::string{"[{}] "}.append(value);
+            console_->critical(fmt::runtime(message.c_str()), loggerName(logger), args...);
+
+            // Throwing the linked exception.
+            const auto str = utilities::format(value, args...);
+            switch (logger) {
+                using enum Logger;
+                case cdrom: throw excpt::CdromError(str);
+                case config: throw excpt::ConfigError(str);
+                case gui: throw excpt::GuiError(str);
+                case generic: throw excpt::GenericError(str);
+                case main: throw excpt::MainError(str);
+                case memory: throw excpt::MemoryError(str);
+                case opengl: throw excpt::OpenglError(str);
+                case scsp: throw excpt::ScspError(str);
+                case scu: throw excpt::ScuError(str);
+                case sh2: throw excpt::Sh2Error(str);
+                case smpc: throw excpt::SmpcError(str);
+                case test: throw excpt::TestError(str);
+                case texture: throw excpt::TextureError(str);
+                case unimplemented: throw excpt::UnimplementedError(str);
+                case vdp1: throw excpt::Vdp1Error(str);
+                case vdp2: throw excpt::Vdp2Error(str);
             }
             //} catch (const std::runtime_error& e) {
         } catch (...) {
@@ -233,15 +269,13 @@ class Log {
     template<typename... Args>
     static inline void warning(const Logger logger, std::string_view value, const Args&... args) {
         try {
-            const auto& logger_name = loggers_names_[logger];
-            if (loggerExists(logger_name)) {
-                loggers_.at(logger_name)->warn(fmt::runtime(value), args...);
-                // Warnings are also logged to console, using original logger name.
-                // Using append() here as operator '+' isn't available for string_view.
-                const auto& message = std::string{"[{}] "}.append(value);
-                loggers_.at("console")->warn(fmt::runtime(message.c_str()), logger_name, args...);
-            }
-        } catch (const std::runtime_error& e) { loggers_.at("console")->warn(e.what()); }
+            if (isEnabled(logger, spdlog::level::warn)) { getLogger(logger)->warn(fmt::runtime(value), args...); }
+
+            // Warnings are also logged to console, using original logger name, whatever the logger level.
+            // Using append() here as operator '+' isn't available for string_view.
+            const auto& message = std::string{"[{}] "}.append(value);
+            console_->warn(fmt::runtime(message.c_str()), loggerName(logger), args...);
+        } catch (const std::runtime_error& e) { console_->warn(e.what()); }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,15 +295,15 @@ class Log {
 
     template<typename... Args>
     static inline void info(const Logger logger, std::string_view value, const Args&... args) {
-        const auto& logger_name = loggers_names_[logger];
-        if (loggerExists(logger_name)) { loggers_.at(logger_name)->info(fmt::runtime(value), args...); }
+        if (isEnabled(logger, spdlog::level::info)) { getLogger(logger)->info(fmt::runtime(value), args...); }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn template <typename... Args> static inline void Log::debug(const std::string& logger_name, const std::string&
     /// value, const Args&... args)
     ///
-    /// \brief  Writes a debug message to the specified logger.
+    /// \brief  Writes a debug message to the specified logger. Arguments are evaluated even when the logger level is
+    ///         above debug, LOG_DEBUG should be used in code run often.
     ///
     /// \author Runik
     /// \date   08/02/2018
@@ -282,12 +316,13 @@ class Log {
 
     template<typename... Args>
     static inline void debug(const Logger logger, std::string_view value, const Args&... args) {
-        const auto& logger_name = loggers_names_[logger];
-        if (loggerExists(logger_name)) { loggers_.at(logger_name)->debug(fmt::runtime(value), args...); }
+        if constexpr (SATURNIN_LOG_ACTIVE_LEVEL <= SPDLOG_LEVEL_DEBUG) {
+            if (isEnabled(logger, spdlog::level::debug)) { getLogger(logger)->debug(fmt::runtime(value), args...); }
+        }
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn template<typename... Args> static inline void Log::unimplemented(const std::string& value, const Args&... args)
+    /// \fn template<typename... Args> static inline void Log::unimplemented(std::string_view value, const Args&... args)
     ///
     /// \brief  Writes a debug message to the unimplemented logger.
     ///
@@ -297,31 +332,44 @@ class Log {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
     template<typename... Args>
-    static inline void unimplemented(const std::string& value, const Args&... args) {
+    static inline void unimplemented(std::string_view value, const Args&... args) {
         debug(Logger::unimplemented, value, args...);
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn static inline auto Log::loggerExists(const std::string& logger_name) -> bool
+    /// \fn static inline auto Log::isEnabled(const Logger logger, const spdlog::level::level_enum level) -> bool
     ///
-    /// \brief  Queries if a given logger exists.
+    /// \brief  Checks if a message of the specified level would be written by the logger. Loggers are disabled until
+    ///         initialization.
     ///
     /// \author Runik
-    /// \date   08/02/2018
+    /// \date   19/10/2026
     ///
-    /// \exception  std::runtime_error  Raised when a runtime error condition occurs.
+    /// \param  logger  Type of the logger.
+    /// \param  level   Level of the message.
     ///
-    /// \param  logger_name Name of the logger.
+    /// \return True if the message has to be written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static inline auto isEnabled(const Logger logger, const spdlog::level::level_enum level) -> bool {
+        return level >= loggers_[utilities::toUnderlying(logger)].level.load(std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static inline auto Log::loggerName(const Logger logger) -> std::string_view
+    ///
+    /// \brief  Returns the name of the logger.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  logger  Type of the logger.
     ///
-    /// \return True if the logger exists.
+    /// \return The logger name.
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static inline auto loggerExists(const std::string& logger_name) -> bool {
-        if (loggers_.count(logger_name) == 0) {
-            const auto error = utilities::format(tr("Log '{0}' is not defined !"), logger_name);
-            throw exception::LogError(error);
-        }
-        return true;
+    static inline auto loggerName(const Logger logger) -> std::string_view {
+        return loggers_names[utilities::toUnderlying(logger)];
     }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,24 +415,23 @@ class Log {
     static auto createRingbufferSink() -> std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt>;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn static void Log::createLogger(const std::string& logger_name, const
-    /// std::shared_ptr<spdlog::sinks::simple_file_sink_mt>& sink);
+    /// \fn static void Log::createLogger(const Logger logger, const spdlog::sinks_init_list& sink);
     ///
     /// \brief  Creates a logger.
     ///
     /// \author Runik
     /// \date   08/02/2018
     ///
-    /// \param  logger_name Name of the logger.
-    /// \param  sink        The sink.
+    /// \param  logger  Type of the logger.
+    /// \param  sink    The sink.
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void createLogger(const std::string& logger_name, const spdlog::sinks_init_list& sink);
+    static void createLogger(const Logger logger, const spdlog::sinks_init_list& sink);
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn static void Log::createConsole();
     ///
-    /// \brief  Creates the console logger. Will be accessible using "console" name.
+    /// \brief  Creates the console logger, which gets a copy of warnings and errors.
     ///
     /// \author Runik
     /// \date   23/06/2018
@@ -441,7 +488,7 @@ class Log {
     static auto getRingbuffer() -> std::string;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn static void Log::setLogLevel(const std::string& logger, const LogLevel level);
+    /// \fn static void Log::setLogLevel(const Logger logger, const LogLevel level);
     ///
     /// \brief  Sets log level of the logger passed as parameter.
     ///
@@ -452,11 +499,21 @@ class Log {
     /// \param  level   The new level.
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    static void setLogLevel(const std::string& logger, const LogLevel level);
+    static void setLogLevel(const Logger logger, const LogLevel level);
 
   private:
-    static MapLogger                                          loggers_; ///< Map containing all the loggers used in the program
-    static MapLoggerName                                      loggers_names_; ///< Link between logger enumerator and logger name.
+    // A logger and its level, which is checked before any formatting is done.
+    struct LoggerData {
+        std::shared_ptr<spdlog::logger>        logger;                   ///< The spdlog logger.
+        std::atomic<spdlog::level::level_enum> level{spdlog::level::off}; ///< Lowest level written by the logger.
+    };
+
+    static inline auto getLogger(const Logger logger) -> spdlog::logger* {
+        return loggers_[utilities::toUnderlying(logger)].logger.get();
+    }
+
+    static std::array<LoggerData, loggers_number>             loggers_;         ///< Loggers used in the program, indexed by Logger.
+    static std::shared_ptr<spdlog::logger>                    console_;         ///< The console logger.
     static std::shared_ptr<spdlog::sinks::ringbuffer_sink_mt> ringbuffer_sink_; ///< The ringbuffer sink
 };
 }; // namespace saturnin::core
@@ -24,6 +24,7 @@
 #include <saturnin/src/locale.h>      // tr
 #include <saturnin/src/log.h>         // Log
 #include <saturnin/src/thread_pool.h> // TreadPool
+#include <saturnin/src/trace.h>       // Trace
 
 namespace core      = saturnin::core;
 namespace exception = saturnin::exception;
@@ -32,6 +33,7 @@ using core::EmulatorContext;
 using core::Log;
 using core::Logger;
 using core::ThreadPool;
+using core::Trace;
 using core::tr;
 
 auto main(int argc, char* argv[]) -> int {
@@ -45,6 +47,7 @@ auto main(int argc, char* argv[]) -> int {
             state.startInterface();
             state.stopEmulation();
         }
+        Trace::stop();
         Log::shutdown();
         ThreadPool::shutdown();
         std::exit(EXIT_SUCCESS);
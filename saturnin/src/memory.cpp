@@ -25,9 +25,11 @@
 #include <saturnin/src/emulator_context.h>
 #include <saturnin/src/exceptions.h> // MemoryError
 #include <saturnin/src/locale.h>     // NOLINT(modernize-deprecated-headers)
+#include <saturnin/src/save_state.h>
 // #include <saturnin/src/sh2/sh2.h>
 #include <saturnin/src/utilities.h> // format
 #include <saturnin/src/cdrom/cdrom.h>
+#include <saturnin/src/cdrom/iso9660.h>
 #include <saturnin/src/sound/scsp.h>
 #include <saturnin/src/video/vdp1.h>
 #include <saturnin/src/video/vdp2/vdp2.h>
@@ -199,6 +201,16 @@ void Memory::loadBios(const HardwareMode mode) {
     } else {
         Log::warning(Logger::memory, tr("Bios file not found !"));
     }
+
+    // Save states are checked against the hash, it's calculated once as the ROM isn't written afterwards. FNV-1a is used,
+    // its value doesn't depend on the compiler.
+    constexpr auto fnv_offset_basis = u64{0xcbf29ce484222325};
+    constexpr auto fnv_prime        = u64{0x100000001b3};
+
+    rom_hash_ = fnv_offset_basis;
+    for (const auto byte : rom_) {
+        rom_hash_ = (rom_hash_ ^ byte) * fnv_prime;
+    }
 }
 
 auto Memory::loadStvGame(const StvGameConfiguration& game) -> bool {
@@ -215,6 +227,8 @@ auto Memory::loadStvGame(const StvGameConfiguration& game) -> bool {
     }
 
     swapCartArea();
+    is_cart_page_written_.fill(false);
+    cart_loaded_pages_.clear();
 
     return true;
 }
@@ -410,7 +424,7 @@ auto Memory::readStvProtection(const u32 addr, u32 data) const -> u32 {
             case 0xf9ff0000:                           // NOLINT(readability-magic-numbers)
             case 0xffbf0000: data = 0x02002000; break; // NOLINT(readability-magic-numbers)
         }
-        Log::debug(Logger::memory, "ST-V protection read index: {}, value: {}", stv_protection_offset, data);
+        LOG_DEBUG(Logger::memory, "ST-V protection read index: {}, value: {}", stv_protection_offset, data);
     } else {
         stv_protection_offset = 0;
     }
@@ -444,7 +458,7 @@ void Memory::writeStvProtection([[maybe_unused]] const u32 addr, [[maybe_unused]
             // Radiant Silvergun
         case 0x77770000: break; // NOLINT(readability-magic-numbers)
     }
-    Log::debug(Logger::memory, uti::format(core::tr("ST-V offset start: {}"), this->stv_protection_offset_));
+    LOG_DEBUG(Logger::memory, uti::format(core::tr("ST-V offset start: {}"), this->stv_protection_offset_));
 }
 
 auto Memory::isStvProtectionEnabled() const -> bool {
@@ -571,6 +585,7 @@ void Memory::initialize(saturnin::core::HardwareMode mode) {
     if (mode == HardwareMode::stv) {
         if (selectedStvGame().game_name != defaultStvGame().game_name) { loadStvGame(selectedStvGame()); }
     } else {
+        const bool is_cd_fast_boot_set = modules_.config()->readValue(AccessKeys::cfg_cdrom_fast_boot);
         if (selectedBinaryFile().full_path != defaultBinaryFile().full_path) {
             //            if (loadBinaryFile(selectedBinaryFile())) {
             installMinimumBiosRoutines();
@@ -582,6 +597,10 @@ void Memory::initialize(saturnin::core::HardwareMode mode) {
             //} else {
             //    selectedBinaryFile(defaultBinaryFile());
             //}
+        } else if (is_cd_fast_boot_set && !installCdFastBoot()) {
+            // Part of the disc may have been copied already, the BIOS starts from a cleared work RAM.
+            workram_high_.fill(0);
+            Log::warning(Logger::memory, tr("CD fast boot failed, the disc is booted by the BIOS"));
         }
     }
 }
@@ -655,6 +674,119 @@ void Memory::installMinimumBiosRoutines() {
     rawWrite<u32>(workram_high_, 0xa1c, 0x0602bcc2);
 }
 
+auto Memory::installCdFastBoot() -> bool {
+    constexpr auto hardware_identifier  = std::string_view{"SEGA SEGASATURN "};
+    constexpr auto ip_size_offset       = u32{0xE0};
+    constexpr auto master_stack_offset  = u32{0xE8};
+    constexpr auto first_read_offset    = u32{0xF0};
+    constexpr auto ip_max_size          = u32{cdrom::system_area_blocks * cdrom::user_data_size};
+    constexpr auto ip_load_address      = u32{0x06002000};
+    constexpr auto ip_code_offset       = u32{0xE00}; // Area codes, followed by the application initial program.
+    constexpr auto default_master_stack = u32{0x06002000};
+
+    const auto first_file = cdrom::DiscImage::fileSystem().firstFile();
+    if (first_file == nullptr) {
+        Log::warning(Logger::memory, tr("Fast boot needs a disc image with an ISO9660 file system"));
+        return false;
+    }
+
+    // IP.BIN is stored in the system area, before the volume descriptors.
+    auto ip = std::array<u8, ip_max_size>{};
+    for (u32 i = 0; i < cdrom::system_area_blocks; ++i) {
+        const auto block = std::span(ip).subspan(i * cdrom::user_data_size).first<cdrom::user_data_size>();
+        if (!cdrom::IsoFileSystem::readBlock(i, block)) { return false; }
+    }
+    const auto ip_size = rawRead<u32>(ip, ip_size_offset);
+    if (!std::equal(hardware_identifier.begin(), hardware_identifier.end(), ip.begin()) || (ip_size <= ip_code_offset)
+        || (ip_size > ip_max_size)) {
+        Log::warning(Logger::memory, tr("Invalid IP.BIN header, the disc is booted by the BIOS"));
+        return false;
+    }
+
+    // Removing cache through addresses
+    auto first_read_address = rawRead<u32>(ip, first_read_offset);
+    if (((first_read_address >> 28) | 2) == 2) { first_read_address &= 0xFFFFFFF; }
+    const auto first_read_offset_in_ram = first_read_address & workram_high_memory_mask;
+    if (!uti::Range<workram_high_area>::contains(first_read_address)
+        || (first_read_offset_in_ram + first_file->size > workram_high_size)) {
+        Log::warning(Logger::memory, tr("First read file doesn't fit in work RAM, the disc is booted by the BIOS"));
+        return false;
+    }
+
+    auto block = std::array<u8, cdrom::user_data_size>{};
+    for (u32 loaded = 0; loaded < first_file->size; loaded += cdrom::user_data_size) {
+        if (!cdrom::IsoFileSystem::readBlock(first_file->lba + loaded / cdrom::user_data_size, block)) { return false; }
+        std::copy_n(block.begin(),
+                    std::min(u32{cdrom::user_data_size}, first_file->size - loaded),
+                    workram_high_.begin() + first_read_offset_in_ram + loaded);
+    }
+    std::copy_n(ip.begin(), ip_size, workram_high_.begin() + (ip_load_address & workram_high_memory_mask));
+
+    installMinimumBiosRoutines();
+
+    const auto master_stack = rawRead<u32>(ip, master_stack_offset);
+    modules_.masterSh2()->setBinaryFileStartAddress(ip_load_address + ip_code_offset);
+    modules_.masterSh2()->setBinaryFileStackAddress((master_stack != 0) ? master_stack : default_master_stack);
+
+    Log::info(Logger::memory, tr("Fast boot : first read file loaded at {:#010x}"), first_read_address);
+    return true;
+}
+
+void Memory::reloadCart() {
+    for (const auto& [page, content] : cart_loaded_pages_) {
+        if (is_cart_page_written_[page]) { std::ranges::copy(content, cart_.begin() + page * cart_page_size); }
+    }
+    is_cart_page_written_.fill(false);
+}
+
+void Memory::markCartPageWritten(const u32 page) {
+    const auto content = std::span{cart_}.subspan(page * cart_page_size, cart_page_size);
+    cart_loaded_pages_.try_emplace(page, content.begin(), content.end());
+    is_cart_page_written_[page] = true;
+}
+
+template<typename Archive>
+void Memory::serialize(Archive& ar) {
+    ar.bytes(std::span{workram_low_});
+    ar.bytes(std::span{workram_high_});
+    ar.bytes(std::span{smpc_});
+    ar.bytes(std::span{backup_ram_});
+    ar.bytes(std::span{scu_});
+    ar.bytes(std::span{vdp2_vram_});
+    ar.bytes(std::span{vdp2_cram_});
+    ar.bytes(std::span{vdp2_registers_});
+    ar.bytes(std::span{vdp1_vram_});
+    ar.bytes(std::span{vdp1_framebuffer_});
+    ar.bytes(std::span{vdp1_registers_});
+    ar.bytes(std::span{sound_ram_});
+    ar.bytes(std::span{stv_io_});
+    ar.value(stv_protection_offset_);
+    ar.value(stv_protection_offset);
+
+    // Unwritten cart pages are the ones loaded from the game files, pages written since then are restored over them.
+    auto written_pages_number = static_cast<u32>(std::ranges::count(is_cart_page_written_, true));
+    ar.value(written_pages_number);
+    if constexpr (Archive::is_loading) {
+        if (std::ranges::find(is_cart_page_written_, true) != is_cart_page_written_.end()) { reloadCart(); }
+        for (u32 i = 0; (i < written_pages_number) && ar.isValid(); ++i) {
+            auto page = u32{};
+            ar.value(page);
+            if (page >= is_cart_page_written_.size()) { break; } // The chunk size check will fail.
+            markCartPageWritten(page);
+            ar.bytes(std::span{cart_}.subspan(page * cart_page_size, cart_page_size));
+        }
+    } else {
+        for (u32 page = 0; page < is_cart_page_written_.size(); ++page) {
+            if (!is_cart_page_written_[page]) { continue; }
+            ar.value(page);
+            ar.bytes(std::span{cart_}.subspan(page * cart_page_size, cart_page_size));
+        }
+    }
+}
+
+template void Memory::serialize(StateWriter&);
+template void Memory::serialize(StateReader&);
+
 auto Memory::getAreaData(u32 addr) -> AreaMask {
     // Removing cache through addresses
     if (((addr >> 28) | 2) == 2) { addr &= 0xFFFFFFF; }
@@ -711,9 +843,73 @@ void Memory::burstCopy(const u32 source_address, const u32 destination_address,
 
     const auto& [source, source_mask]           = *source_area;
     const auto& [destination, destination_mask] = *destination_area;
+    if (amount == 0) { return; }
+
+    auto copied = u32{};
+    while (copied < amount) {
+        const auto source_offset      = (source_address + copied) & source_mask;
+        const auto destination_offset = (destination_address + copied) & destination_mask;
+        const auto source_left        = source_mask + 1 - source_offset;
+        const auto destination_left   = destination_mask + 1 - destination_offset;
+        const auto size               = std::min({amount - copied, source_left, destination_left});
+        memcpy(destination + destination_offset, source + source_offset, size);
+        copied += size;
+    }
 
-    memcpy(destination + (destination_address & destination_mask), source + (source_address & source_mask), amount);
-
+    if (uti::Range<vdp2_vram_area>::contains(destination_address)) {
+        markVdp2VramAccessed(destination_address & vdp2_vram_memory_mask, amount);
+    }
+    if (uti::Range<vdp2_cram_area>::contains(destination_address)) { was_vdp2_cram_accessed_ = true; }
     if (uti::Range<vdp2_regs_area>::contains(destination_address)) { modules_.vdp2()->refreshRegisters(); }
 }
+
+auto Memory::transferFromCdBlock(const u32 source_address, const u32 destination_address, const u32 amount) -> bool {
+    // Removing cache through addresses
+    const auto uncached = [](const u32 addr) { return (((addr >> 28) | 2) == 2) ? (addr & 0xFFFFFFF) : addr; };
+    if ((amount == 0) || (uncached(source_address) != uncached(cdrom::fetch_data_pointer_address))) { return false; }
+
+    const auto address     = uncached(destination_address);
+    auto       destination = std::span<u8>{};
+    auto       offset      = u32{};
+    if (uti::Range<workram_low_area>::contains(address)) {
+        destination = workram_low_;
+        offset      = address & workram_low_memory_mask;
+    } else if (uti::Range<vdp1_ram_area>::contains(address)) {
+        destination = vdp1_vram_;
+        offset      = address & vdp1_ram_memory_mask;
+    } else if (uti::Range<vdp2_vram_area>::contains(address)) {
+        destination = vdp2_vram_;
+        offset      = address & vdp2_vram_memory_mask;
+    } else if (uti::Range<workram_high_area>::contains(address)) {
+        destination = workram_high_;
+        offset      = address & workram_high_memory_mask;
+    }
+    // Transfers wrapping around the area mirrors are left to the usual accesses.
+    if (destination.empty() || (offset + amount > destination.size())) { return false; }
+
+    modules_.cdrom()->readTransferBlock(destination.subspan(offset, amount));
+
+    if (uti::Range<vdp2_vram_area>::contains(address)) { markVdp2VramAccessed(offset, amount); }
+    return true;
+}
+
+void Memory::markVdp2VramAccessed(const u32 offset, const u32 amount) {
+    const auto mark = [this](const u32 first, const u32 last) {
+        for (auto page = first >> vdp2_page_disp; page <= last >> vdp2_page_disp; ++page) {
+            was_vdp2_page_accessed_[page] = true;
+        }
+        for (auto bitmap = first >> vdp2_bitmap_disp; bitmap <= last >> vdp2_bitmap_disp; ++bitmap) {
+            was_vdp2_bitmap_accessed_[bitmap] = true;
+        }
+    };
+
+    // A block wrapping around the VRAM mirrors is marked up to the end of VRAM, then from its start.
+    const auto end = offset + amount;
+    if (end <= vdp2_vram_size) {
+        mark(offset, end - 1);
+    } else {
+        mark(offset, vdp2_vram_size - 1);
+        mark(0, std::min(end - vdp2_vram_size, vdp2_vram_size) - 1);
+    }
+}
 } // namespace saturnin::core
@@ -255,6 +255,11 @@ class Memory {
         was_vdp2_page_accessed_; ///< True when a specific VDP2 page was accessed.
     std::array<bool, vdp2_vram_size / vdp2_minimum_bitmap_size>
         was_vdp2_bitmap_accessed_; ///< True when a specific VDP2 bitmap was accessed.
+    std::array<bool, cart_size / cart_page_size>
+        is_cart_page_written_{}; ///< True when a cart page was written since the cart was loaded.
+    std::map<u32, std::vector<u8>> cart_loaded_pages_; ///< Content of the written cart pages, as loaded.
+
+    u64 rom_hash_{}; ///< FNV-1a hash of the ROM, calculated when the BIOS is loaded.
 
     sh2::Sh2Type sh2_in_operation_; ///< Which SH2 is in operation
     // bool interrupt_signal_is_sent_from_master_sh2_{ false }; ///< InterruptCapture signal sent to the slave SH2 (minit)
@@ -286,7 +291,7 @@ class Memory {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Memory::loadBios(saturnin::core::HardwareMode mode);
     ///
-    /// \brief  Loads the BIOS into memory.
+    /// \brief  Loads the BIOS into memory, and calculates its hash.
     ///
     /// \author Runik
     /// \date   18/06/2018
@@ -485,7 +490,8 @@ class Memory {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn	void Memory::burstCopy(const u32 source_address, const u32 destination_address, const u32 amount);
     ///
-    /// \brief	Burst copy from one memory area to another.
+    /// \brief	Burst copy from one memory area to another. The copy is split where an area wraps around
+    /// 		its mirrors, VDP2 VRAM and CRAM accesses are tracked once for the whole range.
     ///
     /// \author	Runik
     /// \date	12/02/2023
@@ -497,6 +503,41 @@ class Memory {
 
     void burstCopy(const u32 source_address, const u32 destination_address, const u32 amount);
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn	auto Memory::transferFromCdBlock(const u32 source_address, const u32 destination_address, const u32 amount) -> bool;
+    ///
+    /// \brief	Copies in one block the CD block data transfer register reads of a DMA, when the
+    /// 		destination is a RAM area. Sector data is copied straight from the CD block buffer.
+    ///
+    /// \author	Runik
+    /// \date	19/10/2026
+    ///
+    /// \param 	source_address	   	Source address of the DMA.
+    /// \param 	destination_address	Destination address.
+    /// \param 	amount			   	Amount of data to copy.
+    ///
+    /// \returns	False if the transfer can't be done as a block copy. Nothing is read then, the caller
+    /// 			has to fall back to the usual accesses.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto transferFromCdBlock(const u32 source_address, const u32 destination_address, const u32 amount) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Memory::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the RAM areas. The ROM isn't written once loaded and isn't part of
+    ///         the state, only the cart pages written since the cart was loaded are.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
     // template<typename T, typename U, size_t N>
     // static auto rawRead(const std::array<U, N>& arr, u32 addr) -> T {
     //     T return_value{arr[addr]};
@@ -516,6 +557,20 @@ class Memory {
     //     }
     // }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Memory::markCartPageWritten(const u32 page);
+    ///
+    /// \brief  Keeps a copy of a cart page content, and marks it as written. Called before the first
+    ///         write to the page, by the cart write handlers.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  page    The cart page.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void markCartPageWritten(const u32 page);
+
     EmulatorModules modules_;
 
   private:
@@ -563,6 +618,46 @@ class Memory {
 
     void installMinimumBiosRoutines();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn	auto Memory::installCdFastBoot() -> bool;
+    ///
+    /// \brief	Boots the disc image without running the BIOS boot sequence : IP.BIN and the first read
+    /// 		file are loaded in work RAM, and the master SH2 starts in the initial program once reset.
+    ///
+    /// \author	Runik
+    /// \date	19/10/2026
+    ///
+    /// \returns	False if the disc can't be booted this way, the BIOS boots it then.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto installCdFastBoot() -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Memory::reloadCart();
+    ///
+    /// \brief  Restores the cart to its content after loading, clearing the written pages. The pages
+    ///         are restored from the copies kept before their first write, not from the game files.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void reloadCart();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Memory::markVdp2VramAccessed(const u32 offset, const u32 amount);
+    ///
+    /// \brief  Marks the VDP2 pages and bitmaps covered by a block written to VRAM as accessed.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  offset  Offset of the block in VRAM.
+    /// \param  amount  Size of the block, not null.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void markVdp2VramAccessed(const u32 offset, const u32 amount);
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn template<typename T> void Memory::initializeHandler(AddressRange& ar, ReadType<T> func)
     ///
@@ -912,80 +1007,80 @@ struct readStvIo<u8> {
             switch (addr & 0xFFFFFF) {
                 case stv_io_port_a: {
                     const auto p1 = m.modules_.smpc()->getStvPeripheralMapping().player_1;
-                    if (isKeyPressed(p1.button_1, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.button_1, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_1);
                     }
-                    if (isKeyPressed(p1.button_2, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.button_2, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_2);
                     }
-                    if (isKeyPressed(p1.button_3, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.button_3, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_3);
                     }
-                    if (isKeyPressed(p1.button_4, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.button_4, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_4);
                     }
-                    if (isKeyPressed(p1.direction_down, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.direction_down, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::down);
                     }
-                    if (isKeyPressed(p1.direction_up, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.direction_up, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::up);
                     }
-                    if (isKeyPressed(p1.direction_right, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.direction_right, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::right);
                     }
-                    if (isKeyPressed(p1.direction_left, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p1.direction_left, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::left);
                     }
                     break;
                 }
                 case stv_io_port_b: {
                     const auto p2 = m.modules_.smpc()->getStvPeripheralMapping().player_2;
-                    if (isKeyPressed(p2.button_1, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.button_1, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_1);
                     }
-                    if (isKeyPressed(p2.button_2, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.button_2, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_2);
                     }
-                    if (isKeyPressed(p2.button_3, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.button_3, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_3);
                     }
-                    if (isKeyPressed(p2.button_4, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.button_4, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::button_4);
                     }
-                    if (isKeyPressed(p2.direction_down, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.direction_down, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::down);
                     }
-                    if (isKeyPressed(p2.direction_up, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.direction_up, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::up);
                     }
-                    if (isKeyPressed(p2.direction_right, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.direction_right, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::right);
                     }
-                    if (isKeyPressed(p2.direction_left, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(p2.direction_left, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::left);
                     }
                     break;
                 }
                 case stv_io_port_c: {
                     const auto board = m.modules_.smpc()->getStvPeripheralMapping().board_controls;
-                    if (isKeyPressed(board.p1_coin_switch, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(board.p1_coin_switch, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::coin_switch_player1);
                     }
-                    if (isKeyPressed(board.p2_coin_switch, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(board.p2_coin_switch, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::coin_switch_player2);
                     }
-                    if (isKeyPressed(board.test_switch, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(board.test_switch, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::test_switch);
                         m.modules_.smpc()->setTestSwitch();
                     }
-                    if (isKeyPressed(board.service_switch, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(board.service_switch, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::service_switch);
                         m.modules_.smpc()->setServiceSwitch();
                     }
-                    if (isKeyPressed(board.p1_start, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(board.p1_start, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::start_player1);
                     }
-                    if (isKeyPressed(board.p2_start, m.modules_.context()->openglWindow())) {
+                    if (isKeyPressed(board.p2_start, m.modules_.context())) {
                         data |= util::toUnderlying(StvIOPort::start_player2);
                     }
                     break;
@@ -1092,7 +1187,9 @@ template<typename T>
 struct writeCart {
     operator Memory::WriteType<T>() const {
         return [](Memory& m, const u32 addr, const T data) {
-            u32 relative_addr = calculateRelativeCartAddress(addr);
+            u32        relative_addr = calculateRelativeCartAddress(addr);
+            const auto page          = relative_addr / cart_page_size;
+            if (!m.is_cart_page_written_[page]) { m.markCartPageWritten(page); }
             rawWrite<T>(m.cart_, relative_addr, data);
         };
     }
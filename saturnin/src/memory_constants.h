@@ -38,6 +38,7 @@ constexpr auto vdp1_registers_size          = u8{0x18};
 constexpr auto sound_ram_size               = u32{0x100000};
 constexpr auto stv_io_size                  = u16{0x100};
 constexpr auto cart_size                    = u32{0x3000000};
+constexpr auto cart_page_size               = u32{0x10000};
 constexpr auto rom_memory_mask              = u32{0x7FFFF};
 constexpr auto smpc_memory_mask             = u32{0x7F};
 constexpr auto backup_ram_memory_mask       = u32{0xFFFF};
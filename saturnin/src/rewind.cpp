@@ -0,0 +1,223 @@
+//
+// rewind.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/rewind.h>
+#include <algorithm> // max, min
+#include <chrono>    // seconds
+#include <cstring>   // memcmp, memcpy
+#include <span>      // span
+#include <saturnin/src/config.h>
+#include <saturnin/src/emulator_context.h>
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>
+#include <saturnin/src/save_state.h>
+#include <saturnin/src/thread_pool.h> // ThreadPool
+#include <saturnin/src/timing.h>
+
+namespace saturnin::core {
+
+constexpr auto bytes_per_megabyte = std::size_t{1024 * 1024};
+constexpr auto min_zero_run       = std::size_t{8}; // Shorter runs of identical bytes are kept in the XORed bytes.
+
+template<typename T>
+inline void appendValue(std::vector<u8>& out, const T value) {
+    const auto first = reinterpret_cast<const u8*>(&value);
+    out.insert(out.end(), first, first + sizeof(T));
+}
+
+template<typename T>
+inline auto extractValue(std::span<const u8> in, std::size_t& position) -> T {
+    auto value = T{};
+    std::memcpy(&value, in.data() + position, sizeof(T));
+    position += sizeof(T);
+    return value;
+}
+
+// Appends the XOR of two pages as pairs of counts (identical bytes, XORed bytes), followed by the XORed bytes.
+inline void encodePage(std::span<const u8> previous, std::span<const u8> current, std::vector<u8>& out) {
+    const auto size     = previous.size();
+    auto       position = std::size_t{};
+    while (position < size) {
+        auto identical_end = position;
+        while ((identical_end < size) && (previous[identical_end] == current[identical_end])) {
+            ++identical_end;
+        }
+
+        auto xored_end = identical_end;
+        auto run       = std::size_t{};
+        for (auto i = identical_end; i < size; ++i) {
+            if (previous[i] != current[i]) {
+                xored_end = i + 1;
+                run       = 0;
+            } else if (++run == min_zero_run) {
+                break;
+            }
+        }
+
+        appendValue(out, static_cast<u16>(identical_end - position));
+        appendValue(out, static_cast<u16>(xored_end - identical_end));
+        for (auto i = identical_end; i < xored_end; ++i) {
+            out.push_back(previous[i] ^ current[i]);
+        }
+        position = xored_end;
+    }
+}
+
+// XORs an encoded page into the page, returns the position following the page in the delta.
+inline auto decodePage(std::span<const u8> delta, std::size_t position, std::span<u8> page) -> std::size_t {
+    auto offset = std::size_t{};
+    while (offset < page.size()) {
+        offset += extractValue<u16>(delta, position);
+        const auto xored = extractValue<u16>(delta, position);
+        for (u16 i = 0; i < xored; ++i) {
+            page[offset++] ^= delta[position++];
+        }
+    }
+    return position;
+}
+
+Rewind::~Rewind() { waitCompression(); }
+
+void Rewind::initialize() {
+    waitCompression();
+
+    const bool is_enabled = context_->config()->readValue(AccessKeys::cfg_rewind_enabled);
+    const s32  interval   = context_->config()->readValue(AccessKeys::cfg_rewind_interval);
+    const s32  budget     = context_->config()->readValue(AccessKeys::cfg_rewind_memory_budget);
+    is_enabled_           = is_enabled;
+    interval_             = static_cast<u32>(std::max(interval, s32{1}));
+    memory_budget_        = static_cast<std::size_t>(std::max(budget, s32{1})) * bytes_per_megabyte;
+
+    last_state_.clear();
+    new_state_.clear();
+    snapshots_.clear();
+    snapshots_size_       = 0;
+    frames_since_capture_ = 0;
+    is_capture_due_       = false;
+    is_at_last_capture_   = false;
+    updateCounters();
+}
+
+void Rewind::onFrameEnd() {
+    if (!is_enabled_) { return; }
+    is_at_last_capture_ = false;
+    if (++frames_since_capture_ >= interval_) {
+        frames_since_capture_ = 0;
+        is_capture_due_       = true;
+    }
+}
+
+void Rewind::capture() {
+    TIMING_ZONE(TimingZone::rewind_capture);
+    is_capture_due_ = false;
+
+    // A late comparison skips the capture, the emulation thread never waits for it.
+    if (compression_.valid()) {
+        if (compression_.wait_for(std::chrono::seconds(0)) != std::future_status::ready) { return; }
+        compression_.get();
+    }
+
+    SaveState::write(*context_, new_state_);
+    is_at_last_capture_ = true;
+    if (last_state_.empty()) {
+        std::swap(last_state_, new_state_);
+        updateCounters();
+        return;
+    }
+    compression_ = ThreadPool::pool_.submit_task([this] { compress(); });
+}
+
+auto Rewind::stepBack() -> bool {
+    if (!is_enabled_) { return false; }
+    waitCompression();
+
+    if (is_at_last_capture_) {
+        if (snapshots_.empty()) {
+            Log::info(Logger::main, tr("Rewind buffer is empty"));
+            return false;
+        }
+        const auto& snapshot = snapshots_.back();
+        last_state_.resize(std::max(last_state_.size(), snapshot.state_size));
+        auto position = std::size_t{};
+        while (position < snapshot.delta.size()) {
+            const auto start  = extractValue<u32>(snapshot.delta, position) * rewind_page_size;
+            const auto length = std::min(rewind_page_size, last_state_.size() - start);
+            position          = decodePage(snapshot.delta, position, std::span{last_state_}.subspan(start, length));
+        }
+        last_state_.resize(snapshot.state_size);
+        snapshots_size_ -= snapshot.delta.size();
+        snapshots_.pop_back();
+        updateCounters();
+    }
+    if (last_state_.empty() || !SaveState::read(*context_, last_state_)) { return false; }
+
+    is_at_last_capture_   = true;
+    frames_since_capture_ = 0;
+    is_capture_due_       = false;
+    return true;
+}
+
+void Rewind::compress() {
+    TIMING_ZONE(TimingZone::rewind_compression);
+
+    // States are padded with zeros to the same size while being compared.
+    const auto state_size = last_state_.size();
+    const auto new_size   = new_state_.size();
+    const auto size       = std::max(state_size, new_size);
+    last_state_.resize(size);
+    new_state_.resize(size);
+
+    compression_buffer_.clear();
+    for (auto start = std::size_t{}; start < size; start += rewind_page_size) {
+        const auto length   = std::min(rewind_page_size, size - start);
+        const auto previous = std::span<const u8>{last_state_}.subspan(start, length);
+        const auto current  = std::span<const u8>{new_state_}.subspan(start, length);
+        if (std::memcmp(previous.data(), current.data(), length) == 0) { continue; }
+
+        appendValue(compression_buffer_, static_cast<u32>(start / rewind_page_size));
+        encodePage(previous, current, compression_buffer_);
+    }
+    snapshots_.push_back({state_size, compression_buffer_});
+    snapshots_size_ += snapshots_.back().delta.size();
+
+    new_state_.resize(new_size);
+    std::swap(last_state_, new_state_);
+    trimToBudget();
+    updateCounters();
+}
+
+void Rewind::waitCompression() {
+    if (compression_.valid()) { compression_.get(); }
+}
+
+void Rewind::trimToBudget() {
+    const auto buffers_size = last_state_.capacity() + new_state_.capacity() + compression_buffer_.capacity();
+    while (!snapshots_.empty() && (buffers_size + snapshots_size_ > memory_budget_)) {
+        snapshots_size_ -= snapshots_.front().delta.size();
+        snapshots_.pop_front();
+    }
+}
+
+void Rewind::updateCounters() {
+    snapshots_number_ = snapshots_.size() + (last_state_.empty() ? 0 : 1);
+    memory_used_      = last_state_.capacity() + new_state_.capacity() + compression_buffer_.capacity() + snapshots_size_;
+}
+
+} // namespace saturnin::core
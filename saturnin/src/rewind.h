@@ -0,0 +1,198 @@
+//
+// rewind.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	rewind.h
+///
+/// \brief	Declares the Rewind class, keeping recent states of the machine to step backwards.
+///
+/// Only the most recent state is kept whole. Older states are stored as the pages differing from
+/// the state following them, XORed together and zero run length encoded. Stepping back decodes a
+/// single snapshot over the most recent state.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>  // atomic
+#include <deque>   // deque
+#include <future>  // future
+#include <vector>  // vector
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::core {
+
+class EmulatorContext;
+
+constexpr auto rewind_page_size = std::size_t{0x1000}; ///< States are compared by 4KB pages.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct RewindSnapshot
+///
+/// \brief  A state stored as its difference with the state following it.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RewindSnapshot {
+    std::size_t     state_size; ///< Size of the state once restored.
+    std::vector<u8> delta;      ///< Changed pages : index, then runs of zeros and XORed bytes.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Rewind
+///
+/// \brief  Captures a state every 'rewind.interval' frames in a ring bounded by
+///         'rewind.memory_budget' MB, the oldest snapshots being dropped first. The capture is done
+///         by the emulation thread, the delta is computed by a pool thread.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Rewind {
+  public:
+    //@{
+    // Constructors / Destructors
+    Rewind() = delete;
+    explicit Rewind(EmulatorContext* ec) : context_(ec) {}
+    Rewind(const Rewind&)                      = delete;
+    Rewind(Rewind&&)                           = delete;
+    auto operator=(const Rewind&) & -> Rewind& = delete;
+    auto operator=(Rewind&&) & -> Rewind&      = delete;
+    ~Rewind();
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Rewind::initialize();
+    ///
+    /// \brief  Reads the configuration and empties the buffer. Called when the emulation starts.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void initialize();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Rewind::onFrameEnd();
+    ///
+    /// \brief  Counts frames, the capture itself is done by the emulation loop through capture().
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void onFrameEnd();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] auto Rewind::isCaptureDue() const -> bool
+    ///
+    /// \brief  Checks if a capture is expected.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True when capture() has to be called.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto isCaptureDue() const -> bool { return is_capture_due_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Rewind::capture();
+    ///
+    /// \brief  Writes the current state, and queues its comparison with the previous one. Skipped if
+    ///         the previous comparison isn't done yet.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void capture();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Rewind::stepBack() -> bool;
+    ///
+    /// \brief  Restores the last captured state, or the one before if the machine is already in
+    ///         that state.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    False if there's no state to go back to.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto stepBack() -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] auto Rewind::snapshotsNumber() const -> std::size_t
+    ///
+    /// \brief  Returns the number of states available, can be called from any thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The number of states.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto snapshotsNumber() const -> std::size_t { return snapshots_number_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] auto Rewind::memoryUsed() const -> std::size_t
+    ///
+    /// \brief  Returns the memory used by the buffer in bytes, can be called from any thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The memory used.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto memoryUsed() const -> std::size_t { return memory_used_; }
+
+  private:
+    void compress();
+    void waitCompression();
+    void trimToBudget();
+    void updateCounters();
+
+    EmulatorContext*  context_;                ///< Context of the emulator.
+    bool              is_enabled_{false};      ///< True when 'rewind.enabled' is set.
+    u32               interval_{};             ///< Frames between two captures.
+    std::size_t       memory_budget_{};        ///< Maximum memory used, in bytes.
+    u32               frames_since_capture_{}; ///< Frames elapsed since the last capture.
+    bool              is_capture_due_{false};  ///< True when the emulation loop has to call capture().
+    bool              is_at_last_capture_{};   ///< True when the machine is in the last captured state.
+    std::future<void> compression_;            ///< Comparison running on the thread pool.
+
+    /// \name Owned by the pool thread while a comparison is running.
+    ///
+    //@{
+    std::vector<u8>            last_state_;         ///< Last captured state, uncompressed.
+    std::vector<u8>            new_state_;          ///< State being compared, recycled for the next capture.
+    std::vector<u8>            compression_buffer_; ///< Delta being encoded.
+    std::deque<RewindSnapshot> snapshots_;          ///< Older states, oldest first.
+    std::size_t                snapshots_size_{};   ///< Memory used by the snapshots.
+    //@}
+
+    std::atomic<std::size_t> snapshots_number_{}; ///< Number of states available.
+    std::atomic<std::size_t> memory_used_{};      ///< Memory used in bytes.
+};
+
+} // namespace saturnin::core
@@ -0,0 +1,154 @@
+//
+// ring_buffer.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	ring_buffer.h
+///
+/// \brief	Declares the RingBuffer class, used to stream data between a producer and a consumer without locking.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm> // copy_n, min
+#include <array>     // array
+#include <atomic>    // atomic
+#include <cstddef>   // size_t
+#include <span>      // span
+
+namespace saturnin::core {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  RingBuffer
+///
+/// \brief  Lock free single producer / single consumer ring buffer.
+///
+/// Positions only increase, the capacity being a power of two they are turned into indices with a mask. The producer
+/// only writes the tail and the consumer only writes the head, so neither side ever waits for the other.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \tparam T   Type of the items.
+/// \tparam N   Capacity, a power of two.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T, std::size_t N>
+class RingBuffer {
+    static_assert((N != 0) && ((N & (N - 1)) == 0), "RingBuffer capacity must be a power of two");
+
+  public:
+    ///@{
+    /// Constructors / Destructors
+    RingBuffer()                                        = default;
+    RingBuffer(const RingBuffer&)                       = delete;
+    RingBuffer(RingBuffer&&)                            = delete;
+    auto operator=(const RingBuffer&) & -> RingBuffer&  = delete;
+    auto operator=(RingBuffer&&) & -> RingBuffer&       = delete;
+    ~RingBuffer()                                       = default;
+    ///@}
+
+    static constexpr auto capacity() -> std::size_t { return N; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto RingBuffer::push(std::span<const T> items) -> bool
+    ///
+    /// \brief  Appends items, producer side.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  items   The items to append.
+    ///
+    /// \returns    False if there isn't enough room for all the items, nothing is appended then.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto push(std::span<const T> items) -> bool {
+        const auto tail = tail_.load(std::memory_order_relaxed);
+        if (N - (tail - head_.load(std::memory_order_acquire)) < items.size()) { return false; }
+
+        const auto index = tail & index_mask;
+        const auto first = std::min(items.size(), N - index);
+        std::copy_n(items.begin(), first, items_.begin() + index);
+        std::copy_n(items.begin() + first, items.size() - first, items_.begin());
+        tail_.store(tail + items.size(), std::memory_order_release);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto RingBuffer::pop(std::span<T> items) -> std::size_t
+    ///
+    /// \brief  Removes the oldest items, consumer side.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] items   Where the items are copied, as many as available up to its size.
+    ///
+    /// \returns    The number of items copied.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto pop(std::span<T> items) -> std::size_t {
+        const auto head   = head_.load(std::memory_order_relaxed);
+        const auto number = std::min(items.size(), tail_.load(std::memory_order_acquire) - head);
+
+        const auto index = head & index_mask;
+        const auto first = std::min(number, N - index);
+        std::copy_n(items_.begin() + index, first, items.begin());
+        std::copy_n(items_.begin(), number - first, items.begin() + first);
+        head_.store(head + number, std::memory_order_release);
+        return number;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void RingBuffer::clear()
+    ///
+    /// \brief  Removes all the items, consumer side.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void clear() { head_.store(tail_.load(std::memory_order_acquire), std::memory_order_release); }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] auto RingBuffer::size() const -> std::size_t
+    ///
+    /// \brief  Returns the number of items waiting. The other side may have changed it once the value is used.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The number of items.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto size() const -> std::size_t {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr auto index_mask = N - 1;
+
+    std::array<T, N> items_{}; ///< Items storage.
+
+    // Each position is only written by its owner thread, they are kept apart to avoid false sharing.
+    alignas(64) std::atomic<std::size_t> head_{0}; ///< Position of the oldest item, written by the consumer.
+    alignas(64) std::atomic<std::size_t> tail_{0}; ///< Position following the newest item, written by the producer.
+};
+
+} // namespace saturnin::core
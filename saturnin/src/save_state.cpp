@@ -0,0 +1,222 @@
+//
+// save_state.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/save_state.h>
+#include <array>       // array
+#include <chrono>      // steady_clock
+#include <filesystem>  // create_directories
+#include <fstream>     // ifstream, ofstream
+#include <saturnin/src/emulator_context.h>
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>
+#include <saturnin/src/memory.h>
+#include <saturnin/src/scu.h>
+#include <saturnin/src/smpc.h>
+#include <saturnin/src/cdrom/cdrom.h>
+#include <saturnin/src/sh2/sh2.h>
+#include <saturnin/src/sound/scsp.h>
+#include <saturnin/src/video/texture.h>
+#include <saturnin/src/video/vdp1.h>
+#include <saturnin/src/video/vdp2/vdp2.h>
+
+namespace saturnin::core {
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+
+// Order of the chunks in a state, must match SaveState::serialize().
+constexpr auto state_chunks = std::array{StateChunk::memory,
+                                         StateChunk::master_sh2,
+                                         StateChunk::slave_sh2,
+                                         StateChunk::scu,
+                                         StateChunk::smpc,
+                                         StateChunk::vdp1,
+                                         StateChunk::vdp2,
+                                         StateChunk::cdrom,
+                                         StateChunk::scsp};
+
+constexpr auto chunk_header_size = sizeof(StateChunk) + sizeof(u32);
+
+std::vector<u8> SaveState::file_buffer_;
+
+void StateWriter::beginChunk(const StateChunk chunk) {
+    chunk_start_ = buffer_.size();
+    value(chunk);
+    value(u32{});
+}
+
+void StateWriter::endChunk() {
+    const auto size = static_cast<u32>(buffer_.size() - chunk_start_ - chunk_header_size);
+    std::memcpy(buffer_.data() + chunk_start_ + sizeof(StateChunk), &size, sizeof(size));
+}
+
+void StateReader::beginChunk(const StateChunk chunk) {
+    end_ = buffer_.size();
+
+    auto read_chunk = StateChunk{};
+    auto size       = u32{};
+    value(read_chunk);
+    value(size);
+    if (!isValid() || (read_chunk != chunk) || (size > end_ - position_)) {
+        is_valid_ = false;
+        return;
+    }
+    end_ = position_ + size;
+}
+
+void StateReader::endChunk() {
+    // A module reading less than what was written means the chunk layout changed.
+    if (position_ != end_) { is_valid_ = false; }
+    position_ = end_;
+    end_      = buffer_.size();
+}
+
+void SaveState::write(EmulatorContext& ec, std::vector<u8>& buffer) {
+    buffer.clear();
+    auto ar = StateWriter(buffer);
+    ar.value(save_state_magic);
+    ar.value(save_state_version);
+    ar.value(ec.hardwareMode());
+    // The BIOS isn't part of the state, its hash is kept to check the state is loaded on the same machine.
+    ar.value(ec.memory()->rom_hash_);
+    ar.string(ec.memory()->selectedStvGame().game_name);
+    serialize(ec, ar);
+}
+
+auto SaveState::read(EmulatorContext& ec, std::span<const u8> buffer) -> bool {
+    auto ar            = StateReader(buffer);
+    auto magic         = u32{};
+    auto version       = u16{};
+    auto hardware_mode = HardwareMode{};
+    auto rom_hash      = u64{};
+    auto game_name     = std::string{};
+    ar.value(magic);
+    ar.value(version);
+    ar.value(hardware_mode);
+    ar.value(rom_hash);
+    ar.string(game_name);
+
+    if (!ar.isValid() || (magic != save_state_magic)) {
+        Log::warning(Logger::main, tr("Not a save state"));
+        return false;
+    }
+    if (version != save_state_version) {
+        Log::warning(Logger::main, tr("Save state version {} isn't supported, version {} is expected"), version, save_state_version);
+        return false;
+    }
+    if ((hardware_mode != ec.hardwareMode()) || (rom_hash != ec.memory()->rom_hash_)
+        || (game_name != ec.memory()->selectedStvGame().game_name)) {
+        Log::warning(Logger::main, tr("Save state was made with another BIOS or game"));
+        return false;
+    }
+    if (!checkChunks(buffer, ar.position())) {
+        Log::warning(Logger::main, tr("Save state is corrupted"));
+        return false;
+    }
+
+    serialize(ec, ar);
+    if (!ar.isValid()) {
+        Log::error(Logger::main, tr("Save state couldn't be fully restored, the emulation must be reset"));
+        return false;
+    }
+
+    // Render data isn't saved, everything built from video RAM is rebuilt on the next frame.
+    auto* memory                    = ec.memory();
+    memory->was_vdp2_cram_accessed_ = true;
+    memory->was_vdp2_page_accessed_.fill(true);
+    memory->was_vdp2_bitmap_accessed_.fill(true);
+    video::Texture::discardCache();
+
+    return true;
+}
+
+auto SaveState::save(EmulatorContext& ec, const std::string& path) -> bool {
+    const auto start = std::chrono::steady_clock::now();
+    write(ec, file_buffer_);
+
+    if (const auto directory = std::filesystem::path(path).parent_path(); !directory.empty()) {
+        auto error = std::error_code{};
+        std::filesystem::create_directories(directory, error);
+    }
+    auto file = std::ofstream(path, std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char*>(file_buffer_.data()), static_cast<std::streamsize>(file_buffer_.size()))) {
+        Log::warning(Logger::main, tr("Could not write save state {}"), path);
+        return false;
+    }
+    Log::info(Logger::main,
+              tr("State saved to {} ({} KB, {:.2f} ms)"),
+              path,
+              file_buffer_.size() / 1024,
+              Milliseconds(std::chrono::steady_clock::now() - start).count());
+    return true;
+}
+
+auto SaveState::load(EmulatorContext& ec, const std::string& path) -> bool {
+    const auto start = std::chrono::steady_clock::now();
+
+    auto file = std::ifstream(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        Log::warning(Logger::main, tr("Could not open save state {}"), path);
+        return false;
+    }
+    file_buffer_.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(file_buffer_.data()), static_cast<std::streamsize>(file_buffer_.size()))) {
+        Log::warning(Logger::main, tr("Could not read save state {}"), path);
+        return false;
+    }
+
+    if (!read(ec, file_buffer_)) { return false; }
+    Log::info(Logger::main, tr("State loaded from {} ({:.2f} ms)"), path, Milliseconds(std::chrono::steady_clock::now() - start).count());
+    return true;
+}
+
+template<typename Archive>
+void SaveState::serialize(EmulatorContext& ec, Archive& ar) {
+    const auto chunk = [&ar](const StateChunk id, auto& module) {
+        ar.beginChunk(id);
+        module.serialize(ar);
+        ar.endChunk();
+    };
+    chunk(StateChunk::memory, *ec.memory());
+    chunk(StateChunk::master_sh2, *ec.masterSh2());
+    chunk(StateChunk::slave_sh2, *ec.slaveSh2());
+    chunk(StateChunk::scu, *ec.scu());
+    chunk(StateChunk::smpc, *ec.smpc());
+    chunk(StateChunk::vdp1, *ec.vdp1());
+    chunk(StateChunk::vdp2, *ec.vdp2());
+    chunk(StateChunk::cdrom, *ec.cdrom());
+    chunk(StateChunk::scsp, *ec.scsp());
+}
+
+auto SaveState::checkChunks(std::span<const u8> buffer, std::size_t position) -> bool {
+    for (const auto expected : state_chunks) {
+        if (buffer.size() - position < chunk_header_size) { return false; }
+        auto chunk = StateChunk{};
+        auto size  = u32{};
+        std::memcpy(&chunk, buffer.data() + position, sizeof(chunk));
+        std::memcpy(&size, buffer.data() + position + sizeof(chunk), sizeof(size));
+        position += chunk_header_size;
+        if ((chunk != expected) || (size > buffer.size() - position)) { return false; }
+        position += size;
+    }
+    return position == buffer.size();
+}
+
+} // namespace saturnin::core
@@ -0,0 +1,287 @@
+//
+// save_state.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	save_state.h
+///
+/// \brief	Declares the save states of the whole machine, and the archives used to serialize it.
+///
+/// A state is a header followed by one chunk per module. Each module describes its state once in a
+/// serialize() template, instantiated for StateWriter and StateReader, so saving and loading can't
+/// drift apart. Values are stored as their binary image : states are only valid for the build and
+/// version that wrote them.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstring>     // memcpy
+#include <span>        // span
+#include <string>      // string
+#include <type_traits> // is_trivially_copyable_v
+#include <vector>      // vector
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::core {
+
+class EmulatorContext;
+
+constexpr auto save_state_magic   = u32{0x54535453}; ///< "STST"
+constexpr auto save_state_version = u16{8};          ///< Incremented each time a module state changes.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   StateChunk
+///
+/// \brief  Chunks of a state, one per module, identified by a four characters code.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class StateChunk : u32 {
+    memory     = 0x4F4D454D, ///< "MEMO"
+    master_sh2 = 0x3248534D, ///< "MSH2"
+    slave_sh2  = 0x32485353, ///< "SSH2"
+    scu        = 0x20554353, ///< "SCU "
+    smpc       = 0x43504D53, ///< "SMPC"
+    vdp1       = 0x31504456, ///< "VDP1"
+    vdp2       = 0x32504456, ///< "VDP2"
+    cdrom      = 0x4D524443, ///< "CDRM"
+    scsp       = 0x50534353  ///< "SCSP"
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  StateWriter
+///
+/// \brief  Archive appending a state to a buffer. Memory blocks are copied as is, without any per
+///         element work.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class StateWriter {
+  public:
+    static constexpr auto is_loading = false;
+
+    explicit StateWriter(std::vector<u8>& buffer) : buffer_(buffer) {}
+
+    template<typename T>
+    void value(const T& v) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        append(&v, sizeof(T));
+    }
+
+    template<typename T, std::size_t N>
+    void bytes(std::span<T, N> data) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        append(data.data(), data.size_bytes());
+    }
+
+    template<typename T>
+    void vector(std::vector<T>& v) {
+        value(static_cast<u32>(v.size()));
+        bytes(std::span<T>(v));
+    }
+
+    void string(const std::string& s) {
+        value(static_cast<u32>(s.size()));
+        append(s.data(), s.size());
+    }
+
+    void beginChunk(const StateChunk chunk);
+    void endChunk();
+
+    [[nodiscard]] auto isValid() const -> bool { return true; }
+
+  private:
+    void append(const void* data, const std::size_t size) {
+        const auto first = static_cast<const u8*>(data);
+        buffer_.insert(buffer_.end(), first, first + size);
+    }
+
+    std::vector<u8>& buffer_;        ///< Buffer the state is written to.
+    std::size_t      chunk_start_{}; ///< Position of the current chunk header.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  StateReader
+///
+/// \brief  Archive reading a state from a buffer. Reads can't go past the end of the current chunk,
+///         a failed read leaves the destination untouched and invalidates the reader.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class StateReader {
+  public:
+    static constexpr auto is_loading = true;
+
+    explicit StateReader(std::span<const u8> buffer) : buffer_(buffer), end_(buffer.size()) {}
+
+    template<typename T>
+    void value(T& v) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        extract(&v, sizeof(T));
+    }
+
+    template<typename T, std::size_t N>
+    void bytes(std::span<T, N> data) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        extract(data.data(), data.size_bytes());
+    }
+
+    template<typename T>
+    void vector(std::vector<T>& v) {
+        auto size = u32{};
+        value(size);
+        if (!isValid() || (static_cast<std::size_t>(size) * sizeof(T) > end_ - position_)) {
+            is_valid_ = false;
+            return;
+        }
+        v.resize(size);
+        bytes(std::span<T>(v));
+    }
+
+    void string(std::string& s) {
+        auto size = u32{};
+        value(size);
+        if (!isValid() || (size > end_ - position_)) {
+            is_valid_ = false;
+            return;
+        }
+        s.resize(size);
+        extract(s.data(), size);
+    }
+
+    void beginChunk(const StateChunk chunk);
+    void endChunk();
+
+    [[nodiscard]] auto isValid() const -> bool { return is_valid_; }
+    [[nodiscard]] auto position() const -> std::size_t { return position_; }
+
+  private:
+    void extract(void* data, const std::size_t size) {
+        if (!is_valid_ || (size > end_ - position_)) {
+            is_valid_ = false;
+            return;
+        }
+        std::memcpy(data, buffer_.data() + position_, size);
+        position_ += size;
+    }
+
+    std::span<const u8> buffer_;         ///< State being read.
+    std::size_t         position_{};     ///< Current read position.
+    std::size_t         end_;            ///< End of the current chunk, or of the buffer outside chunks.
+    bool                is_valid_{true}; ///< False once a read failed.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  SaveState
+///
+/// \brief  Saves and loads the state of the whole machine. Must be called from the emulation thread,
+///         between two steps of the emulation loop (see EmulatorContext::requestStateSave()).
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SaveState {
+  public:
+    //@{
+    // Constructors / Destructors
+    SaveState()                                      = delete;
+    SaveState(const SaveState&)                      = delete;
+    SaveState(SaveState&&)                           = delete;
+    auto operator=(const SaveState&) & -> SaveState& = delete;
+    auto operator=(SaveState&&) & -> SaveState&      = delete;
+    ~SaveState()                                     = delete;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static void SaveState::write(EmulatorContext& ec, std::vector<u8>& buffer);
+    ///
+    /// \brief  Writes the current state of the machine to a buffer, replacing its content. The buffer
+    ///         capacity is kept, so reusing it avoids any allocation.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] ec      The emulator context.
+    /// \param [in,out] buffer  The buffer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void write(EmulatorContext& ec, std::vector<u8>& buffer);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto SaveState::read(EmulatorContext& ec, std::span<const u8> buffer) -> bool;
+    ///
+    /// \brief  Restores the machine from a state. The header and the chunks list are checked before
+    ///         anything is modified.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] ec      The emulator context.
+    /// \param          buffer  The state.
+    ///
+    /// \returns    False if the state is invalid or doesn't match the running machine.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto read(EmulatorContext& ec, std::span<const u8> buffer) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto SaveState::save(EmulatorContext& ec, const std::string& path) -> bool;
+    ///
+    /// \brief  Saves the state of the machine to a file.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] ec      The emulator context.
+    /// \param          path    Path of the file.
+    ///
+    /// \returns    False if the file couldn't be written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto save(EmulatorContext& ec, const std::string& path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto SaveState::load(EmulatorContext& ec, const std::string& path) -> bool;
+    ///
+    /// \brief  Loads the state of the machine from a file.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] ec      The emulator context.
+    /// \param          path    Path of the file.
+    ///
+    /// \returns    False if the file couldn't be read or isn't a valid state.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto load(EmulatorContext& ec, const std::string& path) -> bool;
+
+  private:
+    template<typename Archive>
+    static void serialize(EmulatorContext& ec, Archive& ar);
+
+    static auto checkChunks(std::span<const u8> buffer, std::size_t position) -> bool;
+
+    static std::vector<u8> file_buffer_; ///< Reused by save() and load().
+};
+
+} // namespace saturnin::core
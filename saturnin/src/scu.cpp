@@ -20,11 +20,14 @@
 #include <saturnin/src/pch.h>
 #include <saturnin/src/scu.h>
 #include <istream>
+#include <utility>
 #include <saturnin/src/emulator_context.h>
 #include <saturnin/src/locale.h>
 #include <saturnin/src/memory.h>
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/scu_registers.h>
 #include <saturnin/src/sh2/sh2.h>
+#include <saturnin/src/trace.h>
 #include <saturnin/src/utilities.h> // format
 
 namespace uti = saturnin::utilities;
@@ -38,14 +41,37 @@ namespace saturnin::core {
 // Access to Workram L not possible
 // During DMA operation A -> B or B -> A, no CPU access to A-Bus
 
-Scu::Scu(EmulatorContext* ec) : modules_(ec) { initializeRegisters(); };
+// DMA durations are approximated from the buses bandwidth, in SH2 cycles by 32 bits unit read or written. The SCU runs
+// at half the SH2 clock, and B-Bus accesses are 16 bits wide.
+constexpr auto dma_start_cycles          = u32{8}; // Setup of a transfer.
+constexpr auto dma_indirect_entry_cycles = u32{6}; // Reading the 3 longs of an indirect table entry from work RAM.
+
+constexpr auto max_transfer_byte_number = u32{0x100000}; // Transfer size when the byte number is 0.
+constexpr auto indirect_dma_entry_size  = u32{0xC};      // Byte number, write address and read address.
+constexpr auto max_indirect_dma_entries = u32{0x10000};  // Tables without end code are considered corrupted past it.
+
+inline auto dmaAccessCycles(const DmaBus bus) -> u32 {
+    switch (bus) {
+        using enum DmaBus;
+        case cpu_bus: return 2;
+        case a_bus:
+        case b_bus: return 8;
+        default: return 4;
+    }
+}
+
+inline auto dmaTransferCycles(const DmaBus read_bus, const DmaBus write_bus, const u32 byte_number) -> u32 {
+    return (byte_number + 3) / 4 * (dmaAccessCycles(read_bus) + dmaAccessCycles(write_bus));
+}
+
+Scu::Scu(EmulatorContext* ec) : modules_(ec), dsp_(ec) { initializeRegisters(); };
 
-auto Scu::read32(const u32 addr) const -> u32 {
+auto Scu::read32(const u32 addr) -> u32 {
     switch (addr) {
-        case dsp_program_control_port: return regs_.ppaf.data();
+        case dsp_program_control_port: return dsp_.readProgramControlPort();
         case dsp_program_ram_dataport: return regs_.ppd.data();
         case dsp_data_ram_address_port: return regs_.pda.data();
-        case dsp_data_ram_data_port: return regs_.pdd.data();
+        case dsp_data_ram_data_port: return dsp_.readDataRam();
         case level_0_dma_enable_register: return regs_.d0en.data();
         case level_1_dma_enable_register: return regs_.d1en.data();
         case level_2_dma_enable_register: return regs_.d2en.data();
@@ -66,6 +92,7 @@ auto Scu::read32(const u32 addr) const -> u32 {
         case level_2_dma_transfer_byte_number: return regs_.d2c.data();
         case interrupt_status_register: return regs_.ist.data();
         case interrupt_mask_register: return regs_.ims.data();
+        case dma_status_register: updateDmaStatusRegister(); return regs_.dsta.data();
         // default: return rawRead<u32>(modules_.memory()->scu_, addr & scu_memory_mask);
         default: return rawRead<u32>(modules_.memory()->scu_, addr & scu_memory_mask);
     }
@@ -75,45 +102,27 @@ auto Scu::read32(const u32 addr) const -> u32 {
 
 void Scu::write32(const u32 addr, const u32 data) {
     using Dxen = ScuRegs::Dxen;
-    using Ppaf = ScuRegs::Ppaf;
 
     switch (addr) {
         case dsp_program_control_port: {
-            if ((regs_.ppaf >> Ppaf::t0_enum) == Ppaf::D0BusDmaExecution::dma_is_executing) {
-                Log::unimplemented("SCU DSP - D0 Bus DMA execution");
-            }
-
-            if ((regs_.ppaf >> Ppaf::ex_enum) == Ppaf::ProgramExecuteControl::program_execution_begins) {
-                Log::unimplemented("SCU DSP - Program execution");
-                // #ifdef _DEBUGEMU
-                //                 std::ostringstream oss;
-                //                 oss << "DSP program execution started at address : " << showbase << hex <<
-                //                 static_cast<uint32_t>((current_DSP_program_control_port_ & DSP_P));
-                //                 EmuState::pLog->ScuDsp(oss.str());
-                // #endif
-                //                 PC_ = static_cast<uint8_t>((current_DSP_program_control_port_ & DSP_P));
-                //                 DSPProgramDisasm(PC_);
-                regs_.ppaf = {};                                       // DSP interception
-                setInterruptStatusRegister(interrupt_source::dsp_end); // DSP interrupt flag
-            }
-
-            break;
+            regs_.ppaf = data;
+            dsp_.writeProgramControlPort(regs_.ppaf);
+            return;
         }
         case dsp_program_ram_dataport: {
-            auto index = regs_.ppaf >> Ppaf::p_shft;
-            // rawWrite(program_ram_, index * 4, data);
-            rawWrite(program_ram_, index * 4, data);
-            ++index;
-            regs_.ppaf.upd(ScuRegs::Ppaf::programRamAddress(index));
+            // Each word is decoded as it's written.
             regs_.ppd = data;
+            dsp_.writeProgramRam(data);
             return;
         }
         case dsp_data_ram_address_port: {
             regs_.pda = data;
+            dsp_.writeDataRamAddress(regs_.pda);
             return;
         }
         case dsp_data_ram_data_port: {
             regs_.pdd = data;
+            dsp_.writeDataRam(data);
             return;
         }
         case level_0_dma_enable_register: {
@@ -182,11 +191,10 @@ void Scu::write32(const u32 addr, const u32 data) {
     rawWrite<u32>(modules_.memory()->scu_, addr & scu_memory_mask, data);
 };
 
-void Scu::executeDma(DmaConfiguration& dc) {
+auto Scu::executeDma(DmaConfiguration& dc) -> u32 {
     using Dxad = ScuRegs::Dxad;
     using Dxmd = ScuRegs::Dxmd;
 
-    constexpr auto max_transfer_byte_number = u32{0x100000};
     constexpr auto address_add_0            = u8{0};
     constexpr auto address_add_2            = u8{2};
     constexpr auto address_add_4            = u8{4};
@@ -196,20 +204,24 @@ void Scu::executeDma(DmaConfiguration& dc) {
     constexpr auto address_add_64           = u8{64};
     constexpr auto address_add_128          = u8{128};
 
+    Trace::record(TraceEvent::scu_dma_start, dc.read_address, static_cast<u8>(dc.dma_level));
+
+    auto cycles = dma_start_cycles;
+
     switch (dc.dma_mode) {
         using enum Dxmd::DmaMode;
         case direct: {
-            Log::debug(Logger::scu, "Direct Mode DMA - Level {}", utilities::toUnderlying<DmaLevel>(dc.dma_level));
+            LOG_DEBUG(Logger::scu, "Direct Mode DMA - Level {}", utilities::toUnderlying<DmaLevel>(dc.dma_level));
             auto write_address     = u32{dc.write_address};
             auto read_address      = u32{dc.read_address};
             auto count             = u32{(dc.transfer_byte_number == 0) ? max_transfer_byte_number : dc.transfer_byte_number};
             auto read_address_add  = static_cast<u8>((dc.read_add_value == Dxad::ReadAddressAddValue::add_4) ? 4 : 0);
             auto write_address_add = u8{0};
 
-            Log::debug(Logger::scu, "Read address : {:#x}", read_address);
-            Log::debug(Logger::scu, "Write address : {:#x}", write_address);
-            Log::debug(Logger::scu, "Size : {:#x}", count);
-            Log::debug(Logger::scu, "Read add : {:#x}", read_address_add);
+            LOG_DEBUG(Logger::scu, "Read address : {:#x}", read_address);
+            LOG_DEBUG(Logger::scu, "Write address : {:#x}", write_address);
+            LOG_DEBUG(Logger::scu, "Size : {:#x}", count);
+            LOG_DEBUG(Logger::scu, "Read add : {:#x}", read_address_add);
 
             switch (dc.write_add_value) {
                 using enum Dxad::WriteAddressAddValue;
@@ -222,7 +234,7 @@ void Scu::executeDma(DmaConfiguration& dc) {
                 case add_64: write_address_add = address_add_64; break;
                 case add_128: write_address_add = address_add_128; break;
             }
-            Log::debug(Logger::scu, "Write add : {:#x}", write_address_add);
+            LOG_DEBUG(Logger::scu, "Write add : {:#x}", write_address_add);
 
             auto byte_counter = u32{};
             auto word_counter = u32{};
@@ -230,10 +242,11 @@ void Scu::executeDma(DmaConfiguration& dc) {
             auto data         = u32{};
             auto read_offset  = u32{};
 
-            switch (const auto write_bus = getDmaBus(dc.write_address)) {
+            const auto write_bus = getDmaBus(dc.write_address);
+            switch (write_bus) {
                 using enum DmaBus;
                 case a_bus: {
-                    Log::debug(Logger::scu, "A-Bus transfer");
+                    LOG_DEBUG(Logger::scu, "A-Bus transfer");
 
                     switch (getScuRegion(read_address)) {
                         using enum ScuRegion;
@@ -281,7 +294,7 @@ void Scu::executeDma(DmaConfiguration& dc) {
                 case b_bus: {
                     // B-Bus write
                     // 32 bits splitted into 2*16 bits
-                    Log::debug(Logger::scu, "B-Bus transfer");
+                    LOG_DEBUG(Logger::scu, "B-Bus transfer");
 
                     switch (getScuRegion(read_address)) {
                         using enum ScuRegion;
@@ -292,8 +305,13 @@ void Scu::executeDma(DmaConfiguration& dc) {
 
                     auto write_offset = u32{};
 
-                    if ((read_address_add == 4) && (write_address_add == 2)) {
-                        Log::debug(Logger::scu, "Burst copy");
+                    if ((write_address_add == 2)
+                        && modules_.memory()->transferFromCdBlock(read_address & 0x7FFFFFFFu, write_address, dc.transfer_byte_number)) {
+                        LOG_DEBUG(Logger::scu, "CD block transfer");
+                        long_counter = dc.transfer_byte_number / 4;
+                        word_counter = dc.transfer_byte_number / 2;
+                    } else if ((read_address_add == 4) && (write_address_add == 2)) {
+                        LOG_DEBUG(Logger::scu, "Burst copy");
                         modules_.memory()->burstCopy(read_address, write_address, dc.transfer_byte_number);
                     } else {
                         while (byte_counter < dc.transfer_byte_number) {
@@ -318,7 +336,7 @@ void Scu::executeDma(DmaConfiguration& dc) {
                     break;
                 }
                 case cpu_bus: {
-                    Log::debug(Logger::scu, "CPU-Bus transfer");
+                    LOG_DEBUG(Logger::scu, "CPU-Bus transfer");
 
                     switch (getScuRegion(read_address)) {
                         using enum ScuRegion;
@@ -328,6 +346,13 @@ void Scu::executeDma(DmaConfiguration& dc) {
                     }
                     write_address_add = 4;
 
+                    // Reads of the CD block data transfer register are copied as a single block.
+                    if (modules_.memory()->transferFromCdBlock(read_address & 0x7FFFFFFFu, write_address, dc.transfer_byte_number)) {
+                        LOG_DEBUG(Logger::scu, "CD block transfer");
+                        byte_counter = dc.transfer_byte_number;
+                        long_counter = byte_counter / 4;
+                    }
+
                     while (byte_counter < dc.transfer_byte_number) {
                         data = modules_.memory()->read<u8>((read_address & 0x7FFFFFFFu) + read_offset
                                                            + long_counter * read_address_add);
@@ -357,59 +382,54 @@ void Scu::executeDma(DmaConfiguration& dc) {
                 dc.write_address += word_counter * write_address_add;
             }
 
-            sendDmaEndInterrupt(dc.dma_level);
-            resetDmaEnable(dc);
-            Log::debug(Logger::scu, "Level {} direct DMA completed", utilities::toUnderlying<DmaLevel>(dc.dma_level));
+            cycles += dmaTransferCycles(getDmaBus(read_address), write_bus, count);
+            LOG_DEBUG(Logger::scu, "Level {} direct DMA completed", utilities::toUnderlying<DmaLevel>(dc.dma_level));
 
             break;
         }
         case indirect: {
-            Log::debug(Logger::scu, "Indirect Mode DMA - Level {}", utilities::toUnderlying<DmaLevel>(dc.dma_level));
-            constexpr auto storage_buffer_size            = u8{0xC};
-            auto           execute_address_storage_buffer = u32{dc.write_address};
-
-            auto read_address_add  = static_cast<u8>((dc.read_add_value == Dxad::ReadAddressAddValue::add_4) ? 4 : 0);
-            auto write_address_add = u8{0};
+            LOG_DEBUG(Logger::scu, "Indirect Mode DMA - Level {}", utilities::toUnderlying<DmaLevel>(dc.dma_level));
+            const auto table_read_address_add  = static_cast<u8>((dc.read_add_value == Dxad::ReadAddressAddValue::add_4) ? 4 : 0);
+            auto       table_write_address_add = u8{0};
             switch (dc.write_add_value) {
                 using enum Dxad::WriteAddressAddValue;
-                case add_0: write_address_add = address_add_0; break;
-                case add_2: write_address_add = address_add_2; break;
-                case add_4: write_address_add = address_add_4; break;
-                case add_8: write_address_add = address_add_8; break;
-                case add_16: write_address_add = address_add_16; break;
-                case add_32: write_address_add = address_add_32; break;
-                case add_64: write_address_add = address_add_64; break;
-                case add_128: write_address_add = address_add_128; break;
+                case add_0: table_write_address_add = address_add_0; break;
+                case add_2: table_write_address_add = address_add_2; break;
+                case add_4: table_write_address_add = address_add_4; break;
+                case add_8: table_write_address_add = address_add_8; break;
+                case add_16: table_write_address_add = address_add_16; break;
+                case add_32: table_write_address_add = address_add_32; break;
+                case add_64: table_write_address_add = address_add_64; break;
+                case add_128: table_write_address_add = address_add_128; break;
             }
 
-            auto write_address = u32{};
-            auto read_address  = u32{};
-            auto count         = u32{};
-            //= (dc.transfer_byte_number == 0) ? 0x100000 : dc.transfer_byte_number;
-
-            auto is_transfer_done = bool{false};
-            while (!is_transfer_done) {
-                read_address  = modules_.memory()->read<u32>(execute_address_storage_buffer + 8);
-                write_address = modules_.memory()->read<u32>(execute_address_storage_buffer + 4);
-                count         = modules_.memory()->read<u32>(execute_address_storage_buffer);
-                if (count == 0) { count = max_transfer_byte_number; }
-
-                Log::debug(Logger::scu, "Read address : {:#x}", read_address);
-                Log::debug(Logger::scu, "Write address : {:#x}", write_address);
-                Log::debug(Logger::scu, "Size : {:#x}", count);
-                Log::debug(Logger::scu, "Read add : {:#x}", read_address_add);
-                Log::debug(Logger::scu, "Write add : {:#x}", write_address_add);
+            // The whole table is read before transferring, contiguous block copies being merged.
+            const auto entries_number = readIndirectDmaTable(dc.write_address, table_read_address_add, table_write_address_add);
+            cycles += entries_number * dma_indirect_entry_cycles;
+
+            for (const auto& transfer : indirect_dma_transfers_) {
+                const auto read_address      = transfer.read_address;
+                const auto write_address     = transfer.write_address;
+                const auto count             = transfer.transfer_byte_number;
+                auto       read_address_add  = table_read_address_add;
+                auto       write_address_add = table_write_address_add;
+
+                LOG_DEBUG(Logger::scu, "Read address : {:#x}", read_address);
+                LOG_DEBUG(Logger::scu, "Write address : {:#x}", write_address);
+                LOG_DEBUG(Logger::scu, "Size : {:#x}", count);
+                LOG_DEBUG(Logger::scu, "Read add : {:#x}", read_address_add);
+                LOG_DEBUG(Logger::scu, "Write add : {:#x}", write_address_add);
                 auto byte_counter = u32{};
                 auto word_counter = u32{};
                 auto long_counter = u32{};
                 auto data         = u32{};
                 auto read_offset  = u32{};
 
-                const auto write_bus = getDmaBus(dc.write_address);
+                const auto write_bus = getDmaBus(write_address);
                 switch (write_bus) {
                     using enum DmaBus;
                     case a_bus: {
-                        Log::debug(Logger::scu, "A-Bus transfer");
+                        LOG_DEBUG(Logger::scu, "A-Bus transfer");
 
                         switch (getScuRegion(read_address)) {
                             using enum ScuRegion;
@@ -453,7 +473,7 @@ void Scu::executeDma(DmaConfiguration& dc) {
                     case b_bus: {
                         // B-Bus write
                         // 32 bits splitted into 2*16 bits
-                        Log::debug(Logger::scu, "B-Bus transfer");
+                        LOG_DEBUG(Logger::scu, "B-Bus transfer");
 
                         switch (getScuRegion(read_address)) {
                             using enum ScuRegion;
@@ -464,6 +484,18 @@ void Scu::executeDma(DmaConfiguration& dc) {
 
                         u32 write_offset{};
 
+                        if ((write_address_add == 2)
+                            && modules_.memory()->transferFromCdBlock(read_address & 0x7FFFFFFFu, write_address, count)) {
+                            LOG_DEBUG(Logger::scu, "CD block transfer");
+                            byte_counter = count;
+                            long_counter = byte_counter / 4;
+                            word_counter = byte_counter / 2;
+                        } else if ((read_address_add == 4) && (write_address_add == 2)) {
+                            LOG_DEBUG(Logger::scu, "Burst copy");
+                            modules_.memory()->burstCopy(read_address, write_address, count);
+                            byte_counter = count;
+                        }
+
                         while (byte_counter < count) {
                             data = modules_.memory()->read<u8>((read_address & 0x7FFFFFFFu) + read_offset
                                                                + long_counter * read_address_add);
@@ -485,7 +517,7 @@ void Scu::executeDma(DmaConfiguration& dc) {
                         break;
                     }
                     case cpu_bus: {
-                        Log::debug(Logger::scu, "CPU-Bus transfer");
+                        LOG_DEBUG(Logger::scu, "CPU-Bus transfer");
 
                         switch (getScuRegion(read_address)) {
                             using enum ScuRegion;
@@ -495,6 +527,13 @@ void Scu::executeDma(DmaConfiguration& dc) {
                         }
                         write_address_add = 4;
 
+                        // Reads of the CD block data transfer register are copied as a single block.
+                        if (modules_.memory()->transferFromCdBlock(read_address & 0x7FFFFFFFu, write_address, count)) {
+                            LOG_DEBUG(Logger::scu, "CD block transfer");
+                            byte_counter = count;
+                            long_counter = byte_counter / 4;
+                        }
+
                         while (byte_counter < count) {
                             data = modules_.memory()->read<u8>((read_address & 0x7FFFFFFFu) + read_offset
                                                                + long_counter * read_address_add);
@@ -515,20 +554,17 @@ void Scu::executeDma(DmaConfiguration& dc) {
                         Log::warning(Logger::scu, "DSP-Bus transfer - not implemented");
                         break;
                     }
-                    default: Log::warning(Logger::scu, "Unknown DMA bus ! : {}", dc.write_address); break;
+                    default: Log::warning(Logger::scu, "Unknown DMA bus ! : {}", write_address); break;
                 }
 
-                if ((read_address & indirect_dma_end_code) > 0) { is_transfer_done = true; }
-                execute_address_storage_buffer += storage_buffer_size;
+                cycles += dmaTransferCycles(getDmaBus(read_address), write_bus, count);
             }
 
             if (dc.write_address_update == Dxmd::WriteAddressUpdate::update) {
-                dmaUpdateWriteAddress(dc.dma_level, execute_address_storage_buffer);
+                dmaUpdateWriteAddress(dc.dma_level, dc.write_address + entries_number * indirect_dma_entry_size);
             }
 
-            sendDmaEndInterrupt(dc.dma_level);
-            resetDmaEnable(dc);
-            Log::debug(Logger::scu, "Level {} indirect DMA completed", utilities::toUnderlying<DmaLevel>(dc.dma_level));
+            LOG_DEBUG(Logger::scu, "Level {} indirect DMA completed", utilities::toUnderlying<DmaLevel>(dc.dma_level));
 
             break;
         }
@@ -552,6 +588,8 @@ void Scu::executeDma(DmaConfiguration& dc) {
     // DSP-BUS <- CPU-BUS
 
     // If DMA enable bit is set and start factor occurs, DMA transfer is added to the queue
+
+    return cycles;
 }
 
 void Scu::setInterruptStatusRegister(const Interrupt& i) { regs_.ist.upd(i.status, ScuRegs::Ist::InterruptEnable::enabled); };
@@ -560,6 +598,7 @@ void Scu::resetInterruptStatusRegister(const Interrupt& i) { regs_.ist.upd(i.sta
 
 void Scu::generateInterrupt(const Interrupt& i) {
     if (i.level != 0) {
+        Trace::record(TraceEvent::scu_interrupt, i.vector, i.level);
         if (!isInterruptMasked(i)) {
             setInterruptStatusRegister(i);
             modules_.masterSh2()->sendInterrupt(i);
@@ -625,13 +664,15 @@ auto Scu::isInterruptExecuting(const Interrupt& i) -> bool {
 }
 
 void Scu::sendStartFactor(const ScuRegs::Dxmd::StartingFactorSelect sfs) {
-    for (auto& dc : dma_queue_) {
-        if (dc.dma_status == DmaStatus::waiting_start_factor) {
-            if (dc.starting_factor_select == sfs) { dc.dma_status = DmaStatus::queued; }
+    auto is_queued = false;
+    for (auto& dc : dma_levels_) {
+        if ((dc.dma_status == DmaStatus::waiting_start_factor) && (dc.starting_factor_select == sfs)) {
+            dc.dma_status = DmaStatus::queued;
+            is_queued     = true;
         }
     }
 
-    if (!dma_queue_.empty()) { activateDma(); }
+    if (is_queued) { activateDma(); }
 }
 
 void Scu::clearInterruptFlag(const Interrupt& i) {
@@ -753,38 +794,131 @@ void Scu::initializeDmaReadAddress(DmaConfiguration& dc, const ScuRegs::DxrType&
 }
 
 void Scu::addDmaToQueue(const DmaConfiguration& dc) {
-    auto config = DmaConfiguration{dc};
+    using Dxmd = ScuRegs::Dxmd;
+    using Dxen = ScuRegs::Dxen;
 
-    switch (config.starting_factor_select) {
-        using enum ScuRegs::Dxmd::StartingFactorSelect;
-        case dma_start_factor: config.dma_status = DmaStatus::queued; break;
-        default: config.dma_status = DmaStatus::waiting_start_factor;
+    const auto level = uti::toUnderlying(dc.dma_level);
+    if (dma_levels_[level].dma_status == DmaStatus::active) {
+        // The running transfer isn't interrupted, the new one replaces it when it ends.
+        pending_dma_levels_[level]            = dc;
+        pending_dma_levels_[level].dma_status = DmaStatus::waiting_start_factor;
+        return;
+    }
+
+    auto& config                 = dma_levels_[level];
+    config                       = dc;
+    config.dma_status            = DmaStatus::waiting_start_factor;
+    dma_remaining_cycles_[level] = 0;
+
+    if ((config.starting_factor_select == Dxmd::StartingFactorSelect::dma_start_factor)
+        && (config.dma_starting == Dxen::DmaStarting::started)) {
+        config.dma_status = DmaStatus::queued;
+        activateDma();
     }
-    dma_queue_.push_back(config);
 }
 
 void Scu::activateDma() {
+    // Levels are scanned by decreasing priority : a queued DMA waits while a higher level is active, and suspends the
+    // lower levels until it ends.
+    for (auto level = dma_levels_number; level-- > 0;) {
+        auto& dc = dma_levels_[level];
+        if (dc.dma_status == DmaStatus::active) { return; }
+        if (dc.dma_status == DmaStatus::queued) {
+            dc.dma_status                = DmaStatus::active;
+            dma_remaining_cycles_[level] = executeDma(dc);
+            return;
+        }
+    }
+}
+
+auto Scu::readIndirectDmaTable(const u32 table_address, const u8 read_address_add, const u8 write_address_add) -> u32 {
+    // A table in work RAM is read straight from its storage, other areas go through the usual accesses.
+    auto* memory = modules_.memory();
+    auto  table  = std::span<const u8>{};
+    if (uti::Range<workram_high_area>::contains(table_address)) {
+        table = std::span<const u8>{memory->workram_high_}.subspan(table_address & workram_high_memory_mask);
+    } else if (uti::Range<workram_low_area>::contains(table_address)) {
+        table = std::span<const u8>{memory->workram_low_}.subspan(table_address & workram_low_memory_mask);
+    }
+    const auto read_long = [&](const u32 offset) -> u32 {
+        if (offset + 4 > table.size()) { return memory->read<u32>(table_address + offset); }
+        return (static_cast<u32>(table[offset]) << 24) | (static_cast<u32>(table[offset + 1]) << 16)
+               | (static_cast<u32>(table[offset + 2]) << 8) | static_cast<u32>(table[offset + 3]);
+    };
+
+    // B-Bus transfers with a read add of 4 and a write add of 2 are burst copies, when both their source and destination
+    // follow the previous one they are merged into it.
+    const auto is_burst_copy = [read_address_add, write_address_add](const IndirectDmaTransfer& t) {
+        const auto region = getScuRegion(t.read_address);
+        return (read_address_add == 4) && (write_address_add == 2) && (getDmaBus(t.write_address) == DmaBus::b_bus)
+               && (region != ScuRegion::unknown) && (region != ScuRegion::a_bus_cs2);
+    };
+
+    indirect_dma_transfers_.clear();
+    auto entries_number = u32{};
+    auto is_last_entry  = false;
+    while (!is_last_entry && (entries_number < max_indirect_dma_entries)) {
+        const auto offset   = entries_number * indirect_dma_entry_size;
+        auto       transfer = IndirectDmaTransfer{read_long(offset), read_long(offset + 4), read_long(offset + 8)};
+        is_last_entry       = (transfer.read_address & indirect_dma_end_code) != 0;
+        transfer.read_address &= ~indirect_dma_end_code;
+        if (transfer.transfer_byte_number == 0) { transfer.transfer_byte_number = max_transfer_byte_number; }
+        ++entries_number;
+
+        if (!indirect_dma_transfers_.empty()) {
+            auto& previous = indirect_dma_transfers_.back();
+            if ((previous.read_address + previous.transfer_byte_number == transfer.read_address)
+                && (previous.write_address + previous.transfer_byte_number == transfer.write_address) && is_burst_copy(previous)
+                && is_burst_copy(transfer)) {
+                previous.transfer_byte_number += transfer.transfer_byte_number;
+                continue;
+            }
+        }
+        indirect_dma_transfers_.push_back(transfer);
+    }
+    if (!is_last_entry) { Log::warning(Logger::scu, tr("Indirect DMA table at {:#x} has no end code"), table_address); }
+
+    return entries_number;
+}
+
+void Scu::endDma(DmaConfiguration& dc) {
     using Dxen = ScuRegs::Dxen;
 
-    // Check for emptiness is done before the call.
+    sendDmaEndInterrupt(dc.dma_level);
+    resetDmaEnable(dc);
+    dc.dma_status = (dc.dma_enable == Dxen::DmaEnable::enabled) ? DmaStatus::waiting_start_factor : DmaStatus::finished;
+}
 
-    dmaSort();
+void Scu::updateDmaStatusRegister() {
+    using Dsta = ScuRegs::Dsta;
 
-    // Timing is not handled for now, DMA transfer is immediate
+    const auto is_active = [this](const DmaLevel l) { return dma_levels_[uti::toUnderlying(l)].dma_status == DmaStatus::active; };
+    const auto is_queued = [this](const DmaLevel l) { return dma_levels_[uti::toUnderlying(l)].dma_status == DmaStatus::queued; };
 
-    // This case should only happen when timing is handled
-    if (dma_queue_[0].dma_status == DmaStatus::active) { return; }
+    regs_.dsta = {};
+    if (is_active(DmaLevel::level_0)) { regs_.dsta.upd(Dsta::d0mv_enum, Dsta::Level0DmaOperation::in_operation); }
+    if (is_queued(DmaLevel::level_0)) { regs_.dsta.upd(Dsta::d0wt_enum, Dsta::Level0DmaStandBy::on_standby); }
+    if (is_active(DmaLevel::level_1)) { regs_.dsta.upd(Dsta::d1mv_enum, Dsta::Level1DmaOperation::in_operation); }
+    if (is_queued(DmaLevel::level_1)) { regs_.dsta.upd(Dsta::d1wt_enum, Dsta::Level1DmaStandBy::on_standby); }
+    if (is_active(DmaLevel::level_2)) { regs_.dsta.upd(Dsta::d2mv_enum, Dsta::Level2DmaOperation::in_operation); }
+    if (is_queued(DmaLevel::level_2)) { regs_.dsta.upd(Dsta::d2wt_enum, Dsta::Level2DmaStandBy::on_standby); }
 
-    for (auto& dc : dma_queue_) {
-        if (dc.dma_status == DmaStatus::queued) {
-            executeDma(dc);
-            if (dc.dma_enable == Dxen::DmaEnable::enabled) {
-                dc.dma_status = DmaStatus::waiting_start_factor;
-            } else {
-                dc.dma_status = DmaStatus::finished;
-            }
-        }
+    // The running DMA is the active one of highest level, it suspends the active DMA of lower levels.
+    const auto running = std::find_if(dma_levels_.rbegin(), dma_levels_.rend(), [](const DmaConfiguration& dc) {
+        return dc.dma_status == DmaStatus::active;
+    });
+    if (running == dma_levels_.rend()) { return; }
+
+    if ((running->dma_level != DmaLevel::level_0) && is_active(DmaLevel::level_0)) {
+        regs_.dsta.upd(Dsta::d0bk_enum, Dsta::Level0DmaInterrupt::interrupted);
+    }
+    if ((running->dma_level == DmaLevel::level_2) && is_active(DmaLevel::level_1)) {
+        regs_.dsta.upd(Dsta::d1bk_enum, Dsta::Level1DmaInterrupt::interrupted);
     }
+
+    const auto buses = std::array{getDmaBus(running->read_address), getDmaBus(running->write_address)};
+    if (std::ranges::find(buses, DmaBus::a_bus) != buses.end()) { regs_.dsta.upd(Dsta::dacsa_enum, Dsta::ABusAccess::accessing); }
+    if (std::ranges::find(buses, DmaBus::b_bus) != buses.end()) { regs_.dsta.upd(Dsta::dacsb_enum, Dsta::BBusAccess::accessing); }
 }
 
 /* static */
@@ -898,19 +1032,16 @@ auto Scu::getScuRegion(const u32 address) -> ScuRegion {
 }
 
 void Scu::dmaTest() {
-    using Dxmd    = ScuRegs::Dxmd;
-    auto dc       = DmaConfiguration{};
-    dc.dma_status = DmaStatus::finished;
-    dma_queue_.push_back(dc);
-    dc.dma_status = DmaStatus::queued;
-    dma_queue_.push_back(dc);
-    dc.starting_factor_select = Dxmd::StartingFactorSelect::h_blank_in;
-    dc.dma_status             = DmaStatus::waiting_start_factor;
-    dma_queue_.push_back(dc);
+    using Dxmd                = ScuRegs::Dxmd;
+    auto dc                   = DmaConfiguration{};
     dc.starting_factor_select = Dxmd::StartingFactorSelect::h_blank_in;
-    dma_queue_.push_back(dc);
+    dc.dma_level              = DmaLevel::level_0;
+    addDmaToQueue(dc);
+    dc.dma_level = DmaLevel::level_1;
+    addDmaToQueue(dc);
     dc.starting_factor_select = Dxmd::StartingFactorSelect::v_blank_out;
-    dma_queue_.push_back(dc);
+    dc.dma_level              = DmaLevel::level_2;
+    addDmaToQueue(dc);
 
     sendStartFactor(Dxmd::StartingFactorSelect::h_blank_in);
 }
@@ -943,9 +1074,28 @@ void Scu::dmaUpdateWriteAddress(const DmaLevel l, const u32 data) {
     }
 }
 
-void Scu::dmaSort() {
-    std::ranges::sort(dma_queue_,
-                      [](const DmaConfiguration& dc1, const DmaConfiguration& dc2) { return dc1.dma_status < dc2.dma_status; });
+void Scu::run(const u32 cycles) {
+    if (dsp_.isExecuting()) { dsp_.run(cycles); }
+
+    // Only the active DMA of highest level progresses, scanning starts again when a DMA ends as another one may start.
+    auto elapsed = cycles;
+    for (auto level = dma_levels_number; (elapsed > 0) && (level-- > 0);) {
+        auto& dc = dma_levels_[level];
+        if (dc.dma_status != DmaStatus::active) { continue; }
+
+        auto&      remaining = dma_remaining_cycles_[level];
+        const auto spent     = std::min(elapsed, remaining);
+        remaining -= spent;
+        elapsed -= spent;
+        if (remaining > 0) { break; }
+
+        endDma(dc);
+        if (pending_dma_levels_[level].dma_status != DmaStatus::finished) {
+            addDmaToQueue(std::exchange(pending_dma_levels_[level], {}));
+        }
+        activateDma();
+        level = dma_levels_number;
+    }
 }
 
 auto Scu::getTimer0CompareValue() const -> u32 { return regs_.t0c >> ScuRegs::T0c::t0c_shft; }
@@ -972,4 +1122,16 @@ void Scu::onTimer0() {
     sendStartFactor(ScuRegs::Dxmd::StartingFactorSelect::timer_0);
 };
 
+template<typename Archive>
+void Scu::serialize(Archive& ar) {
+    ar.value(regs_);
+    dsp_.serialize(ar);
+    ar.value(dma_levels_);
+    ar.value(pending_dma_levels_);
+    ar.value(dma_remaining_cycles_);
+}
+
+template void Scu::serialize(StateWriter&);
+template void Scu::serialize(StateReader&);
+
 } // namespace saturnin::core
@@ -26,11 +26,11 @@
 #pragma once
 
 #include <array>  // array
-#include <queue>  // priority_queue
 #include <vector> // vector
 #include <saturnin/src/emulator_defs.h>
 #include <saturnin/src/interrupt_sources.h>
 #include <saturnin/src/emulator_modules.h>
+#include <saturnin/src/scu_dsp.h>
 
 namespace is = saturnin::core::interrupt_source;
 
@@ -47,9 +47,7 @@ namespace saturnin::core {
 // class EmulatorContext;
 
 constexpr auto indirect_dma_end_code = u32{0x80000000};
-constexpr auto program_ram_size      = u16{256 * 32 * 4}; ///< 256 words of 32 bits.
-constexpr auto data_ram_size         = u16{64 * 32 * 4};  ///< 64 words of 32 bits.
-constexpr auto data_ram_number       = u8{4};             ///< Number of data RAM.
+constexpr auto dma_levels_number     = std::size_t{3}; ///< Number of DMA levels, level 2 having the highest priority.
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \enum   DmaLevel
@@ -130,6 +128,21 @@ struct DmaConfiguration {
     ScuRegs::Dxmd::StartingFactorSelect starting_factor_select;
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct IndirectDmaTransfer
+///
+/// \brief  Transfer read from an indirect DMA table, possibly merging several consecutive entries.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct IndirectDmaTransfer {
+    u32 transfer_byte_number; ///< Number of bytes transferred.
+    u32 write_address;        ///< Destination address.
+    u32 read_address;         ///< Source address, without the end code.
+};
+
 class Scu {
   public:
     //@{
@@ -144,9 +157,10 @@ class Scu {
     //@}
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn auto Scu::read32(u32 addr) const -> u32;
+    /// \fn auto Scu::read32(u32 addr) -> u32;
     ///
-    /// \brief  Reads 32 bits of data from the specified address in the SCU memory space.
+    /// \brief  Reads 32 bits of data from the specified address in the SCU memory space. DSP ports
+    ///         reads catch up with the DSP execution first.
     ///
     /// \author Runik
     /// \date   24/01/2019
@@ -156,7 +170,7 @@ class Scu {
     /// \return Data read.
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    [[nodiscard]] auto read32(u32 addr) const -> u32;
+    [[nodiscard]] auto read32(u32 addr) -> u32;
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Scu::write32(const u32 addr, const u32 data);
@@ -173,17 +187,35 @@ class Scu {
     void write32(u32 addr, u32 data);
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn void Scu::executeDma(DmaConfiguration& dc);
+    /// \fn auto Scu::executeDma(DmaConfiguration& dc) -> u32;
     ///
-    /// \brief  Executes the DMA operation.
+    /// \brief  Executes the DMA operation. Data is transferred at once, the end of the DMA being scheduled
+    ///         by the caller after the returned duration.
     ///
     /// \author Runik
     /// \date   02/02/2019
     ///
     /// \param [in,out] dc  DMA configuration.
+    ///
+    /// \returns    The duration of the transfer, in SH2 cycles.
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void executeDma(DmaConfiguration& dc);
+    auto executeDma(DmaConfiguration& dc) -> u32;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Scu::run(const u32 cycles);
+    ///
+    /// \brief  Runs the DSP and the active DMA for the SH2 cycles elapsed.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  cycles  SH2 cycles elapsed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void run(const u32 cycles);
+
+    auto dsp() -> ScuDsp& { return dsp_; }
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Scu::setInterruptStatusRegister(const Interrupt& i);
@@ -316,6 +348,21 @@ class Scu {
 
     void dmaTest();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Scu::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the registers, the DSP and the DMA levels.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
     /// \name Context objects accessors
     //@{
     //[[nodiscard]] auto emulatorContext() const -> EmulatorContext*;
@@ -435,7 +482,8 @@ class Scu {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Scu::addDmaToQueue(const DmaConfiguration& dc);
     ///
-    /// \brief  Adds the DMA to the queue.
+    /// \brief  Stores the DMA in the slot of its level, replacing the previous one. A DMA started by DxGO
+    ///         is activated at once. When the level is active, the DMA is kept until the transfer ends.
     ///
     /// \author Runik
     /// \date   22/03/2019
@@ -445,12 +493,6 @@ class Scu {
 
     void addDmaToQueue(const DmaConfiguration& dc);
 
-    struct DmaCompare {
-        auto operator()(const DmaConfiguration& dc1, const DmaConfiguration& dc2) const -> bool {
-            return dc1.dma_status < dc2.dma_status;
-        }
-    };
-
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn static auto Scu::getDmaBus(u32 address) -> DmaBus;
     ///
@@ -522,27 +564,67 @@ class Scu {
     void dmaUpdateWriteAddress(DmaLevel l, u32 data);
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
-    /// \fn void Scu::dmaSort();
+    /// \fn void Scu::activateDma();
     ///
-    /// \brief  Sorts the DMA queue
+    /// \brief  Starts the queued DMA of highest level, unless a DMA of a higher level is active.
     ///
     /// \author Runik
-    /// \date   01/01/2023
+    /// \date   19/10/2026
     ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void dmaSort();
+    void activateDma();
 
-    // using DmaConfigurations = std::vector<DmaConfiguration>;
-    // using DmaQueue          = std::priority_queue<DmaConfiguration, DmaConfigurations, DmaCompare>;
-    using DmaQueue = std::vector<DmaConfiguration>;
-    DmaQueue dma_queue_;
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Scu::readIndirectDmaTable(const u32 table_address, const u8 read_address_add, const u8 write_address_add)
+    /// -> u32;
+    ///
+    /// \brief  Reads a whole indirect DMA table in indirect_dma_transfers_. Entries copied as a single
+    ///         block and following each other in both source and destination are merged.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  table_address       Address of the table.
+    /// \param  read_address_add    Read address add value of the DMA.
+    /// \param  write_address_add   Write address add value of the DMA.
+    ///
+    /// \returns    The number of entries read, up to the one holding the end code.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void activateDma();
+    auto readIndirectDmaTable(const u32 table_address, const u8 read_address_add, const u8 write_address_add) -> u32;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Scu::endDma(DmaConfiguration& dc);
+    ///
+    /// \brief  Ends an active DMA once its duration has elapsed, sending its end interrupt.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] dc  DMA configuration.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void endDma(DmaConfiguration& dc);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Scu::updateDmaStatusRegister();
+    ///
+    /// \brief  Updates DSTA from the state of the DMA levels.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void updateDmaStatusRegister();
+
+    std::array<DmaConfiguration, dma_levels_number> dma_levels_{};           ///< DMA of each level, indexed by level.
+    std::array<DmaConfiguration, dma_levels_number> pending_dma_levels_{};   ///< DMA set while its level was active.
+    std::array<u32, dma_levels_number>              dma_remaining_cycles_{}; ///< Cycles before each active DMA ends.
+    std::vector<IndirectDmaTransfer>                indirect_dma_transfers_; ///< Last indirect table read, storage is reused.
 
     EmulatorModules modules_;
 
-    std::array<u8, program_ram_size>                           program_ram_; ///< DSP Program RAM.
-    std::array<std::array<u8, data_ram_size>, data_ram_number> data_ram_;    ///< DSP Data RAM.
+    ScuDsp dsp_; ///< DSP, holding its program and data RAM.
 
     ScuRegs regs_; ///< Scu memory registers.
 };
@@ -0,0 +1,653 @@
+//
+// scu_dsp.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/scu_dsp.h>
+#include <algorithm> // transform
+#include <bit>       // rotl, rotr
+#include <saturnin/src/interrupt_sources.h>
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>
+#include <saturnin/src/memory.h>
+#include <saturnin/src/save_state.h>
+#include <saturnin/src/scu.h>
+
+namespace saturnin::core {
+
+namespace uti = saturnin::utilities;
+
+constexpr auto sh2_cycles_by_step    = u32{2};     // The DSP runs at the SCU clock, half the SH2 one.
+constexpr auto data_ram_address_mask = u8{0x3F};   // CTn are 6 bits counters.
+constexpr auto loop_counter_mask     = u16{0xFFF}; // LOP is a 12 bits counter.
+constexpr auto d0_address_mask       = u32{0x7FFFFFC};
+constexpr auto dma_add_values        = std::array<u32, 8>{0, 1, 2, 4, 8, 16, 32, 64}; // In 32 bits words.
+constexpr auto condition_enabled     = u8{0x40};
+constexpr auto condition_set         = u8{0x20}; // Condition is true when a tested flag is set, false otherwise.
+constexpr auto condition_flags_mask  = u8{0x0F};
+
+/// \name Data RAM sources and destinations
+//@{
+constexpr auto source_increment_bit = u8{0x4}; // MCn, the source counter is incremented.
+constexpr auto source_bank_mask     = u8{0x3};
+constexpr auto source_alu_low       = u8{0x9}; // ALL
+constexpr auto source_alu_high      = u8{0xA}; // ALH
+constexpr auto destination_rx       = u8{0x4};
+constexpr auto destination_pl       = u8{0x5};
+constexpr auto destination_ra0      = u8{0x6};
+constexpr auto destination_wa0      = u8{0x7};
+constexpr auto destination_lop      = u8{0xA};
+constexpr auto destination_top      = u8{0xB};
+constexpr auto destination_ct_first = u8{0xC};
+constexpr auto destination_pc       = u8{0xC}; // Immediate loads only.
+constexpr auto destination_program  = u8{0x4}; // DMA only.
+//@}
+
+/// \name Program control port bits
+//@{
+constexpr auto ppaf_execute  = u32{1} << 16;
+constexpr auto ppaf_end      = u32{1} << 18;
+constexpr auto ppaf_overflow = u32{1} << 19;
+constexpr auto ppaf_carry    = u32{1} << 20;
+constexpr auto ppaf_zero     = u32{1} << 21;
+constexpr auto ppaf_sign     = u32{1} << 22;
+constexpr auto ppaf_t0       = u32{1} << 23;
+//@}
+
+inline auto signExtend48(const s64 value) -> s64 { return static_cast<s64>(static_cast<u64>(value) << 16) >> 16; }
+
+inline auto signExtend(const u32 value, const u8 width) -> s32 { return static_cast<s32>(value << (32 - width)) >> (32 - width); }
+
+inline auto bits(const u32 value, const u8 position, const u32 mask) -> u8 { return static_cast<u8>((value >> position) & mask); }
+
+ScuDsp::ScuDsp(EmulatorContext* ec) : modules_(ec) {
+    const auto nop = decode(0);
+    micro_ops_.fill(nop);
+    reset();
+}
+
+void ScuDsp::reset() {
+    ct_.fill(0);
+    rx_                  = 0;
+    ry_                  = 0;
+    p_                   = 0;
+    a_                   = 0;
+    alu_                 = 0;
+    ra0_                 = 0;
+    wa0_                 = 0;
+    lop_                 = 0;
+    top_                 = 0;
+    pc_                  = 0;
+    sign_                = false;
+    zero_                = false;
+    carry_               = false;
+    overflow_            = false;
+    is_end_interrupt_    = false;
+    is_executing_        = false;
+    is_paused_           = false;
+    jump_delay_          = 0;
+    is_step_repeated_    = false;
+    dma_remaining_steps_ = 0;
+    pending_cycles_      = 0;
+}
+
+auto ScuDsp::readProgramControlPort() -> u32 {
+    synchronize();
+
+    auto status = u32{pc_};
+    if (is_executing_) { status |= ppaf_execute; }
+    if (is_end_interrupt_) { status |= ppaf_end; }
+    if (overflow_) { status |= ppaf_overflow; }
+    if (carry_) { status |= ppaf_carry; }
+    if (zero_) { status |= ppaf_zero; }
+    if (sign_) { status |= ppaf_sign; }
+    if (dma_remaining_steps_ > 0) { status |= ppaf_t0; }
+
+    // E and V are cleared once read.
+    is_end_interrupt_ = false;
+    overflow_         = false;
+    return status;
+}
+
+void ScuDsp::writeProgramControlPort(const ScuRegs::PpafType& ppaf) {
+    using Ppaf = ScuRegs::Ppaf;
+    synchronize();
+
+    if ((ppaf >> Ppaf::le_enum) == Ppaf::ProgramCounterTransferEnable::program_ram_address_loaded_to_program_counter) {
+        pc_         = static_cast<u8>(ppaf >> Ppaf::p_shft);
+        jump_delay_ = 0;
+    }
+    if ((ppaf >> Ppaf::ep_enum) == Ppaf::ExecutePause::program_pauses) { is_paused_ = true; }
+    if ((ppaf >> Ppaf::pp_enum) == Ppaf::ExecutePauseReset::program_pause_is_reset) { is_paused_ = false; }
+
+    const auto was_executing = is_executing_;
+    is_executing_            = ((ppaf >> Ppaf::ex_enum) == Ppaf::ProgramExecuteControl::program_execution_begins);
+    if (is_executing_ && !was_executing) { pending_cycles_ = 0; }
+
+    if (((ppaf >> Ppaf::es_enum) == Ppaf::StepExecuteControl::program_executes_one_step) && (!is_executing_ || is_paused_)) {
+        step();
+    }
+}
+
+void ScuDsp::writeProgramRam(const u32 data) {
+    synchronize();
+    writeProgramWord(pc_++, data);
+}
+
+void ScuDsp::writeDataRamAddress(const ScuRegs::PdaType& pda) {
+    using Pda = ScuRegs::Pda;
+    synchronize();
+
+    // The port uses the address counter of the selected data RAM.
+    data_ram_port_bank_      = uti::toUnderlying(pda >> Pda::drs_enum);
+    ct_[data_ram_port_bank_] = static_cast<u8>(pda >> Pda::dra_shft);
+}
+
+auto ScuDsp::readDataRam() -> u32 {
+    synchronize();
+    if (is_executing_) { return 0; }
+
+    auto&      ct   = ct_[data_ram_port_bank_];
+    const auto data = data_ram_[data_ram_port_bank_][ct];
+    ct              = (ct + 1) & data_ram_address_mask;
+    return data;
+}
+
+void ScuDsp::writeDataRam(const u32 data) {
+    synchronize();
+    if (is_executing_) { return; }
+
+    auto& ct                           = ct_[data_ram_port_bank_];
+    data_ram_[data_ram_port_bank_][ct] = data;
+    ct                                 = (ct + 1) & data_ram_address_mask;
+}
+
+void ScuDsp::run(const u32 cycles) {
+    pending_cycles_ += cycles;
+    if (pending_cycles_ >= dsp_burst_steps * sh2_cycles_by_step) { synchronize(); }
+}
+
+void ScuDsp::synchronize() {
+    if (!is_executing_) {
+        pending_cycles_ = 0;
+        return;
+    }
+    execute(pending_cycles_ / sh2_cycles_by_step);
+    pending_cycles_ = is_executing_ ? (pending_cycles_ % sh2_cycles_by_step) : 0;
+}
+
+template<typename Archive>
+void ScuDsp::serialize(Archive& ar) {
+    ar.value(program_ram_);
+    ar.value(data_ram_);
+    ar.value(ct_);
+    ar.value(rx_);
+    ar.value(ry_);
+    ar.value(p_);
+    ar.value(a_);
+    ar.value(alu_);
+    ar.value(ra0_);
+    ar.value(wa0_);
+    ar.value(lop_);
+    ar.value(top_);
+    ar.value(pc_);
+    ar.value(sign_);
+    ar.value(zero_);
+    ar.value(carry_);
+    ar.value(overflow_);
+    ar.value(is_end_interrupt_);
+    ar.value(is_executing_);
+    ar.value(is_paused_);
+    ar.value(jump_target_);
+    ar.value(jump_delay_);
+    ar.value(is_step_repeated_);
+    ar.value(repeated_address_);
+    ar.value(dma_remaining_steps_);
+    ar.value(data_ram_port_bank_);
+    ar.value(pending_cycles_);
+
+    if constexpr (Archive::is_loading) { std::ranges::transform(program_ram_, micro_ops_.begin(), &ScuDsp::decode); }
+}
+
+template void ScuDsp::serialize(StateWriter&);
+template void ScuDsp::serialize(StateReader&);
+
+// static
+auto ScuDsp::decode(const u32 instruction) -> DspMicroOp {
+    auto op = DspMicroOp{};
+
+    // Conditions are 7 bits, bit 6 enabling the test.
+    const auto decodeCondition = [instruction]() {
+        const auto condition = bits(instruction, 19, 0x7F);
+        return ((condition & condition_enabled) != 0) ? condition : u8{0};
+    };
+    const auto addSourceIncrement = [&op](const u8 source) {
+        if ((source & source_increment_bit) != 0) { op.increments |= static_cast<u8>(1 << (source & source_bank_mask)); }
+    };
+    const auto addDestinationIncrement = [&op](const u8 destination) {
+        if (destination < dsp_data_ram_number) { op.increments |= static_cast<u8>(1 << destination); }
+    };
+
+    switch (bits(instruction, 30, 0x3)) {
+        case 0b00: {
+            op.command = DspCommand::operation;
+            switch (bits(instruction, 26, 0xF)) {
+                using enum DspAluOperation;
+                case 0x0: op.alu = nop; break;
+                case 0x1: op.alu = logical_and; break;
+                case 0x2: op.alu = logical_or; break;
+                case 0x3: op.alu = logical_xor; break;
+                case 0x4: op.alu = add; break;
+                case 0x5: op.alu = sub; break;
+                case 0x6: op.alu = add_48_bits; break;
+                case 0x8: op.alu = shift_right; break;
+                case 0x9: op.alu = rotate_right; break;
+                case 0xA: op.alu = shift_left; break;
+                case 0xB: op.alu = rotate_left; break;
+                case 0xF: op.alu = rotate_left_8; break;
+                default: op.alu = nop; break;
+            }
+
+            // X-Bus
+            op.x_source     = bits(instruction, 20, 0x7);
+            op.is_rx_loaded = bits(instruction, 25, 0x1) != 0;
+            switch (bits(instruction, 23, 0x3)) {
+                case 0b10: op.p_load = DspPLoad::multiplier; break;
+                case 0b11: op.p_load = DspPLoad::data_ram; break;
+                default: op.p_load = DspPLoad::none; break;
+            }
+            if (op.is_rx_loaded || (op.p_load == DspPLoad::data_ram)) { addSourceIncrement(op.x_source); }
+
+            // Y-Bus
+            op.y_source     = bits(instruction, 14, 0x7);
+            op.is_ry_loaded = bits(instruction, 19, 0x1) != 0;
+            switch (bits(instruction, 17, 0x3)) {
+                case 0b01: op.a_load = DspALoad::clear; break;
+                case 0b10: op.a_load = DspALoad::alu; break;
+                case 0b11: op.a_load = DspALoad::data_ram; break;
+                default: op.a_load = DspALoad::none; break;
+            }
+            if (op.is_ry_loaded || (op.a_load == DspALoad::data_ram)) { addSourceIncrement(op.y_source); }
+
+            // D1-Bus
+            op.destination = bits(instruction, 8, 0xF);
+            switch (bits(instruction, 12, 0x3)) {
+                case 0b01: {
+                    op.d1_move   = DspD1Move::immediate;
+                    op.immediate = signExtend(instruction, 8);
+                    break;
+                }
+                case 0b11: {
+                    op.d1_source = bits(instruction, 0, 0xF);
+                    if (op.d1_source == source_alu_low) {
+                        op.d1_move = DspD1Move::alu_low;
+                    } else if (op.d1_source == source_alu_high) {
+                        op.d1_move = DspD1Move::alu_high;
+                    } else {
+                        op.d1_move = DspD1Move::data_ram;
+                        addSourceIncrement(op.d1_source);
+                    }
+                    break;
+                }
+                default: op.d1_move = DspD1Move::none; break;
+            }
+            if (op.d1_move != DspD1Move::none) {
+                addDestinationIncrement(op.destination);
+                // A counter written by the step isn't incremented.
+                if (op.destination >= destination_ct_first) {
+                    op.increments &= static_cast<u8>(~(1 << (op.destination - destination_ct_first)));
+                }
+            }
+            break;
+        }
+        case 0b10: {
+            op.destination = bits(instruction, 26, 0xF);
+            op.condition   = decodeCondition();
+            op.immediate   = (op.condition != 0) ? signExtend(instruction, 19) : signExtend(instruction, 25);
+            if (op.destination == destination_pc) {
+                op.command   = DspCommand::jump;
+                op.immediate = op.immediate & 0xFF;
+            } else {
+                op.command = DspCommand::load_immediate;
+                addDestinationIncrement(op.destination);
+            }
+            break;
+        }
+        case 0b11: {
+            switch (bits(instruction, 27, 0x7)) {
+                case 0b000:
+                case 0b001: {
+                    op.command             = DspCommand::dma;
+                    op.dma_add             = bits(instruction, 15, 0x7);
+                    op.is_dma_held         = bits(instruction, 14, 0x1) != 0;
+                    op.is_dma_count_in_ram = bits(instruction, 13, 0x1) != 0;
+                    op.is_dma_to_d0        = bits(instruction, 12, 0x1) != 0;
+                    op.destination         = bits(instruction, 8, 0x7);
+                    if (op.is_dma_count_in_ram) {
+                        op.x_source = bits(instruction, 0, 0x7);
+                        addSourceIncrement(op.x_source);
+                    } else {
+                        op.immediate = static_cast<s32>(instruction & 0xFF);
+                    }
+                    break;
+                }
+                case 0b010:
+                case 0b011: {
+                    op.command   = DspCommand::jump;
+                    op.condition = decodeCondition();
+                    op.immediate = static_cast<s32>(instruction & 0xFF);
+                    break;
+                }
+                case 0b100: op.command = DspCommand::loop_bottom; break;
+                case 0b101: op.command = DspCommand::loop_start; break;
+                case 0b110: op.command = DspCommand::end; break;
+                case 0b111: op.command = DspCommand::end_interrupt; break;
+                default: break;
+            }
+            break;
+        }
+        default: op.command = DspCommand::invalid; break;
+    }
+    return op;
+}
+
+void ScuDsp::execute(u32 steps) {
+    while ((steps > 0) && is_executing_ && !is_paused_) {
+        step();
+        --steps;
+    }
+}
+
+void ScuDsp::step() {
+    const auto  address = pc_;
+    const auto& op      = micro_ops_[pc_++];
+    if (dma_remaining_steps_ > 0) { --dma_remaining_steps_; }
+    if (jump_delay_ > 0) { --jump_delay_; }
+
+    switch (op.command) {
+        using enum DspCommand;
+        case operation: executeOperation(op); break;
+        case load_immediate: {
+            if (isConditionTrue(op.condition)) {
+                writeDestination(op.destination, static_cast<u32>(op.immediate));
+                applyIncrements(op.increments);
+            }
+            break;
+        }
+        case dma: executeDma(op); break;
+        case jump: {
+            if (isConditionTrue(op.condition)) { delayJump(static_cast<u8>(op.immediate)); }
+            break;
+        }
+        case loop_bottom: {
+            if (lop_ != 0) {
+                lop_ = (lop_ - 1) & loop_counter_mask;
+                delayJump(top_);
+            }
+            break;
+        }
+        case loop_start: {
+            is_step_repeated_ = true;
+            repeated_address_ = pc_;
+            break;
+        }
+        case end_interrupt: {
+            is_end_interrupt_ = true;
+            modules_.scu()->generateInterrupt(interrupt_source::dsp_end);
+            [[fallthrough]];
+        }
+        case end: {
+            is_executing_ = false;
+            jump_delay_   = 0;
+            break;
+        }
+        case invalid: Log::warning(Logger::scu, tr("SCU DSP - Invalid instruction at {:#x}"), address); break;
+    }
+
+    if (is_step_repeated_ && (address == repeated_address_) && (op.command != DspCommand::loop_start)) {
+        if (lop_ != 0) {
+            lop_ = (lop_ - 1) & loop_counter_mask;
+            pc_  = address;
+        } else {
+            is_step_repeated_ = false;
+        }
+    }
+
+    if (jump_delay_ == 1) {
+        pc_         = jump_target_;
+        jump_delay_ = 0;
+    }
+}
+
+void ScuDsp::executeOperation(const DspMicroOp& op) {
+    // Every bus reads the registers and the data RAM as they were before the step.
+    const auto product = signExtend48(static_cast<s64>(static_cast<s32>(rx_)) * static_cast<s32>(ry_));
+    const auto x_data  = readData(op.x_source);
+    const auto y_data  = readData(op.y_source);
+    if (op.alu != DspAluOperation::nop) { alu_ = computeAlu(op.alu); }
+
+    if (op.is_rx_loaded) { rx_ = x_data; }
+    switch (op.p_load) {
+        using enum DspPLoad;
+        case multiplier: p_ = product; break;
+        case data_ram: p_ = static_cast<s32>(x_data); break;
+        case none: break;
+    }
+
+    if (op.is_ry_loaded) { ry_ = y_data; }
+    switch (op.a_load) {
+        using enum DspALoad;
+        case clear: a_ = 0; break;
+        case alu: a_ = alu_; break;
+        case data_ram: a_ = static_cast<s32>(y_data); break;
+        case none: break;
+    }
+
+    switch (op.d1_move) {
+        using enum DspD1Move;
+        case immediate: writeDestination(op.destination, static_cast<u32>(op.immediate)); break;
+        case data_ram: writeDestination(op.destination, readData(op.d1_source)); break;
+        case alu_low: writeDestination(op.destination, static_cast<u32>(alu_)); break;
+        case alu_high: writeDestination(op.destination, static_cast<u32>(alu_ >> 16)); break;
+        case none: break;
+    }
+
+    applyIncrements(op.increments);
+}
+
+void ScuDsp::executeDma(const DspMicroOp& op) {
+    auto count = static_cast<u32>(op.immediate);
+    if (op.is_dma_count_in_ram) {
+        count = readData(op.x_source);
+        applyIncrements(op.increments);
+    }
+
+    const auto bank = static_cast<u8>(op.destination & source_bank_mask);
+    if (op.is_dma_to_d0) {
+        // Written data may hit areas with side effects, it goes through the usual accesses.
+        const auto add     = dma_add_values[op.dma_add];
+        auto       address = wa0_;
+        auto*      memory  = modules_.memory();
+        for (u32 i = 0; i < count; ++i) {
+            memory->write<u32>((address << 2) & d0_address_mask, data_ram_[bank][ct_[bank]]);
+            ct_[bank] = (ct_[bank] + 1) & data_ram_address_mask;
+            address += add;
+        }
+        if (!op.is_dma_held) { wa0_ = address; }
+    } else {
+        // Reads from the D0-Bus are done 32 bits at a time, any add value but 0 adds 1 word.
+        const auto add     = (op.dma_add != 0) ? u32{1} : u32{0};
+        auto       address = ra0_;
+        for (u32 i = 0; i < count; ++i) {
+            const auto data = readD0((address << 2) & d0_address_mask);
+            if (op.destination == destination_program) {
+                writeProgramWord(static_cast<u8>(i), data);
+            } else {
+                data_ram_[bank][ct_[bank]] = data;
+                ct_[bank]                  = (ct_[bank] + 1) & data_ram_address_mask;
+            }
+            address += add;
+        }
+        if (!op.is_dma_held) { ra0_ = address; }
+    }
+
+    // The transfer is done at once, T0 is kept set for the duration it would take.
+    dma_remaining_steps_ = count;
+}
+
+void ScuDsp::delayJump(const u8 target) {
+    jump_target_ = target;
+    jump_delay_  = 2;
+}
+
+auto ScuDsp::computeAlu(const DspAluOperation operation) -> s64 {
+    const auto acl = static_cast<u32>(a_);
+    const auto pl  = static_cast<u32>(p_);
+    auto       low = u32{};
+
+    switch (operation) {
+        using enum DspAluOperation;
+        case logical_and:
+            low    = acl & pl;
+            carry_ = false;
+            break;
+        case logical_or:
+            low    = acl | pl;
+            carry_ = false;
+            break;
+        case logical_xor:
+            low    = acl ^ pl;
+            carry_ = false;
+            break;
+        case add: {
+            const auto result = u64{acl} + pl;
+            low               = static_cast<u32>(result);
+            carry_            = (result >> 32) != 0;
+            overflow_         = overflow_ || ((((acl ^ low) & (pl ^ low)) >> 31) != 0);
+            break;
+        }
+        case sub: {
+            const auto result = u64{acl} - pl;
+            low               = static_cast<u32>(result);
+            carry_            = (result >> 32) != 0;
+            overflow_         = overflow_ || ((((acl ^ pl) & (acl ^ low)) >> 31) != 0);
+            break;
+        }
+        case add_48_bits: {
+            constexpr auto mask_48 = u64{0xFFFF'FFFF'FFFF};
+            const auto     result  = (static_cast<u64>(a_) & mask_48) + (static_cast<u64>(p_) & mask_48);
+            const auto     alu     = signExtend48(static_cast<s64>(result));
+            carry_                 = ((result >> 48) & 1) != 0;
+            overflow_              = overflow_ || (((a_ < 0) == (p_ < 0)) && ((alu < 0) != (a_ < 0)));
+            sign_                  = alu < 0;
+            zero_                  = alu == 0;
+            return alu;
+        }
+        case shift_right:
+            carry_ = (acl & 1) != 0;
+            low    = static_cast<u32>(static_cast<s32>(acl) >> 1);
+            break;
+        case rotate_right:
+            carry_ = (acl & 1) != 0;
+            low    = std::rotr(acl, 1);
+            break;
+        case shift_left:
+            carry_ = (acl >> 31) != 0;
+            low    = acl << 1;
+            break;
+        case rotate_left:
+            carry_ = (acl >> 31) != 0;
+            low    = std::rotl(acl, 1);
+            break;
+        case rotate_left_8:
+            carry_ = ((acl >> 24) & 1) != 0;
+            low    = std::rotl(acl, 8);
+            break;
+        case nop: return alu_;
+    }
+
+    // 32 bits operations keep the upper part of the accumulator.
+    sign_ = (low >> 31) != 0;
+    zero_ = low == 0;
+    return (a_ & ~s64{0xFFFF'FFFF}) | low;
+}
+
+auto ScuDsp::readData(const u8 source) const -> u32 {
+    const auto bank = static_cast<u8>(source & source_bank_mask);
+    return data_ram_[bank][ct_[bank]];
+}
+
+void ScuDsp::writeDestination(const u8 destination, const u32 value) {
+    switch (destination) {
+        case 0x0:
+        case 0x1:
+        case 0x2:
+        case 0x3: data_ram_[destination][ct_[destination]] = value; break;
+        case destination_rx: rx_ = value; break;
+        case destination_pl: p_ = static_cast<s32>(value); break;
+        case destination_ra0: ra0_ = value; break;
+        case destination_wa0: wa0_ = value; break;
+        case destination_lop: lop_ = static_cast<u16>(value & loop_counter_mask); break;
+        case destination_top: top_ = static_cast<u8>(value); break;
+        case 0xC:
+        case 0xD:
+        case 0xE:
+        case 0xF: ct_[destination - destination_ct_first] = static_cast<u8>(value & data_ram_address_mask); break;
+        default: break;
+    }
+}
+
+void ScuDsp::applyIncrements(const u8 increments) {
+    if (increments == 0) { return; }
+    for (u8 i = 0; i < dsp_data_ram_number; ++i) {
+        if ((increments & (1 << i)) != 0) { ct_[i] = (ct_[i] + 1) & data_ram_address_mask; }
+    }
+}
+
+auto ScuDsp::readD0(const u32 address) const -> u32 {
+    // Work RAM is read straight from its storage, as the SCU DMA block copies do.
+    auto* memory = modules_.memory();
+    if (uti::Range<workram_high_area>::contains(address)) {
+        return rawRead<u32>(memory->workram_high_, address & workram_high_memory_mask);
+    }
+    if (uti::Range<workram_low_area>::contains(address)) {
+        return rawRead<u32>(memory->workram_low_, address & workram_low_memory_mask);
+    }
+    return memory->read<u32>(address);
+}
+
+void ScuDsp::writeProgramWord(const u8 address, const u32 data) {
+    program_ram_[address] = data;
+    micro_ops_[address]   = decode(data);
+}
+
+auto ScuDsp::isConditionTrue(const u8 condition) const -> bool {
+    if (condition == 0) { return true; }
+
+    // Z, S, C and T0 are tested by bits 0 to 3.
+    auto flags = u8{};
+    if (zero_) { flags |= 0x1; }
+    if (sign_) { flags |= 0x2; }
+    if (carry_) { flags |= 0x4; }
+    if (dma_remaining_steps_ > 0) { flags |= 0x8; }
+
+    const auto is_flag_set = (flags & condition & condition_flags_mask) != 0;
+    return ((condition & condition_set) != 0) ? is_flag_set : !is_flag_set;
+}
+
+} // namespace saturnin::core
@@ -0,0 +1,250 @@
+//
+// scu_dsp.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	scu_dsp.h
+///
+/// \brief	Declares the ScuDsp class, the DSP of the System Control Unit.
+///
+/// Program RAM words are decoded into micro operations when they are written, execution only
+/// dispatches on the decoded fields. The DSP runs in bursts of steps, and catches up with the SH2
+/// when its ports are accessed.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array> // array
+#include <saturnin/src/emulator_defs.h>
+#include <saturnin/src/emulator_modules.h>
+#include <saturnin/src/scu_registers.h>
+
+namespace saturnin::core {
+
+constexpr auto dsp_program_ram_size = u16{256}; ///< Program RAM size, in 32 bits words.
+constexpr auto dsp_data_ram_size    = u8{64};   ///< Data RAM size, in 32 bits words.
+constexpr auto dsp_data_ram_number  = u8{4};    ///< Number of data RAM.
+constexpr auto dsp_burst_steps      = u16{128}; ///< Minimum number of steps executed at once.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   DspCommand
+///
+/// \brief  Kind of a DSP instruction.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class DspCommand : u8 { operation, load_immediate, dma, jump, loop_bottom, loop_start, end, end_interrupt, invalid };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   DspAluOperation
+///
+/// \brief  ALU control of an operation command.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class DspAluOperation : u8 {
+    nop,
+    logical_and,
+    logical_or,
+    logical_xor,
+    add,
+    sub,
+    add_48_bits,
+    shift_right,
+    rotate_right,
+    shift_left,
+    rotate_left,
+    rotate_left_8
+};
+
+enum class DspPLoad : u8 { none, multiplier, data_ram };            ///< X-Bus control of the P register.
+enum class DspALoad : u8 { none, clear, alu, data_ram };            ///< Y-Bus control of the A register.
+enum class DspD1Move : u8 { none, immediate, data_ram, alu_low, alu_high }; ///< D1-Bus source.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct DspMicroOp
+///
+/// \brief  A decoded program RAM word.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct DspMicroOp {
+    DspCommand      command;             ///< Kind of instruction.
+    DspAluOperation alu;                 ///< ALU operation.
+    DspPLoad        p_load;              ///< P register load.
+    DspALoad        a_load;              ///< A register load.
+    DspD1Move       d1_move;             ///< D1-Bus move.
+    bool            is_rx_loaded;        ///< RX is loaded from the X-Bus source.
+    bool            is_ry_loaded;        ///< RY is loaded from the Y-Bus source.
+    bool            is_dma_to_d0;        ///< DMA direction is from the data RAM to the D0-Bus.
+    bool            is_dma_held;         ///< DMA doesn't update its D0-Bus address.
+    bool            is_dma_count_in_ram; ///< DMA transfer count is read from the data RAM.
+    u8              x_source;            ///< Data RAM read by the X-Bus, or holding the DMA count.
+    u8              y_source;            ///< Data RAM read by the Y-Bus.
+    u8              d1_source;           ///< Data RAM read by the D1-Bus.
+    u8              destination;         ///< Destination of the D1-Bus or the immediate, data RAM of the DMA.
+    u8              condition;           ///< Condition of a load or a jump, 0 when unconditional.
+    u8              dma_add;             ///< DMA address add mode.
+    u8              increments;          ///< CTn incremented at the end of the step, bit n for CTn.
+    s32             immediate;           ///< Immediate value, jump target or DMA count.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  ScuDsp
+///
+/// \brief  SCU DSP, executing the program RAM with its own registers and data RAM.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ScuDsp {
+  public:
+    //@{
+    // Constructors / Destructors
+    ScuDsp() = delete;
+    explicit ScuDsp(EmulatorContext* ec);
+    ScuDsp(const ScuDsp&)                      = delete;
+    ScuDsp(ScuDsp&&)                           = delete;
+    auto operator=(const ScuDsp&) & -> ScuDsp& = delete;
+    auto operator=(ScuDsp&&) & -> ScuDsp&      = delete;
+    ~ScuDsp()                                  = default;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void ScuDsp::reset();
+    ///
+    /// \brief  Stops the program and clears the registers. Program and data RAM are kept.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void reset();
+
+    /// \name Ports accessed through the SCU registers
+    //@{
+    auto readProgramControlPort() -> u32;
+    void writeProgramControlPort(const ScuRegs::PpafType& ppaf);
+    void writeProgramRam(const u32 data);
+    void writeDataRamAddress(const ScuRegs::PdaType& pda);
+    auto readDataRam() -> u32;
+    void writeDataRam(const u32 data);
+    //@}
+
+    [[nodiscard]] auto isExecuting() const -> bool { return is_executing_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void ScuDsp::run(const u32 cycles);
+    ///
+    /// \brief  Accounts for the SH2 cycles elapsed. Steps are only executed once they fill a burst.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  cycles  SH2 cycles elapsed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void run(const u32 cycles);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void ScuDsp::synchronize();
+    ///
+    /// \brief  Executes the steps owed for the cycles already elapsed.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void synchronize();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void ScuDsp::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the registers and the memories, micro operations are decoded again
+    ///         once loaded.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
+  private:
+    static auto decode(const u32 instruction) -> DspMicroOp;
+
+    void execute(u32 steps);
+    void step();
+    void executeOperation(const DspMicroOp& op);
+    void executeDma(const DspMicroOp& op);
+    void delayJump(const u8 target);
+    auto computeAlu(const DspAluOperation operation) -> s64;
+    auto readData(const u8 source) const -> u32;
+    void writeDestination(const u8 destination, const u32 value);
+    void applyIncrements(const u8 increments);
+    auto readD0(const u32 address) const -> u32;
+    void writeProgramWord(const u8 address, const u32 data);
+
+    [[nodiscard]] auto isConditionTrue(const u8 condition) const -> bool;
+
+    EmulatorModules modules_;
+
+    std::array<u32, dsp_program_ram_size>                                program_ram_{}; ///< Program RAM.
+    std::array<DspMicroOp, dsp_program_ram_size>                         micro_ops_{};   ///< Decoded program RAM.
+    std::array<std::array<u32, dsp_data_ram_size>, dsp_data_ram_number> data_ram_{};    ///< Data RAM.
+
+    /// \name Registers
+    //@{
+    std::array<u8, dsp_data_ram_number> ct_{};  ///< Data RAM address counters.
+    u32                                 rx_{};  ///< Multiplier X input.
+    u32                                 ry_{};  ///< Multiplier Y input.
+    s64                                 p_{};   ///< Multiplier output, 48 bits sign extended.
+    s64                                 a_{};   ///< Accumulator, 48 bits sign extended.
+    s64                                 alu_{}; ///< ALU output, 48 bits sign extended.
+    u32                                 ra0_{}; ///< DMA read address, in 32 bits words.
+    u32                                 wa0_{}; ///< DMA write address, in 32 bits words.
+    u16                                 lop_{}; ///< Loop counter.
+    u8                                  top_{}; ///< Loop top address.
+    u8                                  pc_{};  ///< Program counter.
+    //@}
+
+    /// \name Flags
+    //@{
+    bool sign_{};
+    bool zero_{};
+    bool carry_{};
+    bool overflow_{};
+    bool is_end_interrupt_{}; ///< Program ended by ENDI, cleared when read.
+    //@}
+
+    bool is_executing_{};        ///< Program is running.
+    bool is_paused_{};           ///< Program is paused.
+    u8   jump_target_{};         ///< Target of the pending jump.
+    u8   jump_delay_{};          ///< Steps before the pending jump is taken, jumps have a delay slot.
+    bool is_step_repeated_{};    ///< The step following a LPS is repeated while LOP isn't 0.
+    u8   repeated_address_{};    ///< Address of the repeated step.
+    u32  dma_remaining_steps_{}; ///< Steps until the running DMA ends, T0 flag is set meanwhile.
+    u8   data_ram_port_bank_{};  ///< Data RAM accessed through the data port.
+    u32  pending_cycles_{};      ///< SH2 cycles elapsed, not executed yet.
+};
+
+} // namespace saturnin::core
@@ -27,6 +27,7 @@
 #include <saturnin/src/log.h>
 #include <saturnin/src/memory.h>
 #include <saturnin/src/scu.h>
+#include <saturnin/src/trace.h> // Trace
 #include <saturnin/src/sh2/sh2.h> // Sh2, Sh2Type
 #include <saturnin/src/sh2/basic_interpreter/sh2_functions_link.h>
 
@@ -37,6 +38,8 @@ namespace saturnin::sh2::basic_interpreter {
 using core::DebugStatus;
 using core::Log;
 using core::Logger;
+using core::Trace;
+using core::TraceEvent;
 
 constexpr u32 sr_bitmask{0x3f3};
 
@@ -1258,26 +1261,26 @@ void BasicInterpreter::rte(Sh2& s) {
         if (s.sh2_type_ == Sh2Type::master) {
             using enum Logger;
             s.modules_.scu()->clearInterruptFlag(s.current_interrupt_);
-            Log::debug(Logger::sh2, "*** Back from interrupt ***");
+            LOG_DEBUG(Logger::sh2, "*** Back from interrupt ***");
             switch (s.current_interrupt_.vector) {
-                case is::vector_v_blank_in: Log::debug(sh2, "VBlank-In interrupt routine finished"); break;
-                case is::vector_v_blank_out: Log::debug(sh2, "VBlank-Out interrupt routine finished"); break;
-                case is::vector_h_blank_in: Log::debug(sh2, "HBlank-In interrupt routine finished"); break;
-                case is::vector_timer_0: Log::debug(sh2, "Timer 0 interrupt routine finished"); break;
-                case is::vector_timer_1: Log::debug(sh2, "Timer 1 interrupt routine finished"); break;
-                case is::vector_dsp_end: Log::debug(sh2, "DSP End interrupt routine finished"); break;
-                case is::vector_sound_request: Log::debug(sh2, "Sound Request interrupt routine finished"); break;
-                case is::vector_system_manager: Log::debug(sh2, "System Manager interrupt routine finished"); break;
-                case is::vector_pad_interrupt: Log::debug(sh2, "Pad interrupt routine finished"); break;
-                case is::vector_level_2_dma_end: Log::debug(sh2, "Level 2 DMA End interrupt routine finished"); break;
-                case is::vector_level_1_dma_end: Log::debug(sh2, "Level 1 DMA End interrupt routine finished"); break;
-                case is::vector_level_0_dma_end: Log::debug(sh2, "Level 0 DMA End interrupt routine finished"); break;
-                case is::vector_dma_illegal: Log::debug(sh2, "DMA Illegal interrupt routine finished"); break;
-                case is::vector_sprite_draw_end: Log::debug(sh2, "Sprite Draw End interrupt routine finished"); break;
+                case is::vector_v_blank_in: LOG_DEBUG(sh2, "VBlank-In interrupt routine finished"); break;
+                case is::vector_v_blank_out: LOG_DEBUG(sh2, "VBlank-Out interrupt routine finished"); break;
+                case is::vector_h_blank_in: LOG_DEBUG(sh2, "HBlank-In interrupt routine finished"); break;
+                case is::vector_timer_0: LOG_DEBUG(sh2, "Timer 0 interrupt routine finished"); break;
+                case is::vector_timer_1: LOG_DEBUG(sh2, "Timer 1 interrupt routine finished"); break;
+                case is::vector_dsp_end: LOG_DEBUG(sh2, "DSP End interrupt routine finished"); break;
+                case is::vector_sound_request: LOG_DEBUG(sh2, "Sound Request interrupt routine finished"); break;
+                case is::vector_system_manager: LOG_DEBUG(sh2, "System Manager interrupt routine finished"); break;
+                case is::vector_pad_interrupt: LOG_DEBUG(sh2, "Pad interrupt routine finished"); break;
+                case is::vector_level_2_dma_end: LOG_DEBUG(sh2, "Level 2 DMA End interrupt routine finished"); break;
+                case is::vector_level_1_dma_end: LOG_DEBUG(sh2, "Level 1 DMA End interrupt routine finished"); break;
+                case is::vector_level_0_dma_end: LOG_DEBUG(sh2, "Level 0 DMA End interrupt routine finished"); break;
+                case is::vector_dma_illegal: LOG_DEBUG(sh2, "DMA Illegal interrupt routine finished"); break;
+                case is::vector_sprite_draw_end: LOG_DEBUG(sh2, "Sprite Draw End interrupt routine finished"); break;
                 default: Log::warning(sh2, "Unknow interrupt vector:{:#0x}", s.current_interrupt_.level);
             }
 
-            Log::debug(sh2, "Level:{:#0x}", s.current_interrupt_.level);
+            LOG_DEBUG(sh2, "Level:{:#0x}", s.current_interrupt_.level);
         }
 
         s.is_interrupted_                                   = false;
@@ -1684,7 +1687,7 @@ void BasicInterpreter::delaySlot(Sh2& s, const u32 addr) {
             Log::error(Logger::sh2, "Illegal instruction slot");
             s.modules_.context()->emulationStatus(core::EmulationStatus::stopped);
         } else {
-            s.modules_.context()->addToTrace(s.pc_);
+            Trace::record(TraceEvent::sh2_delay_slot, s.pc_, static_cast<u8>(s.sh2Type()));
             // Delay slot instruction execution
             is_delay_slot_executing = true;
             execute(s);
@@ -24,10 +24,12 @@
 #include <saturnin/src/emulator_context.h>
 #include <saturnin/src/interrupt_controller.h> //Interrupt
 #include <saturnin/src/interrupt_sources.h>
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/scu.h>
 #include <saturnin/src/sh2/basic_interpreter/sh2_instructions.h>
 #include <saturnin/src/sh2/fast_interpreter/sh2_opcodes.h>
 #include <saturnin/src/sh2/sh2_shared.h>
+#include <saturnin/src/timing.h>
 #include <saturnin/src/utilities.h>
 
 namespace is = saturnin::core::interrupt_source;
@@ -334,7 +336,7 @@ void Sh2::writeRegisters8(u32 addr, u8 data) {
         //////////////
         case cache_control_register:
             using Ccr = Sh2Regs::Cache::Ccr;
-            Log::debug(Logger::sh2, "CCR byte write: {}", data);
+            LOG_DEBUG(Logger::sh2, "CCR byte write: {}", data);
 
             regs_.cache.ccr = data;
             if ((regs_.cache.ccr >> Ccr::cp_enum) == Ccr::CachePurge::cache_purge) {
@@ -835,16 +837,87 @@ void Sh2::powerOnReset() {
         pc_                    = binary_file_start_address_;
         vbr_                   = 0x06000000;
         is_binary_file_loaded_ = false;
+        if (binary_file_stack_address_ != 0) { r_[sp_register_index] = binary_file_stack_address_; }
     }
+    binary_file_stack_address_ = 0; // Only used by the reset following the load.
 
     initializeOnChipRegisters();
 
     callstack_.clear();
 }
 
+template<typename Archive>
+inline void serializeInterrupt(Archive& ar, Interrupt& interrupt) {
+    ar.value(interrupt.vector);
+    ar.value(interrupt.level);
+    ar.value(interrupt.mask);
+    ar.value(interrupt.status);
+    ar.string(interrupt.name);
+}
+
+template<typename Archive>
+void Sh2::serialize(Archive& ar) {
+    ar.bytes(std::span{cache_addresses_});
+    ar.bytes(std::span{cache_data_});
+    ar.bytes(std::span{io_registers_});
+    ar.value(regs_);
+    ar.value(pc_);
+    ar.value(pr_);
+    ar.value(macl_);
+    ar.value(mach_);
+    ar.value(vbr_);
+    ar.value(gbr_);
+    ar.value(r_);
+    ar.value(cycles_elapsed_);
+    ar.value(current_opcode_);
+    ar.value(is_current_opcode_subroutine_call_);
+    ar.value(is_binary_file_loaded_);
+    ar.value(binary_file_start_address_);
+    ar.value(binary_file_stack_address_);
+
+    auto pending_interrupts_number = static_cast<u32>(pending_interrupts_.size());
+    ar.value(pending_interrupts_number);
+    if constexpr (Archive::is_loading) {
+        pending_interrupts_.clear();
+        for (u32 i = 0; (i < pending_interrupts_number) && ar.isValid(); ++i) {
+            serializeInterrupt(ar, pending_interrupts_.emplace_back());
+        }
+    } else {
+        for (auto& interrupt : pending_interrupts_) {
+            serializeInterrupt(ar, interrupt);
+        }
+    }
+    ar.value(is_interrupted_);
+    ar.value(is_level_interrupted_);
+    serializeInterrupt(ar, current_interrupt_);
+
+    ar.value(dmac_next_transfer_priority_);
+
+    ar.value(divu_is_running_);
+    ar.value(divu_opcode_is_stalled_);
+    ar.value(divu_remaining_cycles_);
+    ar.value(divu_quot_);
+    ar.value(divu_rem_);
+
+    ar.value(frt_elapsed_cycles_);
+    ar.value(frt_clock_divisor_);
+    ar.value(frt_mask_);
+    ar.value(frt_current_ocr_);
+
+    ar.value(is_nmi_registered_);
+
+    if constexpr (Archive::is_loading) {
+        std::lock_guard lock(sh2_mutex_);
+        callstack_.clear();
+    }
+}
+
+template void Sh2::serialize(core::StateWriter&);
+template void Sh2::serialize(core::StateReader&);
+
 void Sh2::start32bitsDivision() {
     // 32/32 division
-    Log::debug(Logger::sh2, "32/32 division");
+    LOG_DEBUG(Logger::sh2, "32/32 division");
 
     // divu_opcode_is_stalled_ = false;
 
@@ -867,10 +940,10 @@ void Sh2::start32bitsDivision() {
         divu_quot_ = (s32)dvdnt / (s32)dvsr;
         divu_rem_  = (s32)dvdnt % (s32)dvsr;
         // Log::debug(Logger::sh2, "Quotient : {}, remainder : {}", divu_quot_, divu_rem_);
-        Log::debug(Logger::sh2, "{:#x} / {:#x} -> {:#x}, {:#x}", dvdnt, dvsr, divu_quot_, divu_rem_);
+        LOG_DEBUG(Logger::sh2, "{:#x} / {:#x} -> {:#x}, {:#x}", dvdnt, dvsr, divu_quot_, divu_rem_);
     } else {
         // Log::debug(Logger::sh2, "Overflow detected !");
-        Log::debug(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dvdnt, dvsr);
+        LOG_DEBUG(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dvdnt, dvsr);
         regs_.divu.dvcr.set(Sh2Regs::Divu::Dvcr::ovf);
     }
 
@@ -880,7 +953,7 @@ void Sh2::start32bitsDivision() {
     if (is_dvdnt_ovf && is_dvsr_ovf) {
         if ((divu_quot_ == INT32_MAX) && ((divu_rem_ & sign_bit_32_mask) != 0)) {
             // Log::debug(Logger::sh2, "Overflow detected !");
-            Log::debug(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dvdnt, dvsr);
+            LOG_DEBUG(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dvdnt, dvsr);
             regs_.divu.dvcr.set(Sh2Regs::Divu::Dvcr::ovf);
         }
     }
@@ -895,7 +968,7 @@ void Sh2::start32bitsDivision() {
 }
 
 void Sh2::start64bitsDivision() {
-    Log::debug(Logger::sh2, "64/32 division");
+    LOG_DEBUG(Logger::sh2, "64/32 division");
 
     // divu_opcode_is_stalled_ = false;
 
@@ -915,10 +988,10 @@ void Sh2::start64bitsDivision() {
         quotient  = (s64)dividend / (s32)dvsr;
         remainder = (s64)dividend % (s32)dvsr;
         // Log::debug(Logger::sh2, "Quotient : {}, remainder : {}", quotient, remainder);
-        Log::debug(Logger::sh2, "{:#x} / {:#x} -> {:#x}, {:#x}", dividend, dvsr, (u64)quotient, (u64)remainder);
+        LOG_DEBUG(Logger::sh2, "{:#x} / {:#x} -> {:#x}, {:#x}", dividend, dvsr, (u64)quotient, (u64)remainder);
     } else {
         // Log::debug(Logger::sh2, "Overflow detected !");
-        Log::debug(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dividend, dvsr);
+        LOG_DEBUG(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dividend, dvsr);
         regs_.divu.dvcr.set(Sh2Regs::Divu::Dvcr::ovf);
     }
 
@@ -928,7 +1001,7 @@ void Sh2::start64bitsDivision() {
     if (is_dvdnth_ovf && is_dvsr_ovf) {
         if ((quotient == INT32_MAX) && ((remainder & sign_bit_32_mask) != 0)) {
             // Log::debug(Logger::sh2, "Overflow detected !");
-            Log::debug(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dividend, dvsr);
+            LOG_DEBUG(Logger::sh2, "{:#x} / {:#x} -> Overflow detected !", dividend, dvsr);
             regs_.divu.dvcr.set(Sh2Regs::Divu::Dvcr::ovf);
         }
     }
@@ -950,12 +1023,12 @@ void Sh2::runInterruptController() {
             const auto  interrupt_mask = (regs_.sr >> Sh2Regs::StatusRegister::i_shft);
             const auto& interrupt      = pending_interrupts_.front();
             if ((interrupt.level > interrupt_mask) || interrupt == is::nmi) {
-                Log::debug(Logger::sh2,
-                           "{} SH2 interrupt request {:#0x} {:#0x}, PC={:#0x}",
-                           sh2_type_name_.at(sh2_type_),
-                           interrupt.vector,
-                           interrupt.level,
-                           pc_);
+                LOG_DEBUG(Logger::sh2,
+                          "{} SH2 interrupt request {:#0x} {:#0x}, PC={:#0x}",
+                          sh2_type_name_.at(sh2_type_),
+                          interrupt.vector,
+                          interrupt.level,
+                          pc_);
 
                 is_level_interrupted_[interrupt.level] = false;
 
@@ -974,11 +1047,11 @@ void Sh2::runInterruptController() {
                 if (interrupt != is::nmi) {
                     is_interrupted_    = true; // Entering interrupt mode.
                     current_interrupt_ = interrupt;
-                    Log::debug(Logger::sh2,
-                               "{} SH2 {} interrupt routine started, pc={:#0x}",
-                               sh2_type_name_.at(sh2_type_),
-                               interrupt.name,
-                               pc_);
+                    LOG_DEBUG(Logger::sh2,
+                              "{} SH2 {} interrupt routine started, pc={:#0x}",
+                              sh2_type_name_.at(sh2_type_),
+                              interrupt.name,
+                              pc_);
                 }
                 pc_ = modules_.memory()->read<u32>(interrupt.vector * 4 + vbr_);
 
@@ -995,7 +1068,7 @@ void Sh2::runDivisionUnit(const u8 cycles_to_run) {
         // auto dvcr = DivisionControlRegister(io_registers_[division_control_register & sh2_memory_mask]);
         if ((regs_.divu.dvcr >> Dvcr::ovf_enum) == Dvcr::OverflowFlag::overflow) {
             if ((regs_.divu.dvcr >> Dvcr::ovfie_enum) == Dvcr::InterruptRequestUponOverflow::enabled) {
-                Log::debug(Logger::sh2, "DIVU - Sending division overflow interrupt");
+                LOG_DEBUG(Logger::sh2, "DIVU - Sending division overflow interrupt");
                 is::sh2_division_overflow.vector = static_cast<u8>(regs_.intc.vcrdiv >> Sh2Regs::Intc::Vcrdiv::DIVUV_SHFT);
                 is::sh2_division_overflow.level  = static_cast<u8>(regs_.intc.ipra >> Sh2Regs::Intc::Ipra::DIVU_LEVEL_SHFT);
                 sendInterrupt(is::sh2_division_overflow);
@@ -1038,7 +1111,7 @@ void Sh2::runFreeRunningTimer(const u8 cycles_to_run) {
         if (current_frc > u16_max) {
             regs_.frt.ftcsr.set(Ftcsr::ovf);
             if ((regs_.frt.tier >> Tier::ovie_enum) == Tier::TimerOverflowInterruptEnable::interrupt_request_enabled) {
-                Log::debug(Logger::sh2, "FRT - Sending overflow interrupt");
+                LOG_DEBUG(Logger::sh2, "FRT - Sending overflow interrupt");
                 is::sh2_frt_overflow_flag_set.vector = static_cast<u8>(regs_.intc.vcrd >> Vcrd::FOVV_SHFT);
                 is::sh2_frt_overflow_flag_set.level  = static_cast<u8>(regs_.intc.iprb >> Iprb::FRT_LEVEL_SHFT);
                 sendInterrupt(is::sh2_frt_overflow_flag_set);
@@ -1050,7 +1123,7 @@ void Sh2::runFreeRunningTimer(const u8 cycles_to_run) {
         if ((old_frc <= ocra) && (current_frc > ocra)) {
             regs_.frt.ftcsr.set(Ftcsr::ocfa);
             if ((regs_.frt.tier >> Tier::ociae_enum) == Tier::OutputCompareInterruptAEnable::interrupt_request_enabled) {
-                Log::debug(Logger::sh2, "FRT - OCRA match");
+                LOG_DEBUG(Logger::sh2, "FRT - OCRA match");
                 is::sh2_frt_output_compare_flag_a_set.vector = static_cast<u8>(regs_.intc.vcrc >> Vcrc::FOCV_SHFT);
                 is::sh2_frt_output_compare_flag_a_set.level  = static_cast<u8>(regs_.intc.iprb >> Iprb::FRT_LEVEL_SHFT);
                 sendInterrupt(is::sh2_frt_output_compare_flag_a_set);
@@ -1063,7 +1136,7 @@ void Sh2::runFreeRunningTimer(const u8 cycles_to_run) {
         if ((old_frc <= ocrb) && (current_frc > ocrb)) {
             regs_.frt.ftcsr.set(Ftcsr::ocfb);
             if ((regs_.frt.tier >> Tier::ocibe_enum) == Tier::OutputCompareInterruptBEnable::interrupt_request_enabled) {
-                Log::debug(Logger::sh2, "FRT - OCRB match");
+                LOG_DEBUG(Logger::sh2, "FRT - OCRB match");
                 is::sh2_frt_output_compare_flag_b_set.vector = static_cast<u8>(regs_.intc.vcrc >> Vcrc::FOCV_SHFT);
                 is::sh2_frt_output_compare_flag_b_set.level  = static_cast<u8>(regs_.intc.iprb >> Iprb::FRT_LEVEL_SHFT);
                 sendInterrupt(is::sh2_frt_output_compare_flag_b_set);
@@ -1171,19 +1244,19 @@ void Sh2::executeDmaOnChannel(Sh2DmaConfiguration& conf) {
                 case dreq: {
                     // External request is immediately executed without waiting for an external signal.
                     // Not sure how to implement this, could be interesting to check on the console ...
-                    Log::debug(Logger::sh2, "DMAC ({}) - Channel {} external request for {} SH2", sh2_type, channel_number);
+                    LOG_DEBUG(Logger::sh2, "DMAC ({}) - Channel {} external request for {} SH2", sh2_type, channel_number);
                     break;
                 }
                 case txi: {
-                    Log::unimplemented("SH2 DMAC - Channel {} SCI transmit request for {} SH2 not implemented !",
-                                       channel_number,
-                                       sh2_type);
+                    LOG_UNIMPLEMENTED("SH2 DMAC - Channel {} SCI transmit request for {} SH2 not implemented !",
+                                      channel_number,
+                                      sh2_type);
                     return;
                 }
                 case rxi: {
-                    Log::unimplemented("SH2 DMAC - Channel {} SCI receive request for {} SH2 not implemented !",
-                                       channel_number,
-                                       sh2_type);
+                    LOG_UNIMPLEMENTED("SH2 DMAC - Channel {} SCI receive request for {} SH2 not implemented !",
+                                      channel_number,
+                                      sh2_type);
                     return;
                 }
                 default: {
@@ -1195,22 +1268,39 @@ void Sh2::executeDmaOnChannel(Sh2DmaConfiguration& conf) {
                 }
             }
         } else {
-            Log::debug(Logger::sh2, "DMAC ({}) - Channel {} auto request", sh2_type, channel_number);
+            LOG_DEBUG(Logger::sh2, "DMAC ({}) - Channel {} auto request", sh2_type, channel_number);
         }
         auto counter     = u32{conf.counter};
         auto source      = u32{conf.source};
         auto destination = u32{conf.destination};
-        Log::debug(Logger::sh2, "DMAC ({}) - Channel {} transfer", sh2_type, channel_number);
-        Log::debug(Logger::sh2, "PC={:#0x}", pc_);
-        Log::debug(Logger::sh2, "Source:{:#0x}", source);
-        Log::debug(Logger::sh2, "Destination:{:#0x}", destination);
-        Log::debug(Logger::sh2, "Count:{:#0x}", counter);
+        LOG_DEBUG(Logger::sh2, "DMAC ({}) - Channel {} transfer", sh2_type, channel_number);
+        LOG_DEBUG(Logger::sh2, "PC={:#0x}", pc_);
+        LOG_DEBUG(Logger::sh2, "Source:{:#0x}", source);
+        LOG_DEBUG(Logger::sh2, "Destination:{:#0x}", destination);
+        LOG_DEBUG(Logger::sh2, "Count:{:#0x}", counter);
 
         constexpr auto transfer_byte_size_1  = u8{0x1};
         constexpr auto transfer_byte_size_2  = u8{0x2};
         constexpr auto transfer_byte_size_4  = u8{0x4};
         constexpr auto transfer_byte_size_16 = u8{0x10};
 
+        // Word reads of the CD block data transfer register to incremented addresses are copied as a single block.
+        if (((conf.chcr >> Chcr::sm_enum) == Chcr::SourceAddressMode::fixed)
+            && ((conf.chcr >> Chcr::dm_enum) == Chcr::DestinationAddressMode::incremented)) {
+            auto unit_size = u8{};
+            switch (conf.chcr >> Chcr::ts_enum) {
+                using enum Chcr::TransferSize;
+                case two_byte_unit: unit_size = transfer_byte_size_2; break;
+                case four_byte_unit: unit_size = transfer_byte_size_4; break;
+                default: break;
+            }
+            if ((unit_size != 0) && modules_.memory()->transferFromCdBlock(source, destination, counter * unit_size)) {
+                LOG_DEBUG(Logger::sh2, "DMAC ({}) - Channel {} CD block transfer", sh2_type, channel_number);
+                destination += counter * unit_size;
+                counter = 0;
+            }
+        }
+
         while (counter > 0) {
             auto transfer_size = u8{};
             switch (conf.chcr >> Chcr::ts_enum) {
@@ -1278,7 +1368,7 @@ void Sh2::executeDmaOnChannel(Sh2DmaConfiguration& conf) {
 
         // if (toEnum<Sh2DmaInterruptEnable>(conf.chcr.interrupt_enable) == Sh2DmaInterruptEnable::enabled) {
         if ((conf.chcr >> Chcr::ie_enum) == Chcr::Sh2DmaInterruptEnable::enabled) {
-            Log::debug(Logger::sh2, "DMAC ({}) - Sending DMA channel {} transfer end interrupt.", sh2_type, channel_number);
+            LOG_DEBUG(Logger::sh2, "DMAC ({}) - Sending DMA channel {} transfer end interrupt.", sh2_type, channel_number);
             conf.interrupt.level = static_cast<u8>(regs_.intc.ipra >> Sh2Regs::Intc::Ipra::DMAC_LEVEL_SHFT);
             sendInterrupt(conf.interrupt);
         }
@@ -1304,11 +1394,11 @@ void Sh2::sendInterrupt(const core::Interrupt& i) { // NOLINT(readability-conver
                 pending_interrupts_.sort();
                 pending_interrupts_.reverse();
 
-                Log::debug(Logger::sh2, "{} SH2 interrupt pending : {:#0x}", sh2_type_name_.at(sh2_type_), i.vector);
+                LOG_DEBUG(Logger::sh2, "{} SH2 interrupt pending : {:#0x}", sh2_type_name_.at(sh2_type_), i.vector);
             }
         } else {
             // Max number of pending interrupts reached, nothing is added
-            Log::debug(Logger::sh2, "Maximum number of pending interrupts reached");
+            LOG_DEBUG(Logger::sh2, "Maximum number of pending interrupts reached");
 
             // When the interrupt is NMI, the lower priority interrupt is removed
             if (i.vector == is::vector_nmi) {
@@ -1319,7 +1409,7 @@ void Sh2::sendInterrupt(const core::Interrupt& i) { // NOLINT(readability-conver
                 pending_interrupts_.sort();
                 pending_interrupts_.reverse();
 
-                Log::debug(Logger::sh2, "NMI interrupt forced");
+                LOG_DEBUG(Logger::sh2, "NMI interrupt forced");
             }
         }
     }
@@ -1341,10 +1431,13 @@ void Sh2::sendInterruptCaptureSignal() {
 }
 
 auto Sh2::run() -> u8 {
+    TIMING_ZONE((sh2_type_ == Sh2Type::master) ? core::TimingZone::master_sh2_run : core::TimingZone::slave_sh2_run);
     modules_.memory()->sh2_in_operation_ = sh2_type_;
     runInterruptController();
-    current_opcode_ = modules_.memory()->read<u16>(pc_);
+    const auto current_pc = pc_;
+    current_opcode_       = modules_.memory()->read<u16>(pc_);
     execute(*this);
+    if constexpr (is_profiler_compiled) { profiler_.onInstructionEnd(current_pc, pc_, cycles_elapsed_); }
 
     // runDivisionUnit(cycles_elapsed_);
     runFreeRunningTimer(cycles_elapsed_);
@@ -1385,12 +1478,14 @@ void Sh2::addToCallstack(const u32 call_addr, const u32 return_addr) {
     std::lock_guard lock(sh2_mutex_);
     callstack_.emplace_back(call_addr, return_addr);
     isCurrentOpcodeSubroutineCall(true);
+    if constexpr (is_profiler_compiled) { profiler_.onCall(); }
     modules_.context()->updateDebugStatus(core::DebugPosition::on_subroutine_call, sh2_type_);
 }
 
 void Sh2::popFromCallstack() {
     std::lock_guard lock(sh2_mutex_);
     callstack_.pop_back();
+    if constexpr (is_profiler_compiled) { profiler_.onReturn(); }
 };
 
 auto Sh2::callstack() -> std::vector<CallstackItem> {
@@ -1401,8 +1496,11 @@ auto Sh2::callstack() -> std::vector<CallstackItem> {
 void Sh2::setBinaryFileStartAddress(const u32 val) {
     is_binary_file_loaded_     = true;
     binary_file_start_address_ = val;
+    binary_file_stack_address_ = 0;
 }
 
+void Sh2::setBinaryFileStackAddress(const u32 val) { binary_file_stack_address_ = val; }
+
 auto Sh2::disasm(const u32 pc, const u16 opcode) -> std::string { return opcodes_disasm_lut_[opcode](pc, opcode); }
 
 void Sh2::initializeDisasmLut() {
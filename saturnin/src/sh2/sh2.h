@@ -37,6 +37,7 @@
 #include <saturnin/src/sh2/fast_interpreter/sh2_opcodes.h>
 #include <saturnin/src/sh2/basic_interpreter/sh2_instructions.h>
 #include <saturnin/src/sh2/sh2_disasm_link.h>
+#include <saturnin/src/sh2/sh2_profiler.h>
 
 // Forward declarations
 // namespace saturnin::core {
@@ -487,6 +488,35 @@ class Sh2 {
 
     [[nodiscard]] auto callstack() -> std::vector<CallstackItem>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Sh2::profiler() -> Sh2Profiler&
+    ///
+    /// \brief  Returns the hot spot profiler of the CPU.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    A reference to the profiler.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto profiler() -> Sh2Profiler& { return profiler_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Sh2::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the state of the CPU, its cache and its on chip modules (DMAC, DIVU,
+    ///         FRT). Debugger data isn't part of the state, the callstack is cleared on restore.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
     ///@{
     /// Accessors
     void               breakpoint(const u8 index, const u32 addr) { breakpoints_[index] = addr; };
@@ -501,7 +531,8 @@ class Sh2 {
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Sh2::setBinaryFileStartAddress(const u32 val);
     ///
-    /// \brief  Sets the start address of the binary file.
+    /// \brief  Sets the start address of the binary file. The stack address set by a previous load is
+    ///         cleared.
     ///
     /// \author Runik
     /// \date   12/08/2021
@@ -511,6 +542,19 @@ class Sh2 {
 
     void setBinaryFileStartAddress(const u32 val);
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Sh2::setBinaryFileStackAddress(const u32 val);
+    ///
+    /// \brief  Sets the stack pointer used when the binary file starts, after its start address.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  val The stack address.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setBinaryFileStackAddress(const u32 val);
+
     static void initializeDisasmLut();
 
     static auto disasm(u32 pc, u16 opcode) -> std::string;
@@ -784,6 +828,7 @@ class Sh2 {
 
     bool is_binary_file_loaded_{false}; ///< True if a binary file has been loaded.
     u32  binary_file_start_address_{};  ///< Start address of the binary file if any.
+    u32  binary_file_stack_address_{};  ///< Stack pointer of the binary file, 0 to keep the reset one.
 
     std::mutex sh2_mutex_; ///< Handles class data when accessed from another thread.
 
@@ -822,6 +867,7 @@ class Sh2 {
     std::vector<CallstackItem>          callstack_;            ///< Callstack of the processor
     u32                                 debug_return_address_; ///< The debug return address used with step_over / step_out.
     std::array<u32, breakpoints_number> breakpoints_;          ///< Breakpoints on current CPU program counter.
+    Sh2Profiler                         profiler_;             ///< Hot spot profiler.
 
     bool is_nmi_registered_{false}; ///< True if a Non Maskable Interrupt is registered
 
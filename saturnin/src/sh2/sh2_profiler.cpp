@@ -0,0 +1,379 @@
+//
+// sh2_profiler.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/sh2/sh2_profiler.h>
+#include <algorithm> // sort
+#include <array>     // array
+#include <fstream>   // ifstream, ofstream
+#include <iterator>  // istreambuf_iterator
+#include <sstream>   // istringstream
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>
+#include <saturnin/src/utilities.h> // format
+
+namespace saturnin::sh2 {
+
+namespace uti = saturnin::utilities;
+
+using core::Log;
+using core::Logger;
+using core::tr;
+
+// Reads a value from a file image, in the endianness of the file. Out of bounds reads return 0.
+template<typename T>
+inline auto readImage(const std::vector<u8>& data, const std::size_t offset, const bool is_big_endian) -> T {
+    if (offset + sizeof(T) > data.size()) { return T{}; }
+    auto value = u32{};
+    for (auto i = std::size_t{}; i < sizeof(T); ++i) {
+        const auto byte = u32{data[offset + (is_big_endian ? i : sizeof(T) - 1 - i)]};
+        value           = (value << 8) | byte;
+    }
+    return static_cast<T>(value);
+}
+
+// Reads a null terminated string from a file image.
+inline auto readImageString(const std::vector<u8>& data, const std::size_t offset, const std::size_t max_size) -> std::string {
+    auto str = std::string{};
+    for (auto i = offset; i < data.size() && i < offset + max_size && data[i] != 0; ++i) {
+        str.push_back(static_cast<char>(data[i]));
+    }
+    return str;
+}
+
+auto SymbolMap::load(const std::string& path) -> bool {
+    auto file = std::ifstream(path, std::ios::binary);
+    if (!file) {
+        Log::warning(Logger::sh2, tr("Could not open symbols file {}"), path);
+        return false;
+    }
+    const auto data = std::vector<u8>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+
+    constexpr auto elf_magic        = std::array<u8, 4>{0x7F, 'E', 'L', 'F'};
+    constexpr auto coff_sh_magic_be = u16{0x0500};
+    constexpr auto coff_sh_magic_le = u16{0x0550};
+
+    const auto previous_size = symbols_.size();
+    auto       is_loaded     = false;
+    if (data.size() >= elf_magic.size() && std::equal(elf_magic.begin(), elf_magic.end(), data.begin())) {
+        is_loaded = loadElf(data);
+    } else if (const auto magic = readImage<u16>(data, 0, true); magic == coff_sh_magic_be || magic == coff_sh_magic_le) {
+        is_loaded = loadCoff(data);
+    } else {
+        is_loaded = loadText(data);
+    }
+
+    if (!is_loaded || symbols_.size() == previous_size) {
+        Log::warning(Logger::sh2, tr("No symbol found in {}"), path);
+        return false;
+    }
+    Log::info(Logger::sh2, tr("{} symbol(s) loaded from {}"), symbols_.size() - previous_size, path);
+    return true;
+}
+
+auto SymbolMap::loadText(const std::vector<u8>& data) -> bool {
+    auto stream = std::istringstream(std::string(data.begin(), data.end()));
+    auto line   = std::string{};
+    while (std::getline(stream, line)) {
+        if (const auto comment = line.find_first_of("#;"); comment != std::string::npos) { line.erase(comment); }
+
+        auto line_stream = std::istringstream(line);
+        auto address     = std::string{};
+        auto name        = std::string{};
+        if (!(line_stream >> address >> name)) { continue; }
+        try {
+            symbols_[static_cast<u32>(std::stoul(address, nullptr, 16))] = name;
+        } catch (const std::exception&) { continue; }
+    }
+    return true;
+}
+
+auto SymbolMap::loadElf(const std::vector<u8>& data) -> bool {
+    constexpr auto ei_class_offset       = std::size_t{4};
+    constexpr auto ei_data_offset        = std::size_t{5};
+    constexpr auto elf_class_32          = u8{1};
+    constexpr auto elf_data_big_endian   = u8{2};
+    constexpr auto e_shoff_offset        = std::size_t{0x20};
+    constexpr auto e_shentsize_offset    = std::size_t{0x2E};
+    constexpr auto e_shnum_offset        = std::size_t{0x30};
+    constexpr auto sh_type_offset        = std::size_t{0x04};
+    constexpr auto sh_offset_offset      = std::size_t{0x10};
+    constexpr auto sh_size_offset        = std::size_t{0x14};
+    constexpr auto sh_link_offset        = std::size_t{0x18};
+    constexpr auto sht_symtab            = u32{2};
+    constexpr auto symbol_size           = std::size_t{0x10};
+    constexpr auto st_value_offset       = std::size_t{0x04};
+    constexpr auto st_info_offset        = std::size_t{0x0C};
+    constexpr auto st_shndx_offset       = std::size_t{0x0E};
+    constexpr auto stt_notype            = u8{0};
+    constexpr auto stt_func              = u8{2};
+    constexpr auto max_symbol_name_size  = std::size_t{0x200};
+
+    if (data.size() <= ei_data_offset || data[ei_class_offset] != elf_class_32) {
+        Log::warning(Logger::sh2, tr("Only 32 bits ELF files are supported"));
+        return false;
+    }
+    const auto is_be       = (data[ei_data_offset] == elf_data_big_endian);
+    const auto shoff       = std::size_t{readImage<u32>(data, e_shoff_offset, is_be)};
+    const auto shentsize   = std::size_t{readImage<u16>(data, e_shentsize_offset, is_be)};
+    const auto shnum       = std::size_t{readImage<u16>(data, e_shnum_offset, is_be)};
+    const auto sectionData = [&](const std::size_t index, const std::size_t field) {
+        return std::size_t{readImage<u32>(data, shoff + index * shentsize + field, is_be)};
+    };
+
+    for (auto i = std::size_t{}; i < shnum; ++i) {
+        if (sectionData(i, sh_type_offset) != sht_symtab) { continue; }
+        const auto symtab_offset = sectionData(i, sh_offset_offset);
+        const auto symtab_size   = sectionData(i, sh_size_offset);
+        const auto strtab_offset = sectionData(sectionData(i, sh_link_offset), sh_offset_offset);
+        for (auto s = symtab_offset; s + symbol_size <= symtab_offset + symtab_size && s + symbol_size <= data.size();
+             s += symbol_size) {
+            const auto type = static_cast<u8>(data[s + st_info_offset] & 0xF);
+            if ((type != stt_func && type != stt_notype) || readImage<u16>(data, s + st_shndx_offset, is_be) == 0) { continue; }
+
+            auto name = readImageString(data, strtab_offset + readImage<u32>(data, s, is_be), max_symbol_name_size);
+            if (name.empty()) { continue; }
+            symbols_[readImage<u32>(data, s + st_value_offset, is_be)] = std::move(name);
+        }
+    }
+    return true;
+}
+
+auto SymbolMap::loadCoff(const std::vector<u8>& data) -> bool {
+    constexpr auto coff_sh_magic_be   = u16{0x0500};
+    constexpr auto f_symptr_offset    = std::size_t{0x08};
+    constexpr auto f_nsyms_offset     = std::size_t{0x0C};
+    constexpr auto symbol_size        = std::size_t{18};
+    constexpr auto short_name_size    = std::size_t{8};
+    constexpr auto n_value_offset     = std::size_t{0x08};
+    constexpr auto n_scnum_offset     = std::size_t{0x0C};
+    constexpr auto n_type_offset      = std::size_t{0x0E};
+    constexpr auto n_sclass_offset    = std::size_t{0x10};
+    constexpr auto n_numaux_offset    = std::size_t{0x11};
+    constexpr auto c_ext              = u8{2};
+    constexpr auto c_stat             = u8{3};
+    constexpr auto function_type_mask = u16{0x30};
+    constexpr auto function_type      = u16{0x20};
+    constexpr auto max_long_name_size = std::size_t{0x200};
+
+    const auto is_be         = (readImage<u16>(data, 0, true) == coff_sh_magic_be);
+    const auto symptr        = std::size_t{readImage<u32>(data, f_symptr_offset, is_be)};
+    const auto nsyms         = std::size_t{readImage<u32>(data, f_nsyms_offset, is_be)};
+    const auto string_offset = symptr + nsyms * symbol_size;
+
+    for (auto i = std::size_t{}; i < nsyms; ++i) {
+        const auto s = symptr + i * symbol_size;
+        if (s + symbol_size > data.size()) { break; }
+
+        const auto scnum   = static_cast<s16>(readImage<u16>(data, s + n_scnum_offset, is_be));
+        const auto type    = readImage<u16>(data, s + n_type_offset, is_be);
+        const auto sclass  = data[s + n_sclass_offset];
+        const auto is_kept = (scnum > 0) && (sclass == c_ext || (sclass == c_stat && (type & function_type_mask) == function_type));
+        if (is_kept) {
+            // Names longer than 8 characters are stored in the string table, the first 4 bytes being 0.
+            auto name = (readImage<u32>(data, s, is_be) == 0)
+                            ? readImageString(data, string_offset + readImage<u32>(data, s + 4, is_be), max_long_name_size)
+                            : readImageString(data, s, short_name_size);
+            if (!name.empty()) { symbols_[readImage<u32>(data, s + n_value_offset, is_be)] = std::move(name); }
+        }
+        i += data[s + n_numaux_offset];
+    }
+    return true;
+}
+
+auto SymbolMap::name(const u32 address) const -> std::string {
+    auto it = symbols_.upper_bound(address);
+    if (it == symbols_.begin()) { return uti::format("{:#010x}", address); }
+    return std::prev(it)->second;
+}
+
+auto SymbolMap::address(const u32 address) const -> u32 {
+    auto it = symbols_.upper_bound(address);
+    if (it == symbols_.begin()) { return address; }
+    return std::prev(it)->first;
+}
+
+void Sh2Profiler::onFlowChange(const u32 next_pc) {
+    flushFunctionCycles();
+    if (is_call_pending_) {
+        if (stack_.size() == profiler_max_stack_depth) { stack_.erase(stack_.begin()); }
+        stack_.push_back(next_pc);
+    } else if (!stack_.empty()) {
+        stack_.pop_back();
+    }
+    is_call_pending_   = false;
+    is_return_pending_ = false;
+
+    if (are_blocks_counted_.load(std::memory_order_relaxed)) { countBlock(next_pc); }
+}
+
+void Sh2Profiler::countBlock(const u32 address) {
+    auto lock = std::scoped_lock(mutex_);
+    ++block_entries_[address];
+}
+
+void Sh2Profiler::sample(const u32 pc) {
+    sampling_countdown_ += sampling_period_.load(std::memory_order_relaxed);
+    flushFunctionCycles();
+
+    auto stack = stack_;
+    stack.push_back(pc);
+    auto lock = std::scoped_lock(mutex_);
+    ++samples_[stack];
+    ++samples_count_;
+}
+
+void Sh2Profiler::flushFunctionCycles() {
+    if (are_function_cycles_counted_.load(std::memory_order_relaxed) && current_function_cycles_ != 0) {
+        auto lock = std::scoped_lock(mutex_);
+        function_cycles_[stack_.empty() ? root_frame : stack_.back()] += current_function_cycles_;
+    }
+    current_function_cycles_ = 0;
+}
+
+void Sh2Profiler::applyReset() {
+    is_reset_requested_ = false;
+    stack_.clear();
+    is_call_pending_         = false;
+    is_return_pending_       = false;
+    current_function_cycles_ = 0;
+    sampling_countdown_      = sampling_period_;
+
+    auto lock = std::scoped_lock(mutex_);
+    samples_.clear();
+    function_cycles_.clear();
+    block_entries_.clear();
+    samples_count_ = 0;
+}
+
+auto Sh2Profiler::frameName(const u32 address) const -> std::string {
+    return (address == root_frame) ? std::string{"[root]"} : symbols_.name(address);
+}
+
+auto Sh2Profiler::functions() -> std::vector<ProfiledFunction> {
+    auto by_name = std::map<std::string, ProfiledFunction>{};
+    auto lock    = std::scoped_lock(mutex_);
+    for (const auto& [address, cycles] : function_cycles_) {
+        auto& f = by_name[frameName(address)];
+        f.address     = (address == root_frame) ? address : symbols_.address(address);
+        f.self_cycles += cycles;
+    }
+
+    // Samples are accounted to the function containing the PC when symbols are available, to the calling frame
+    // otherwise.
+    const auto is_symbolized = (symbols_.size() != 0);
+    for (const auto& [stack, count] : samples_) {
+        const auto frame = is_symbolized ? symbols_.address(stack.back()) : ((stack.size() > 1) ? stack[stack.size() - 2] : root_frame);
+        auto&      f     = by_name[frameName(frame)];
+        f.address        = frame;
+        f.samples += count;
+    }
+
+    auto list = std::vector<ProfiledFunction>{};
+    list.reserve(by_name.size());
+    for (auto& [name, f] : by_name) {
+        f.name = name;
+        list.push_back(std::move(f));
+    }
+    std::ranges::sort(list, [](const ProfiledFunction& a, const ProfiledFunction& b) {
+        return (a.self_cycles != b.self_cycles) ? a.self_cycles > b.self_cycles : a.samples > b.samples;
+    });
+    return list;
+}
+
+auto Sh2Profiler::samplesCount() -> u64 {
+    auto lock = std::scoped_lock(mutex_);
+    return samples_count_;
+}
+
+auto Sh2Profiler::exportCollapsedStacks(const std::string& path) -> bool {
+    auto out = std::ofstream(path, std::ios::trunc);
+    if (!out) {
+        Log::warning(Logger::sh2, tr("Could not open profiler output {}"), path);
+        return false;
+    }
+
+    // Stacks are named after symbolization, different stacks can end up with the same name.
+    auto collapsed = std::map<std::string, u64>{};
+    {
+        auto lock = std::scoped_lock(mutex_);
+        for (const auto& [stack, count] : samples_) {
+            auto line = std::string{};
+            for (const auto address : stack) {
+                if (!line.empty()) { line += ';'; }
+                line += symbols_.name(address);
+            }
+            collapsed[line] += count;
+        }
+    }
+    for (const auto& [line, count] : collapsed) {
+        out << line << ' ' << count << '\n';
+    }
+
+    Log::info(Logger::sh2, tr("Collapsed stacks written to {}"), path);
+    return true;
+}
+
+auto Sh2Profiler::exportFunctions(const std::string& path) -> bool {
+    auto out = std::ofstream(path, std::ios::trunc);
+    if (!out) {
+        Log::warning(Logger::sh2, tr("Could not open profiler output {}"), path);
+        return false;
+    }
+
+    const auto list         = functions();
+    auto       total_cycles = u64{};
+    auto       total_samples = u64{};
+    for (const auto& f : list) {
+        total_cycles += f.self_cycles;
+        total_samples += f.samples;
+    }
+    const auto percent = [](const u64 value, const u64 total) {
+        return (total != 0) ? static_cast<double>(value) * 100.0 / static_cast<double>(total) : 0.0;
+    };
+
+    out << "function,address,self_cycles,self_cycles_percent,samples,samples_percent\n";
+    for (const auto& f : list) {
+        out << uti::format("{},{:#010x},{},{:.2f},{},{:.2f}\n",
+                           f.name,
+                           f.address,
+                           f.self_cycles,
+                           percent(f.self_cycles, total_cycles),
+                           f.samples,
+                           percent(f.samples, total_samples));
+    }
+
+    auto blocks = std::vector<std::pair<u32, u64>>{};
+    {
+        auto lock = std::scoped_lock(mutex_);
+        blocks.assign(block_entries_.begin(), block_entries_.end());
+    }
+    if (!blocks.empty()) {
+        std::ranges::sort(blocks, [](const auto& a, const auto& b) { return a.second > b.second; });
+        out << "\nblock,function,entries\n";
+        for (const auto& [address, entries] : blocks) {
+            out << uti::format("{:#010x},{},{}\n", address, symbols_.name(address), entries);
+        }
+    }
+
+    Log::info(Logger::sh2, tr("Functions table written to {}"), path);
+    return true;
+}
+
+} // namespace saturnin::sh2
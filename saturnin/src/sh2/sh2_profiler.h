@@ -0,0 +1,291 @@
+//
+// sh2_profiler.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	sh2_profiler.h
+///
+/// \brief	Declares the SH2 hot spot profiler and the symbol maps used to name its results.
+///
+/// The profiler is fed by hooks called by the SH2 whatever the core used : Sh2::run() reports
+/// every executed instruction, Sh2::addToCallstack() and Sh2::popFromCallstack() report calls and
+/// returns. A core executing whole blocks reports the block with a single onInstructionEnd() call.
+/// Hooks are compiled out when SATURNIN_SH2_PROFILER is 0.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>        // atomic
+#include <map>           // map
+#include <mutex>         // mutex
+#include <string>        // string
+#include <unordered_map> // unordered_map
+#include <vector>        // vector
+#include <saturnin/src/emulator_defs.h>
+
+// Compiles the profiler hooks in the SH2 cores. Release builds define it to 0.
+#ifndef SATURNIN_SH2_PROFILER
+    #define SATURNIN_SH2_PROFILER 1
+#endif
+
+namespace saturnin::sh2 {
+
+constexpr auto is_profiler_compiled     = bool{SATURNIN_SH2_PROFILER != 0};
+constexpr auto default_sampling_period  = u32{1000}; ///< Cycles between 2 PC samples.
+constexpr auto profiler_max_stack_depth = std::size_t{256};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  SymbolMap
+///
+/// \brief  Links program addresses to names. Loads ELF and COFF symbol tables, or text files made
+///         of "<address in hex> <name>" lines.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class SymbolMap {
+  public:
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SymbolMap::load(const std::string& path) -> bool;
+    ///
+    /// \brief  Loads symbols from a file, its format being detected from its content. Symbols are
+    ///         added to the ones already loaded.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the file.
+    ///
+    /// \returns    False if the file couldn't be read or contains no symbol.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto load(const std::string& path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SymbolMap::name(const u32 address) const -> std::string;
+    ///
+    /// \brief  Returns the name of the symbol containing the address, which is the closest symbol at
+    ///         or before it. The address in hex is returned when there's no such symbol.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  address The address.
+    ///
+    /// \returns    The symbol name.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto name(const u32 address) const -> std::string;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SymbolMap::address(const u32 address) const -> u32;
+    ///
+    /// \brief  Returns the address of the symbol containing the address, or the address itself when
+    ///         there's no such symbol.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  address The address.
+    ///
+    /// \returns    The symbol address.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto address(const u32 address) const -> u32;
+
+    [[nodiscard]] auto size() const -> std::size_t { return symbols_.size(); }
+
+  private:
+    auto loadText(const std::vector<u8>& data) -> bool;
+    auto loadElf(const std::vector<u8>& data) -> bool;
+    auto loadCoff(const std::vector<u8>& data) -> bool;
+
+    std::map<u32, std::string> symbols_; ///< Symbols names by address.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct ProfiledFunction
+///
+/// \brief  Profiling results of a function.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ProfiledFunction {
+    std::string name;        ///< Symbol name, or address when not symbolized.
+    u32         address;     ///< Function address.
+    u64         self_cycles; ///< Cycles spent in the function, callees excluded.
+    u64         samples;     ///< PC samples taken in the function.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Sh2Profiler
+///
+/// \brief  Samples the PC every given number of cycles, with the calls stack followed by the
+///         profiler, and optionally counts basic blocks entries and cycles by function.
+///
+/// Hooks run on the emulation thread. Results are kept under a mutex taken on calls, returns, blocks
+/// entries and samples, the per instruction work being limited to a few counters.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Sh2Profiler {
+  public:
+    ///@{
+    /// Hooks, shared by the SH2 cores.
+    void onCall() { is_call_pending_ = true; }
+    void onReturn() { is_return_pending_ = true; }
+
+    void onInstructionEnd(const u32 pc, const u32 next_pc, const u8 cycles) {
+        if (!is_enabled_.load(std::memory_order_relaxed)) { return; }
+        if (is_reset_requested_.load(std::memory_order_relaxed)) { applyReset(); }
+
+        current_function_cycles_ += cycles;
+        if (is_call_pending_ || is_return_pending_) {
+            onFlowChange(next_pc);
+        } else if (next_pc != pc + instruction_size && are_blocks_counted_.load(std::memory_order_relaxed)) {
+            countBlock(next_pc);
+        }
+
+        sampling_countdown_ -= cycles;
+        if (sampling_countdown_ <= 0) { sample(next_pc); }
+    }
+    ///@}
+
+    ///@{
+    /// Settings, changed from the GUI thread.
+    void isEnabled(const bool enabled) { is_enabled_ = enabled; }
+    [[nodiscard]] auto isEnabled() const -> bool { return is_enabled_; }
+    void areBlocksCounted(const bool counted) { are_blocks_counted_ = counted; }
+    [[nodiscard]] auto areBlocksCounted() const -> bool { return are_blocks_counted_; }
+    void areFunctionCyclesCounted(const bool counted) { are_function_cycles_counted_ = counted; }
+    [[nodiscard]] auto areFunctionCyclesCounted() const -> bool { return are_function_cycles_counted_; }
+    void samplingPeriod(const u32 cycles) { sampling_period_ = (cycles != 0) ? cycles : default_sampling_period; }
+    [[nodiscard]] auto samplingPeriod() const -> u32 { return sampling_period_; }
+    void reset() { is_reset_requested_ = true; }
+    ///@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Sh2Profiler::symbols() -> SymbolMap&;
+    ///
+    /// \brief  Symbols used to name the results. Must be loaded while the profiler is disabled.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The symbol map.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto symbols() -> SymbolMap& { return symbols_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Sh2Profiler::functions() -> std::vector<ProfiledFunction>;
+    ///
+    /// \brief  Returns the results by function, sorted by decreasing self cycles, then samples.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The functions list.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto functions() -> std::vector<ProfiledFunction>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Sh2Profiler::samplesCount() -> u64;
+    ///
+    /// \brief  Returns the number of samples taken.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The samples count.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto samplesCount() -> u64;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Sh2Profiler::exportCollapsedStacks(const std::string& path) -> bool;
+    ///
+    /// \brief  Writes the samples as collapsed stacks ("caller;callee;leaf count" lines), the input
+    ///         format of flame graph tools.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the file.
+    ///
+    /// \returns    False if the file couldn't be written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto exportCollapsedStacks(const std::string& path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto Sh2Profiler::exportFunctions(const std::string& path) -> bool;
+    ///
+    /// \brief  Writes the results by function as CSV, with the basic blocks entries when counted.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the file.
+    ///
+    /// \returns    False if the file couldn't be written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto exportFunctions(const std::string& path) -> bool;
+
+  private:
+    static constexpr auto instruction_size = u32{2};
+    static constexpr auto root_frame       = u32{0xFFFFFFFF}; ///< Frame used when no call was seen.
+
+    void onFlowChange(const u32 next_pc);
+    void countBlock(const u32 address);
+    void sample(const u32 pc);
+    void flushFunctionCycles();
+    void applyReset();
+    [[nodiscard]] auto frameName(const u32 address) const -> std::string;
+
+    std::atomic<bool> is_enabled_{false};                        ///< True when the hooks record data.
+    std::atomic<bool> are_blocks_counted_{false};                ///< True when basic blocks entries are counted.
+    std::atomic<bool> are_function_cycles_counted_{false};       ///< True when cycles are accounted by function.
+    std::atomic<bool> is_reset_requested_{false};                ///< Reset done by the emulation thread on next hook.
+    std::atomic<u32>  sampling_period_{default_sampling_period}; ///< Cycles between 2 samples.
+
+    ///@{
+    /// Owned by the emulation thread.
+    bool             is_call_pending_{};         ///< Current instruction called a subroutine.
+    bool             is_return_pending_{};       ///< Current instruction returned from a subroutine.
+    s64              sampling_countdown_{};      ///< Cycles before the next sample.
+    u64              current_function_cycles_{}; ///< Cycles of the current function not yet accounted.
+    std::vector<u32> stack_;                     ///< Addresses of the called functions.
+    ///@}
+
+    std::mutex                      mutex_;           ///< Protects the results.
+    std::map<std::vector<u32>, u64> samples_;         ///< Samples count by stack, the PC being the last element.
+    std::unordered_map<u32, u64>    function_cycles_; ///< Self cycles by function address.
+    std::unordered_map<u32, u64>    block_entries_;   ///< Entries count by basic block address.
+    u64                             samples_count_{}; ///< Total of samples taken.
+    SymbolMap                       symbols_;         ///< Symbols used to name the results.
+};
+
+} // namespace saturnin::sh2
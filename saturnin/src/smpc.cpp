@@ -24,9 +24,12 @@
 #include <string> // string
 #include <saturnin/src/config.h>
 #include <saturnin/src/emulator_context.h>
+#include <saturnin/src/headless.h> // Headless
 #include <saturnin/src/locale.h>
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/sh2/sh2.h>
 #include <saturnin/src/sound/scsp.h>
+#include <saturnin/src/timing.h>
 
 namespace saturnin::core {
 
@@ -413,7 +416,7 @@ void Smpc::executeCommand() {
         using enum Comreg::SmpcCommand;
         case master_sh2_on: {
             is_master_sh2_on_ = true;
-            Log::debug(Logger::smpc, tr("-=Master SH2 ON=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Master SH2 ON=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -421,14 +424,14 @@ void Smpc::executeCommand() {
         case slave_sh2_on: {
             is_slave_sh2_on_ = true;
             modules_.slaveSh2()->powerOnReset();
-            Log::debug(Logger::smpc, tr("-=Slave SH2 ON=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Slave SH2 ON=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
         }
         case slave_sh2_off: {
             is_slave_sh2_on_ = false;
-            Log::debug(Logger::smpc, tr("-=Slave SH2 OFF=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Slave SH2 OFF=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -436,7 +439,7 @@ void Smpc::executeCommand() {
         case sound_on: {
             is_sound_on_ = true;
             modules_.scsp()->reset();
-            Log::debug(Logger::smpc, tr("-=Sound ON=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Sound ON=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -444,21 +447,21 @@ void Smpc::executeCommand() {
         case sound_off: {
             is_sound_on_ = false;
             // emulator_context_->scsp()->setSound(false);
-            Log::debug(Logger::smpc, tr("-=Sound OFF=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Sound OFF=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
         }
         case cd_on: {
             is_cd_on_ = true;
-            Log::debug(Logger::smpc, tr("-=CD ON=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=CD ON=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
         }
         case cd_off: {
             is_cd_on_ = false;
-            Log::debug(Logger::smpc, tr("-=CD OFF=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=CD OFF=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -467,7 +470,7 @@ void Smpc::executeCommand() {
             modules_.masterSh2()->powerOnReset();
             modules_.slaveSh2()->powerOnReset();
             // emulator_context_->scsp()->reset();
-            Log::debug(Logger::smpc, tr("-=Reset Entire System=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Reset Entire System=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -493,11 +496,11 @@ void Smpc::executeCommand() {
             modules_.vdp2()->onSystemClockUpdate();
             if ((regs_.comreg >> Comreg::comreg_enum) == clock_change_320) {
                 is_horizontal_res_352 = false;
-                Log::debug(Logger::smpc, tr("-=Clock Change 320 Mode=- command executed"));
+                LOG_DEBUG(Logger::smpc, tr("-=Clock Change 320 Mode=- command executed"));
             }
             if ((regs_.comreg >> Comreg::comreg_enum) == clock_change_352) {
                 is_horizontal_res_352 = true;
-                Log::debug(Logger::smpc, tr("-=Clock Change 352 Mode=- command executed"));
+                LOG_DEBUG(Logger::smpc, tr("-=Clock Change 352 Mode=- command executed"));
             }
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
@@ -505,21 +508,21 @@ void Smpc::executeCommand() {
         }
         case nmi_request: {
             modules_.scu()->generateInterrupt(interrupt_source::nmi);
-            Log::debug(Logger::smpc, tr("-=NMI Request=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=NMI Request=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
         }
         case reset_enable: {
             is_soft_reset_allowed_ = true;
-            Log::debug(Logger::smpc, tr("-=Reset Enable=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Reset Enable=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
         }
         case reset_disable: {
             is_soft_reset_allowed_ = false;
-            Log::debug(Logger::smpc, tr("-=Reset Disable=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Reset Disable=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -532,13 +535,13 @@ void Smpc::executeCommand() {
             for (u8 i = 0; i < 4; ++i) {
                 smem_[i] = regs_.ireg[i].data();
             }
-            Log::debug(Logger::smpc, tr("-=SMPC Memory Setting=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=SMPC Memory Setting=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
         }
         case time_setting: {
-            Log::debug(Logger::smpc, tr("-=Time Setting=- command executed"));
+            LOG_DEBUG(Logger::smpc, tr("-=Time Setting=- command executed"));
             regs_.oreg[31] = regs_.comreg.data();
             regs_.sf.clr(Sf::sf);
             return;
@@ -557,12 +560,12 @@ void Smpc::executeIntback() {
         regs_.sr.clr(Sr::pdl);
         regs_.sf.clr(Sf::sf);
         regs_.oreg[31] = Oreg::interrupt_back;
-        Log::debug(Logger::smpc, tr("Interrupt request"));
+        LOG_DEBUG(Logger::smpc, tr("Interrupt request"));
         modules_.scu()->generateInterrupt(interrupt_source::system_manager);
         return;
     }
 
-    Log::debug(Logger::smpc, tr("INTBACK started"));
+    LOG_DEBUG(Logger::smpc, tr("INTBACK started"));
     regs_.oreg[31] = {};
 
     if ((regs_.ireg[0] >> Ireg::stac_enum) == Ireg::SmpcStatusAcquisition::status_returned) {
@@ -582,7 +585,7 @@ void Smpc::executeIntback() {
         is_intback_processing_ = true;
     }
 
-    Log::debug(Logger::smpc, tr("Interrupt request"));
+    LOG_DEBUG(Logger::smpc, tr("Interrupt request"));
     modules_.scu()->generateInterrupt(interrupt_source::system_manager);
 
     regs_.sf.clr(Sf::sf);
@@ -593,7 +596,7 @@ void Smpc::getStatus() {
     using Ireg = SmpcRegs::Ireg;
     using Oreg = SmpcRegs::Oreg;
 
-    Log::debug(Logger::smpc, tr("INTBACK returning status data"));
+    LOG_DEBUG(Logger::smpc, tr("INTBACK returning status data"));
     regs_.sr = {};
     regs_.sr.clr(Sr::bit_7);
     regs_.sr.set(Sr::bit_6);
@@ -651,7 +654,7 @@ void Smpc::getPeripheralData() {
     using Sr   = SmpcRegs::Sr;
     using Ireg = SmpcRegs::Ireg;
 
-    Log::debug(Logger::smpc, tr("INTBACK returning peripheral data"));
+    LOG_DEBUG(Logger::smpc, tr("INTBACK returning peripheral data"));
 
     // SMPC Peripheral result :
     // [SR]
@@ -797,35 +800,35 @@ auto Smpc::generatePeripheralData(const SaturnPeripheralId id) -> PeripheralData
         case saturn_standard_pad: {
             auto first_data = SaturnPadData::SaturnStandardPad1stDataType{};
             first_data      = u8_max;
-            if (isKeyPressed(p1.direction_right, openglWindow())) {
+            if (isKeyPressed(p1.direction_right, modules_.context())) {
                 first_data.clr(SaturnPadData::SaturnStandardPad1stData::direction_right);
             }
-            if (isKeyPressed(p1.direction_left, openglWindow())) {
+            if (isKeyPressed(p1.direction_left, modules_.context())) {
                 first_data.clr(SaturnPadData::SaturnStandardPad1stData::direction_left);
             }
-            if (isKeyPressed(p1.direction_down, openglWindow())) {
+            if (isKeyPressed(p1.direction_down, modules_.context())) {
                 first_data.clr(SaturnPadData::SaturnStandardPad1stData::direction_down);
             }
-            if (isKeyPressed(p1.direction_up, openglWindow())) {
+            if (isKeyPressed(p1.direction_up, modules_.context())) {
                 first_data.clr(SaturnPadData::SaturnStandardPad1stData::direction_up);
             }
-            if (isKeyPressed(p1.button_start, openglWindow())) {
+            if (isKeyPressed(p1.button_start, modules_.context())) {
                 first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_start);
             }
-            if (isKeyPressed(p1.button_a, openglWindow())) { first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_a); }
-            if (isKeyPressed(p1.button_c, openglWindow())) { first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_c); }
-            if (isKeyPressed(p1.button_b, openglWindow())) { first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_b); }
+            if (isKeyPressed(p1.button_a, modules_.context())) { first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_a); }
+            if (isKeyPressed(p1.button_c, modules_.context())) { first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_c); }
+            if (isKeyPressed(p1.button_b, modules_.context())) { first_data.clr(SaturnPadData::SaturnStandardPad1stData::button_b); }
             peripheral_data.peripheral_data_table.push_back(first_data.data());
 
             auto second_data = SaturnPadData::SaturnStandardPad2ndDataType{};
             second_data      = u8_max;
-            if (isKeyPressed(p1.button_shoulder_right, openglWindow())) {
+            if (isKeyPressed(p1.button_shoulder_right, modules_.context())) {
                 second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_shoulder_right);
             }
-            if (isKeyPressed(p1.button_x, openglWindow())) { second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_x); }
-            if (isKeyPressed(p1.button_y, openglWindow())) { second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_y); }
-            if (isKeyPressed(p1.button_z, openglWindow())) { second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_z); }
-            if (isKeyPressed(p1.button_shoulder_left, openglWindow())) {
+            if (isKeyPressed(p1.button_x, modules_.context())) { second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_x); }
+            if (isKeyPressed(p1.button_y, modules_.context())) { second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_y); }
+            if (isKeyPressed(p1.button_z, modules_.context())) { second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_z); }
+            if (isKeyPressed(p1.button_shoulder_left, modules_.context())) {
                 second_data.clr(SaturnPadData::SaturnStandardPad2ndData::button_shoulder_left);
             }
             peripheral_data.peripheral_data_table.push_back(second_data.data());
@@ -897,7 +900,7 @@ auto Smpc::read(const u32 addr) -> u8 {
             }
 
             return regs_.pdr2 >> SmpcRegs::Pdr::pdr_shft;
-            Log::debug(Logger::smpc, "PDR2 read : {:#0x}", regs_.pdr2.data());
+            LOG_DEBUG(Logger::smpc, "PDR2 read : {:#0x}", regs_.pdr2.data());
             return regs_.pdr2.data();
 
         default: return 0;
@@ -934,7 +937,7 @@ void Smpc::write(const u32 addr, const u8 data) {
             regs_.ireg[0]  = data;
             if (is_intback_processing_) {
                 if ((regs_.ireg[0] >> Ireg::br_enum) == Ireg::IntbackBreakRequest::requested) {
-                    Log::debug(Logger::smpc, tr("INTBACK break request"));
+                    LOG_DEBUG(Logger::smpc, tr("INTBACK break request"));
                     regs_.sr.clr(Sr::upper_nibble);
                     is_intback_processing_ = false;
                     break;
@@ -942,7 +945,7 @@ void Smpc::write(const u32 addr, const u8 data) {
 
                 auto old_continue = old_ireg0 >> SmpcRegs::Ireg::cont_shft;
                 if (auto new_continue = regs_.ireg[0] >> Ireg::cont_shft; new_continue != old_continue) {
-                    Log::debug(Logger::smpc, tr("INTBACK continue request"));
+                    LOG_DEBUG(Logger::smpc, tr("INTBACK continue request"));
                     setCommandDuration();
                     regs_.sf.set(Sf::sf);
                     break;
@@ -962,18 +965,18 @@ void Smpc::write(const u32 addr, const u8 data) {
             if (modules_.context()->hardwareMode() == HardwareMode::stv) {
                 constexpr auto sound_status = u8{0x10};
                 if ((data & sound_status) > 0) {
-                    Log::debug(Logger::smpc, tr("-=Sound OFF=-"));
+                    LOG_DEBUG(Logger::smpc, tr("-=Sound OFF=-"));
 
                     is_sound_on_ = false;
                 } else {
-                    Log::debug(Logger::smpc, tr("-=Sound ON=-"));
+                    LOG_DEBUG(Logger::smpc, tr("-=Sound ON=-"));
 
                     is_sound_on_ = true;
                     modules_.scsp()->reset();
                 }
             }
             regs_.pdr2.upd(Pdr::pdr(data));
-            Log::debug(Logger::smpc, "PDR2 write : {:#0x}", regs_.pdr2.data());
+            LOG_DEBUG(Logger::smpc, "PDR2 write : {:#0x}", regs_.pdr2.data());
             break;
         case data_direction_register_1: regs_.ddr1.upd(Ddr::ddr(data)); break;
         case data_direction_register_2: regs_.ddr2.upd(Ddr::ddr(data)); break;
@@ -1014,6 +1017,7 @@ void Smpc::initialize() {
 }
 
 void Smpc::run(const s8 cycles) {
+    TIMING_ZONE(TimingZone::smpc_run);
     if (command_remaining_cycles_ > 0) {
         command_remaining_cycles_ -= cycles;
         if (command_remaining_cycles_ <= 0) { executeCommand(); }
@@ -1094,6 +1098,11 @@ void Smpc::clearStvSwitchs() {
 
 auto getKeyName(const PeripheralKey pk) -> std::string { return keyboard_layout.at(pk); }
 
+auto getKeyFromName(std::string_view name) -> PeripheralKey {
+    const auto it = std::ranges::find_if(keyboard_layout, [name](const auto& key) { return key.second == name; });
+    return (it != keyboard_layout.end()) ? it->first : PeripheralKey::key_unknown;
+}
+
 auto getRtcTime() -> RtcTime {
     using namespace date;
     using namespace std::chrono;
@@ -1143,8 +1152,32 @@ auto getRtcTime() -> RtcTime {
     return rtc;
 }
 
-auto isKeyPressed(const PeripheralKey pk, GLFWwindow* window) -> bool {
-    return glfwGetKey(window, uti::toUnderlying(pk)) == GLFW_PRESS;
+auto isKeyPressed(const PeripheralKey pk, EmulatorContext* state) -> bool {
+    if (state->isHeadless()) { return state->headless()->isKeyPressed(pk); }
+    return glfwGetKey(state->openglWindow(), uti::toUnderlying(pk)) == GLFW_PRESS;
 }
 
+template<typename Archive>
+void Smpc::serialize(Archive& ar) {
+    ar.value(regs_);
+    ar.value(clock_);
+    ar.value(command_remaining_cycles_);
+    ar.value(is_master_sh2_on_);
+    ar.value(is_slave_sh2_on_);
+    ar.value(is_sound_on_);
+    ar.value(is_soft_reset_allowed_);
+    ar.value(is_horizontal_res_352);
+    ar.value(is_cd_on_);
+    ar.value(is_intback_processing_);
+    ar.value(port_1_status_);
+    ar.value(port_2_status_);
+    ar.vector(full_peripheral_data_table_);
+    ar.value(is_service_switch_set_);
+    ar.value(is_test_switch_set_);
+    ar.bytes(std::span{smem_});
+}
+
+template void Smpc::serialize(StateWriter&);
+template void Smpc::serialize(StateReader&);
+
 } // namespace saturnin::core
@@ -28,6 +28,7 @@
 #include <array>        // array
 #include <bitset>       // bitset
 #include <chrono>       // duration
+#include <string_view>  // string_view
 #include <vector>       // vector
 #include <windows.h>    // Removes C4005 warning
 #include <GLFW/glfw3.h> // Keyboard handling
@@ -536,6 +537,22 @@ class Smpc {
     void setServiceSwitch();
     void clearStvSwitchs();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Smpc::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the registers, the system clock, the modules power status and the
+    ///         SMEM. Peripherals mappings come from the configuration and aren't part of the state.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
   private:
     static constexpr u8 input_registers_number{7};
     static constexpr u8 output_registers_number{32};
@@ -692,6 +709,21 @@ class Smpc {
 
 auto getKeyName(PeripheralKey pk) -> std::string;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn auto getKeyFromName(std::string_view name) -> PeripheralKey;
+///
+/// \brief  Gets the key matching a printable name, as returned by getKeyName().
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  name    The key name.
+///
+/// \return The key, or PeripheralKey::key_unknown if the name isn't found.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+auto getKeyFromName(std::string_view name) -> PeripheralKey;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn auto getRtcTime() -> RtcTime;
 ///
@@ -706,19 +738,19 @@ auto getKeyName(PeripheralKey pk) -> std::string;
 auto getRtcTime() -> RtcTime;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
-/// \fn auto isKeyPressed(PeripheralKey pk, GLFWwindow* window) -> bool;
+/// \fn auto isKeyPressed(PeripheralKey pk, EmulatorContext* state) -> bool;
 ///
-/// \brief  Query if a key is pressed.
+/// \brief  Query if a key is pressed. In headless mode, keys are read from the input script.
 ///
 /// \author Runik
 /// \date   26/03/2020
 ///
 /// \param          pk      The peripheral key to test.
-/// \param [in,out] window  If non-null, the OpenGL window.
+/// \param [in,out] state   The emulator context.
 ///
 /// \returns    True if key is pressed.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-auto isKeyPressed(PeripheralKey pk, GLFWwindow* window) -> bool;
+auto isKeyPressed(PeripheralKey pk, EmulatorContext* state) -> bool;
 
 } // namespace saturnin::core
@@ -0,0 +1,199 @@
+//
+// audio_sink.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/sound/audio_sink.h>
+#include <Windows.h>
+#include <mmsystem.h> // waveOut
+#include <algorithm>  // fill
+#include <array>      // array
+#include <saturnin/src/locale.h> // tr
+#include <saturnin/src/log.h>    // Log
+
+namespace saturnin::sound {
+
+using core::Log;
+using core::Logger;
+using core::tr;
+
+constexpr auto wav_sample_rate     = u32{44'100};
+constexpr auto wav_channels        = u16{2};
+constexpr auto wav_bits_per_sample = u16{16};
+constexpr auto wav_block_align     = u16{wav_channels * wav_bits_per_sample / 8};
+constexpr auto wav_header_size     = u32{44};   // RIFF header followed by the fmt chunk and the data chunk header.
+constexpr auto wav_fmt_size        = u32{16};   // Size of a PCM fmt chunk.
+constexpr auto wav_format_pcm      = u16{1};    // Uncompressed PCM.
+constexpr auto drain_batch_size    = u16{1024}; // Samples popped from the ring at once.
+
+constexpr auto waveout_buffers_number = std::size_t{4};   // Buffers queued to the device.
+constexpr auto waveout_buffer_samples = std::size_t{512}; // Samples by buffer, about 12 ms.
+constexpr auto waveout_wait_timeout   = DWORD{20};        // In ms, the stop request is checked at least this often.
+
+// WAV fields are little endian, whatever the host.
+inline void writeLittleEndian(std::ofstream& file, const u32 value, const u8 size) {
+    for (u8 i = 0; i < size; ++i) {
+        file.put(static_cast<char>((value >> (i * 8)) & 0xFF));
+    }
+}
+
+WavFileSink::WavFileSink(const std::string& path) : file_(path, std::ios::binary) {
+    if (!file_) {
+        Log::warning(Logger::scsp, tr("Could not open audio dump file {}"), path);
+        return;
+    }
+    writeHeader();
+    Log::info(Logger::scsp, tr("Sound output written to {}"), path);
+}
+
+WavFileSink::~WavFileSink() { close(); }
+
+void WavFileSink::drain(OutputBuffer& samples) {
+    auto lock  = std::scoped_lock(file_mutex_);
+    auto batch = std::array<StereoSample, drain_batch_size>{};
+    while (const auto number = samples.pop(batch)) {
+        if (!file_.is_open() || !file_) { continue; }
+        for (std::size_t i = 0; i < number; ++i) {
+            writeLittleEndian(file_, static_cast<u16>(batch[i].left), 2);
+            writeLittleEndian(file_, static_cast<u16>(batch[i].right), 2);
+        }
+        samples_written_ += static_cast<u32>(number);
+    }
+}
+
+void WavFileSink::close() {
+    // Sizes are only known once the dump ends.
+    auto lock = std::scoped_lock(file_mutex_);
+    if (!file_.is_open()) { return; }
+    if (file_) {
+        file_.seekp(0);
+        writeHeader();
+    }
+    file_.close();
+}
+
+void WavFileSink::writeHeader() {
+    const auto data_size = samples_written_ * wav_block_align;
+    file_.write("RIFF", 4);
+    writeLittleEndian(file_, wav_header_size - 8 + data_size, 4);
+    file_.write("WAVEfmt ", 8);
+    writeLittleEndian(file_, wav_fmt_size, 4);
+    writeLittleEndian(file_, wav_format_pcm, 2);
+    writeLittleEndian(file_, wav_channels, 2);
+    writeLittleEndian(file_, wav_sample_rate, 4);
+    writeLittleEndian(file_, wav_sample_rate * wav_block_align, 4);
+    writeLittleEndian(file_, wav_block_align, 2);
+    writeLittleEndian(file_, wav_bits_per_sample, 2);
+    file_.write("data", 4);
+    writeLittleEndian(file_, data_size, 4);
+}
+
+struct WaveOutSink::Device {
+    struct Buffer {
+        std::array<StereoSample, waveout_buffer_samples> samples{}; ///< 16 bits little endian stereo, as expected by the device.
+        WAVEHDR                                          header{};  ///< Header given to the device.
+    };
+
+    HWAVEOUT                                   handle{};  ///< The opened device, null when closed.
+    HANDLE                                     event{};   ///< Signaled by the device when a buffer is played.
+    std::array<Buffer, waveout_buffers_number> buffers{}; ///< Buffers queued in turn.
+};
+
+WaveOutSink::WaveOutSink(OutputBuffer& samples) : samples_(samples), device_(std::make_unique<Device>()) {
+    auto format            = WAVEFORMATEX{};
+    format.wFormatTag      = WAVE_FORMAT_PCM;
+    format.nChannels       = wav_channels;
+    format.nSamplesPerSec  = wav_sample_rate;
+    format.nAvgBytesPerSec = wav_sample_rate * wav_block_align;
+    format.nBlockAlign     = wav_block_align;
+    format.wBitsPerSample  = wav_bits_per_sample;
+
+    device_->event = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+    if ((device_->event == nullptr)
+        || (waveOutOpen(&device_->handle, WAVE_MAPPER, &format, reinterpret_cast<DWORD_PTR>(device_->event), 0, CALLBACK_EVENT)
+            != MMSYSERR_NOERROR)) {
+        Log::warning(Logger::scsp, tr("Could not open the audio device, sound won't be played"));
+        device_->handle = nullptr;
+        close();
+        return;
+    }
+    for (auto& buffer : device_->buffers) {
+        buffer.header.lpData         = reinterpret_cast<LPSTR>(buffer.samples.data());
+        buffer.header.dwBufferLength = static_cast<DWORD>(sizeof(buffer.samples));
+        waveOutPrepareHeader(device_->handle, &buffer.header, sizeof(WAVEHDR));
+    }
+    is_playing_ = true;
+    feeder_     = std::jthread([this](const std::stop_token& stop) { feed(stop); });
+    Log::info(Logger::scsp, tr("Sound output played on the default audio device"));
+}
+
+WaveOutSink::~WaveOutSink() { close(); }
+
+void WaveOutSink::drain(OutputBuffer& samples) {
+    // Only called once the device is closed, samples are discarded to keep the ring from filling up.
+    auto batch = std::array<StereoSample, drain_batch_size>{};
+    while (samples.pop(batch) != 0) {}
+}
+
+void WaveOutSink::flush(OutputBuffer& samples) {
+    if (!is_playing_) {
+        samples.clear();
+        return;
+    }
+    is_flush_requested_ = true;
+}
+
+void WaveOutSink::close() {
+    auto lock   = std::scoped_lock(device_mutex_);
+    is_playing_ = false;
+    if (feeder_.joinable()) {
+        feeder_.request_stop();
+        SetEvent(device_->event);
+        feeder_.join();
+    }
+    if (device_->handle != nullptr) {
+        // Queued buffers are returned at once, they can then be unprepared.
+        waveOutReset(device_->handle);
+        for (auto& buffer : device_->buffers) {
+            waveOutUnprepareHeader(device_->handle, &buffer.header, sizeof(WAVEHDR));
+        }
+        waveOutClose(device_->handle);
+        device_->handle = nullptr;
+    }
+    if (device_->event != nullptr) {
+        CloseHandle(device_->event);
+        device_->event = nullptr;
+    }
+}
+
+void WaveOutSink::feed(const std::stop_token& stop) {
+    while (!stop.stop_requested()) {
+        if (is_flush_requested_.exchange(false)) { samples_.clear(); }
+        for (auto& buffer : device_->buffers) {
+            if ((buffer.header.dwFlags & WHDR_INQUEUE) != 0) { continue; }
+
+            // On underrun the buffer is completed with silence, the device keeps playing at its own rate.
+            const auto number = samples_.pop(buffer.samples);
+            std::fill(buffer.samples.begin() + number, buffer.samples.end(), StereoSample{});
+            waveOutWrite(device_->handle, &buffer.header, sizeof(WAVEHDR));
+        }
+        WaitForSingleObject(device_->event, waveout_wait_timeout);
+    }
+}
+
+} // namespace saturnin::sound
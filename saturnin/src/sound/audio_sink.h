@@ -0,0 +1,198 @@
+//
+// audio_sink.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	audio_sink.h
+///
+/// \brief	Declares the AudioSink interface, consuming the samples mixed by the SCSP, the WAV file
+///         sink and the host audio device sink.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <atomic>  // atomic
+#include <fstream> // ofstream
+#include <memory>  // unique_ptr
+#include <mutex>   // mutex
+#include <string>  // string
+#include <thread>  // jthread, stop_token
+#include <saturnin/src/emulator_defs.h>
+#include <saturnin/src/sound/scsp.h> // OutputBuffer
+
+namespace saturnin::sound {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  AudioSink
+///
+/// \brief  Consumer side of the SCSP output ring.
+///
+/// A real time sink is fed by the host audio device from its own thread, the emulation is then
+/// paced by the ring fill level. Other sinks are drained by the emulation thread after each slice.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class AudioSink {
+  public:
+    //@{
+    // Constructors / Destructors
+    AudioSink()                                      = default;
+    AudioSink(const AudioSink&)                      = delete;
+    AudioSink(AudioSink&&)                           = delete;
+    auto operator=(const AudioSink&) & -> AudioSink& = delete;
+    auto operator=(AudioSink&&) & -> AudioSink&      = delete;
+    virtual ~AudioSink()                             = default;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] virtual auto AudioSink::isRealTime() const -> bool = 0;
+    ///
+    /// \brief  Query if the samples are consumed at the host playback rate.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if the sink drains the ring by itself.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] virtual auto isRealTime() const -> bool = 0;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn virtual void AudioSink::drain(OutputBuffer& samples) = 0;
+    ///
+    /// \brief  Consumes every sample waiting in the ring.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] samples The SCSP output ring.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    virtual void drain(OutputBuffer& samples) = 0;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn virtual void AudioSink::flush(OutputBuffer& samples) = 0;
+    ///
+    /// \brief  Discards the samples waiting in the ring, called from the emulation thread when the sound
+    ///         restarts.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] samples The SCSP output ring.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    virtual void flush(OutputBuffer& samples) = 0;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn virtual void AudioSink::close() = 0;
+    ///
+    /// \brief  Ends the output, samples drained afterwards are discarded. Can be called from any
+    ///         thread, more than once.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    virtual void close() = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  WavFileSink
+///
+/// \brief  Writes the samples to a 16 bits stereo 44.1kHz WAV file, used for headless runs.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class WavFileSink final : public AudioSink {
+  public:
+    //@{
+    // Constructors / Destructors
+    WavFileSink() = delete;
+    explicit WavFileSink(const std::string& path);
+    WavFileSink(const WavFileSink&)                      = delete;
+    WavFileSink(WavFileSink&&)                           = delete;
+    auto operator=(const WavFileSink&) & -> WavFileSink& = delete;
+    auto operator=(WavFileSink&&) & -> WavFileSink&      = delete;
+    ~WavFileSink() override;
+    //@}
+
+    [[nodiscard]] auto isRealTime() const -> bool override { return false; }
+
+    void drain(OutputBuffer& samples) override;
+    void flush(OutputBuffer& samples) override { samples.clear(); }
+    void close() override;
+
+  private:
+    // Writes the RIFF header, sizes being those of the samples written so far.
+    void writeHeader();
+
+    std::ofstream file_;              ///< The WAV file.
+    std::mutex    file_mutex_;        ///< Closing may come from another thread than the emulation one.
+    u32           samples_written_{}; ///< Number of stereo samples written.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  WaveOutSink
+///
+/// \brief  Plays the samples on the default host audio device through waveOut. A thread refills the
+///         device buffers from the ring as they are played.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class WaveOutSink final : public AudioSink {
+  public:
+    //@{
+    // Constructors / Destructors
+    WaveOutSink() = delete;
+    explicit WaveOutSink(OutputBuffer& samples);
+    WaveOutSink(const WaveOutSink&)                      = delete;
+    WaveOutSink(WaveOutSink&&)                           = delete;
+    auto operator=(const WaveOutSink&) & -> WaveOutSink& = delete;
+    auto operator=(WaveOutSink&&) & -> WaveOutSink&      = delete;
+    ~WaveOutSink() override;
+    //@}
+
+    // Real time as long as the device is playing.
+    [[nodiscard]] auto isRealTime() const -> bool override { return is_playing_; }
+
+    void drain(OutputBuffer& samples) override;
+    void flush(OutputBuffer& samples) override;
+    void close() override;
+
+  private:
+    struct Device;
+
+    // Feeder thread loop, waiting for the device to return its buffers.
+    void feed(const std::stop_token& stop);
+
+    OutputBuffer&           samples_;              ///< The SCSP output ring, the feeder thread being its consumer.
+    std::unique_ptr<Device> device_;               ///< waveOut handle and buffers.
+    std::mutex              device_mutex_;         ///< Closing may come from another thread than the emulation one.
+    std::atomic<bool>       is_playing_{};         ///< True while the feeder thread consumes the ring.
+    std::atomic<bool>       is_flush_requested_{}; ///< The ring is emptied by the feeder thread, being its consumer.
+    std::jthread            feeder_;               ///< Refills the device buffers.
+};
+
+} // namespace saturnin::sound
@@ -19,11 +19,16 @@
 
 #include <saturnin/src/pch.h>
 #include <saturnin/src/sound/scsp.h>
+#include <saturnin/src/sound/audio_sink.h>
+#include <algorithm> // clamp, min
+#include <limits>    // numeric_limits
 #include <saturnin/src/config.h>
 #include <saturnin/src/interrupt_sources.h>
 #include <saturnin/src/scu_registers.h>
 #include <saturnin/src/locale.h> // tr
 #include <saturnin/src/memory.h>
+#include <saturnin/src/save_state.h>
+#include <saturnin/src/timing.h>
 extern "C" {
 #include <saturnin/lib/musashi/m68k.h>        // Musashi
 #include <saturnin/lib/scsp_stef/scsp_stef.h> // Stef's SCSP core
@@ -43,9 +48,42 @@ constexpr auto scsp_registers_start_address = u32{0x100000};
 constexpr auto m68k_frequency               = u32{11'289'600};
 constexpr auto sample_frequency             = u32{44'100};
 constexpr auto m68k_cycles_per_sample       = u32{m68k_frequency / sample_frequency};
+constexpr auto slice_68k_cycles             = u32{samples_slice * m68k_cycles_per_sample};
+constexpr auto slot_registers_size          = u32{0x20};
+constexpr auto exts_0_level_address         = u32{scsp_registers_start_address + 16 * slot_registers_size + 0x17};
+constexpr auto exts_1_level_address         = u32{scsp_registers_start_address + 17 * slot_registers_size + 0x17};
+constexpr auto muted_shift                  = u8{16};
+
+// Attenuations of an EXTS input, as right shifts of the samples.
+struct ExternalInputShifts {
+    u8 left;
+    u8 right;
+};
+
+// Converts an EFSDL/EFPAN register byte the same way Stef's core does for the slots effect outputs : each EFSDL step is
+// 6dB, each 2 EFPAN steps attenuate one side of 6dB more, bit 4 selecting the left side.
+inline auto externalInputShifts(const u8 efsdl_efpan) -> ExternalInputShifts {
+    const auto level = static_cast<u8>((efsdl_efpan >> 5) & 0x7);
+    if (level == 0) { return {muted_shift, muted_shift}; }
+
+    auto       shifts     = ExternalInputShifts{static_cast<u8>(level ^ 0x7), static_cast<u8>(level ^ 0x7)};
+    const auto pan        = static_cast<u8>(efsdl_efpan & 0x1F);
+    auto&      attenuated = ((pan & 0x10) != 0) ? shifts.left : shifts.right;
+    attenuated            = ((pan & 0xF) == 0xF) ? muted_shift : static_cast<u8>(attenuated + ((pan >> 1) & 0x7));
+    return shifts;
+}
+
+inline auto attenuate(const s16 sample, const u8 shift) -> s32 { return (shift < muted_shift) ? (sample >> shift) : 0; }
+
+inline auto clampSample(const s32 sample) -> s16 {
+    return static_cast<s16>(std::clamp(sample, s32{std::numeric_limits<s16>::min()}, s32{std::numeric_limits<s16>::max()}));
+}
 
 EmulatorModules Scsp::external_access_modules_;
 
+// The sink is only complete here.
+Scsp::~Scsp() = default;
+
 void Scsp::initialize() {
     // scsp_init(Scsp::ram().data(), Scsp::scsp68kInterruptHandler, Scsp::scspHostInterruptHandler);
     scsp_init(Scsp::ram().data(),
@@ -58,27 +96,50 @@ void Scsp::initialize() {
 void Scsp::reset() {
     m68k_pulse_reset();
     calculateSamplesPerFrame();
-    calculate68KCyclesRatio();
+    updateSh2Frequency();
+    pending_cycles_ = 0;
+    exts_levels_    = {};
+    clearBuffers();
+}
+
+void Scsp::clearBuffers() {
+    // Samples of the previous run mustn't be played, CD-DA restarts with a full read ahead.
+    cdda_samples_.clear();
+    is_cdda_buffering_  = true;
+    cdda_drift_counter_ = 0;
+    if (audio_sink_ != nullptr) {
+        audio_sink_->flush(output_samples_);
+    } else {
+        output_samples_.clear();
+    }
 }
 
 void Scsp::run(const u32 cycles) {
+    TIMING_ZONE(core::TimingZone::scsp_run);
     if (modules_.smpc()->isSoundOn()) {
-        const auto m68k_cycles = static_cast<u32>(cycles / m68k_cycles_ratio_);
-        elapsed_68k_cycles_ += m68k_cycles;
+        // Both sides are scaled by the other frequency, no fraction of a cycle is lost between two slices.
+        pending_cycles_ += u64{cycles} * m68k_frequency;
+        const auto slice_cycles = u64{slice_68k_cycles} * sh2_frequency_;
+        while (pending_cycles_ >= slice_cycles) {
+            pending_cycles_ -= slice_cycles;
+            runSlice();
+        }
+    }
+}
 
-        // timers update
-        const auto elapsed_samples = elapsed_68k_cycles_ / m68k_cycles_per_sample;
-        scsp_update_timer(elapsed_samples);
-        elapsed_68k_cycles_ %= m68k_cycles_per_sample;
+void Scsp::runSlice() {
+    // The 68K runs a slice ahead of the samples, timers interrupts are raised at the slice boundaries.
+    m68k_execute(slice_68k_cycles);
+    scsp_update_timer(samples_slice);
+    generateSamples(samples_slice);
 
-        m68k_execute(m68k_cycles);
-    }
+    if ((audio_sink_ != nullptr) && !audio_sink_->isRealTime()) { audio_sink_->drain(output_samples_); }
 }
 
 void Scsp::scspHostInterruptHandler() {
     using namespace saturnin::core::interrupt_source;
 
-    Log::debug(Logger::scsp, tr("Interrupt request"));
+    LOG_DEBUG(Logger::scsp, tr("Interrupt request"));
     external_access_modules_.scu()->generateInterrupt(sound_request);
     external_access_modules_.scu()->sendStartFactor(core::ScuRegs::Dxmd::StartingFactorSelect::sound_req);
 }
@@ -88,6 +149,41 @@ void Scsp::scsp68kInterruptHandler(const u32 level) { m68k_set_irq(level); }
 // static
 auto Scsp::ram() -> std::array<u8, core::sound_ram_size>& { return external_access_modules_.memory()->sound_ram_; }
 
+void Scsp::receiveCddaSector(std::span<const u8> sector) {
+    auto       samples = std::array<StereoSample, cdda_samples_per_sector>{};
+    const auto number  = std::min(samples.size(), sector.size() / sizeof(StereoSample));
+    for (std::size_t i = 0; i < number; ++i) {
+        const auto offset = i * sizeof(StereoSample);
+        samples[i].left   = static_cast<s16>(sector[offset] | (sector[offset + 1] << 8));
+        samples[i].right  = static_cast<s16>(sector[offset + 2] | (sector[offset + 3] << 8));
+    }
+
+    // The drive is stalled by nothing on the real hardware either, a sector coming while the buffer is full is lost.
+    if (!cdda_samples_.push(std::span(samples).first(number))) {
+        LOG_DEBUG(Logger::scsp, tr("CD-DA buffer full, sector dropped"));
+    }
+}
+
+void Scsp::audioSink(std::unique_ptr<AudioSink> sink) { audio_sink_ = std::move(sink); }
+
+void Scsp::closeAudioSink() {
+    if (audio_sink_ != nullptr) { audio_sink_->close(); }
+}
+
+auto Scsp::isAudioPaced() const -> bool { return (audio_sink_ != nullptr) && audio_sink_->isRealTime(); }
+
+// static
+void Scsp::updateExternalInputLevels(const u32 address, const u32 data, const u8 size) {
+    if ((address > exts_1_level_address) || (address + size <= exts_0_level_address)) { return; }
+
+    // Registers are big endian, the first byte written being the most significant one.
+    for (u8 i = 0; i < size; ++i) {
+        const auto value = static_cast<u8>(data >> ((size - 1 - i) * 8));
+        if (address + i == exts_0_level_address) { exts_levels_[0] = value; }
+        if (address + i == exts_1_level_address) { exts_levels_[1] = value; }
+    }
+}
+
 auto Scsp::read8(const u32 addr) const -> u8 {
     auto local_addr = addr & sound_ram_mask;
     if (local_addr < sound_ram_upper_boundary) { return rawRead<u8>(Scsp::ram(), local_addr ^ 1); }
@@ -115,6 +211,7 @@ void Scsp::write8(const u32 addr, const u8 data) const {
         rawWrite<u8>(Scsp::ram(), local_addr ^ 1, data);
     } else if (local_addr >= scsp_registers_start_address) {
         scsp_w_b(local_addr, data);
+        updateExternalInputLevels(local_addr, data, 1);
     }
 }
 
@@ -124,6 +221,7 @@ void Scsp::write16(const u32 addr, const u16 data) const {
         rawWrite<u16>(Scsp::ram(), local_addr, swapEndianness<u16>(data));
     } else if (local_addr >= scsp_registers_start_address) {
         scsp_w_w(local_addr, data);
+        updateExternalInputLevels(local_addr, data, 2);
     }
 }
 
@@ -133,6 +231,7 @@ void Scsp::write32(const u32 addr, const u32 data) const {
         rawWrite<u32>(Scsp::ram(), local_addr, swapEndianness<u32>(swapWords(data)));
     } else if (local_addr >= scsp_registers_start_address) {
         scsp_w_d(local_addr, data);
+        updateExternalInputLevels(local_addr, data, 4);
     }
 }
 
@@ -160,11 +259,98 @@ void Scsp::calculateSamplesPerFrame() {
     }
 }
 
-void Scsp::calculate68KCyclesRatio() {
-    const auto sh2_frequency = modules_.smpc()->getSystemClock();
-    m68k_cycles_ratio_       = static_cast<float>(sh2_frequency) / static_cast<float>(m68k_frequency);
+void Scsp::updateSh2Frequency() { sh2_frequency_ = modules_.smpc()->getSystemClock(); }
+
+void Scsp::generateSamples(const u16 samples_number) {
+    // EXTS 0 is the CD left channel, EXTS 1 the right one.
+    const auto exts_0 = externalInputShifts(exts_levels_[0]);
+    const auto exts_1 = externalInputShifts(exts_levels_[1]);
+
+    // Stef's core adds the slots outputs to the buffers, they start from silence.
+    auto       slots_left  = std::array<long, samples_slice>{};
+    auto       slots_right = std::array<long, samples_slice>{};
+    const auto number      = std::min(samples_number, samples_slice);
+    scsp_update(slots_left.data(), slots_right.data(), number);
+
+    auto samples = std::array<StereoSample, samples_slice>{};
+    for (u16 i = 0; i < number; ++i) {
+        const auto cdda  = nextCddaSample();
+        const auto left  = attenuate(cdda.left, exts_0.left) + attenuate(cdda.right, exts_1.left);
+        const auto right = attenuate(cdda.left, exts_0.right) + attenuate(cdda.right, exts_1.right);
+        samples[i].left  = clampSample(static_cast<s32>(slots_left[i]) + left);
+        samples[i].right = clampSample(static_cast<s32>(slots_right[i]) + right);
+    }
+
+    // Emulation never waits for the host : when the output isn't consumed fast enough, the newest samples are lost.
+    output_samples_.push(std::span(samples).first(number));
 }
 
+auto Scsp::nextCddaSample() -> StereoSample {
+    auto sample = StereoSample{};
+    if (is_cdda_buffering_) {
+        if (cdda_samples_.size() < cdda_read_ahead) { return sample; }
+        is_cdda_buffering_ = false;
+    }
+
+    // Sectors are delivered by the periodic responses, slightly faster than 75 per second : the surplus is absorbed by
+    // dropping a sample from time to time, which can't be heard.
+    if ((cdda_samples_.size() > cdda_high_watermark) && (++cdda_drift_counter_ >= cdda_drift_period)) {
+        cdda_drift_counter_ = 0;
+        cdda_samples_.pop(std::span(&sample, 1));
+    }
+    if (cdda_samples_.pop(std::span(&sample, 1)) == 0) { is_cdda_buffering_ = true; }
+    return sample;
+}
+
+template<typename Archive>
+void Scsp::serialize(Archive& ar) {
+    ar.value(samples_per_frame_);
+    ar.value(sh2_frequency_);
+    ar.value(pending_cycles_);
+    ar.value(exts_levels_);
+
+    // Musashi's context holds host pointers, registers are exchanged by name instead.
+    if constexpr (!Archive::is_loading) {
+        m68k_context_.clear();
+        m68k_save_context([](char* name, unsigned int value) { m68k_context_[name] = value; });
+    }
+    auto registers_number = static_cast<u32>(m68k_context_.size());
+    ar.value(registers_number);
+    if constexpr (Archive::is_loading) {
+        m68k_context_.clear();
+        for (u32 i = 0; (i < registers_number) && ar.isValid(); ++i) {
+            auto name  = std::string{};
+            auto value = u32{};
+            ar.string(name);
+            ar.value(value);
+            m68k_context_[name] = value;
+        }
+    } else {
+        for (const auto& [name, value] : m68k_context_) {
+            ar.string(name);
+            ar.value(value);
+        }
+    }
+
+    // Stef's core relocates its own pointers.
+    auto scsp_state = std::vector<u8>(scsp_get_state_size());
+    if constexpr (!Archive::is_loading) { scsp_get_state(scsp_state.data()); }
+    ar.bytes(std::span{scsp_state});
+
+    if constexpr (Archive::is_loading) {
+        if (!ar.isValid()) { return; }
+        m68k_load_context([](char* name) -> unsigned int {
+            const auto it = m68k_context_.find(name);
+            return (it != m68k_context_.end()) ? it->second : 0;
+        });
+        scsp_set_state(scsp_state.data());
+        clearBuffers();
+    }
+}
+
+template void Scsp::serialize(core::StateWriter&);
+template void Scsp::serialize(core::StateReader&);
+
 // Musashi functions
 extern "C" void m68k_write_memory_8(u32 address, u32 value) {
     address &= sound_ram_mask;
@@ -174,6 +360,7 @@ extern "C" void m68k_write_memory_8(u32 address, u32 value) {
         rawWrite<u8>(Scsp::ram(), address ^ 1, value);
     } else if (address >= scsp_registers_start_address) {
         scsp_w_b(address, value);
+        Scsp::updateExternalInputLevels(address, value, 1);
     }
 }
 
@@ -184,6 +371,7 @@ extern "C" void m68k_write_memory_16(u32 address, u32 value) {
         rawWrite<u16>(Scsp::ram(), address, swapEndianness<u16>(value));
     } else if (address >= scsp_registers_start_address) {
         scsp_w_w(address, value);
+        Scsp::updateExternalInputLevels(address, value, 2);
     }
 }
 
@@ -194,6 +382,7 @@ extern "C" void m68k_write_memory_32(u32 address, u32 value) {
         rawWrite<u32>(Scsp::ram(), address, swapEndianness<u32>(swapWords(value)));
     } else if (address >= scsp_registers_start_address) {
         scsp_w_d(address, value);
+        Scsp::updateExternalInputLevels(address, value, 4);
     }
 }
 
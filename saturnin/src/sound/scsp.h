@@ -25,10 +25,13 @@
 
 #pragma once
 
+#include <memory> // unique_ptr
+#include <span>   // span
 #include <saturnin/src/emulator_defs.h>
 #include <saturnin/src/emulator_modules.h>
 #include <saturnin/src/log.h>
 #include <saturnin/src/memory.h>
+#include <saturnin/src/ring_buffer.h>
 
 // Forward declarations
 // namespace saturnin::core {
@@ -38,12 +41,32 @@
 
 namespace saturnin::sound {
 
+class AudioSink;
+
 using saturnin::core::EmulatorContext;
 using saturnin::core::EmulatorModules;
 using saturnin::core::Log;
 using saturnin::core::Logger;
 using saturnin::core::Memory;
 
+// 16 bits stereo sample.
+struct StereoSample {
+    s16 left;
+    s16 right;
+};
+
+constexpr auto cdda_samples_per_sector = u16{588};   ///< Samples in a 2352 bytes CD-DA sector.
+constexpr auto cdda_buffer_size        = u32{8192};  ///< CD-DA ring capacity in samples, about 14 sectors.
+constexpr auto cdda_read_ahead         = u16{1176};  ///< Samples buffered before CD-DA is mixed again after an underrun.
+constexpr auto cdda_high_watermark     = u16{2940};  ///< Over this level, samples are dropped to follow the drive.
+constexpr auto cdda_drift_period       = u16{128};   ///< Minimum samples mixed between two dropped samples.
+constexpr auto output_buffer_size      = u32{16384}; ///< Mixed samples ring capacity, about 370 ms.
+constexpr auto output_target_level     = u32{2048};  ///< Ring level kept by audio pacing, about 46 ms.
+constexpr auto samples_slice           = u16{256};   ///< Samples generated at once, the 68K running ahead of them.
+
+using CddaBuffer   = core::RingBuffer<StereoSample, cdda_buffer_size>;
+using OutputBuffer = core::RingBuffer<StereoSample, output_buffer_size>;
+
 class Scsp {
   public:
     //@{
@@ -54,7 +77,7 @@ class Scsp {
     Scsp(Scsp&&)                           = delete;
     auto operator=(const Scsp&) & -> Scsp& = delete;
     auto operator=(Scsp&&) & -> Scsp&      = delete;
-    ~Scsp()                                = default;
+    ~Scsp();
     //@}
 
     template<typename T>
@@ -102,10 +125,10 @@ class Scsp {
     // Initializes the SCSP module (including the 68K).
     void initialize();
 
-    // Resets the sound system.
+    // Resets the sound system, the CD-DA and output rings being emptied.
     void reset();
 
-    // Runs the SCSP for the scpecified number of cycles.
+    // Accounts for the SH2 cycles elapsed. The 68K and the SCSP only run once they fill a slice of samples.
     void run(const u32 cycles);
 
     // Interrupt sent to the host system by the SCSP.
@@ -117,6 +140,33 @@ class Scsp {
     // A reference to the SCSP RAM area to allow access from external functions (like Musashi's)
     static auto ram() -> std::array<u8, core::sound_ram_size>&;
 
+    // Receives a CD-DA sector read by the CD block (little endian 16 bits stereo samples), it's played through the EXTS
+    // inputs.
+    void receiveCddaSector(std::span<const u8> sector);
+
+    // Mixed samples, waiting to be sent to the host.
+    auto outputSamples() -> OutputBuffer& { return output_samples_; }
+
+    // Sets the consumer of the mixed samples, nullptr to remove it.
+    void audioSink(std::unique_ptr<AudioSink> sink);
+
+    // Ends the audio sink output, the dump file being completed.
+    void closeAudioSink();
+
+    // True when a real time audio sink is attached : frames are then paced by the output samples level.
+    [[nodiscard]] auto isAudioPaced() const -> bool;
+
+    // True when more samples than the target level are waiting for the audio sink.
+    [[nodiscard]] auto isOutputAhead() const -> bool { return output_samples_.size() > output_target_level; }
+
+    // Keeps track of the EFSDL/EFPAN registers of slots 16 and 17, which set the level of the EXTS inputs.
+    static void updateExternalInputLevels(const u32 address, const u32 data, const u8 size);
+
+    // Saves or restores the SCSP and 68K state, Archive being StateWriter or StateReader. Sound RAM is part of the memory
+    // state.
+    template<typename Archive>
+    void serialize(Archive& ar);
+
   private:
     /// \name SCSP memory accessors
     ///@{
@@ -131,15 +181,38 @@ class Scsp {
     // Calculates the number of samples per frame.
     void calculateSamplesPerFrame();
 
-    // Calculates the 68K cycles ratio relative to the SH2 cycles
-    void calculate68KCyclesRatio();
+    // Gets the SH2 frequency the elapsed cycles are converted from.
+    void updateSh2Frequency();
+
+    // Runs the 68K and the SCSP for a slice of samples.
+    void runSlice();
+
+    // Empties the CD-DA and output rings, after a reset or a state load.
+    void clearBuffers();
+
+    // Mixes the samples of a slice, and appends them to the output samples.
+    void generateSamples(const u16 samples_number);
+
+    // Returns the next CD-DA sample, silence while the read ahead is refilled.
+    auto nextCddaSample() -> StereoSample;
 
     static EmulatorModules external_access_modules_; ///< Used to get access to the soundram data from Musashi's functions
     EmulatorModules        modules_;
 
-    u16   samples_per_frame_{};  ///< Number of samples to be played in one frame. Depends on the frame duration
-    float m68k_cycles_ratio_{};  ///< The 68k cycles ratio relative to the sh2 cycles.
-    u32   elapsed_68k_cycles_{}; ///< The elapsed 68k cycles.
+    inline static std::map<std::string, u32, std::less<>> m68k_context_; ///< 68K registers by name, exchanged with Musashi.
+    inline static std::array<u8, 2>                        exts_levels_{}; ///< EFSDL/EFPAN of the EXTS 0 and 1 inputs.
+
+    u16 samples_per_frame_{}; ///< Number of samples to be played in one frame. Depends on the frame duration
+    u32 sh2_frequency_{};     ///< The SH2 frequency, in Hz.
+    u64 pending_cycles_{};    ///< SH2 cycles elapsed and not run yet, multiplied by the 68K frequency.
+
+    // CD-DA samples are only transient data, they aren't part of the saved state.
+    CddaBuffer   cdda_samples_;            ///< CD-DA samples, from the CD block to the EXTS inputs.
+    bool         is_cdda_buffering_{true}; ///< True while the CD-DA read ahead is refilled.
+    u16          cdda_drift_counter_{};    ///< Samples mixed since the last dropped CD-DA sample.
+    OutputBuffer output_samples_;          ///< Mixed samples.
+
+    std::unique_ptr<AudioSink> audio_sink_; ///< Consumer of the mixed samples.
 };
 
 } // namespace saturnin::sound
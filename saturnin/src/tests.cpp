@@ -20,121 +20,448 @@
 #include <saturnin/src/pch.h>
 #include <saturnin/src/tests.h>
 
-#include <chrono>
-#include <iostream>
+#include <array>   // array
+#include <fstream> // ofstream
+#include <sstream> // ostringstream
+#include <tuple>   // tuple
 #include <nanobench.h>
+#include <saturnin/src/emulator_context.h>
 #include <saturnin/src/emulator_defs.h>
-#include <saturnin/src/bit_register.h>
-#include <saturnin/src/utilities.h>
+#include <saturnin/src/log.h>
+#include <saturnin/src/memory.h>
+#include <saturnin/src/scu.h>
+#include <saturnin/src/scu_dsp.h>
+#include <saturnin/src/scu_registers.h>
+#include <saturnin/src/utilities.h> // format, toUnderlying
+#include <saturnin/src/sh2/sh2.h>
+#include <saturnin/src/sh2/sh2_registers.h>
+#include <saturnin/src/video/texture.h>
+#include <saturnin/src/video/vdp1.h>
+#include <saturnin/src/video/vdp_common.h>
+#include <saturnin/src/video/opengl/opengl.h>
+#include <saturnin/src/video/opengl/opengl_texturing.h>
 #include <saturnin/src/video/vdp2/vdp2.h>
 
 namespace saturnin::tests {
 
-void Test::startTest() { start_time_ = std::chrono::steady_clock::now(); }
+namespace uti = saturnin::utilities;
 
-auto Test::endTest() -> std::string {
-    elapsed_time_ = std::chrono::steady_clock::now() - start_time_;
-    auto res      = (std::chrono::duration_cast<std::chrono::microseconds>(elapsed_time_)).count();
+using ankerl::nanobench::Bench;
+using ankerl::nanobench::doNotOptimizeAway;
+using core::EmulatorContext;
+using core::Log;
+using core::Logger;
+using core::tr;
 
-    using namespace std::literals;
-    return utilities::format("{} µs", res);
+constexpr auto memory_block_size = u32{0x1000}; // Size of the memory blocks read and written by the cases.
+
+auto Microbenchmarks::run(std::ostream& os) -> std::vector<Bench> {
+    EmulatorContext ec{};
+    ec.memory()->initialize(core::HardwareMode::saturn);
+
+    // Canned data : memory areas are filled with a counter, so every dot decoded has a different value.
+    const auto fill = [](auto& area) {
+        auto filler = u8{};
+        for (auto& val : area) {
+            val = filler++;
+        }
+    };
+    fill(ec.memory()->workram_high_);
+    fill(ec.memory()->vdp2_vram_);
+    fill(ec.memory()->vdp2_cram_);
+    fill(ec.memory()->vdp1_vram_);
+
+    using Group       = void (*)(EmulatorContext&, Bench&);
+    const auto groups
+        = std::array<Group, 7>{&memoryAccess, &sh2Dispatch, &dmaTransfers, &vdp2Decoding, &vdp1Decoding, &textureCache, &scuDsp};
+
+    auto benches = std::vector<Bench>{};
+    benches.reserve(groups.size());
+    for (const auto group : groups) {
+        auto& b = benches.emplace_back();
+        b.output(&os).relative(true);
+        group(ec, b);
+    }
+
+    // Textures decoded by the cases mustn't stay in the cache, it's shared with the emulation.
+    video::Texture::deleteCache();
+
+    return benches;
 }
 
-void runTests() {
-    if constexpr (constexpr auto run_bitfields_benchmarks = false) {
-        using namespace saturnin::video;
-        using namespace std::string_literals;
-        using Tvmd = Vdp2Regs::Tvmd;
+void Microbenchmarks::memoryAccess(EmulatorContext& ec, Bench& b) {
+    struct Region {
+        std::string_view name;
+        u32              address;
+    };
+    const auto regions = std::array{
+        Region{"work RAM high", core::workram_high_area.start},
+        Region{"work RAM low",  core::workram_low_area.start },
+        Region{"VDP1 RAM",      video::vdp1_vram_start_address},
+        Region{"VDP2 VRAM",     video::vram_start_address    },
+        Region{"VDP2 CRAM",     video::cram_start_address    }
+    };
+    auto* memory = ec.memory();
 
-        auto bitfield_original = Test();
+    b.title("Memory access").unit("access").batch(memory_block_size / sizeof(u32));
+    for (const auto& region : regions) {
+        b.run(uti::format("Read 32 bits, {}", region.name), [&] {
+            auto sum = u32{};
+            for (auto offset = u32{}; offset < memory_block_size; offset += sizeof(u32)) {
+                sum += memory->read<u32>(region.address + offset);
+            }
+            doNotOptimizeAway(sum);
+        });
+        b.run(uti::format("Write 32 bits, {}", region.name), [&] {
+            for (auto offset = u32{}; offset < memory_block_size; offset += sizeof(u32)) {
+                memory->write<u32>(region.address + offset, offset);
+            }
+        });
+    }
+}
 
-        bitfield_original.startTest();
+void Microbenchmarks::sh2Dispatch(EmulatorContext& ec, Bench& b) {
+    constexpr auto pc_start_vector     = u32{0x00000008};
+    constexpr auto sp_start_vector     = u32{0x0000000C};
+    constexpr auto program_address     = u32{0x06004000};
+    constexpr auto stack_address       = u32{0x06002000};
+    constexpr auto instructions_number = u32{1000};
 
-        auto           test = std::vector<u32>{};
-        constexpr auto iterations{1000000};
-        constexpr auto tvmd = Vdp2Regs::TvmdType{0b1000000000000011};
-        auto           val  = u32{};
+    // ADD #1,R0 / ADD R0,R1 / BRA to the start / NOP in the delay slot.
+    constexpr auto program = std::array<u16, 4>{0x7001, 0x310C, 0xAFFC, 0x0009};
+    auto*          memory  = ec.memory();
+    for (auto i = u32{}; i < program.size(); ++i) {
+        memory->write<u16>(program_address + i * sizeof(u16), program[i]);
+    }
+    core::rawWrite<u32>(memory->rom_, pc_start_vector, program_address);
+    core::rawWrite<u32>(memory->rom_, sp_start_vector, stack_address);
 
-        for (int i = 0; i < iterations; ++i) {
-            if ((tvmd >> Tvmd::hreso_enum) == Tvmd::HorizontalResolution::hi_res_704) { ++val; }
-            test.push_back(val);
-        }
+    struct Core {
+        std::string_view  name;
+        sh2::ExecuteFunc* execute;
+    };
+    const auto cores = std::array{
+        Core{"Basic interpreter", &sh2::basic_interpreter::BasicInterpreter::execute},
+        Core{"Fast interpreter",  &sh2::fast_interpreter::FastInterpreter::execute  }
+    };
 
-        auto result = "Original bitfield "s;
-        result += bitfield_original.endTest();
-        core::Log::info(Logger::test, result);
+    // The execute function is shared by every SH2, the current one is restored once done.
+    const auto current_execute = sh2::Sh2::execute;
+    sh2::basic_interpreter::initializeOpcodesLut();
+
+    auto* sh2 = ec.masterSh2();
+    b.title("SH2 dispatch").unit("instruction").batch(instructions_number);
+    for (const auto& core : cores) {
+        sh2::Sh2::execute = core.execute;
+        sh2->powerOnReset();
+        b.run(std::string(core.name), [&] {
+            for (auto i = u32{}; i < instructions_number; ++i) {
+                sh2->run();
+            }
+        });
     }
+    sh2::Sh2::execute = current_execute;
+}
+
+void Microbenchmarks::dmaTransfers(EmulatorContext& ec, Bench& b) {
+    using Dxad = core::ScuRegs::Dxad;
+    using Dxmd = core::ScuRegs::Dxmd;
+
+    constexpr auto source_address = u32{0x06010000};
+    constexpr auto transfer_size  = memory_block_size;
 
-    if constexpr (constexpr auto run_registers_benchmarks = false) {
-        using namespace saturnin::video;
-        using namespace std::string_literals;
-        auto result = "{} {} {}";
-        auto reg    = Test();
+    b.title("DMA transfers").unit("byte").batch(transfer_size);
 
-        reg.startTest();
+    auto direct                 = core::DmaConfiguration{};
+    direct.dma_level            = core::DmaLevel::level_0;
+    direct.dma_mode             = Dxmd::DmaMode::direct;
+    direct.read_address         = source_address;
+    direct.transfer_byte_number = transfer_size;
+    direct.read_add_value       = Dxad::ReadAddressAddValue::add_4;
 
-        constexpr auto iterations{1000000};
+    // Write add value of 2 to the B-Bus is the burst copy path, other values go through byte accesses.
+    const auto scu_cases = std::array{
+        std::tuple{"SCU direct DMA, work RAM high to VDP2 VRAM, write add 2", video::vram_start_address,      Dxad::WriteAddressAddValue::add_2},
+        std::tuple{"SCU direct DMA, work RAM high to VDP1 RAM, write add 4",  video::vdp1_vram_start_address, Dxad::WriteAddressAddValue::add_4}
+    };
+    auto* scu = ec.scu();
+    for (const auto& [name, write_address, write_add_value] : scu_cases) {
+        direct.write_address   = write_address;
+        direct.write_add_value = write_add_value;
+        b.run(name, [&] {
+            auto dc = direct;
+            scu->executeDma(dc);
+        });
+    }
+
+    // SH2 DMAC channel 0 in auto request mode, with source and destination incremented. Writing CHCR0 starts the
+    // transfer, which also clears the transfer end flag of the previous one.
+    constexpr auto chcr_long_unit      = u32{0x5A01};
+    constexpr auto chcr_16_bytes_unit  = u32{0x5E01};
+    constexpr auto dmaor_master_enable = u32{0x1};
+    const auto     sh2_cases           = std::array{
+        std::tuple{"SH2 DMAC, long unit",     chcr_long_unit,     transfer_size / 4},
+        std::tuple{"SH2 DMAC, 16 bytes unit", chcr_16_bytes_unit, transfer_size / 4}
+    };
+    auto* sh2 = ec.masterSh2();
+    sh2->writeRegisters<u32>(sh2::dma_operation_register, dmaor_master_enable);
+    for (const auto& [name, chcr, count] : sh2_cases) {
+        b.run(name, [&] {
+            sh2->writeRegisters<u32>(sh2::dma_source_address_register_0, source_address);
+            sh2->writeRegisters<u32>(sh2::dma_destination_address_register_0, core::workram_low_area.start);
+            sh2->writeRegisters<u32>(sh2::dma_tranfer_count_register_0, count);
+            sh2->writeRegisters<u32>(sh2::dma_channel_control_register_0, chcr);
+        });
+    }
+}
 
-        // 5
-        reg.startTest();
+void Microbenchmarks::vdp2Decoding(EmulatorContext& ec, Bench& b) {
+    using video::ColorCount;
 
-        DataExtraction data{};
-        data.as_16bits = 0x12345678;
+    constexpr auto cells_number   = u32{64};
+    constexpr auto cell_dots      = u32{8 * 8};
+    constexpr auto bitmap_width   = u32{512};
+    constexpr auto bitmap_height  = u32{256};
+    constexpr auto palette_number = u16{1};
 
-        int val = 0;
-        for (int i = 0; i < iterations; ++i) {
-            val += data.as_16bits >> DataExtraction::As16Bits::dot0_shift;
-            val += data.as_16bits >> DataExtraction::As16Bits::dot1_shift;
+    auto* vdp2         = ec.vdp2();
+    auto  screen       = video::ScrollScreenStatus{};
+    auto  texture_data = std::vector<u8>{};
+    texture_data.reserve(static_cast<std::size_t>(cells_number * cell_dots * 4));
+    const auto decodeCells = [&](const u32 cell_size, const auto& read) {
+        texture_data.clear();
+        for (auto i = u32{}; i < cells_number; ++i) {
+            read(i * cell_size);
         }
+        doNotOptimizeAway(texture_data.data());
+    };
+
+    b.title("VDP2 decoding").unit("dot").batch(cells_number * cell_dots);
+    b.run("Cell, 16 colors", [&] {
+        decodeCells(32, [&](const u32 a) { vdp2->read16ColorsCellData<u16>(texture_data, screen, palette_number, a); });
+    });
+    b.run("Cell, 256 colors", [&] {
+        decodeCells(64, [&](const u32 a) { vdp2->read256ColorsCellData<u16>(texture_data, screen, palette_number, a); });
+    });
+    b.run("Cell, 2048 colors", [&] {
+        decodeCells(128, [&](const u32 a) { vdp2->read2048ColorsCellData<u16>(texture_data, screen, a); });
+    });
+    b.run("Cell, 32K colors", [&] { decodeCells(128, [&](const u32 a) { vdp2->read32KColorsCellData(texture_data, screen, a); }); });
+    b.run("Cell, 16M colors", [&] { decodeCells(256, [&](const u32 a) { vdp2->read16MColorsCellData(texture_data, screen, a); }); });
+
+    // Bitmap reads are bounded by the capacity of the texture data, reserved the same way readBitmapData() does.
+    screen.bitmap_start_address  = video::vram_start_address;
+    screen.bitmap_palette_number = palette_number;
+    const auto decodeBitmap      = [&](const u32 capacity_factor, const auto& read) {
+        auto data = std::vector<u8>{};
+        data.reserve(static_cast<std::size_t>(bitmap_width * bitmap_height * capacity_factor));
+        read(data);
+        doNotOptimizeAway(data.data());
+    };
 
-        core::Log::info(Logger::test, result, "BitReg"s, reg.endTest(), val);
+    b.batch(bitmap_width * bitmap_height);
+    b.run("Bitmap, 16 colors", [&] { decodeBitmap(2, [&](std::vector<u8>& d) { vdp2->read16ColorsBitmapData<u16>(d, screen); }); });
+    b.run("Bitmap, 256 colors", [&] { decodeBitmap(4, [&](std::vector<u8>& d) { vdp2->read256ColorsBitmapData<u16>(d, screen); }); });
+    b.run("Bitmap, 2048 colors", [&] { decodeBitmap(8, [&](std::vector<u8>& d) { vdp2->read2048ColorsBitmapData<u16>(d, screen); }); });
+    b.run("Bitmap, 32K colors", [&] { decodeBitmap(8, [&](std::vector<u8>& d) { vdp2->read32KColorsBitmapData(d, screen); }); });
+    b.run("Bitmap, 16M colors", [&] { decodeBitmap(16, [&](std::vector<u8>& d) { vdp2->read16MColorsBitmapData(d, screen); }); });
+}
+
+void Microbenchmarks::vdp1Decoding(EmulatorContext& ec, Bench& b) {
+    using video::CmdPmod;
+
+    constexpr auto sprites_number   = u32{64};
+    constexpr auto sprite_width     = u16{32};
+    constexpr auto sprite_height    = u16{32};
+    constexpr auto textures_offset  = u32{0x10000}; // Textures are stored after the command tables.
+    constexpr auto texture_stride   = u32{sprite_width * sprite_height * 2};
+    constexpr auto color_mode_shift = u8{3};
+    constexpr auto end_bit          = u16{0x8000};
+
+    // Canned command list : normal sprites using the same color mode, followed by a draw end command.
+    auto*      memory            = ec.memory();
+    const auto writeCommandList = [&](const CmdPmod::ColorMode mode) {
+        for (auto i = u32{}; i < sprites_number; ++i) {
+            const auto table           = video::vdp1_ram_start_address + i * video::table_size;
+            const auto texture_address = textures_offset + i * texture_stride;
+            memory->write<u16>(table + video::cmdctrl_offset, 0);
+            memory->write<u16>(table + video::cmdpmod_offset, static_cast<u16>(uti::toUnderlying(mode) << color_mode_shift));
+            memory->write<u16>(table + video::cmdcolr_offset, 0);
+            memory->write<u16>(table + video::cmdsrca_offset, static_cast<u16>(texture_address / video::vdp1_address_multiplier));
+            memory->write<u16>(table + video::cmdsize_offset, static_cast<u16>(((sprite_width / 8) << 8) | sprite_height));
+            memory->write<u16>(table + video::cmdxa_offset, static_cast<u16>((i % 8) * sprite_width));
+            memory->write<u16>(table + video::cmdya_offset, static_cast<u16>((i / 8) * sprite_height));
+        }
+        memory->write<u16>(video::vdp1_ram_start_address + sprites_number * video::table_size + video::cmdctrl_offset, end_bit);
+    };
+
+    // Texture updates are queued for the OpenGL thread, which doesn't exist here.
+    auto*      vdp1    = ec.vdp1();
+    const auto process = [&](const bool is_cache_discarded) {
+        if (is_cache_discarded) { video::Texture::discardCache(video::VdpType::vdp1); }
+        vdp1->populateRenderData();
+        static_cast<void>(ec.opengl()->texturing()->takeTextureUpdates());
+    };
+
+    const auto modes = std::array{
+        std::pair{"Color bank 16 colors",   CmdPmod::ColorMode::mode_0_16_colors_bank  },
+        std::pair{"Lookup table 16 colors", CmdPmod::ColorMode::mode_1_16_colors_lookup},
+        std::pair{"Color bank 64 colors",   CmdPmod::ColorMode::mode_2_64_colors_bank  },
+        std::pair{"Color bank 128 colors",  CmdPmod::ColorMode::mode_3_128_colors_bank },
+        std::pair{"Color bank 256 colors",  CmdPmod::ColorMode::mode_4_256_colors_bank },
+        std::pair{"RGB 32K colors",         CmdPmod::ColorMode::mode_5_32k_colors_rgb  }
+    };
+
+    b.title("VDP1 command lists").unit("sprite").batch(sprites_number);
+    writeCommandList(CmdPmod::ColorMode::mode_0_16_colors_bank);
+    process(true);
+    b.run("Command list parsing, textures cached", [&] { process(false); });
+    for (const auto& [name, mode] : modes) {
+        writeCommandList(mode);
+        b.run(uti::format("Command list parsing, {}", name), [&] { process(true); });
     }
+}
 
-    if constexpr (constexpr auto run_data_copy_benchmarks = true) {
-        using namespace core;
-        using namespace video;
+void Microbenchmarks::textureCache([[maybe_unused]] EmulatorContext& ec, Bench& b) {
+    using video::Texture;
 
-        EmulatorContext ec{};
-        ec.memory()->initialize(HardwareMode::saturn);
-        auto row             = DataExtraction{};
-        auto current_address = u32{0x25e00000};
+    constexpr auto textures_number = u32{1024};
+    constexpr auto texture_width   = u16{32};
+    constexpr auto texture_height  = u16{32};
+    constexpr auto base_address    = u32{0x25c40000};
+    constexpr auto address_stride  = u32{0x800};
 
-        auto filler = u8{};
-        for (auto& val : ec.memory()->vdp2_vram_) {
-            val = filler;
-            ++filler;
+    const auto texture_data = std::vector<u8>(static_cast<std::size_t>(texture_width * texture_height * 4));
+    auto       keys         = std::vector<std::size_t>{};
+    keys.reserve(textures_number);
+    for (auto i = u32{}; i < textures_number; ++i) {
+        keys.push_back(Texture::calculateKey(video::VdpType::vdp1, base_address + i * address_stride, 0));
+    }
+
+    b.title("Texture cache").unit("texture").batch(textures_number);
+    b.run("Store", [&] {
+        for (auto i = u32{}; i < textures_number; ++i) {
+            auto data = texture_data;
+            Texture::storeTexture(Texture(video::VdpType::vdp1,
+                                          video::VdpLayer::sprite,
+                                          base_address + i * address_stride,
+                                          0,
+                                          0,
+                                          data,
+                                          texture_width,
+                                          texture_height));
         }
+    });
+    b.run("Lookup", [&] {
+        auto needed = u32{};
+        for (const auto key : keys) {
+            needed += Texture::isTextureLoadingNeeded(key) ? 1 : 0;
+        }
+        doNotOptimizeAway(needed);
+    });
+    b.run("Get", [&] {
+        for (const auto key : keys) {
+            doNotOptimizeAway(Texture::getTexture(key));
+        }
+    });
+}
 
-        std::vector<u8> texture_data;
-        // core::Log::info(Logger::test, "{}", arr[0x3f]);
-        auto os = std::ostringstream{};
-        auto b  = ankerl::nanobench::Bench();
-        b.output(&os).relative(true);
+void Microbenchmarks::scuDsp(EmulatorContext& ec, Bench& b) {
+    constexpr auto vertices_number  = u32{16};
+    constexpr auto program_load     = u32{0x8000};  // LE, program RAM address 0.
+    constexpr auto program_start    = u32{0x18000}; // LE and EX, from address 0.
+    constexpr auto cycles_by_run    = u32{256};
+    constexpr auto vertex_base_bank = u32{3};
 
-        // ankerl::nanobench::Bench().output(&os).run("Direct copy", [&] {
-        b.run("Direct copy", [&] {
-            texture_data.clear();
-            current_address = u32{0x25e00000};
-            for (u32 i = 0; i < 8; ++i) {
-                row.as_8bits = ec.memory()->read<u32>(current_address);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot0_shift);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot1_shift);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot2_shift);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot3_shift);
-                current_address += 4;
-                row.as_8bits = ec.memory()->read<u32>(current_address);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot0_shift);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot1_shift);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot2_shift);
-                texture_data.emplace_back(row.as_8bits >> DataExtraction::As8Bits::dot3_shift);
-                current_address += 4;
-            }
+    // Transforms the vertices of data RAM 1 by the rotation matrix of data RAM 0, one vertex by loop, results are
+    // written to data RAM 2. The vertex base address is kept in data RAM 3 and advanced by the loop.
+    constexpr auto matrix_row = std::array<u32, 6>{
+        0x00003D03, // MOV M3,CT1
+        0x024B4000, // CLR A          MOV MC0,X  MOV MC1,Y
+        0x03494000, // MOV MUL,P      MOV MC0,X  MOV MC1,Y
+        0x1B4D4000, // AD2 MOV ALU,A  MOV MUL,P  MOV MC0,X  MOV MC1,Y
+        0x19040000, // AD2 MOV ALU,A  MOV MUL,P
+        0x1800320A  // AD2 MOV ALH,MC2
+    };
+    auto program = std::vector<u32>{
+        0xA800000F, // MVI #15,LOP
+        0x00001E00, // MOV 0,CT2
+        0x00001F00, // MOV 0,CT3
+        0x00001B04, // MOV 4,TOP
+        0x00001C00  // MOV 0,CT0
+    };
+    for (u32 i = 0; i < 3; ++i) {
+        program.insert(program.end(), matrix_row.begin(), matrix_row.end());
+    }
+    program.insert(program.end(),
+                   {
+                       0x0006D503, // MOV M3,A       MOV 3,PL
+                       0x10003309, // ADD            MOV ALL,MC3
+                       0xE0000000, // BTM
+                       0x00001F00, // MOV 0,CT3      delay slot
+                       0xF8000000  // ENDI
+                   });
 
-            // ankerl::nanobench::doNotOptimizeAway(d);
-        });
+    auto*      scu    = ec.scu();
+    const auto upload = [&] {
+        scu->write32(core::dsp_program_control_port, program_load);
+        for (const auto word : program) {
+            scu->write32(core::dsp_program_ram_dataport, word);
+        }
+    };
+    const auto fillDataRam = [&](const u32 bank, const u32 size, const u32 first_value) {
+        scu->write32(core::dsp_data_ram_address_port, bank << 6);
+        for (u32 i = 0; i < size; ++i) {
+            scu->write32(core::dsp_data_ram_data_port, first_value + i);
+        }
+    };
+    const auto execute = [&] {
+        fillDataRam(vertex_base_bank, 1, 0);
+        scu->write32(core::dsp_program_control_port, program_start);
+        while (scu->dsp().isExecuting()) {
+            scu->run(cycles_by_run);
+        }
+    };
+
+    upload();
+    fillDataRam(0, 9, 0x10000);
+    fillDataRam(1, vertices_number * 3, 0x20000);
+
+    b.title("SCU DSP").unit("vertex").batch(vertices_number);
+    b.run("Transform program", execute);
+    b.run("Transform program, uploaded before each run", [&] {
+        upload();
+        execute();
+    });
+}
+
+void runTests() {
+    auto os = std::ostringstream{};
+    Microbenchmarks::run(os);
+    Log::info(Logger::test, "{}", os.str());
+}
 
-        core::Log::info(Logger::test, "{}", os.str());
+auto runMicrobenchmarks(const std::string& output_path) -> bool {
+    auto       os      = std::ostringstream{};
+    const auto benches = Microbenchmarks::run(os);
+    Log::info(Logger::test, "{}", os.str());
+
+    auto out = std::ofstream(output_path, std::ios::trunc);
+    if (!out) {
+        Log::warning(Logger::test, tr("Could not open microbenchmarks report {}"), output_path);
+        return false;
+    }
+
+    // Each group is rendered as a nanobench JSON document, the documents being gathered in an array.
+    out << "[\n";
+    for (auto i = std::size_t{}; i < benches.size(); ++i) {
+        ankerl::nanobench::render(ankerl::nanobench::templates::json(), benches[i], out);
+        if (i + 1 < benches.size()) { out << ",\n"; }
     }
+    out << "]\n";
+
+    Log::info(Logger::test, tr("Microbenchmarks results written to {}"), output_path);
+    return true;
 }
 
 } // namespace saturnin::tests
@@ -20,25 +20,99 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \file	tests.h
 ///
-/// \brief	Declares functions needed to test various aspects of the emulator.
+/// \brief	Declares the microbenchmarks suite, measuring the hot kernels of the emulator.
 ///
+/// Each group of cases is a nanobench run, cases inside a group being relative to the first one.
+/// The suite can be run from the benchmarks window, or from the command line with
+/// --microbenchmarks <file>, results being written to the file in JSON.
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #pragma once
 
+#include <iosfwd> // ostream
+#include <string> // string
+#include <vector> // vector
+
+namespace ankerl::nanobench {
+class Bench;
+} // namespace ankerl::nanobench
+
+namespace saturnin::core {
+class EmulatorContext;
+} // namespace saturnin::core
+
 namespace saturnin::tests {
 
-class Test {
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Microbenchmarks
+///
+/// \brief  Microbenchmarks suite. Cases run on their own emulator context, filled with canned data.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Microbenchmarks {
   public:
-    void startTest();
+    //@{
+    // Constructors / Destructors
+    Microbenchmarks()                                            = delete;
+    Microbenchmarks(const Microbenchmarks&)                      = delete;
+    Microbenchmarks(Microbenchmarks&&)                           = delete;
+    auto operator=(const Microbenchmarks&) & -> Microbenchmarks& = delete;
+    auto operator=(Microbenchmarks&&) & -> Microbenchmarks&      = delete;
+    ~Microbenchmarks()                                           = delete;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto Microbenchmarks::run(std::ostream& os) -> std::vector<ankerl::nanobench::Bench>;
+    ///
+    /// \brief  Runs every group of cases.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] os  Stream where the results tables are written.
+    ///
+    /// \returns    The results, one bench by group.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    auto endTest() -> std::string;
+    static auto run(std::ostream& os) -> std::vector<ankerl::nanobench::Bench>;
 
   private:
-    std::chrono::time_point<std::chrono::steady_clock> start_time_{};
-    std::chrono::duration<double>                      elapsed_time_{};
+    static void memoryAccess(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
+    static void sh2Dispatch(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
+    static void dmaTransfers(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
+    static void vdp2Decoding(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
+    static void vdp1Decoding(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
+    static void textureCache(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
+    static void scuDsp(core::EmulatorContext& ec, ankerl::nanobench::Bench& b);
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void runTests();
+///
+/// \brief  Runs the microbenchmarks suite, results are logged.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
 void runTests();
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn auto runMicrobenchmarks(const std::string& output_path) -> bool;
+///
+/// \brief  Runs the microbenchmarks suite, results are logged and written in JSON.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  output_path Path of the JSON file.
+///
+/// \returns    False if the file couldn't be written.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+auto runMicrobenchmarks(const std::string& output_path) -> bool;
+
 } // namespace saturnin::tests
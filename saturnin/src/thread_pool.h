@@ -76,6 +76,19 @@ class ThreadPool {
 
     static void shutdown();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto ThreadPool::threadsNumber() -> std::size_t;
+    ///
+    /// \brief  Returns the number of threads in the pool.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \return The number of threads.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto threadsNumber() -> std::size_t { return pool_.get_thread_count(); }
+
     // static BS::thread_pool pool_; ///< Pool of threads
     static BS::light_thread_pool pool_; ///< Pool of threads
 };
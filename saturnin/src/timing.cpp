@@ -0,0 +1,185 @@
+//
+// timing.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/timing.h>
+#include <algorithm> // min
+#include <fstream>   // ofstream
+#include <saturnin/src/log.h>
+#include <saturnin/src/utilities.h> // format
+
+namespace saturnin::core {
+
+namespace uti = saturnin::utilities;
+
+using Milliseconds = std::chrono::duration<double, std::milli>;
+using Microseconds = std::chrono::duration<double, std::micro>;
+
+constexpr auto trace_pid = u32{1};
+
+std::atomic<bool>                              Timing::is_capturing_{false};
+std::mutex                                     Timing::buffers_mutex_;
+std::vector<std::shared_ptr<ZoneBuffer>>       Timing::buffers_;
+u32                                            Timing::buffers_count_{};
+std::array<FrameTimings, Timing::history_size> Timing::history_;
+std::size_t                                    Timing::history_index_{};
+std::size_t                                    Timing::history_count_{};
+TimingClock::time_point                        Timing::last_frame_end_{};
+TimingClock::time_point                        Timing::capture_start_{};
+std::vector<Timing::FrameCounters>             Timing::capture_frames_;
+u32                                            Timing::frame_thread_index_{};
+                                               
+void Timing::nameThread(const std::string& name) {
+    auto& buffer = threadBuffer();
+    auto  lock   = std::scoped_lock(buffers_mutex_);
+    buffer.name_ = name;
+}
+
+void Timing::onFrameEnd() {
+    const auto now    = TimingClock::now();
+    auto&      caller = threadBuffer();
+
+    auto lock    = std::scoped_lock(buffers_mutex_);
+    auto timings = FrameTimings{};
+    for (const auto& buffer : buffers_) {
+        for (auto i = std::size_t{}; i < timing_zones_number; ++i) {
+            const auto total = buffer->self_time_[i].load(std::memory_order_relaxed);
+            timings.zones_ms[i] += Milliseconds(std::chrono::nanoseconds(total - buffer->reported_self_time_[i])).count();
+            buffer->reported_self_time_[i] = total;
+        }
+    }
+    if (last_frame_end_ != TimingClock::time_point{}) { timings.frame_ms = Milliseconds(now - last_frame_end_).count(); }
+    last_frame_end_ = now;
+
+    history_[history_index_] = timings;
+    history_index_           = (history_index_ + 1) % history_size;
+    history_count_           = std::min(history_count_ + 1, history_size);
+
+    if (isCapturing()) {
+        capture_frames_.push_back({now, timings});
+        frame_thread_index_ = caller.index_;
+    } else {
+        // Buffers only referenced here belong to threads that have exited, their times are now published.
+        std::erase_if(buffers_, [](const auto& buffer) { return buffer.use_count() == 1; });
+    }
+}
+
+auto Timing::history() -> std::vector<FrameTimings> {
+    auto lock   = std::scoped_lock(buffers_mutex_);
+    auto frames = std::vector<FrameTimings>{};
+    frames.reserve(history_count_);
+    for (auto i = history_size - history_count_; i < history_size; ++i) {
+        frames.push_back(history_[(history_index_ + i) % history_size]);
+    }
+    return frames;
+}
+
+void Timing::startCapture() {
+    auto lock = std::scoped_lock(buffers_mutex_);
+    for (const auto& buffer : buffers_) {
+        auto events_lock = std::scoped_lock(buffer->events_mutex_);
+        buffer->events_.clear();
+        buffer->dropped_events_ = 0;
+    }
+    capture_frames_.clear();
+    capture_start_ = TimingClock::now();
+    is_capturing_.store(true, std::memory_order_relaxed);
+    Log::info(Logger::main, tr("Timing capture started"));
+}
+
+auto Timing::stopCapture(const std::string& path) -> bool {
+    is_capturing_.store(false, std::memory_order_relaxed);
+
+    auto out = std::ofstream(path, std::ios::trunc);
+    if (!out) {
+        Log::warning(Logger::main, tr("Could not open timing capture {}"), path);
+        return false;
+    }
+
+    const auto timestamp  = [](const TimingClock::time_point t) { return Microseconds(t - capture_start_).count(); };
+    auto       separator  = std::string_view{""};
+    const auto writeEvent = [&](const std::string& event) {
+        out << separator << event;
+        separator = ",\n";
+    };
+
+    auto lock = std::scoped_lock(buffers_mutex_);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    writeEvent(uti::format(R"({{"name":"process_name","ph":"M","pid":{},"args":{{"name":"Saturnin"}}}})", trace_pid));
+
+    auto dropped_events = u64{};
+    for (const auto& buffer : buffers_) {
+        auto       events_lock = std::scoped_lock(buffer->events_mutex_);
+        const auto name        = buffer->name_.empty() ? uti::format("thread {}", buffer->index_) : buffer->name_;
+        writeEvent(uti::format(R"({{"name":"thread_name","ph":"M","pid":{},"tid":{},"args":{{"name":"{}"}}}})",
+                               trace_pid,
+                               buffer->index_,
+                               name));
+        for (const auto& event : buffer->events_) {
+            writeEvent(uti::format(R"({{"name":"{}","cat":"zone","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                                   timing_zones_info[static_cast<std::size_t>(event.zone)].name,
+                                   timestamp(event.start),
+                                   Microseconds(event.duration).count(),
+                                   trace_pid,
+                                   buffer->index_));
+        }
+        dropped_events += buffer->dropped_events_;
+        buffer->events_.clear();
+        buffer->events_.shrink_to_fit();
+    }
+
+    // Zones entered too often to be recorded one by one are written as counters, spanning the frame they were measured in.
+    for (const auto& [time, timings] : capture_frames_) {
+        const auto frame_start = time - std::chrono::duration_cast<TimingClock::duration>(Milliseconds(timings.frame_ms));
+        writeEvent(uti::format(R"({{"name":"frame","cat":"frame","ph":"X","ts":{:.3f},"dur":{:.3f},"pid":{},"tid":{}}})",
+                               timestamp(frame_start),
+                               timings.frame_ms * 1000.0,
+                               trace_pid,
+                               frame_thread_index_));
+
+        auto args = std::string{};
+        for (auto i = std::size_t{}; i < timing_zones_number; ++i) {
+            if (timing_zones_info[i].is_traced) { continue; }
+            if (!args.empty()) { args += ','; }
+            args += uti::format(R"("{}":{:.3f})", timing_zones_info[i].name, timings.zones_ms[i]);
+        }
+        writeEvent(uti::format(R"({{"name":"zones_ms","ph":"C","ts":{:.3f},"pid":{},"args":{{{}}}}})",
+                               timestamp(frame_start),
+                               trace_pid,
+                               args));
+    }
+    out << "\n]}\n";
+    capture_frames_.clear();
+
+    if (dropped_events != 0) { Log::warning(Logger::main, tr("{} timing zone(s) dropped during the capture"), dropped_events); }
+    Log::info(Logger::main, tr("Timing capture written to {}"), path);
+    return true;
+}
+
+auto Timing::threadBuffer() -> ZoneBuffer& {
+    thread_local auto buffer = std::shared_ptr<ZoneBuffer>{};
+    if (!buffer) {
+        auto lock = std::scoped_lock(buffers_mutex_);
+        buffer    = std::make_shared<ZoneBuffer>(buffers_count_++);
+        buffers_.push_back(buffer);
+    }
+    return *buffer;
+}
+
+} // namespace saturnin::core
@@ -0,0 +1,369 @@
+//
+// timing.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	timing.h
+///
+/// \brief	Declares the timing zones, used to measure the host time spent in the emulator modules.
+///
+/// A zone is opened with TIMING_ZONE() and closed at the end of the enclosing scope. Time is
+/// accumulated by zone in a buffer owned by the calling thread, a zone time excluding the time of
+/// the zones nested in it. Every frame, the accumulated times are published for the GUI, and while
+/// a capture is running the zones are recorded to be exported as a Chrome trace_event JSON file.
+///
+/// Zones are compiled out unless SATURNIN_TIMING_ZONES is defined to 1, which DebugFast builds do.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>       // array
+#include <atomic>      // atomic
+#include <chrono>      // steady_clock
+#include <memory>      // shared_ptr
+#include <mutex>       // mutex
+#include <string>      // string
+#include <string_view> // string_view
+#include <vector>      // vector
+#include <saturnin/src/emulator_defs.h>
+
+#ifndef SATURNIN_TIMING_ZONES
+    #define SATURNIN_TIMING_ZONES 0
+#endif
+
+#if SATURNIN_TIMING_ZONES
+    #define TIMING_ZONE(zone) const auto timing_zone_scope = saturnin::core::TimingScope(zone)
+#else
+    #define TIMING_ZONE(zone) static_cast<void>(0)
+#endif
+
+namespace saturnin::core {
+
+constexpr auto are_timing_zones_compiled = bool{SATURNIN_TIMING_ZONES != 0};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   TimingZone
+///
+/// \brief  Zones measured.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class TimingZone : u8 {
+    master_sh2_run,
+    slave_sh2_run,
+    smpc_run,
+    vdp2_run,
+    cdrom_run,
+    scsp_run,
+    vdp1_populate_render_data,
+    vdp2_populate_render_data,
+    vdp1_texture_decoding,
+    vdp2_bitmap_decoding,
+    vdp2_cell_decoding,
+    textures_generation,
+    textures_packing,
+    opengl_render,
+    frame_limiter,
+    rewind_capture,
+    rewind_compression,
+    chd_decompression
+};
+
+constexpr auto timing_zones_number = std::size_t{18};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct TimingZoneInfo
+///
+/// \brief  Description of a timing zone.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TimingZoneInfo {
+    std::string_view name;      ///< Name displayed and exported.
+    bool             is_traced; ///< False for zones entered too often to be recorded one by one, exported as per frame counters.
+};
+
+constexpr auto timing_zones_info = std::array<TimingZoneInfo, timing_zones_number>{
+    {{"master_sh2_run", false},
+     {"slave_sh2_run", false},
+     {"smpc_run", false},
+     {"vdp2_run", false},
+     {"cdrom_run", false},
+     {"scsp_run", false},
+     {"vdp1_populate_render_data", true},
+     {"vdp2_populate_render_data", true},
+     {"vdp1_texture_decoding", false},
+     {"vdp2_bitmap_decoding", true},
+     {"vdp2_cell_decoding", false},
+     {"textures_generation", true},
+     {"textures_packing", true},
+     {"opengl_render", true},
+     {"frame_limiter", true},
+     {"rewind_capture", true},
+     {"rewind_compression", true},
+     {"chd_decompression", true}}
+};
+
+using TimingClock = std::chrono::steady_clock;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct ZoneEvent
+///
+/// \brief  A zone recorded during a capture.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct ZoneEvent {
+    TimingClock::time_point  start;    ///< Zone start.
+    std::chrono::nanoseconds duration; ///< Zone duration, nested zones included.
+    TimingZone               zone;     ///< The zone.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct FrameTimings
+///
+/// \brief  Time spent by zone during one emulated frame, in milliseconds.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct FrameTimings {
+    std::array<double, timing_zones_number> zones_ms{}; ///< Self time by zone, nested zones excluded.
+    double                                  frame_ms{}; ///< Host time between the end of the previous frame and this one.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  ZoneBuffer
+///
+/// \brief  Timing data of one thread. Times are only written by the owning thread, events are
+///         protected by a mutex as they are read when the capture is exported.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class ZoneBuffer {
+  public:
+    static constexpr auto max_events = std::size_t{0x100000}; ///< Events kept by capture, next ones are dropped.
+
+    explicit ZoneBuffer(const u32 index) : index_(index) {}
+
+    void addSelfTime(const TimingZone zone, const std::chrono::nanoseconds self) {
+        auto& time = self_time_[static_cast<std::size_t>(zone)];
+        time.store(time.load(std::memory_order_relaxed) + static_cast<u64>(self.count()), std::memory_order_relaxed);
+    }
+
+    void addEvent(const ZoneEvent& event) {
+        auto lock = std::scoped_lock(events_mutex_);
+        if (events_.size() == max_events) {
+            ++dropped_events_;
+            return;
+        }
+        events_.push_back(event);
+    }
+
+  private:
+    friend class Timing;
+
+    std::array<std::atomic<u64>, timing_zones_number> self_time_{};          ///< Accumulated self time by zone, in ns.
+    std::array<u64, timing_zones_number>              reported_self_time_{}; ///< Self time already published.
+    std::mutex                                        events_mutex_;         ///< Protects the events.
+    std::vector<ZoneEvent>                            events_;               ///< Events of the current capture.
+    u64                                               dropped_events_{};     ///< Events lost because the buffer was full.
+    std::string                                       name_;                 ///< Name of the thread.
+    u32                                               index_;                ///< Index of the buffer, used as thread id.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Timing
+///
+/// \brief  Collects the timing zones of every thread.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Timing {
+  public:
+    //@{
+    // Constructors / Destructors
+    Timing()                                   = delete;
+    Timing(const Timing&)                      = delete;
+    Timing(Timing&&)                           = delete;
+    auto operator=(const Timing&) & -> Timing& = delete;
+    auto operator=(Timing&&) & -> Timing&      = delete;
+    ~Timing()                                  = delete;
+    //@}
+
+    static constexpr auto history_size = std::size_t{120}; ///< Number of frames kept for the GUI.
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static void Timing::nameThread(const std::string& name);
+    ///
+    /// \brief  Names the calling thread in the exported traces.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  name    The name of the thread.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void nameThread(const std::string& name);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static void Timing::onFrameEnd();
+    ///
+    /// \brief  Publishes the time spent by zone since the previous call. Called by the emulation
+    ///         thread at VBlank.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void onFrameEnd();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto Timing::history() -> std::vector<FrameTimings>;
+    ///
+    /// \brief  Returns the timings of the last frames, oldest first.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    Up to history_size frames.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto history() -> std::vector<FrameTimings>;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static void Timing::startCapture();
+    ///
+    /// \brief  Starts recording the zones, previously captured ones being discarded.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void startCapture();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto Timing::stopCapture(const std::string& path) -> bool;
+    ///
+    /// \brief  Stops recording and writes the captured zones as a Chrome trace_event JSON file, which
+    ///         can be opened with chrome://tracing or Perfetto. Zones that aren't traced one by one are
+    ///         written as per frame counters.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the file.
+    ///
+    /// \returns    False if the file couldn't be written.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto stopCapture(const std::string& path) -> bool;
+
+    static inline auto isCapturing() -> bool { return is_capturing_.load(std::memory_order_relaxed); }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static inline void Timing::addZone(const TimingZone zone, const TimingClock::time_point start, const std::chrono::nanoseconds duration, const std::chrono::nanoseconds self)
+    ///
+    /// \brief  Accounts a closed zone to the calling thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  zone        The zone.
+    /// \param  start       Zone start.
+    /// \param  duration    Zone duration.
+    /// \param  self        Zone duration, nested zones excluded.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static inline void addZone(const TimingZone                zone,
+                               const TimingClock::time_point   start,
+                               const std::chrono::nanoseconds duration,
+                               const std::chrono::nanoseconds self) {
+        auto& buffer = threadBuffer();
+        buffer.addSelfTime(zone, self);
+        if (isCapturing() && timing_zones_info[static_cast<std::size_t>(zone)].is_traced) {
+            buffer.addEvent({start, duration, zone});
+        }
+    }
+
+  private:
+    struct FrameCounters {
+        TimingClock::time_point time;    ///< End of the frame.
+        FrameTimings            timings; ///< Timings of the frame.
+    };
+
+    static auto threadBuffer() -> ZoneBuffer&;
+
+    static std::atomic<bool>                        is_capturing_;       ///< True while zones are recorded.
+    static std::mutex                               buffers_mutex_;      ///< Protects the data below.
+    static std::vector<std::shared_ptr<ZoneBuffer>> buffers_;            ///< Buffers of the threads.
+    static u32                                      buffers_count_;      ///< Number of buffers created, used as index.
+    static std::array<FrameTimings, history_size>   history_;            ///< Timings of the last frames.
+    static std::size_t                              history_index_;      ///< Next history slot written.
+    static std::size_t                              history_count_;      ///< Number of valid history slots.
+    static TimingClock::time_point                  last_frame_end_;     ///< End of the previous frame.
+    static TimingClock::time_point                  capture_start_;      ///< Start of the current capture.
+    static std::vector<FrameCounters>               capture_frames_;     ///< Frames of the current capture.
+    static u32                                      frame_thread_index_; ///< Index of the thread calling onFrameEnd().
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  TimingScope
+///
+/// \brief  Measures a zone from its construction to its destruction. Used through TIMING_ZONE().
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class TimingScope {
+  public:
+    //@{
+    // Constructors / Destructors
+    TimingScope() = delete;
+    explicit TimingScope(const TimingZone zone) : zone_(zone), parent_(current_), start_(TimingClock::now()) { current_ = this; }
+    TimingScope(const TimingScope&)                      = delete;
+    TimingScope(TimingScope&&)                           = delete;
+    auto operator=(const TimingScope&) & -> TimingScope& = delete;
+    auto operator=(TimingScope&&) & -> TimingScope&      = delete;
+    ~TimingScope() {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(TimingClock::now() - start_);
+        current_            = parent_;
+        if (parent_ != nullptr) { parent_->children_time_ += duration; }
+        Timing::addZone(zone_, start_, duration, duration - children_time_);
+    }
+    //@}
+
+  private:
+    inline static thread_local TimingScope* current_{nullptr}; ///< Innermost zone of the thread.
+
+    TimingZone               zone_;            ///< The zone measured.
+    TimingScope*             parent_;          ///< Zone enclosing this one.
+    TimingClock::time_point  start_;           ///< Zone start.
+    std::chrono::nanoseconds children_time_{}; ///< Time spent in nested zones.
+};
+
+} // namespace saturnin::core
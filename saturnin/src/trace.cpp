@@ -0,0 +1,173 @@
+//
+// trace.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/trace.h>
+#include <algorithm> // stable_sort
+#include <chrono>    // milliseconds
+#include <saturnin/src/log.h>
+#include <saturnin/src/utilities.h> // format, toUnderlying
+
+namespace saturnin::core {
+
+namespace uti = saturnin::utilities;
+
+constexpr auto writer_period = std::chrono::milliseconds(10);
+
+std::atomic<bool>                       Trace::is_enabled_{false};
+std::atomic<u64>                        Trace::cycles_{};
+std::mutex                              Trace::rings_mutex_;
+std::ofstream                           Trace::file_;
+std::vector<std::shared_ptr<TraceRing>> Trace::rings_;
+u8                                      Trace::rings_count_{};
+std::jthread                            Trace::writer_;
+std::vector<TraceRecord>                Trace::write_buffer_;
+
+void TraceRing::drain(std::vector<TraceRecord>& out) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    const auto head = head_.load(std::memory_order_acquire);
+    for (auto i = tail; i != head; ++i) {
+        out.push_back(records_[i & mask]);
+    }
+    if (head != tail) { last_cycle_ = records_[(head - 1) & mask].cycle; }
+    tail_.store(head, std::memory_order_release);
+
+    // The marker is stamped with this ring's last record, other rings may have been drained to the same vector.
+    const auto dropped = dropped_.load(std::memory_order_relaxed);
+    if (dropped != reported_dropped_) {
+        out.push_back({last_cycle_,
+                       static_cast<u16>(TraceEvent::records_dropped),
+                       index_,
+                       index_,
+                       static_cast<u32>(dropped - reported_dropped_)});
+        reported_dropped_ = dropped;
+    }
+}
+
+auto Trace::start(const std::string& path) -> bool {
+    auto lock = std::scoped_lock(rings_mutex_);
+    if (is_enabled_) { return true; }
+
+    file_.open(path, std::ios::binary | std::ios::trunc);
+    if (!file_) {
+        Log::warning(Logger::main, tr("Could not open trace file {}"), path);
+        return false;
+    }
+    const auto header = TraceFileHeader{};
+    file_.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    writer_ = std::jthread(&Trace::writerThread);
+    is_enabled_.store(true, std::memory_order_relaxed);
+    Log::info(Logger::main, tr("Tracing to {}"), path);
+    return true;
+}
+
+void Trace::stop() {
+    if (!is_enabled_.exchange(false)) { return; }
+    writer_.request_stop();
+    if (writer_.joinable()) { writer_.join(); }
+
+    drainRings();
+    auto lock = std::scoped_lock(rings_mutex_);
+    file_.close();
+}
+
+void Trace::writerThread(const std::stop_token& token) {
+    while (!token.stop_requested()) {
+        std::this_thread::sleep_for(writer_period);
+        drainRings();
+    }
+}
+
+void Trace::drainRings() {
+    auto lock = std::scoped_lock(rings_mutex_);
+    write_buffer_.clear();
+    for (const auto& ring : rings_) {
+        ring->drain(write_buffer_);
+    }
+
+    // Rings only referenced here belong to threads that have exited, they can go once emptied.
+    std::erase_if(rings_, [](const auto& ring) { return ring.use_count() == 1; });
+
+    if (write_buffer_.empty() || !file_.is_open()) { return; }
+    std::ranges::stable_sort(write_buffer_, {}, &TraceRecord::cycle);
+    file_.write(reinterpret_cast<const char*>(write_buffer_.data()),
+                static_cast<std::streamsize>(write_buffer_.size() * sizeof(TraceRecord)));
+}
+
+auto Trace::threadRing() -> TraceRing& {
+    thread_local auto ring = std::shared_ptr<TraceRing>{};
+    if (!ring) {
+        auto lock = std::scoped_lock(rings_mutex_);
+        ring      = std::make_shared<TraceRing>(rings_count_++);
+        rings_.push_back(ring);
+    }
+    return *ring;
+}
+
+auto Trace::decode(const std::string& trace_path, const std::string& output_path) -> bool {
+    auto input = std::ifstream(trace_path, std::ios::binary);
+    if (!input) {
+        Log::warning(Logger::main, tr("Could not open trace file {}"), trace_path);
+        return false;
+    }
+
+    auto header = TraceFileHeader{};
+    input.read(reinterpret_cast<char*>(&header), sizeof(header));
+    if (!input || header.magic != TraceFileHeader{}.magic || header.version != TraceFileHeader{}.version
+        || header.record_size != sizeof(TraceRecord)) {
+        Log::warning(Logger::main, tr("{} isn't a valid trace file"), trace_path);
+        return false;
+    }
+
+    auto output = std::ofstream(output_path, std::ios::trunc);
+    auto record = TraceRecord{};
+    while (input.read(reinterpret_cast<char*>(&record), sizeof(record))) {
+        auto line = uti::format("{:>14} [{:d}] ", record.cycle, record.ring);
+        switch (static_cast<TraceEvent>(record.event)) {
+            using enum TraceEvent;
+            case records_dropped: line += uti::format("{:d} record(s) dropped", record.payload); break;
+            case sh2_delay_slot:
+                line += uti::format("{} SH2 delay slot, PC={:#010x}", (record.extra == 1) ? "Master" : "Slave", record.payload);
+                break;
+            case scu_interrupt:
+                line += uti::format("SCU interrupt, vector={:#04x} level={:d}", record.payload, record.extra);
+                break;
+            case scu_dma_start:
+                line += uti::format("SCU DMA level {:d} start, read address={:#010x}", record.extra, record.payload);
+                break;
+            case vdp2_register_write:
+                line += uti::format("VDP2 register write, {:#06x}={:#06x}", record.payload >> 16, record.payload & 0xFFFF);
+                break;
+            case cdrom_command:
+                line += uti::format("CD block command {:#04x}, CR2={:#06x} CR3={:#06x}",
+                                    record.extra,
+                                    record.payload >> 16,
+                                    record.payload & 0xFFFF);
+                break;
+            default: line += uti::format("Unknown event {:d}", record.event);
+        }
+        output << line << '\n';
+    }
+
+    Log::info(Logger::main, tr("Trace decoded to {}"), output_path);
+    return true;
+}
+
+} // namespace saturnin::core
@@ -0,0 +1,294 @@
+//
+// trace.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	trace.h
+///
+/// \brief	Declares the static Trace class, used to record binary events from the emulation.
+///
+/// Events are written as fixed size records into a bounded ring owned by the producing thread, and
+/// a background thread drains the rings into a binary file. Nothing is formatted on the emulation
+/// side : the file is converted to text afterwards by Trace::decode().
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>       // array
+#include <atomic>      // atomic
+#include <fstream>     // ofstream
+#include <memory>      // shared_ptr
+#include <mutex>       // mutex
+#include <stop_token>  // stop_token
+#include <string>      // string
+#include <thread>      // jthread
+#include <type_traits> // is_trivially_copyable_v
+#include <vector>      // vector
+#include <saturnin/src/emulator_defs.h>
+
+namespace saturnin::core {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \enum   TraceEvent
+///
+/// \brief  Events that can be recorded in the trace. Meaning of the extra and payload fields of the
+///         record depends on the event.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+enum class TraceEvent : u16 {
+    records_dropped,     ///< Records lost because a ring was full. extra : ring index, payload : number of records.
+    sh2_delay_slot,      ///< SH2 delay slot executed. extra : Sh2Type, payload : PC.
+    scu_interrupt,       ///< Interrupt generated by the SCU. extra : level, payload : vector.
+    scu_dma_start,       ///< SCU DMA transfer started. extra : DMA level, payload : read address.
+    vdp2_register_write, ///< VDP2 register written. payload : register offset (upper 16 bits) | data (lower 16 bits).
+    cdrom_command        ///< CD block command executed. extra : command, payload : CR2 (upper 16 bits) | CR3 (lower 16 bits).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct TraceRecord
+///
+/// \brief  A trace record, as written in the trace file.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TraceRecord {
+    u64 cycle;   ///< Master SH2 cycle count when the record was written.
+    u16 event;   ///< The TraceEvent.
+    u8  ring;    ///< Index of the ring the record was written to, one ring by producing thread.
+    u8  extra;   ///< Event dependant data.
+    u32 payload; ///< Event dependant data.
+};
+static_assert(sizeof(TraceRecord) == 16, "TraceRecord layout is part of the trace file format");
+static_assert(std::is_trivially_copyable_v<TraceRecord>);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct TraceFileHeader
+///
+/// \brief  Header written at the start of the trace file.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TraceFileHeader {
+    std::array<char, 4> magic{'S', 'T', 'R', 'C'}; ///< File identifier.
+    u16                 version{1};                 ///< Format version.
+    u16                 record_size{sizeof(TraceRecord)}; ///< Size of one record, in bytes.
+};
+static_assert(sizeof(TraceFileHeader) == 8, "TraceFileHeader layout is part of the trace file format");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  TraceRing
+///
+/// \brief  Single producer / single consumer ring of trace records.
+///
+/// The producer is the thread owning the ring, the consumer is the trace writer thread. When the
+/// ring is full, new records are dropped and counted instead of blocking the producer.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class TraceRing {
+  public:
+    static constexpr auto capacity = std::size_t{0x10000}; ///< Number of records in the ring (1 MiB).
+
+    explicit TraceRing(const u8 index) : index_(index) {}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void TraceRing::push(const TraceRecord& record);
+    ///
+    /// \brief  Adds a record to the ring. Must only be called from the producing thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  record  The record to add.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void push(const TraceRecord& record) {
+        const auto head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) == capacity) {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return;
+        }
+        records_[head & mask] = record;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void TraceRing::drain(std::vector<TraceRecord>& out);
+    ///
+    /// \brief  Moves every available record to the end of the vector. Must only be called from the
+    ///         consuming thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param [in,out] out Vector the records are appended to.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void drain(std::vector<TraceRecord>& out);
+
+    [[nodiscard]] auto index() const -> u8 { return index_; }
+
+  private:
+    static constexpr auto mask = capacity - 1;
+    static_assert((capacity & mask) == 0, "Ring capacity must be a power of 2");
+
+    alignas(64) std::atomic<u64> head_{}; ///< Next slot written by the producer.
+    alignas(64) std::atomic<u64> tail_{}; ///< Next slot read by the consumer.
+    std::atomic<u64> dropped_{};          ///< Number of records dropped since the ring creation.
+    u64              reported_dropped_{}; ///< Dropped records already reported by the consumer.
+    u64              last_cycle_{};       ///< Cycle of the last record drained by the consumer.
+    u8               index_;              ///< Index of the ring.
+
+    std::array<TraceRecord, capacity> records_{}; ///< The records.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  Trace
+///
+/// \brief  Records binary events from the emulation threads into a trace file.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Trace {
+  public:
+    //@{
+    // Constructors / Destructors
+    Trace()                                  = delete;
+    Trace(const Trace&)                      = delete;
+    Trace(Trace&&)                           = delete;
+    auto operator=(const Trace&) & -> Trace& = delete;
+    auto operator=(Trace&&) & -> Trace&      = delete;
+    ~Trace()                                 = delete;
+    //@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto Trace::start(const std::string& path) -> bool;
+    ///
+    /// \brief  Opens the trace file and starts the writer thread. Does nothing if the trace is already
+    ///         started.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  path    Path of the trace file.
+    ///
+    /// \returns    False if the file couldn't be opened.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto start(const std::string& path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static void Trace::stop();
+    ///
+    /// \brief  Stops recording, writes the remaining records and closes the trace file.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void stop();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto Trace::decode(const std::string& trace_path, const std::string& output_path) -> bool;
+    ///
+    /// \brief  Converts a binary trace file to text.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  trace_path  Path of the binary trace file.
+    /// \param  output_path Path of the generated text file.
+    ///
+    /// \returns    False if the trace file couldn't be read.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto decode(const std::string& trace_path, const std::string& output_path) -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static inline auto Trace::isEnabled() -> bool
+    ///
+    /// \brief  Checks if events are currently recorded.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if the trace is started.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static inline auto isEnabled() -> bool { return is_enabled_.load(std::memory_order_relaxed); }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static inline void Trace::advanceCycles(const u32 cycles)
+    ///
+    /// \brief  Advances the cycle count used to timestamp the records. Only called by the emulation
+    ///         main thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  cycles  Number of cycles elapsed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static inline void advanceCycles(const u32 cycles) {
+        cycles_.store(cycles_.load(std::memory_order_relaxed) + cycles, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static inline void Trace::record(const TraceEvent event, const u32 payload, const u8 extra = 0)
+    ///
+    /// \brief  Records an event in the ring of the calling thread. Does nothing when the trace isn't
+    ///         started.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  event   The event.
+    /// \param  payload Event dependant data.
+    /// \param  extra   Event dependant data.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static inline void record(const TraceEvent event, const u32 payload, const u8 extra = 0) {
+        if (!isEnabled()) { return; }
+        auto& ring = threadRing();
+        ring.push({cycles_.load(std::memory_order_relaxed), static_cast<u16>(event), ring.index(), extra, payload});
+    }
+
+  private:
+    static auto threadRing() -> TraceRing&;
+    static void writerThread(const std::stop_token& token);
+    static void drainRings();
+
+    static std::atomic<bool>                       is_enabled_;   ///< True when events are recorded.
+    static std::atomic<u64>                        cycles_;       ///< Cycle count used to timestamp the records.
+    static std::mutex                              rings_mutex_;  ///< Protects rings_ and the trace file.
+    static std::ofstream                           file_;         ///< The trace file.
+    static std::vector<std::shared_ptr<TraceRing>> rings_;        ///< Rings of the producing threads.
+    static u8                                      rings_count_;  ///< Number of rings created, used as ring index.
+    static std::jthread                            writer_;       ///< Thread writing the records to the file.
+    static std::vector<TraceRecord>                write_buffer_; ///< Records drained, waiting to be written.
+};
+
+} // namespace saturnin::core
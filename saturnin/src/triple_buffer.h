@@ -0,0 +1,149 @@
+//
+// triple_buffer.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	triple_buffer.h
+///
+/// \brief	Declares the TripleBuffer class, used to hand data over between two threads without locking.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>                        // array
+#include <atomic>                       // atomic
+#include <saturnin/src/emulator_defs.h> // u8
+
+namespace saturnin::core {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \class  TripleBuffer
+///
+/// \brief  Lock free single producer / single consumer triple buffer.
+///
+/// The writer fills the back buffer and publishes it, the reader acquires the last published buffer. Neither side ever
+/// waits for the other : when the reader is slower, intermediate buffers are replaced by newer ones.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \tparam T   Type of the buffered data.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+class TripleBuffer {
+  public:
+    ///@{
+    /// Constructors / Destructors
+    TripleBuffer()                                          = default;
+    TripleBuffer(const TripleBuffer&)                       = delete;
+    TripleBuffer(TripleBuffer&&)                            = delete;
+    auto operator=(const TripleBuffer&) & -> TripleBuffer&  = delete;
+    auto operator=(TripleBuffer&&) & -> TripleBuffer&       = delete;
+    ~TripleBuffer()                                         = default;
+    ///@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto TripleBuffer::writeBuffer() -> T&
+    ///
+    /// \brief  Returns the buffer owned by the writer. Its content is whatever was stored there the last time it was
+    ///         used, it's up to the writer to reset it.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The write buffer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto writeBuffer() -> T& { return buffers_[back_]; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto TripleBuffer::publish() -> bool
+    ///
+    /// \brief  Makes the write buffer available to the reader, the writer gets a new buffer.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    False if the previously published buffer wasn't acquired by the reader. In that case it becomes the
+    ///             new write buffer, with its content untouched.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto publish() -> bool {
+        const auto previous = shared_.exchange(static_cast<u8>(back_ | fresh_flag), std::memory_order_acq_rel);
+        back_               = static_cast<u8>(previous & index_mask);
+        return (previous & fresh_flag) == 0;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] auto TripleBuffer::hasNewData() const -> bool
+    ///
+    /// \brief  Checks if a buffer was published since the last acquisition.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if a new buffer can be acquired.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto hasNewData() const -> bool { return (shared_.load(std::memory_order_acquire) & fresh_flag) != 0; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto TripleBuffer::acquire() -> bool
+    ///
+    /// \brief  Makes the last published buffer the read buffer.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    False if nothing was published since the last call, the read buffer is unchanged.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto acquire() -> bool {
+        if (!hasNewData()) { return false; }
+        const auto previous = shared_.exchange(front_, std::memory_order_acq_rel);
+        front_              = static_cast<u8>(previous & index_mask);
+        return true;
+    }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto TripleBuffer::readBuffer() const -> const T&
+    ///
+    /// \brief  Returns the buffer owned by the reader.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The last acquired buffer.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto readBuffer() const -> const T& { return buffers_[front_]; }
+
+  private:
+    static constexpr auto index_mask = u8{0x3};
+    static constexpr auto fresh_flag = u8{0x4}; ///< Set when the shared buffer wasn't acquired yet.
+
+    std::array<T, 3> buffers_{}; ///< The three buffers.
+
+    // Each index is only touched by its owner thread, they are kept apart to avoid false sharing.
+    alignas(64) u8 back_{0};                ///< Index of the buffer owned by the writer.
+    alignas(64) u8 front_{1};               ///< Index of the buffer owned by the reader.
+    alignas(64) std::atomic<u8> shared_{2}; ///< Index of the buffer being exchanged, with the fresh flag.
+};
+
+} // namespace saturnin::core
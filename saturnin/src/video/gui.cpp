@@ -27,14 +27,17 @@
 #include <saturnin/src/emulator_enums.h> // EmulationStatus
 #include <saturnin/src/locale.h>         // tr
 #include <saturnin/src/log.h>            // Log
+#include <saturnin/src/rewind.h>         // Rewind
 #include <saturnin/src/sh2/basic_interpreter/sh2_instructions.h>
 #include <saturnin/src/smpc.h> // SaturnDigitalPad, PeripheralKey
 #include <saturnin/src/tests.h>
 #include <saturnin/src/thread_pool.h>                   // ThreadPool
+#include <saturnin/src/timing.h>                        // Timing
 #include <saturnin/src/utilities.h>                     // stringToVector, format
 #include <saturnin/src/cdrom/scsi.h>                    // ScsiDriveInfo
 #include <saturnin/src/video/opengl/opengl_texturing.h> // OpenglTexturing
 #include <saturnin/src/video/opengl/opengl_render.h>    // OpenglRender
+#include <saturnin/src/video/software_renderer.h>       // SoftwareRenderer
 #include <saturnin/src/video/texture.h>                 // Texture
 #include <saturnin/src/video/vdp1.h>                    // Vdp1
 #include <saturnin/src/video/vdp2/vdp2.h>               // vram_timing_size
@@ -64,6 +67,7 @@ using core::SaturnDigitalPad;
 using core::StvBoardControls;
 using core::StvPlayerControls;
 using core::ThreadPool;
+using core::internTr;
 using core::tr;
 using sh2::Sh2Register;
 using sh2::Sh2Type;
@@ -89,14 +93,15 @@ void showCoreWindow(GuiConfiguration& conf, core::EmulatorContext& state) {
     const auto pos_x = float{ImGui::GetMainViewport()->Pos.x + ImGui::GetMainViewport()->Size.x};
     const auto pos_y = float{ImGui::GetMainViewport()->Pos.y};
     ImGui::SetNextWindowPos(ImVec2(pos_x, pos_y), ImGuiCond_Once);
-    const auto size = ImVec2(275, 80);
+    const auto size = ImVec2(275, 105);
     ImGui::SetNextWindowSize(size);
 
     auto wc                     = ImGuiWindowClass{};
     wc.ViewportFlagsOverrideSet = ImGuiViewportFlags_NoAutoMerge;
     ImGui::SetNextWindowClass(&wc);
 
-    ImGui::Begin(tr("Core").c_str(), nullptr, window_flags);
+    static const auto title = internTr("Core");
+    ImGui::Begin(tr(title).data(), nullptr, window_flags);
 
     showMainMenu(conf, state);
 
@@ -112,6 +117,16 @@ void showCoreWindow(GuiConfiguration& conf, core::EmulatorContext& state) {
         state.stopEmulation();
         conf.show_debug_sh2 = false;
     }
+    auto is_fast_forward_enabled = state.isFastForwardEnabled();
+    if (ImGui::Checkbox(tr("Fast forward").c_str(), &is_fast_forward_enabled)) { state.fastForward(is_fast_forward_enabled); }
+    ImGui::SameLine();
+    if (ImGui::Button(tr("Rewind").c_str(), button_width)) { state.requestRewind(); }
+    ImGui::SameLine();
+    constexpr auto bytes_per_megabyte = std::size_t{1024 * 1024};
+    ImGui::TextUnformatted(uti::format(tr("{} state(s), {} MB"),
+                                       state.rewind()->snapshotsNumber(),
+                                       state.rewind()->memoryUsed() / bytes_per_megabyte)
+                               .c_str());
 
     ImGui::End();
 }
@@ -119,7 +134,8 @@ void showCoreWindow(GuiConfiguration& conf, core::EmulatorContext& state) {
 void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
     if (ImGui::BeginMenuBar()) {
         // File
-        if (ImGui::BeginMenu(tr("File").c_str())) {
+        static const auto file_menu = internTr("File");
+        if (ImGui::BeginMenu(tr(file_menu).data())) {
             if (ImGui::BeginMenu(tr("Load ST-V rom").c_str())) {
                 auto games = core::listAvailableStvGames();
 
@@ -152,6 +168,16 @@ void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
             if (ImGui::MenuItem(tr("Load binary file").c_str(), nullptr, &conf.show_file_load_binary)) {
                 // No code is needed here, the boolean will open the window
             }
+            ImGui::Separator();
+            const auto quick_state_path = std::string{"states/quick.sst"};
+            const auto is_running       = (state.emulationStatus() == core::EmulationStatus::running);
+            if (ImGui::MenuItem(tr("Quick save state").c_str(), nullptr, false, is_running)) {
+                state.requestStateSave(quick_state_path);
+            }
+            if (ImGui::MenuItem(tr("Quick load state").c_str(), nullptr, false, is_running)) {
+                state.requestStateLoad(quick_state_path);
+            }
+            ImGui::Separator();
             if (ImGui::MenuItem(tr("Exit").c_str())) { state.renderingStatus(core::RenderingStatus::stopped); }
 
             ImGui::EndMenu();
@@ -163,7 +189,8 @@ void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
             using enum core::EmulationStatus;
             case running:
             case reset: {
-                if (ImGui::BeginMenu(tr("Debug").c_str())) {
+                static const auto debug_menu = internTr("Debug");
+                if (ImGui::BeginMenu(tr(debug_menu).data())) {
                     if (ImGui::BeginMenu(tr("Memory").c_str())) {
                         ImGui::MenuItem(tr("Editor").c_str(), nullptr, &conf.show_debug_memory_editor);
                         ImGui::MenuItem(tr("Dump").c_str(), nullptr, &conf.show_debug_memory_dump);
@@ -188,7 +215,8 @@ void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
             default: break;
         }
 
-        if (ImGui::BeginMenu(tr("Options").c_str())) {
+        static const auto options_menu = internTr("Options");
+        if (ImGui::BeginMenu(tr(options_menu).data())) {
             enum class Header : u8 {
                 general     = 0,
                 rendering   = 1,
@@ -331,6 +359,16 @@ void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
                 if (ImGui::Combo("##renderers", &index_renderer, renderers)) {
                     state.config()->writeValue(core::AccessKeys::cfg_rendering_renderer, renderers[index_renderer]);
                 }
+
+                // Fast forward frame skip
+                ImGui::TextUnformatted(tr("Fast forward frame skip").c_str());
+                ImGui::SameLine(second_column_offset);
+                constexpr auto max_frame_skip = s32{30};
+                s32            frame_skip     = state.config()->readValue(core::AccessKeys::cfg_rendering_fast_forward_frame_skip);
+                if (ImGui::SliderInt("##frame_skip", &frame_skip, 0, max_frame_skip)) {
+                    state.config()->writeValue(core::AccessKeys::cfg_rendering_fast_forward_frame_skip, frame_skip);
+                    state.vdp2()->fastForwardFrameSkip(frame_skip);
+                }
             }
 
             // Paths header
@@ -467,6 +505,51 @@ void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
                         Log::warning(Logger::config, tr("Unknown drive access method ..."));
                     }
                 }
+                ImGui::SameLine();
+                if (ImGui::RadioButton(tr("Image").c_str(), &method, util::toUnderlying(cdrom::CdromAccessMethod::image))) {
+                    const auto key = state.config()->getCdromAccessKey(cdrom::CdromAccessMethod::image);
+                    if (key != std::nullopt) {
+                        state.config()->writeValue(core::AccessKeys::cfg_cdrom_access_method, *key);
+                    } else {
+                        Log::warning(Logger::config, tr("Unknown drive access method ..."));
+                    }
+                }
+
+                // Disc image
+                {
+                    constexpr auto string_size = u8{255};
+                    ImGui::TextUnformatted(tr("Disc image").c_str());
+                    ImGui::SameLine(second_column_offset);
+
+                    const std::string full_path    = state.config()->readValue(core::AccessKeys::cfg_cdrom_image);
+                    auto              path_for_gui = util::stringToVector(full_path, string_size);
+                    if (ImGui::InputText("##cdrom_image", path_for_gui.data(), path_for_gui.capacity())) {
+                        state.config()->writeValue(core::AccessKeys::cfg_cdrom_image, path_for_gui.data());
+                    }
+
+                    ImGui::SameLine();
+                    static auto select_dialog = ImGui::FileBrowser();
+                    if (ImGui::Button("...##cdrom_image")) {
+                        select_dialog.SetTitle(tr("Select a disc image ..."));
+                        select_dialog.SetTypeFilters({".cue", ".chd", ".iso", ".bin", ".*"});
+                        select_dialog.SetPwd(fs::path{full_path}.parent_path());
+                        select_dialog.Open();
+                    }
+                    select_dialog.Display();
+
+                    if (select_dialog.HasSelected()) {
+                        state.config()->writeValue(core::AccessKeys::cfg_cdrom_image, select_dialog.GetSelected().string());
+                    }
+                }
+
+                // Fast boot
+                ImGui::TextUnformatted(tr("Fast boot").c_str());
+                ImGui::SameLine(second_column_offset);
+
+                static bool is_fast_boot_set = state.config()->readValue(core::AccessKeys::cfg_cdrom_fast_boot);
+                if (ImGui::Checkbox("##cdrom_fast_boot", &is_fast_boot_set)) {
+                    state.config()->writeValue(core::AccessKeys::cfg_cdrom_fast_boot, is_fast_boot_set);
+                }
 
                 // CD-Rom system ID
             }
@@ -870,9 +953,11 @@ void showMainMenu(GuiConfiguration& conf, core::EmulatorContext& state) {
         // Tests
         if (ImGui::BeginMenu(tr("Benchmarks").c_str())) {
             ImGui::MenuItem(tr("Threads").c_str(), nullptr, &conf.show_benchmarks);
+            ImGui::MenuItem(tr("Timing").c_str(), nullptr, &conf.show_timing);
             ImGui::EndMenu();
         }
         if (conf.show_benchmarks) { showBenchmarkWindow(state, &conf.show_benchmarks); }
+        if (conf.show_timing) { showTimingWindow(&conf.show_timing); }
 
         ImGui::EndMenuBar();
     }
@@ -951,8 +1036,20 @@ void showRenderingWindow(core::EmulatorContext& state) {
 
     ImGui::Begin("Video rendering", nullptr, flags);
 
-    if (state.opengl()->areFbosInitialized()) {
+    if (state.vdp2()->rendererType() == video::RendererType::renderer_software) {
+        // The frame rendered on the CPU is uploaded to a texture when a new one is available.
+        static auto texture_id = u32{};
+        auto*       renderer   = state.softwareRenderer();
+        if (renderer->acquireFrame()) {
+            const auto& frame = renderer->frame();
+            if (texture_id != 0) { video::OpenglTexturing::deleteTexture(texture_id); }
+            texture_id = video::OpenglTexturing::generateTexture(frame.size.w, frame.size.h, frame.rgba);
+        }
+        const auto alpha = 0xff;
+        if (texture_id != 0) { gui::addTextureToDrawList(static_cast<s32>(texture_id), width, height, alpha); }
+    } else if (state.opengl()->areFbosInitialized()) {
         if (state.opengl()->render()->isThereSomethingToRender()) {
+            state.opengl()->render()->acquireRenderPacket();
             state.opengl()->texturing()->generateTextures();
             state.opengl()->render()->renderSelector();
         }
@@ -1009,7 +1106,7 @@ void showLogWindow(const core::EmulatorContext& state, bool* opened) {
 }
 
 void showDebugSh2Window(core::EmulatorContext& state, bool* opened) {
-    const auto window_size = ImVec2(670, 465);
+    const auto window_size = ImVec2(670, 675);
     ImGui::SetNextWindowSize(window_size);
 
     auto window_flags
@@ -1280,6 +1377,101 @@ void showDebugSh2Window(core::EmulatorContext& state, bool* opened) {
         ImGui::EndChild();
     }
 
+    {
+        // Profiler
+        const auto child_size = ImVec2(665, 205);
+        ImGui::BeginChild("ChildProfiler", child_size, true, window_flags);
+        ImGui::ChildWindowHeader(tr("Profiler"));
+
+        if constexpr (!sh2::is_profiler_compiled) {
+            ImGui::TextUnformatted(tr("The profiler isn't available in this build.").c_str());
+        } else {
+            auto& profiler = current_sh2->profiler();
+
+            auto is_enabled = profiler.isEnabled();
+            if (ImGui::Checkbox(tr("Enabled").c_str(), &is_enabled)) { profiler.isEnabled(is_enabled); }
+            ImGui::SameLine();
+            auto are_blocks_counted = profiler.areBlocksCounted();
+            if (ImGui::Checkbox(tr("Basic blocks").c_str(), &are_blocks_counted)) { profiler.areBlocksCounted(are_blocks_counted); }
+            ImGui::SameLine();
+            auto are_function_cycles_counted = profiler.areFunctionCyclesCounted();
+            if (ImGui::Checkbox(tr("Cycles by function").c_str(), &are_function_cycles_counted)) {
+                profiler.areFunctionCyclesCounted(are_function_cycles_counted);
+            }
+            ImGui::SameLine();
+            constexpr auto period_width = 90.f;
+            auto           period       = static_cast<int>(profiler.samplingPeriod());
+            ImGui::SetNextItemWidth(period_width);
+            if (ImGui::InputInt(tr("Sampling period").c_str(), &period, 0)) { profiler.samplingPeriod(static_cast<u32>(period)); }
+
+            // Symbols are shared by both CPUs, as they usually come from the same program.
+            static auto symbols_dialog = ImGui::FileBrowser();
+            if (ImGui::Button(tr("Load symbols ...").c_str())) {
+                symbols_dialog.SetTitle(tr("Select a symbols file ..."));
+                symbols_dialog.SetTypeFilters({".elf", ".cof", ".coff", ".sym", ".map", ".txt", ".*"});
+                symbols_dialog.Open();
+            }
+            symbols_dialog.Display();
+            if (symbols_dialog.HasSelected()) {
+                if (state.masterSh2()->profiler().isEnabled() || state.slaveSh2()->profiler().isEnabled()) {
+                    Log::warning(Logger::gui, tr("Symbols can't be loaded while profiling"));
+                } else {
+                    const auto path = symbols_dialog.GetSelected().string();
+                    state.masterSh2()->profiler().symbols().load(path);
+                    state.slaveSh2()->profiler().symbols().load(path);
+                }
+                symbols_dialog.ClearSelected();
+            }
+            ImGui::SameLine();
+            if (ImGui::Button(tr("Export").c_str())) {
+                const auto name = (sh2_type == Sh2Type::master) ? std::string{"master"} : std::string{"slave"};
+                profiler.exportCollapsedStacks(uti::format("logs/sh2_{}.folded", name));
+                profiler.exportFunctions(uti::format("logs/sh2_{}_functions.csv", name));
+            }
+            ImGui::SameLine();
+            if (ImGui::Button(tr("Reset").c_str())) { profiler.reset(); }
+            ImGui::SameLine();
+            ImGui::TextUnformatted(uti::format(tr("{} samples"), profiler.samplesCount()).c_str());
+
+            // Results are aggregated on the GUI thread, the list is only refreshed a few times per second.
+            constexpr auto refresh_period = u32{30};
+            constexpr auto max_displayed  = std::size_t{100};
+            static auto    frames_count   = u32{};
+            static auto    displayed_type = Sh2Type{Sh2Type::master};
+            static auto    functions      = std::vector<sh2::ProfiledFunction>{};
+            if (frames_count++ % refresh_period == 0 || displayed_type != sh2_type) {
+                functions      = profiler.functions();
+                displayed_type = sh2_type;
+                if (functions.size() > max_displayed) { functions.resize(max_displayed); }
+            }
+
+            const auto table_size  = ImVec2(0.0f, 130.f);
+            const auto table_flags = ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_ScrollY | ImGuiTableFlags_PadOuterX
+                                     | ImGuiTableFlags_RowBg;
+            if (ImGui::BeginTable("profiler", 4, table_flags, table_size)) {
+                ImGui::TableSetupScrollFreeze(0, 1);
+                ImGui::TableSetupColumn(tr("Function").c_str());
+                ImGui::TableSetupColumn(tr("Address").c_str());
+                ImGui::TableSetupColumn(tr("Self cycles").c_str());
+                ImGui::TableSetupColumn(tr("Samples").c_str());
+                ImGui::TableHeadersRow();
+                std::ranges::for_each(functions, [](const auto& f) {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::TextUnformatted(f.name.c_str());
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::TextUnformatted(uti::format("{:#010x}", f.address).c_str());
+                    ImGui::TableSetColumnIndex(2);
+                    ImGui::TextUnformatted(uti::format("{}", f.self_cycles).c_str());
+                    ImGui::TableSetColumnIndex(3);
+                    ImGui::TextUnformatted(uti::format("{}", f.samples).c_str());
+                });
+                ImGui::EndTable();
+            }
+        }
+        ImGui::EndChild();
+    }
+
     ImGui::PopStyleVar();
     ImGui::PopStyleVar();
     ImGui::PopStyleVar();
@@ -1293,7 +1485,8 @@ void showDebugMemoryEditorWindow(core::EmulatorContext& state, bool* opened) {
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("Memory debug").c_str(), opened, window_flags);
+    static const auto title = internTr("Memory debug");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     static auto current_area = MemoryMapArea::rom;
 
@@ -1335,7 +1528,8 @@ void showDebugMemoryDumpWindow(core::EmulatorContext& state, bool* opened) {
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("Memory dump").c_str(), opened, window_flags);
+    static const auto title = internTr("Memory dump");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     static auto current_area = MemoryMapArea::rom;
 
@@ -1394,7 +1588,8 @@ void showDebugVdp1Window(core::EmulatorContext& state, bool* opened) {
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("VDP1 debug").c_str(), opened, window_flags);
+    static const auto title = internTr("VDP1 debug");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     if (state.debugStatus() != core::DebugStatus::disabled) {
         constexpr auto local_child_rounding = 5.0f;
@@ -1520,7 +1715,8 @@ void showDebugVdp2Window(core::EmulatorContext& state, bool* opened) {
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("VDP2 debug").c_str(), opened, window_flags);
+    static const auto title = internTr("VDP2 debug");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     using video::ScrollScreen;
     using ScrollScreenName    = std::unordered_map<ScrollScreen, std::string>;
@@ -1771,7 +1967,8 @@ void showDebugTexturesWindow(core::EmulatorContext& state, bool* opened) {
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("Textures debug").c_str(), opened, window_flags);
+    static const auto title = internTr("Textures debug");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     if (state.debugStatus() == core::DebugStatus::disabled) {
         ImGui::TextUnformatted(tr("Pause emulation to display debug data ...").c_str());
@@ -1926,7 +2123,8 @@ void showDebugSmpcWindow(core::EmulatorContext& state, bool* opened) {
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("SMPC debug").c_str(), opened, window_flags);
+    static const auto title = internTr("SMPC debug");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     ImGui::BeginChild("smpc_registers_child");
 
@@ -1972,7 +2170,8 @@ void showFileLoadBinaryWindow(GuiConfiguration& conf, core::EmulatorContext& sta
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
 
-    ImGui::Begin(tr("Load binary file").c_str(), opened, window_flags);
+    static const auto title = internTr("Load binary file");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
 
     constexpr auto string_size = u8{255};
     ImGui::TextUnformatted(tr("Binary file").c_str());
@@ -2039,15 +2238,98 @@ void showFileLoadBinaryWindow(GuiConfiguration& conf, core::EmulatorContext& sta
     ImGui::End();
 }
 
-void showBenchmarkWindow([[maybe_unused]] const core::EmulatorContext& state, bool* opened) {
+void showBenchmarkWindow(const core::EmulatorContext& state, bool* opened) {
     const auto window_size = ImVec2(600, 345);
     ImGui::SetNextWindowSize(window_size);
 
     auto window_flags
         = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
-    ImGui::Begin(tr("Benchmarks").c_str(), opened, window_flags);
+    static const auto title = internTr("Benchmarks");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
+
+    // Microbenchmarks share the texture cache and the SH2 core with the emulation.
+    if (state.emulationStatus() == core::EmulationStatus::running) {
+        ImGui::TextUnformatted(tr("Emulation must be stopped to run the microbenchmarks.").c_str());
+    } else if (ImGui::Button("Run tests")) {
+        tests::runTests();
+    }
+
+    ImGui::End();
+}
+
+void showTimingWindow(bool* opened) {
+    const auto window_size = ImVec2(520, 440);
+    ImGui::SetNextWindowSize(window_size);
+
+    auto window_flags
+        = ImGuiWindowFlags{ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoSavedSettings | ImGuiWindowFlags_NoCollapse};
+    static const auto title = internTr("Timing");
+    ImGui::Begin(tr(title).data(), opened, window_flags);
+
+    if constexpr (!core::are_timing_zones_compiled) {
+        ImGui::TextUnformatted(tr("Timing zones aren't available in this build.").c_str());
+    } else {
+        const auto capture_path = std::string{"logs/saturnin_timing.json"};
+        if (core::Timing::isCapturing()) {
+            if (ImGui::Button(tr("Stop capture").c_str())) { core::Timing::stopCapture(capture_path); }
+            ImGui::SameLine();
+            ImGui::TextUnformatted(tr("Capturing ...").c_str());
+        } else {
+            if (ImGui::Button(tr("Start capture").c_str())) { core::Timing::startCapture(); }
+            ImGui::SameLine();
+            ImGui::TextUnformatted(uti::format(tr("Chrome trace written to {}"), capture_path).c_str());
+        }
 
-    if (ImGui::Button("Run tests")) { tests::runTests(); }
+        const auto history = core::Timing::history();
+        if (history.empty()) {
+            ImGui::TextUnformatted(tr("No frame emulated yet.").c_str());
+        } else {
+            auto frames_ms = std::vector<float>{};
+            frames_ms.reserve(history.size());
+            auto average = core::FrameTimings{};
+            for (const auto& frame : history) {
+                frames_ms.push_back(static_cast<float>(frame.frame_ms));
+                average.frame_ms += frame.frame_ms / static_cast<double>(history.size());
+                for (auto i = std::size_t{}; i < core::timing_zones_number; ++i) {
+                    average.zones_ms[i] += frame.zones_ms[i] / static_cast<double>(history.size());
+                }
+            }
+
+            const auto plot_size = ImVec2(0.f, 60.f);
+            ImGui::PlotLines("##frames",
+                             frames_ms.data(),
+                             static_cast<int>(frames_ms.size()),
+                             0,
+                             uti::format(tr("Frame : {:.2f} ms (average {:.2f} ms)"), history.back().frame_ms, average.frame_ms)
+                                 .c_str(),
+                             0.f,
+                             FLT_MAX,
+                             plot_size);
+
+            // Zone times exclude the zones nested in them, the frame limiter included.
+            const auto table_flags = ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter;
+            if (ImGui::BeginTable("timing_zones", 4, table_flags)) {
+                ImGui::TableSetupColumn(tr("Zone").c_str());
+                ImGui::TableSetupColumn(tr("Last frame (ms)").c_str());
+                ImGui::TableSetupColumn(tr("Average (ms)").c_str());
+                ImGui::TableSetupColumn(tr("Average (%)").c_str());
+                ImGui::TableHeadersRow();
+                for (auto i = std::size_t{}; i < core::timing_zones_number; ++i) {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::TextUnformatted(std::string{core::timing_zones_info[i].name}.c_str());
+                    ImGui::TableSetColumnIndex(1);
+                    ImGui::TextUnformatted(uti::format("{:.3f}", history.back().zones_ms[i]).c_str());
+                    ImGui::TableSetColumnIndex(2);
+                    ImGui::TextUnformatted(uti::format("{:.3f}", average.zones_ms[i]).c_str());
+                    ImGui::TableSetColumnIndex(3);
+                    const auto percent = (average.frame_ms != 0.0) ? average.zones_ms[i] * 100.0 / average.frame_ms : 0.0;
+                    ImGui::TextUnformatted(uti::format("{:.1f}", percent).c_str());
+                }
+                ImGui::EndTable();
+            }
+        }
+    }
 
     ImGui::End();
 }
@@ -54,6 +54,7 @@ struct GuiConfiguration {
     bool show_demo                = false;
     bool show_log                 = true;
     bool show_benchmarks          = false;
+    bool show_timing              = false;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,6 +260,20 @@ void showFileLoadBinaryWindow(GuiConfiguration& conf, core::EmulatorContext& sta
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \fn	void showBenchmarkWindow(const core::EmulatorContext& state, bool* opened);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn	void showTimingWindow(bool* opened);
+///
+/// \brief	Shows the host time spent by timing zone during the last frames, and handles timing
+/// 		captures.
+///
+/// \author	Runik
+/// \date	19/10/2026
+///
+/// \param [in,out]	opened	If non-null, true if opened.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void showTimingWindow(bool* opened);
 ///
 /// \brief	Shows the benchmark window
 ///
@@ -75,8 +75,6 @@ Opengl::Opengl(core::Config* config) :
 
 Opengl::~Opengl() { shutdown(); }
 
-auto Opengl::getMutex(const MutexType& type) -> std::mutex& { return mutexes_[uti::toUnderlying(type)]; }
-
 void Opengl::initialize() {
     hostScreenResolution(ScreenResolution{video::minimum_window_width, video::minimum_window_height});
 
@@ -84,11 +82,14 @@ void Opengl::initialize() {
 
     render()->initialize();
     texturing()->initialize();
+    is_initialized_ = true;
 }
 
 void Opengl::shutdown() {
+    if (!is_initialized_) { return; }
     render()->shutdown();
     texturing()->shutdown();
+    is_initialized_ = false;
 }
 
 auto Opengl::areFbosInitialized() const -> bool { return opengl_texturing_->getFboId(FboType::general) != 0; };
@@ -177,6 +178,7 @@ auto runOpengl(core::EmulatorContext& state) -> s32 {
 
     glfwMakeContextCurrent(window);
     glfwSwapInterval(1); // Enable vsync
+    auto is_vsync_enabled = true;
     const auto ico_16 = rh::embed("saturnin-ico-16.png");
     const auto ico_32 = rh::embed("saturnin-ico-32.png");
     const auto ico_48 = rh::embed("saturnin-ico-48.png");
@@ -289,6 +291,13 @@ auto runOpengl(core::EmulatorContext& state) -> s32 {
             ImGui::RenderPlatformWindowsDefault();
         }
 
+        // Fast forward mode isn't locked to the display refresh rate.
+        if (state.isFastForwardEnabled() == is_vsync_enabled) {
+            is_vsync_enabled = !is_vsync_enabled;
+            glfwMakeContextCurrent(window);
+            glfwSwapInterval(is_vsync_enabled ? 1 : 0);
+        }
+
         glfwSwapBuffers(window);
     }
 
@@ -84,7 +84,6 @@ constexpr auto fbo_texture_array_depth = u16{14};
 constexpr auto max_fbo_texture         = u8{20};
 
 enum class FboType : u8 { general, for_gui, vdp2_debug };
-enum class MutexType : u8 { parts_list = 0, textures_link = 1, texture_delete = 2 };
 
 // Status of FBO textures in the pool.
 enum class FboTextureStatus : u8 {
@@ -177,8 +176,6 @@ class Opengl {
     // Checks if the Saturn resolution is set.
     auto isSaturnResolutionSet() const -> bool;
 
-    auto getMutex(const MutexType& type) -> std::mutex&;
-
     // Interface to the OpenglRender object.
     auto render() -> OpenglRender* { return opengl_render_.get(); };
     // Interface to the OpenglTexturing object.
@@ -195,13 +192,13 @@ class Opengl {
 
     core::Config* config_; // Configuration object.
 
+    bool is_initialized_{false}; // True once the OpenGL objects are created, they aren't in headless mode.
+
     std::unique_ptr<OpenglRender>    opengl_render_;    // OpenGL render object.
     std::unique_ptr<OpenglTexturing> opengl_texturing_; // OpenGL texturing object.
 
     ScreenResolutions screen_resolutions_; // Host and Saturn screen resolution
 
-    std::array<std::mutex, 3> mutexes_{std::mutex(), std::mutex(), std::mutex()}; // Mutexes used to protect various shared data
-
     std::string fps_; // Calculated frames per second.
 };
 
@@ -31,6 +31,7 @@
 #include <glm/gtc/type_ptr.hpp>
 #include <saturnin/src/video/opengl/opengl_shaders.h>
 #include <saturnin/src/video/opengl/opengl_texturing.h>
+#include <saturnin/src/timing.h>
 #include <saturnin/src/video/opengl/opengl_utilities.h>
 #include <saturnin/src/video/opengl/opengl_texturing.h>
 #include <saturnin/src/video/vdp1.h>
@@ -161,6 +162,7 @@ void OpenglRender::renderParts(const PartsList& parts_list, const u32 texture_id
 }
 
 void OpenglRender::render() {
+    TIMING_ZONE(core::TimingZone::opengl_render);
     if constexpr (uses_fbo) {
         renderByScreenPriority();
     } else {
@@ -171,13 +173,7 @@ void OpenglRender::render() {
 void OpenglRender::renderByScreenPriority() {
     // Parts to be displayed are moved to global_parts_list_, with one entry by priority + linked FBO (FboKey).
     // Goal is to reuse FBOs which are identical from previous frame to improve performances.
-    MapOfPartsList global_parts_list;
-
-    const auto getPartsFromThread = [&]() {
-        std::lock_guard lock(opengl_->getMutex(MutexType::parts_list));
-        if (!parts_lists_.empty()) { global_parts_list = std::move(parts_lists_); }
-    };
-    getPartsFromThread();
+    const auto& global_parts_list = render_packets_.readBuffer().parts_lists;
 
     preRender();
 
@@ -195,37 +191,18 @@ void OpenglRender::renderByScreenPriority() {
     //}
 
     postRender();
-
-    const auto notifyMainThread = [this, &global_parts_list]() {
-        std::lock_guard lk(opengl_->getMutex(MutexType::parts_list));
-        MapOfPartsList().swap(global_parts_list);
-        data_condition_.notify_one();
-    };
-    notifyMainThread();
 }
 
 void OpenglRender::renderByParts() {
     // All the parts to be displayed are read, regardless of their screen of attachment.
     // Parts are sorted by priority, nothing's cached.
 
-    PartsList parts_list;
-
     preRender();
 
-    const auto getParts = [this, &parts_list]() {
-        std::lock_guard lock(opengl_->getMutex(MutexType::parts_list));
-        if (!parts_lists_[mixed_parts_key].empty()) { parts_list = std::move(parts_lists_[mixed_parts_key]); }
-    };
-    getParts();
-
-    renderParts(parts_list, opengl_->texturing()->getTextureArrayId());
-
-    const auto notifyMainThread = [this, &parts_list]() {
-        std::lock_guard lk(opengl_->getMutex(MutexType::parts_list));
-        PartsList().swap(parts_list);
-        data_condition_.notify_one();
-    };
-    notifyMainThread();
+    const auto& parts_lists = render_packets_.readBuffer().parts_lists;
+    if (const auto it = parts_lists.find(mixed_parts_key); it != parts_lists.end()) {
+        renderParts(it->second, opengl_->texturing()->getTextureArrayId());
+    }
 
     postRender();
 }
@@ -483,16 +460,17 @@ void OpenglRender::renderSelector() {
 
 auto OpenglRender::isThereSomethingToRender() const -> bool {
     if constexpr (render_type == RenderType::RenderType_drawElements) {
-        if constexpr (uses_fbo) {
-            return !parts_lists_.empty();
-        } else {
-            if (parts_lists_.contains(mixed_parts_key)) { return !parts_lists_.at(mixed_parts_key).empty(); }
-            return false;
-        }
+        return render_packets_.hasNewData();
     }
     if constexpr (render_type == RenderType::RenderType_drawTest) { return true; }
 }
 
+auto OpenglRender::acquireRenderPacket() -> bool {
+    if (!render_packets_.acquire()) { return false; }
+    opengl_->texturing()->applyTextureUpdates(render_packets_.readBuffer().texture_updates);
+    return true;
+}
+
 void OpenglRender::switchRenderedBuffer() {
     using enum FboTextureType;
     current_rendered_buffer_ = (current_rendered_buffer_ == back_buffer) ? front_buffer : back_buffer;
@@ -630,14 +608,8 @@ void OpenglRender::displayFramebufferByScreenPriority(core::EmulatorContext& sta
         addVdp1PartsToList(priority);
     }
 
-    // Step three : wait to send data to the render thread.
-    if constexpr (render_type == RenderType::RenderType_drawElements) {
-        if (parts_lists_.empty()) {
-            std::unique_lock lk(opengl_->getMutex(MutexType::parts_list));
-            parts_lists_ = std::move(global_parts_list);
-            data_condition_.wait(lk, [this]() { return parts_lists_.empty(); });
-        }
-    }
+    // Step three : send data to the render thread.
+    if constexpr (render_type == RenderType::RenderType_drawElements) { publishRenderPacket(std::move(global_parts_list)); }
 }
 
 void OpenglRender::displayFramebufferByParts(core::EmulatorContext& state) {
@@ -679,12 +651,23 @@ void OpenglRender::displayFramebufferByParts(core::EmulatorContext& state) {
     addVdp1PartsToList();
     std::ranges::stable_sort(parts_list, [](const RenderPart& a, const RenderPart& b) { return a.priority < b.priority; });
     if constexpr (render_type == RenderType::RenderType_drawElements) {
-        if (parts_lists_[mixed_parts_key].empty()) {
-            std::unique_lock lk(opengl_->getMutex(MutexType::parts_list));
-            parts_lists_[mixed_parts_key] = std::move(parts_list);
-            data_condition_.wait(lk, [this]() { return parts_lists_[mixed_parts_key].empty(); });
-        }
+        auto parts_lists             = MapOfPartsList{};
+        parts_lists[mixed_parts_key] = std::move(parts_list);
+        publishRenderPacket(std::move(parts_lists));
     }
 }
 
+void OpenglRender::publishRenderPacket(MapOfPartsList&& parts_lists) {
+    auto& packet = render_packets_.writeBuffer();
+
+    // A dropped packet comes back as the write buffer : its texture updates were never applied, they are kept.
+    if (!is_last_packet_dropped_) { packet.texture_updates.clear(); }
+    const auto updates = opengl_->texturing()->takeTextureUpdates();
+    packet.texture_updates.insert(packet.texture_updates.end(), updates.begin(), updates.end());
+    packet.parts_lists  = std::move(parts_lists);
+    packet.frame_number = ++packet_number_;
+
+    is_last_packet_dropped_ = !render_packets_.publish();
+}
+
 } // namespace saturnin::video
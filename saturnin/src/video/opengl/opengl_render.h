@@ -20,6 +20,7 @@
 #pragma once
 
 #include <saturnin/src/emulator_defs.h>
+#include <saturnin/src/triple_buffer.h> // TripleBuffer
 #include <saturnin/src/video/opengl/opengl.h>
 #include <saturnin/src/video/opengl/opengl_texturing.h>
 #include <saturnin/src/video/vdp_common.h>
@@ -31,6 +32,13 @@ constexpr auto render_type = RenderType::RenderType_drawElements;
 
 using MapOfPartsList = std::map<FboKey, PartsList>; // Parts list by priority + layer
 
+// Everything the render thread needs to display a frame. Once published, a packet isn't modified by the emulation thread.
+struct RenderPacket {
+    u32                        frame_number{};  // Number of the emulated frame.
+    MapOfPartsList             parts_lists;     // Parts to display, by priority + layer.
+    std::vector<TextureUpdate> texture_updates; // Texture links updates to apply before generating the textures.
+};
+
 class OpenglRender {
   public:
     OpenglRender() = default;
@@ -71,6 +79,10 @@ class OpenglRender {
     // Checks if there's something to render.
     auto isThereSomethingToRender() const -> bool;
 
+    // Gets the last frame published by the emulation thread and applies its texture updates. Returns false if no new
+    // frame was published.
+    auto acquireRenderPacket() -> bool;
+
     // Switch between back and front rendering buffers.
     void switchRenderedBuffer();
 
@@ -86,6 +98,9 @@ class OpenglRender {
     void displayFramebufferByScreenPriority(core::EmulatorContext& state);
     void displayFramebufferByParts(core::EmulatorContext& state);
 
+    // Hands the frame parts and texture updates over to the render thread, without waiting for it.
+    void publishRenderPacket(MapOfPartsList&& parts_lists);
+
     // Accessors / mutators
     void               partToHighlight(const Vdp1Part& part) { part_to_highlight_ = part; };
     auto               partToHighlight() const -> Vdp1Part { return part_to_highlight_; };
@@ -100,11 +115,13 @@ class OpenglRender {
     FboTextureType current_rendered_buffer_; // The current rendered buffer (front or back)
 
     // Following parts data will have to be moved to the platform agnostic renderer
-    MapOfPartsList parts_lists_; // Map of parts_list, one entry by FboKey. When used with use_fbo = false, all parts are using
-                                 // the same map entry.
-    PartsList parts_list_debug_; // List of parts used to generate textures for debugging.
+    // Frames handed over from the emulation thread to the render thread. Parts lists have one entry by FboKey. When used
+    // with use_fbo = false, all parts are using the same map entry.
+    core::TripleBuffer<RenderPacket> render_packets_;
+    u32                              packet_number_{};          // Number of published packets.
+    bool                             is_last_packet_dropped_{}; // The last published packet was replaced before rendering.
 
-    std::condition_variable data_condition_; // Condition variable to synchronize between emulation and UI thread.
+    PartsList parts_list_debug_; // List of parts used to generate textures for debugging.
 
     Shaders shaders_; // Shaders storage
 };
@@ -27,6 +27,7 @@
 #include <glbinding/gl21ext/gl.h>
 #include <glbinding/gl33core/gl.h>
 #include <glbinding/gl33ext/gl.h>
+#include <saturnin/src/timing.h>
 #include <saturnin/src/video/texture.h>
 #include <saturnin/src/video/opengl/opengl_utilities.h>
 #include <saturnin/src/video/opengl/opengl_render.h>
@@ -111,20 +112,48 @@ void OpenglTexturing::addOrUpdateTexture(const size_t key, const VdpLayer layer)
     // const auto& texture = Texture::getTexture(key);
 
     // if (texture) {
-    std::lock_guard lock(opengl_->getMutex(MutexType::textures_link));
-    textures_link_[key].key                 = key;
-    textures_link_[key].opengl_id           = 0;
-    textures_link_[key].texture_array_index = 0;
-    layer_to_cache_reload_state_[layer]     = true; // This layer will have to be reloaded
+    std::lock_guard lock(pending_texture_updates_mutex_);
+    pending_texture_updates_[key] = {.key = key, .layer = layer, .type = TextureUpdateType::add_or_update};
     // textures_link_[key].width     = (*texture)->width();
     // textures_link_[key].height    = (*texture)->height();
     // textures_link_[key].size      = (*texture)->size();
     // }
 }
 
-void OpenglTexturing::removeTextureLink(const size_t key) { textures_link_.erase(key); }
+void OpenglTexturing::removeTextureLink(const size_t key) {
+    std::lock_guard lock(pending_texture_updates_mutex_);
+    pending_texture_updates_[key] = {.key = key, .type = TextureUpdateType::remove};
+}
+
+auto OpenglTexturing::takeTextureUpdates() -> std::vector<TextureUpdate> {
+    auto updates = std::vector<TextureUpdate>{};
+    {
+        std::lock_guard lock(pending_texture_updates_mutex_);
+        updates.reserve(pending_texture_updates_.size());
+        for (const auto& [key, update] : pending_texture_updates_) {
+            updates.push_back(update);
+        }
+        pending_texture_updates_.clear();
+    }
+    return updates;
+}
+
+void OpenglTexturing::applyTextureUpdates(const std::vector<TextureUpdate>& updates) {
+    for (const auto& update : updates) {
+        if (update.type == TextureUpdateType::remove) {
+            textures_link_.erase(update.key);
+            continue;
+        }
+        // The OpenGL link is reset in order to regenerate the texture.
+        textures_link_[update.key].key                 = update.key;
+        textures_link_[update.key].opengl_id           = 0;
+        textures_link_[update.key].texture_array_index = 0;
+        layer_to_cache_reload_state_[update.layer]     = true; // This layer will have to be reloaded
+    }
+}
 
 void OpenglTexturing::generateTextures() {
+    TIMING_ZONE(core::TimingZone::textures_generation);
     // Textures are generated in a 128 layers texture array, each layer being a texture atlas of
     // 1024*1024 pixels.
     // In theory, the maximum number of different VDP2 cells that could be stored by the Saturn at a given time is 0x80000
@@ -165,6 +194,7 @@ void OpenglTexturing::generateTextures() {
 // improve packing, but there's a non trivial performance tradeoff, with a big increase in complexity.
 // So for now, keeping things simple.
 void OpenglTexturing::packTextures(std::vector<OpenglTexture>& textures, const VdpLayer layer) {
+    TIMING_ZONE(core::TimingZone::textures_packing);
     glBindTexture(GL_TEXTURE_2D_ARRAY, texture_array_id_);
     // First, indexes used by the layer are cleared and removed from the used list.
     auto empty_data = std::vector<u8>(texture_array_width * texture_array_height * 4);
@@ -285,14 +315,12 @@ auto OpenglTexturing::readVertexes(const PartsList& parts) -> std::vector<Vertex
 }
 
 auto OpenglTexturing::getOpenglTexture(const size_t key) -> std::optional<OpenglTexture> {
-    std::lock_guard lock(opengl_->getMutex(MutexType::textures_link));
-    const auto      it = textures_link_.find(key);
+    const auto it = textures_link_.find(key);
     return (it == textures_link_.end()) ? std::nullopt : std::optional<OpenglTexture>(it->second);
 }
 
 auto OpenglTexturing::getOpenglTextureDetails(const size_t key) -> std::string {
-    auto            details = std::string{};
-    std::lock_guard lock(opengl_->getMutex(MutexType::textures_link));
+    auto details = std::string{};
     if (const auto it = textures_link_.find(key); it != textures_link_.end()) {
         details += util::format("Key: 0x{:x}\n", it->second.key);
         details += util::format("Position: {},{}\n", it->second.pos.x, it->second.pos.y);
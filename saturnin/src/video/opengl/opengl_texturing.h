@@ -33,6 +33,15 @@ using FboTextureTypeToLayer = std::array<FboTextureType, fbo_texture_array_depth
                                                                                    // the index of the array being the layer.
 using GuiTextureTypeToId = std::unordered_map<GuiTextureType, u32>; // Defines the type of each texture used to render to GUI.
 
+enum class TextureUpdateType : u8 { add_or_update, remove };
+
+// Change of a texture link, made by the emulation thread and applied by the render thread.
+struct TextureUpdate {
+    size_t            key{};   // Texture key.
+    VdpLayer          layer{}; // Layer using the texture, for cache management.
+    TextureUpdateType type{};  // Type of the update.
+};
+
 class OpenglTexturing {
   public:
     OpenglTexturing() = default;
@@ -72,6 +81,12 @@ class OpenglTexturing {
     // Removes the link between the Saturn texture and the OpenGL texture id.
     void removeTextureLink(const size_t key);
 
+    // Returns the texture links updates made since the last call. Called from the emulation thread.
+    auto takeTextureUpdates() -> std::vector<TextureUpdate>;
+
+    // Applies texture links updates to the textures used for rendering. Called from the render thread.
+    void applyTextureUpdates(const std::vector<TextureUpdate>& updates);
+
     // Gets texture identifier corresponding to the key if found.
     auto getOpenglTexture(const size_t key) -> std::optional<OpenglTexture>;
 
@@ -135,6 +150,10 @@ class OpenglTexturing {
     TexturesLink textures_link_;                  // Link between the Texture key and the OpenglTexture.
     u32          texture_array_debug_layer_id_{}; // Identifier for the texture array debug layer.
 
+    // Pending updates are keyed by texture, only the last update of a texture matters.
+    std::unordered_map<size_t, TextureUpdate> pending_texture_updates_;       // Updates not handed over to the render thread.
+    std::mutex                                pending_texture_updates_mutex_; // Only contended by emulation side threads.
+
     u32                   fbo_texture_array_id_;      // Identifier for the FBO texture array.
     GuiTextureTypeToId    gui_texture_type_to_id_;    // Links the texture to be used in the GUI to a type.
     FboTypeToId           fbo_type_to_id_;            // The framebuffer objects used in the app.
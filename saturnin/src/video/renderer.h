@@ -20,7 +20,7 @@
 #pragma once
 
 namespace saturnin::video {
-enum class RendererType { renderer_opengl_legacy, renderer_opengl_modern, renderer_opengl_compute_shader, renderer_vulkan };
+enum class RendererType { renderer_opengl_legacy, renderer_opengl_modern, renderer_opengl_compute_shader, renderer_vulkan, renderer_software };
 
 class Renderer {
   public:
@@ -0,0 +1,997 @@
+//
+// software_renderer.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/video/software_renderer.h>
+#include <algorithm> // min, fill
+#include <saturnin/src/memory.h>
+#include <saturnin/src/thread_pool.h>
+#include <saturnin/src/utilities.h> // toUnderlying
+
+namespace saturnin::video {
+
+using core::ThreadPool;
+namespace util = saturnin::utilities;
+
+constexpr auto fixed_point_shift           = u8{8};
+constexpr auto fixed_point_one             = s32{1 << fixed_point_shift};
+constexpr auto page_dots                   = u16{512};
+constexpr auto character_number_4mb_mask   = u16{0x3FFF};
+constexpr auto character_number_8mb_mask   = u16{0x7FFF};
+constexpr auto line_scroll_value_mask      = u32{0x7FFFF};
+constexpr auto line_zoom_value_mask        = u32{0x7FF};
+constexpr auto window_position_mask        = u16{0x3FF};
+constexpr auto window_vertical_mask        = u16{0x1FF};
+constexpr auto color_calculation_ratio_max = u8{31};
+constexpr auto color_component_max         = s32{0xFF};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct SpriteTypeFormat
+///
+/// \brief  Layout of the sprite data in the VDP1 framebuffer, depending on the sprite type.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct SpriteTypeFormat {
+    u8   priority_shift; ///< Position of the priority register number.
+    u8   priority_mask;  ///< Mask of the priority register number.
+    u8   ratio_shift;    ///< Position of the color calculation ratio register number.
+    u8   ratio_mask;     ///< Mask of the color calculation ratio register number, 0 when not available.
+    u16  color_mask;     ///< Mask of the dot color data.
+    bool is_8_bits;      ///< True when a framebuffer dot is 8 bits wide.
+};
+
+// clang-format off
+constexpr auto sprite_type_formats = std::array<SpriteTypeFormat, 16>{{
+    {14, 0x3, 11, 0x7, 0x7FF, false}, // Type 0
+    {13, 0x7, 11, 0x3, 0x7FF, false}, // Type 1
+    {14, 0x1, 11, 0x7, 0x7FF, false}, // Type 2
+    {13, 0x3, 11, 0x3, 0x7FF, false}, // Type 3
+    {13, 0x3, 10, 0x7, 0x3FF, false}, // Type 4
+    {12, 0x7, 11, 0x1, 0x7FF, false}, // Type 5
+    {12, 0x7, 10, 0x3, 0x3FF, false}, // Type 6
+    {12, 0x7,  9, 0x7, 0x1FF, false}, // Type 7
+    { 7, 0x1,  0, 0x0, 0x07F, true }, // Type 8
+    { 7, 0x1,  6, 0x1, 0x03F, true }, // Type 9
+    { 6, 0x3,  0, 0x0, 0x03F, true }, // Type A
+    { 0, 0x0,  6, 0x3, 0x03F, true }, // Type B
+    { 7, 0x1,  0, 0x0, 0x0FF, true }, // Type C
+    { 7, 0x1,  6, 0x1, 0x0FF, true }, // Type D
+    { 6, 0x3,  0, 0x0, 0x0FF, true }, // Type E
+    { 0, 0x0,  6, 0x3, 0x0FF, true }  // Type F
+}};
+// clang-format on
+
+inline auto packColor(const Color& color) -> u32 {
+    return static_cast<u32>(color.r) | static_cast<u32>(color.g) << 8 | static_cast<u32>(color.b) << 16 | u32{0xFF} << 24;
+}
+
+inline auto readVram16(const std::span<const u8> data, const u32 address) -> u16 {
+    return static_cast<u16>(data[address & core::vdp2_vram_memory_mask] << 8 | data[(address + 1) & core::vdp2_vram_memory_mask]);
+}
+
+inline auto readVram32(const std::span<const u8> data, const u32 address) -> u32 {
+    return static_cast<u32>(readVram16(data, address)) << 16 | readVram16(data, address + 2);
+}
+
+// Tables (line scroll, vertical cell scroll, back screen, line window) addresses are split in 2 registers.
+inline auto getTableAddress(const u16 upper, const u16 lower) -> u32 {
+    return ((((upper & 0x7u) << 16) | (lower & 0xFFFEu)) << 1) & core::vdp2_vram_memory_mask;
+}
+
+// A window control byte holds the W0 / W1 settings of one layer.
+inline auto getWindowSetting(const u8 control) -> WindowSetting {
+    return WindowSetting{.is_w0_enabled = (control & 0x2) != 0,
+                         .is_w0_outside = (control & 0x1) != 0,
+                         .is_w1_enabled = (control & 0x8) != 0,
+                         .is_w1_outside = (control & 0x4) != 0,
+                         .is_logic_and  = (control & 0x80) != 0};
+}
+
+inline auto getLayerIndex(const ScrollScreen s) -> u8 {
+    switch (s) {
+        using enum ScrollScreen;
+        case rbg0: return util::toUnderlying(SoftwareLayer::rbg0);
+        case rbg1: return util::toUnderlying(SoftwareLayer::nbg0);
+        case nbg0: return util::toUnderlying(SoftwareLayer::nbg0);
+        case nbg1: return util::toUnderlying(SoftwareLayer::nbg1);
+        case nbg2: return util::toUnderlying(SoftwareLayer::nbg2);
+        case nbg3: return util::toUnderlying(SoftwareLayer::nbg3);
+        default: return util::toUnderlying(SoftwareLayer::back);
+    }
+}
+
+void SoftwareRenderer::render() {
+    auto* vdp2 = modules_.vdp2();
+    setupFrame();
+
+    rendered_frame_.resize(static_cast<size_t>(frame_size_.w) * frame_size_.h * 4);
+    if (vdp2->hasMidFrameRegisterWrites(frame_size_.h)) {
+        // Raster effects : each span of lines is rendered with the registers state it was displayed with.
+        // The frame size is kept from the end of frame state, as the buffer is already allocated.
+        const auto size = frame_size_;
+        vdp2->replayRegisterWrites(size.h, [this, size](const u16 first_line, const u16 last_line) {
+            setupFrame();
+            frame_size_ = size;
+            renderLines(first_line, last_line);
+        });
+    } else {
+        renderLines(0, frame_size_.h);
+    }
+
+    if (is_frame_hashed_) {
+        // FNV-1a
+        constexpr auto fnv_offset_basis = u64{0xcbf29ce484222325};
+        constexpr auto fnv_prime        = u64{0x100000001b3};
+        last_frame_hash_                = fnv_offset_basis;
+        for (const auto byte : rendered_frame_) {
+            last_frame_hash_ = (last_frame_hash_ ^ byte) * fnv_prime;
+        }
+    }
+
+    // The data is swapped with the buffer of an older frame, which will be reused for the next one.
+    auto& frame  = frames_.writeBuffer();
+    frame.number = ++frame_number_;
+    frame.size   = frame_size_;
+    frame.rgba.swap(rendered_frame_);
+    frames_.publish();
+}
+
+auto SoftwareRenderer::acquireFrame() -> bool { return frames_.acquire(); }
+
+auto SoftwareRenderer::frame() const -> const RenderedFrame& { return frames_.readBuffer(); }
+
+void SoftwareRenderer::setupFrame() {
+    auto*       vdp2 = modules_.vdp2();
+    const auto& regs = vdp2->regs_;
+
+    frame_size_.w    = std::min(vdp2->tv_screen_status_.horizontal_res, software_max_line_width);
+    frame_size_.h    = std::min(vdp2->tv_screen_status_.vertical_res, vertical_res_512);
+    is_hi_res_       = vdp2->tv_screen_status_.screen_mode_type == ScreenModeType::hi_res
+                 || vdp2->tv_screen_status_.screen_mode_type == ScreenModeType::exclusive;
+    is_cram_32_bits_ = vdp2->ram_status_.color_ram_mode == Vdp2Regs::Ramctl::ColorRamMode::mode_2_rgb_8_bits_1024_colors;
+
+    for (const auto s : {ScrollScreen::nbg0,
+                         ScrollScreen::nbg1,
+                         ScrollScreen::nbg2,
+                         ScrollScreen::nbg3,
+                         ScrollScreen::rbg0,
+                         ScrollScreen::rbg1}) {
+        setupLayer(s);
+    }
+    is_rbg1_displayed_ = layers_setup_[util::toUnderlying(ScrollScreen::rbg1)].is_displayed;
+    if (is_rbg1_displayed_) {
+        // RBG1 uses parameter B, RBG0 is then limited to parameter A.
+        layers_setup_[util::toUnderlying(ScrollScreen::rbg0)].rotation.mode = RotationSetup::RotationParametersMode::rotation_parameter_a;
+    }
+
+    // Color offsets
+    const auto setColorOffset = [this, vdp2](const SoftwareLayer layer, const VdpLayer vdp_layer) {
+        const auto offset = vdp2->getColorOffset(vdp_layer);
+        for (u8 i = 0; i < 3; ++i) {
+            color_offsets_[util::toUnderlying(layer)][i]
+                = offset.signs[i] ? static_cast<s16>(offset.values[i]) : static_cast<s16>(-offset.values[i]);
+        }
+    };
+    setColorOffset(SoftwareLayer::sprite, VdpLayer::sprite);
+    setColorOffset(SoftwareLayer::rbg0, VdpLayer::rbg0);
+    setColorOffset(SoftwareLayer::nbg0, VdpLayer::nbg0);
+    setColorOffset(SoftwareLayer::nbg1, VdpLayer::nbg1);
+    setColorOffset(SoftwareLayer::nbg2, VdpLayer::nbg2);
+    setColorOffset(SoftwareLayer::nbg3, VdpLayer::nbg3);
+    setColorOffset(SoftwareLayer::back, VdpLayer::back);
+
+    // Color calculation
+    using Ccctl                                      = Vdp2Regs::Ccctl;
+    const auto ccctl                                 = regs.ccctl.data();
+    is_add_as_is_                                    = (regs.ccctl >> Ccctl::ccmd_enum) == Ccctl::ColorCalculationMode::add_as_is;
+    is_ratio_from_second_                            = (ccctl & 0x200) != 0; // CCRTMD
+    ratios_[util::toUnderlying(SoftwareLayer::back)] = static_cast<u8>(regs.ccrlb >> Vdp2Regs::Ccrlb::bkccrt_shft);
+    color_calculation_window_                        = getWindowSetting(static_cast<u8>(regs.wctld.data() >> 8));
+
+    // Sprites
+    sprite_control_ = regs.spctl.data();
+    for (u8 i = 0; i < 8; ++i) {
+        sprite_priorities_[i] = vdp2->getSpritePriority(i);
+    }
+    sprite_ratios_[0]                    = static_cast<u8>(regs.ccrsa >> Vdp2Regs::Ccrsa::s0ccrt_shft);
+    sprite_ratios_[1]                    = static_cast<u8>(regs.ccrsa >> Vdp2Regs::Ccrsa::s1ccrt_shft);
+    sprite_ratios_[2]                    = static_cast<u8>(regs.ccrsb >> Vdp2Regs::Ccrsb::s2ccrt_shft);
+    sprite_ratios_[3]                    = static_cast<u8>(regs.ccrsb >> Vdp2Regs::Ccrsb::s3ccrt_shft);
+    sprite_ratios_[4]                    = static_cast<u8>(regs.ccrsc >> Vdp2Regs::Ccrsc::s4ccrt_shft);
+    sprite_ratios_[5]                    = static_cast<u8>(regs.ccrsc >> Vdp2Regs::Ccrsc::s5ccrt_shft);
+    sprite_ratios_[6]                    = static_cast<u8>(regs.ccrsd >> Vdp2Regs::Ccrsd::s6ccrt_shft);
+    sprite_ratios_[7]                    = static_cast<u8>(regs.ccrsd >> Vdp2Regs::Ccrsd::s7ccrt_shft);
+    sprite_color_offset_                 = vdp2->getSpriteColorAddressOffset();
+    is_sprite_color_calculation_enabled_ = (ccctl & 0x40) != 0;
+    sprite_window_                       = getWindowSetting(static_cast<u8>(regs.wctlc.data() >> 8));
+
+    // Back screen
+    back_screen_table_       = getTableAddress(regs.bktau.data(), regs.bktal.data());
+    is_back_screen_per_line_ = (regs.bktau.data() & 0x8000) != 0;
+
+    // Normal windows, horizontal coordinates are always in hi-res units.
+    window_start_x_ = {regs.wpsx0.data() & window_position_mask, regs.wpsx1.data() & window_position_mask};
+    window_end_x_   = {regs.wpex0.data() & window_position_mask, regs.wpex1.data() & window_position_mask};
+    window_start_y_ = {regs.wpsy0.data() & window_vertical_mask, regs.wpsy1.data() & window_vertical_mask};
+    window_end_y_   = {regs.wpey0.data() & window_vertical_mask, regs.wpey1.data() & window_vertical_mask};
+    is_line_window_ = {(regs.lwta0u.data() & 0x8000) != 0, (regs.lwta1u.data() & 0x8000) != 0};
+    line_window_tables_
+        = {getTableAddress(regs.lwta0u.data(), regs.lwta0l.data()), getTableAddress(regs.lwta1u.data(), regs.lwta1l.data())};
+}
+
+void SoftwareRenderer::setupLayer(const ScrollScreen s) {
+    using Pcnxx = Vdp2Regs::Pcnxx;
+    using Plsz  = Vdp2Regs::Plsz;
+
+    auto*       vdp2   = modules_.vdp2();
+    const auto& regs   = vdp2->regs_;
+    auto&       layer  = layers_setup_[util::toUnderlying(s)];
+    const auto& screen = vdp2->getScreen(s);
+
+    layer        = LayerSetup{};
+    layer.screen = screen;
+    layer.is_displayed
+        = screen.is_display_enabled && screen.priority_number != 0 && !vdp2->isLayerDisabled(s);
+    if (!layer.is_displayed) { return; }
+
+    // RBG1 shares the NBG0 bits in the registers holding one field per screen.
+    const auto register_index = (s == ScrollScreen::rbg1) ? u8{0} : static_cast<u8>(util::toUnderlying(s));
+    const auto is_rotation    = (s == ScrollScreen::rbg0 || s == ScrollScreen::rbg1);
+
+    // Map
+    layer.map_width       = is_rotation ? u8{4} : u8{2};
+    layer.plane_addresses = {screen.plane_a_start_address,
+                             screen.plane_b_start_address,
+                             screen.plane_c_start_address,
+                             screen.plane_d_start_address,
+                             screen.plane_e_start_address,
+                             screen.plane_f_start_address,
+                             screen.plane_g_start_address,
+                             screen.plane_h_start_address,
+                             screen.plane_i_start_address,
+                             screen.plane_j_start_address,
+                             screen.plane_k_start_address,
+                             screen.plane_l_start_address,
+                             screen.plane_m_start_address,
+                             screen.plane_n_start_address,
+                             screen.plane_o_start_address,
+                             screen.plane_p_start_address};
+    for (auto& address : layer.plane_addresses) {
+        address &= core::vdp2_vram_memory_mask;
+    }
+    layer.plane_width  = (screen.plane_size == Plsz::PlaneSize::size_1_by_1) ? page_dots : page_dots * 2;
+    layer.plane_height = (screen.plane_size == Plsz::PlaneSize::size_2_by_2) ? page_dots * 2 : page_dots;
+
+    // Bitmap
+    switch (screen.bitmap_size) {
+        using enum BitmapSize;
+        case size_512_by_256: layer.bitmap_width = 512, layer.bitmap_height = 256; break;
+        case size_512_by_512: layer.bitmap_width = 512, layer.bitmap_height = 512; break;
+        case size_1024_by_256: layer.bitmap_width = 1024, layer.bitmap_height = 256; break;
+        case size_1024_by_512: layer.bitmap_width = 1024, layer.bitmap_height = 512; break;
+        default: layer.bitmap_width = 512, layer.bitmap_height = 256;
+    }
+    layer.bitmap_address = screen.bitmap_start_address & core::vdp2_vram_memory_mask;
+
+    // Pattern name data
+    layer.character_size = (screen.character_pattern_size == Vdp2Regs::CharacterSize::one_by_one) ? u8{8} : u8{16};
+    layer.pattern_name_data_size
+        = (screen.pattern_name_data_size == Pcnxx::PatternNameDataSize::one_word) ? u8{2} : u8{4};
+    layer.character_mask = (vdp2->ram_status_.vram_size == Vdp2Regs::Vrsize::VramSize::size_4_mbits)
+                               ? character_number_4mb_mask
+                               : character_number_8mb_mask;
+
+    const auto is_10_bits
+        = (screen.character_number_supplement_mode == Pcnxx::CharacterNumberSupplementMode::character_number_10_bits);
+    const auto is_16_colors = (screen.character_color_number == ColorCount::palette_16);
+    if (screen.pattern_name_data_size == Pcnxx::PatternNameDataSize::two_words) {
+        layer.read_pattern_name_data = &getPatternNameData2Words;
+    } else if (screen.character_pattern_size == Vdp2Regs::CharacterSize::one_by_one) {
+        if (is_16_colors) {
+            layer.read_pattern_name_data
+                = is_10_bits ? &getPatternNameData1Word1Cell16Colors10Bits : &getPatternNameData1Word1Cell16Colors12Bits;
+        } else {
+            layer.read_pattern_name_data = is_10_bits ? &getPatternNameData1Word1CellOver16Colors10Bits
+                                                      : &getPatternNameData1Word1CellOver16Colors12Bits;
+        }
+    } else {
+        if (is_16_colors) {
+            layer.read_pattern_name_data
+                = is_10_bits ? &getPatternNameData1Word4Cells16Colors10Bits : &getPatternNameData1Word4Cells16Colors12Bits;
+        } else {
+            layer.read_pattern_name_data = is_10_bits ? &getPatternNameData1Word4CellsOver16Colors10Bits
+                                                      : &getPatternNameData1Word4CellsOver16Colors12Bits;
+        }
+    }
+
+    // Scrolling
+    layer.increment_x = fixed_point_one;
+    layer.increment_y = fixed_point_one;
+    if (!is_rotation) {
+        layer.scroll_x = screen.screen_scroll_horizontal_integer << fixed_point_shift;
+        layer.scroll_y = screen.screen_scroll_vertical_integer << fixed_point_shift;
+    }
+    if (s == ScrollScreen::nbg0 || s == ScrollScreen::nbg1) {
+        const auto is_nbg0 = (s == ScrollScreen::nbg0);
+        layer.scroll_x |= screen.screen_scroll_horizontal_fractional;
+        layer.scroll_y |= screen.screen_scroll_vertical_fractional;
+
+        const auto zoom_x_integer    = is_nbg0 ? regs.zmxin0.data() : regs.zmxin1.data();
+        const auto zoom_x_fractional = is_nbg0 ? regs.zmxdn0.data() : regs.zmxdn1.data();
+        const auto zoom_y_integer    = is_nbg0 ? regs.zmyin0.data() : regs.zmyin1.data();
+        const auto zoom_y_fractional = is_nbg0 ? regs.zmydn0.data() : regs.zmydn1.data();
+        layer.increment_x            = ((zoom_x_integer & 0x7) << fixed_point_shift) | (zoom_x_fractional >> 8);
+        layer.increment_y            = ((zoom_y_integer & 0x7) << fixed_point_shift) | (zoom_y_fractional >> 8);
+        // Games often leave the zoom registers untouched, a null increment is handled as no reduction.
+        if (layer.increment_x == 0) { layer.increment_x = fixed_point_one; }
+        if (layer.increment_y == 0) { layer.increment_y = fixed_point_one; }
+
+        const auto scrctl                 = regs.scrctl.data() >> (is_nbg0 ? 0 : 8);
+        layer.is_vertical_cell_scroll     = (scrctl & 0x1) != 0;
+        layer.is_line_scroll_x            = (scrctl & 0x2) != 0;
+        layer.is_line_scroll_y            = (scrctl & 0x4) != 0;
+        layer.is_line_zoom                = (scrctl & 0x8) != 0;
+        layer.line_scroll_interval        = static_cast<u8>((scrctl >> 4) & 0x3);
+        layer.line_scroll_table           = is_nbg0 ? getTableAddress(regs.lsta0u.data(), regs.lsta0l.data())
+                                                    : getTableAddress(regs.lsta1u.data(), regs.lsta1l.data());
+        layer.vertical_cell_scroll_table  = getTableAddress(regs.vcstau.data(), regs.vcstal.data());
+        const auto is_vcs_shared          = (regs.scrctl.data() & 0x101) == 0x101;
+        layer.vertical_cell_scroll_stride = is_vcs_shared ? u8{2} : u8{1};
+        layer.vertical_cell_scroll_index  = (is_vcs_shared && !is_nbg0) ? u8{1} : u8{0};
+    }
+
+    // Rotation
+    if (is_rotation) {
+        using CoefficientMode  = CoefficientTableSetting::CoefficientMode;
+        auto& rotation         = layer.rotation;
+        layer.is_rotation      = true;
+        rotation.table_address = getTableAddress(regs.rptau.data(), regs.rptal.data());
+        rotation.mode          = (s == ScrollScreen::rbg1)
+                                     ? RotationSetup::RotationParametersMode::rotation_parameter_b
+                                     : static_cast<RotationSetup::RotationParametersMode>(regs.rpmd.data() & 0x3);
+
+        // KTCTL and KTAOF hold parameter A settings in the low byte and parameter B ones in the high byte.
+        const auto ktctl = regs.ktctl.data();
+        const auto ktaof = regs.ktaof.data();
+        const auto is_in_color_ram
+            = vdp2->ram_status_.coefficient_table_storage == Vdp2Regs::Ramctl::CoefficientTableStorage::stored_in_color_ram;
+        for (u8 p = 0; p < 2; ++p) {
+            const auto control                             = ktctl >> (p * 8);
+            rotation.coefficients[p].is_enabled            = (control & 0x1) != 0;
+            rotation.coefficients[p].is_one_word           = (control & 0x2) != 0;
+            rotation.coefficients[p].mode                  = static_cast<CoefficientMode>((control >> 2) & 0x3);
+            rotation.coefficients[p].is_line_color_enabled = (control & 0x10) != 0;
+            rotation.coefficients[p].is_in_color_ram       = is_in_color_ram;
+            rotation.coefficients[p].address_offset        = (ktaof >> (p * 8)) & 0x7;
+        }
+
+        const auto plsz             = regs.plsz.data();
+        rotation.screen_over        = {static_cast<Plsz::ScreenOverProcess>((plsz >> 10) & 0x3),
+                                       static_cast<Plsz::ScreenOverProcess>((plsz >> 14) & 0x3)};
+        rotation.over_pattern_names = {regs.ovpnra.data(), regs.ovpnrb.data()};
+        rotation.parameter_window   = getWindowSetting(static_cast<u8>(regs.wctld.data()));
+    }
+
+    // Mosaic
+    const auto mzctl = regs.mzctl.data();
+    if ((mzctl >> register_index) & 0x1) {
+        layer.mosaic_width  = static_cast<u8>(((mzctl >> 8) & 0xF) + 1);
+        layer.mosaic_height = static_cast<u8>(((mzctl >> 12) & 0xF) + 1);
+    }
+
+    // Windows
+    switch (s) {
+        using enum ScrollScreen;
+        case nbg0:
+        case rbg1: layer.window = getWindowSetting(static_cast<u8>(regs.wctla.data())); break;
+        case nbg1: layer.window = getWindowSetting(static_cast<u8>(regs.wctla.data() >> 8)); break;
+        case nbg2: layer.window = getWindowSetting(static_cast<u8>(regs.wctlb.data())); break;
+        case nbg3: layer.window = getWindowSetting(static_cast<u8>(regs.wctlb.data() >> 8)); break;
+        case rbg0: layer.window = getWindowSetting(static_cast<u8>(regs.wctlc.data())); break;
+        default: break;
+    }
+
+    // Special functions and color calculation
+    layer.is_special_priority          = ((regs.sfprmd.data() >> (register_index * 2)) & 0x3) == 1;
+    layer.is_special_color_calculation = ((regs.sfccmd.data() >> (register_index * 2)) & 0x3) == 1;
+    layer.is_color_calculation_enabled = ((regs.ccctl.data() >> register_index) & 0x1) != 0;
+    switch (s) {
+        using enum ScrollScreen;
+        case nbg0:
+        case rbg1: layer.color_calculation_ratio = static_cast<u8>(regs.ccrna >> Vdp2Regs::Ccrna::n0ccrt_shft); break;
+        case nbg1: layer.color_calculation_ratio = static_cast<u8>(regs.ccrna >> Vdp2Regs::Ccrna::n1ccrt_shft); break;
+        case nbg2: layer.color_calculation_ratio = static_cast<u8>(regs.ccrnb >> Vdp2Regs::Ccrnb::n2ccrt_shft); break;
+        case nbg3: layer.color_calculation_ratio = static_cast<u8>(regs.ccrnb >> Vdp2Regs::Ccrnb::n3ccrt_shft); break;
+        case rbg0: layer.color_calculation_ratio = static_cast<u8>(regs.ccrr >> Vdp2Regs::Ccrr::r0ccrt_shft); break;
+        default: break;
+    }
+    ratios_[getLayerIndex(s)] = layer.color_calculation_ratio;
+}
+
+void SoftwareRenderer::renderLines(const u16 first_line, const u16 last_line) {
+    // Only the bands are waited for, other users of the pool (rewind compression, CD prefetch) keep running.
+    auto bands      = ThreadPool::multi_future<void>{};
+    auto band_index = std::size_t{};
+    for (auto band_start = first_line; band_start < last_line; band_start += software_band_height) {
+        const auto band_end = std::min(static_cast<u16>(band_start + software_band_height), last_line);
+        // Buffers are too big for the stack of the pool threads, they're allocated once and reused by the band.
+        if (band_index == band_buffers_.size()) { band_buffers_.push_back(std::make_unique<LineBuffers>()); }
+        auto& buffers = *band_buffers_[band_index++];
+        bands.push_back(ThreadPool::pool_.submit_task([this, band_start, band_end, &buffers]() {
+            renderBand(band_start, band_end, buffers);
+        }));
+    }
+    bands.wait();
+}
+
+void SoftwareRenderer::renderBand(const u16 first_line, const u16 last_line, LineBuffers& buffers) {
+    for (auto line = first_line; line < last_line; ++line) {
+        renderLine(line, buffers);
+    }
+}
+
+void SoftwareRenderer::renderLine(const u16 line, LineBuffers& buffers) {
+    buffers.active_layers_number = 0;
+    const auto addLayer          = [&buffers](const SoftwareLayer l) {
+        buffers.active_layers[buffers.active_layers_number++] = util::toUnderlying(l);
+    };
+    const auto getLine = [&buffers](const SoftwareLayer l) -> LayerLine& { return buffers.layers[util::toUnderlying(l)]; };
+
+    updateWindowSpans(line, buffers);
+
+    // Layers are added in the order used to solve equal priorities.
+    drawSpriteLine(line, buffers, getLine(SoftwareLayer::sprite));
+    addLayer(SoftwareLayer::sprite);
+
+    if (const auto& rbg0 = layers_setup_[util::toUnderlying(ScrollScreen::rbg0)]; rbg0.is_displayed) {
+        drawRotationScrollScreenLine(rbg0, line, buffers, getLine(SoftwareLayer::rbg0));
+        addLayer(SoftwareLayer::rbg0);
+    }
+
+    if (is_rbg1_displayed_) {
+        drawRotationScrollScreenLine(layers_setup_[util::toUnderlying(ScrollScreen::rbg1)],
+                                     line,
+                                     buffers,
+                                     getLine(SoftwareLayer::nbg0));
+        addLayer(SoftwareLayer::nbg0);
+    } else {
+        for (const auto s : {ScrollScreen::nbg0, ScrollScreen::nbg1, ScrollScreen::nbg2, ScrollScreen::nbg3}) {
+            const auto& nbg = layers_setup_[util::toUnderlying(s)];
+            if (!nbg.is_displayed) { continue; }
+            const auto layer = static_cast<SoftwareLayer>(getLayerIndex(s));
+            drawNormalScrollScreenLine(nbg, line, buffers, getLine(layer));
+            addLayer(layer);
+        }
+    }
+
+    drawBackScreenLine(line, getLine(SoftwareLayer::back));
+    compositeLine(line, buffers);
+}
+
+void SoftwareRenderer::drawNormalScrollScreenLine(const LayerSetup& layer,
+                                                  const u16         line,
+                                                  LineBuffers&      buffers,
+                                                  LayerLine&        out) const {
+    const auto data        = vram();
+    const auto width       = frame_size_.w;
+    const auto mosaic_line = static_cast<s32>(line - line % layer.mosaic_height);
+
+    auto scroll_x    = layer.scroll_x;
+    auto increment_x = layer.increment_x;
+    auto y           = layer.scroll_y + mosaic_line * layer.increment_y;
+
+    if (layer.is_line_scroll_x || layer.is_line_scroll_y || layer.is_line_zoom) {
+        const auto entry_size = u32{4} * (static_cast<u32>(layer.is_line_scroll_x) + static_cast<u32>(layer.is_line_scroll_y)
+                                          + static_cast<u32>(layer.is_line_zoom));
+        auto       address    = layer.line_scroll_table + (static_cast<u32>(mosaic_line) >> layer.line_scroll_interval) * entry_size;
+        if (layer.is_line_scroll_x) {
+            scroll_x += static_cast<s32>((readVram32(data, address) >> 8) & line_scroll_value_mask);
+            address += 4;
+        }
+        if (layer.is_line_scroll_y) {
+            // Line scroll Y replaces the vertical coordinate of the line.
+            y = layer.scroll_y + static_cast<s32>((readVram32(data, address) >> 8) & line_scroll_value_mask);
+            address += 4;
+        }
+        if (layer.is_line_zoom) {
+            increment_x = static_cast<s32>((readVram32(data, address) >> 8) & line_zoom_value_mask);
+            if (increment_x == 0) { increment_x = fixed_point_one; }
+        }
+    }
+
+    if (layer.mosaic_width == 1) {
+        for (u16 x = 0; x < width; ++x) {
+            buffers.sample_x[x] = (scroll_x + x * increment_x) >> fixed_point_shift;
+        }
+    } else {
+        for (u16 x = 0; x < width; ++x) {
+            buffers.sample_x[x] = (scroll_x + (x - x % layer.mosaic_width) * increment_x) >> fixed_point_shift;
+        }
+    }
+
+    if (layer.is_vertical_cell_scroll) {
+        // One table entry per 8 dots column.
+        for (u16 column = 0; column < width; column += 8) {
+            const auto address
+                = layer.vertical_cell_scroll_table
+                  + ((column >> 3) * layer.vertical_cell_scroll_stride + layer.vertical_cell_scroll_index) * u32{4};
+            const auto column_y = (y + static_cast<s32>((readVram32(data, address) >> 8) & line_scroll_value_mask))
+                                  >> fixed_point_shift;
+            std::fill_n(buffers.sample_y.begin() + column, std::min<u16>(8, width - column), column_y);
+        }
+    } else {
+        std::fill_n(buffers.sample_y.begin(), width, y >> fixed_point_shift);
+    }
+
+    fetchDots(layer, buffers, out);
+    applyWindow(layer.window, buffers, out);
+}
+
+void SoftwareRenderer::drawRotationScrollScreenLine(const LayerSetup& layer,
+                                                    const u16         line,
+                                                    LineBuffers&      buffers,
+                                                    LayerLine&        out) const {
+    using RotationParametersMode = RotationSetup::RotationParametersMode;
+
+    const auto& rotation    = layer.rotation;
+    const auto  data        = vram();
+    const auto  width       = frame_size_.w;
+    const auto  mosaic_line = static_cast<u16>(line - line % layer.mosaic_height);
+
+    const auto calculateCoordinates = [&](const u8 index, std::span<s32> x, std::span<s32> y, std::span<u8> is_transparent) {
+        // The parameter table is read once per line, the line setup is then shared by all the dots.
+        const auto  parameter = readRotationParameter(data, rotation.table_address + index * rotation_parameter_b_offset);
+        const auto& setting   = rotation.coefficients[index];
+        calculateRotationCoordinates(parameter,
+                                     setupRotationLine(parameter, mosaic_line),
+                                     setting,
+                                     setting.is_in_color_ram ? cram() : data,
+                                     x.first(width),
+                                     y.first(width),
+                                     is_transparent.first(width));
+    };
+
+    // Parameter B is calculated apart and merged when screens are switched.
+    const auto mergeParameterB = [&](const std::span<const u8> is_parameter_b) {
+        calculateCoordinates(1, buffers.rotation_x, buffers.rotation_y, buffers.rotation_transparent);
+        for (u16 x = 0; x < width; ++x) {
+            const auto use_b                = is_parameter_b[x] != 0;
+            buffers.sample_parameter[x]     = static_cast<u8>(use_b);
+            buffers.sample_x[x]             = use_b ? buffers.rotation_x[x] : buffers.sample_x[x];
+            buffers.sample_y[x]             = use_b ? buffers.rotation_y[x] : buffers.sample_y[x];
+            buffers.is_sample_transparent[x] = use_b ? buffers.rotation_transparent[x] : buffers.is_sample_transparent[x];
+        }
+    };
+
+    switch (rotation.mode) {
+        using enum RotationParametersMode;
+        case rotation_parameter_a:
+            calculateCoordinates(0, buffers.sample_x, buffers.sample_y, buffers.is_sample_transparent);
+            std::fill_n(buffers.sample_parameter.begin(), width, u8{0});
+            break;
+        case rotation_parameter_b:
+            calculateCoordinates(1, buffers.sample_x, buffers.sample_y, buffers.is_sample_transparent);
+            std::fill_n(buffers.sample_parameter.begin(), width, u8{1});
+            break;
+        case screens_are_switched_via_coefficient_table: {
+            // Dots made transparent by the parameter A coefficient table use parameter B.
+            calculateCoordinates(0, buffers.sample_x, buffers.sample_y, buffers.is_sample_transparent);
+            const auto is_parameter_a_transparent = buffers.is_sample_transparent;
+            mergeParameterB(is_parameter_a_transparent);
+            break;
+        }
+        case screens_are_switched_via_window:
+            calculateCoordinates(0, buffers.sample_x, buffers.sample_y, buffers.is_sample_transparent);
+            calculateWindowMask(rotation.parameter_window, buffers);
+            mergeParameterB(buffers.mask);
+            break;
+    }
+
+    if (layer.mosaic_width > 1) {
+        for (u16 x = 0; x < width; ++x) {
+            const auto first                 = x - x % layer.mosaic_width;
+            buffers.sample_x[x]              = buffers.sample_x[first];
+            buffers.sample_y[x]              = buffers.sample_y[first];
+            buffers.sample_parameter[x]      = buffers.sample_parameter[first];
+            buffers.is_sample_transparent[x] = buffers.is_sample_transparent[first];
+        }
+    }
+
+    fetchDots(layer, buffers, out);
+    applyWindow(layer.window, buffers, out);
+}
+
+void SoftwareRenderer::fetchDots(const LayerSetup& layer, const LineBuffers& buffers, LayerLine& out) const {
+    const auto  data   = vram();
+    const auto  width  = frame_size_.w;
+    const auto& screen = layer.screen;
+
+    const auto is_cc_enabled = layer.is_color_calculation_enabled;
+
+    if (screen.format == ScrollScreenFormat::bitmap) {
+        const auto palette = (screen.character_color_number == ColorCount::palette_16)
+                                 ? static_cast<u16>(screen.bitmap_palette_number << 4)
+                                 : static_cast<u16>(screen.bitmap_palette_number << 8);
+        const auto priority = layer.is_special_priority
+                                  ? static_cast<u8>((screen.priority_number & 0x6) | screen.bitmap_special_priority)
+                                  : screen.priority_number;
+        const auto is_cc    = is_cc_enabled
+                           && (!layer.is_special_color_calculation || screen.bitmap_special_color_calculation != 0);
+        for (u16 x = 0; x < width; ++x) {
+            auto is_over_pattern = false;
+            if (layer.is_rotation
+                && !isRotationDotVisible(layer, buffers, x, layer.bitmap_width, layer.bitmap_height, is_over_pattern)) {
+                out.priority[x] = 0;
+                continue;
+            }
+            const auto bx    = static_cast<u32>(buffers.sample_x[x]) & (layer.bitmap_width - 1);
+            const auto by    = static_cast<u32>(buffers.sample_y[x]) & (layer.bitmap_height - 1);
+            auto       color = u32{};
+            if (readDot(layer, layer.bitmap_address, by * layer.bitmap_width + bx, palette, color)) {
+                out.color[x]               = color;
+                out.priority[x]            = priority;
+                out.ratio[x]               = layer.color_calculation_ratio;
+                out.is_color_calculated[x] = static_cast<u8>(is_cc);
+            } else {
+                out.priority[x] = 0;
+            }
+        }
+        return;
+    }
+
+    const auto map_width_dots  = static_cast<u32>(layer.map_width) * layer.plane_width;
+    const auto map_height_dots = static_cast<u32>(layer.map_width) * layer.plane_height;
+    const auto pages_per_row   = static_cast<u32>(layer.plane_width / page_dots);
+    const auto cp_per_row      = static_cast<u32>(page_dots / layer.character_size);
+    const auto cell_size       = static_cast<u32>(screen.cell_size);
+
+    // Consecutive dots usually share the same character pattern, the last decoded one is kept.
+    constexpr auto over_pattern_key = u32{0xFFFFFFF0}; // Outside of VRAM, the parameter index is added.
+    auto last_pnd_address = u32{0xFFFFFFFF};
+    auto pnd              = PatternNameData{};
+    auto character_base   = u32{};
+    auto palette          = u16{};
+    auto priority         = u8{};
+    auto is_cc            = false;
+
+    for (u16 x = 0; x < width; ++x) {
+        auto is_over_pattern = false;
+        if (layer.is_rotation && !isRotationDotVisible(layer, buffers, x, map_width_dots, map_height_dots, is_over_pattern)) {
+            out.priority[x] = 0;
+            continue;
+        }
+
+        const auto mx = static_cast<u32>(buffers.sample_x[x]) & (map_width_dots - 1);
+        const auto my = static_cast<u32>(buffers.sample_y[x]) & (map_height_dots - 1);
+
+        // Plane, page and character pattern containing the dot
+        auto pnd_address = over_pattern_key | buffers.sample_parameter[x];
+        if (!is_over_pattern) {
+            const auto plane = (my / layer.plane_height) * layer.map_width + mx / layer.plane_width;
+            const auto px    = mx % layer.plane_width;
+            const auto py    = my % layer.plane_height;
+            const auto page  = (py / page_dots) * pages_per_row + px / page_dots;
+            const auto cx    = (px % page_dots) / layer.character_size;
+            const auto cy    = (py % page_dots) / layer.character_size;
+            pnd_address      = (layer.plane_addresses[plane] + page * screen.page_size
+                           + (cy * cp_per_row + cx) * layer.pattern_name_data_size)
+                          & core::vdp2_vram_memory_mask;
+        }
+
+        if (pnd_address != last_pnd_address) {
+            last_pnd_address = pnd_address;
+            auto raw         = u32{};
+            if (is_over_pattern) {
+                raw = layer.rotation.over_pattern_names[buffers.sample_parameter[x]];
+            } else {
+                raw = (layer.pattern_name_data_size == 2) ? readVram16(data, pnd_address) : readVram32(data, pnd_address);
+            }
+            pnd = layer.read_pattern_name_data(raw, screen);
+            pnd.character_number &= layer.character_mask;
+            character_base = static_cast<u32>(pnd.character_number) * 0x20;
+
+            switch (screen.character_color_number) {
+                using enum ColorCount;
+                case palette_16: palette = static_cast<u16>(pnd.palette_number << 4); break;
+                case palette_256: palette = static_cast<u16>((pnd.palette_number << 4) & 0x700); break;
+                default: palette = 0;
+            }
+            priority = layer.is_special_priority ? static_cast<u8>((screen.priority_number & 0x6) | pnd.special_priority)
+                                                 : screen.priority_number;
+            is_cc    = is_cc_enabled && (!layer.is_special_color_calculation || pnd.special_color_calculation != 0);
+        }
+
+        // Dot position inside the character pattern, flips apply to the whole pattern.
+        auto dx = mx % layer.character_size;
+        auto dy = my % layer.character_size;
+        if (pnd.is_horizontally_flipped) { dx = layer.character_size - 1 - dx; }
+        if (pnd.is_vertically_flipped) { dy = layer.character_size - 1 - dy; }
+        const auto cell_address = character_base + ((dy >> 3) * 2 + (dx >> 3)) * cell_size;
+
+        auto color = u32{};
+        if (readDot(layer, cell_address, (dy & 7) * 8 + (dx & 7), palette, color)) {
+            out.color[x]               = color;
+            out.priority[x]            = priority;
+            out.ratio[x]               = layer.color_calculation_ratio;
+            out.is_color_calculated[x] = static_cast<u8>(is_cc);
+        } else {
+            out.priority[x] = 0;
+        }
+    }
+}
+
+auto SoftwareRenderer::isRotationDotVisible(const LayerSetup&  layer,
+                                            const LineBuffers& buffers,
+                                            const u16          x,
+                                            const u32          area_width,
+                                            const u32          area_height,
+                                            bool&              is_over_pattern) const -> bool {
+    using ScreenOverProcess = RotationSetup::ScreenOverProcess;
+    constexpr auto forced_area_size = s32{512};
+
+    if (buffers.is_sample_transparent[x]) { return false; }
+
+    const auto sx = buffers.sample_x[x];
+    const auto sy = buffers.sample_y[x];
+    const auto is_outside
+        = sx < 0 || sy < 0 || sx >= static_cast<s32>(area_width) || sy >= static_cast<s32>(area_height);
+    switch (layer.rotation.screen_over[buffers.sample_parameter[x]]) {
+        using enum ScreenOverProcess;
+        case character_pattern_is_repeated:
+            // Only available for cell screens, bitmaps are repeated.
+            is_over_pattern = is_outside && layer.screen.format == ScrollScreenFormat::cell;
+            return true;
+        case scroll_screen_is_transparent: return !is_outside;
+        case force_display_and_make_transparent: return sx >= 0 && sy >= 0 && sx < forced_area_size && sy < forced_area_size;
+        default: return true;
+    }
+}
+
+auto SoftwareRenderer::readDot(const LayerSetup& layer, const u32 address, const u32 index, const u16 palette, u32& color) const
+    -> bool {
+    const auto  data           = vram();
+    const auto& screen         = layer.screen;
+    const auto  is_transparent = screen.is_transparency_code_valid;
+    switch (screen.character_color_number) {
+        using enum ColorCount;
+        case palette_16: {
+            const auto byte = data[(address + index / 2) & core::vdp2_vram_memory_mask];
+            const auto dot  = (index & 1) ? (byte & 0xF) : (byte >> 4);
+            if (dot == 0 && is_transparent) { return false; }
+            color = readColorRam(screen.color_ram_address_offset, palette | dot);
+            return true;
+        }
+        case palette_256: {
+            const auto dot = data[(address + index) & core::vdp2_vram_memory_mask];
+            if (dot == 0 && is_transparent) { return false; }
+            color = readColorRam(screen.color_ram_address_offset, palette + dot);
+            return true;
+        }
+        case palette_2048: {
+            const auto dot = readVram16(data, address + index * 2) & 0x7FF;
+            if (dot == 0 && is_transparent) { return false; }
+            color = readColorRam(screen.color_ram_address_offset, dot);
+            return true;
+        }
+        case rgb_32k: {
+            const auto raw = readVram16(data, address + index * 2);
+            if ((raw & 0x8000) == 0 && is_transparent) { return false; }
+            color = packColor(Color(raw));
+            return true;
+        }
+        case rgb_16m: {
+            const auto raw = readVram32(data, address + index * 4);
+            if ((raw & 0x80000000) == 0 && is_transparent) { return false; }
+            color = packColor(Color(raw));
+            return true;
+        }
+        default: return false;
+    }
+}
+
+auto SoftwareRenderer::readColorRam(const u32 offset, const u32 index) const -> u32 {
+    const auto data = cram();
+    if (is_cram_32_bits_) {
+        const auto address = (offset | index * 4) & core::vdp2_cram_memory_mask;
+        return packColor(Color(util::readAs32(data.subspan(address & ~u32{0x3}, 4))));
+    }
+    const auto address = (offset | index * 2) & core::vdp2_cram_memory_mask;
+    return packColor(Color(util::readAs16(data.subspan(address & ~u32{0x1}, 2))));
+}
+
+void SoftwareRenderer::drawSpriteLine(const u16 line, LineBuffers& buffers, LayerLine& out) const {
+    const auto& format       = sprite_type_formats[sprite_control_ & 0xF];
+    const auto  is_mixed     = (sprite_control_ & 0x20) != 0;
+    const auto  cc_number    = static_cast<u8>((sprite_control_ >> 8) & 0x7);
+    const auto  cc_condition = static_cast<u8>((sprite_control_ >> 12) & 0x3);
+    const auto& framebuffer  = modules_.memory()->vdp1_framebuffer_;
+    const auto  width        = frame_size_.w;
+
+    const auto isColorCalculated = [&](const u8 priority, const u16 raw) {
+        if (!is_sprite_color_calculation_enabled_) { return false; }
+        switch (cc_condition) {
+            case 0: return priority <= cc_number;
+            case 1: return priority == cc_number;
+            case 2: return priority >= cc_number;
+            default: return (raw & 0x8000) != 0;
+        }
+    };
+
+    for (u16 x = 0; x < width; ++x) {
+        auto raw = u16{};
+        if (format.is_8_bits) {
+            const auto stride = is_hi_res_ ? u32{1024} : u32{512};
+            raw               = framebuffer[(line * stride + x) & core::vdp1_framebuffer_memory_mask];
+        } else {
+            const auto address = ((line * u32{512} + x) * 2) & core::vdp1_framebuffer_memory_mask;
+            raw                = static_cast<u16>(framebuffer[address] << 8 | framebuffer[address + 1]);
+        }
+        if (raw == 0) {
+            out.priority[x] = 0;
+            continue;
+        }
+
+        auto priority_register = u8{};
+        auto ratio_register    = u8{};
+        if (is_mixed && !format.is_8_bits && (raw & 0x8000)) {
+            // RGB dot, registers 0 are used.
+            out.color[x] = packColor(Color(raw));
+        } else {
+            const auto dot = static_cast<u16>(raw & format.color_mask);
+            if (dot == 0) {
+                out.priority[x] = 0;
+                continue;
+            }
+            priority_register = static_cast<u8>((raw >> format.priority_shift) & format.priority_mask);
+            ratio_register    = static_cast<u8>((raw >> format.ratio_shift) & format.ratio_mask);
+            out.color[x]      = readColorRam(sprite_color_offset_, dot);
+        }
+        const auto priority        = sprite_priorities_[priority_register];
+        out.priority[x]            = priority;
+        out.ratio[x]               = sprite_ratios_[ratio_register];
+        out.is_color_calculated[x] = static_cast<u8>(isColorCalculated(priority, raw));
+    }
+
+    applyWindow(sprite_window_, buffers, out);
+}
+
+void SoftwareRenderer::drawBackScreenLine(const u16 line, LayerLine& out) const {
+    const auto address = back_screen_table_ + (is_back_screen_per_line_ ? u32{line} * 2 : 0);
+    const auto color   = packColor(Color(readVram16(vram(), address)));
+    const auto width   = frame_size_.w;
+    std::fill_n(out.color.begin(), width, color);
+    std::fill_n(out.ratio.begin(), width, ratios_[util::toUnderlying(SoftwareLayer::back)]);
+}
+
+void SoftwareRenderer::updateWindowSpans(const u16 line, LineBuffers& buffers) const {
+    const auto data = vram();
+    for (u8 w = 0; w < 2; ++w) {
+        auto& span          = buffers.windows[w];
+        span.is_line_inside = line >= window_start_y_[w] && line <= window_end_y_[w];
+        span.start          = window_start_x_[w];
+        span.end            = window_end_x_[w];
+        if (is_line_window_[w]) {
+            const auto address = line_window_tables_[w] + u32{line} * 4;
+            span.start         = readVram16(data, address) & window_position_mask;
+            span.end           = readVram16(data, address + 2) & window_position_mask;
+        }
+        if (!is_hi_res_) {
+            span.start >>= 1;
+            span.end >>= 1;
+        }
+    }
+}
+
+void SoftwareRenderer::calculateWindowMask(const WindowSetting& setting, LineBuffers& buffers) const {
+    const auto  width = frame_size_.w;
+    const auto& w0    = buffers.windows[0];
+    const auto& w1    = buffers.windows[1];
+    for (s32 x = 0; x < width; ++x) {
+        const auto in_w0 = (w0.is_line_inside && x >= w0.start && x <= w0.end) != setting.is_w0_outside;
+        const auto in_w1 = (w1.is_line_inside && x >= w1.start && x <= w1.end) != setting.is_w1_outside;
+        auto       area  = bool{};
+        if (setting.is_w0_enabled && setting.is_w1_enabled) {
+            area = setting.is_logic_and ? (in_w0 && in_w1) : (in_w0 || in_w1);
+        } else {
+            area = setting.is_w0_enabled ? in_w0 : in_w1;
+        }
+        buffers.mask[x] = static_cast<u8>(area);
+    }
+}
+
+void SoftwareRenderer::applyWindow(const WindowSetting& setting, LineBuffers& buffers, LayerLine& out) const {
+    if (!setting.isUsed()) { return; }
+    calculateWindowMask(setting, buffers);
+    const auto width = frame_size_.w;
+    for (u16 x = 0; x < width; ++x) {
+        if (buffers.mask[x]) { out.priority[x] = 0; }
+    }
+}
+
+void SoftwareRenderer::compositeLine(const u16 line, LineBuffers& buffers) {
+    const auto width             = frame_size_.w;
+    const auto back              = util::toUnderlying(SoftwareLayer::back);
+    const auto is_cc_window_used = color_calculation_window_.isUsed();
+    if (is_cc_window_used) { calculateWindowMask(color_calculation_window_, buffers); }
+
+    auto* destination = rendered_frame_.data() + static_cast<size_t>(line) * width * 4;
+    for (u16 x = 0; x < width; ++x) {
+        // Top and second screens, the first layer in the list wins when priorities are equal.
+        auto top             = back;
+        auto second          = back;
+        auto top_priority    = u8{};
+        auto second_priority = u8{};
+        for (u8 i = 0; i < buffers.active_layers_number; ++i) {
+            const auto layer    = buffers.active_layers[i];
+            const auto priority = buffers.layers[layer].priority[x];
+            if (priority > top_priority) {
+                second          = top;
+                second_priority = top_priority;
+                top             = layer;
+                top_priority    = priority;
+            } else if (priority > second_priority) {
+                second          = layer;
+                second_priority = priority;
+            }
+        }
+
+        const auto& top_line = buffers.layers[top];
+        auto        color    = top_line.color[x];
+        auto        r        = static_cast<s32>(color & 0xFF);
+        auto        g        = static_cast<s32>((color >> 8) & 0xFF);
+        auto        b        = static_cast<s32>((color >> 16) & 0xFF);
+
+        if (top != back && top_line.is_color_calculated[x] && !(is_cc_window_used && buffers.mask[x])) {
+            const auto& second_line  = buffers.layers[second];
+            const auto  second_color = second_line.color[x];
+            const auto  second_r     = static_cast<s32>(second_color & 0xFF);
+            const auto  second_g     = static_cast<s32>((second_color >> 8) & 0xFF);
+            const auto  second_b     = static_cast<s32>((second_color >> 16) & 0xFF);
+            if (is_add_as_is_) {
+                r = std::min(r + second_r, color_component_max);
+                g = std::min(g + second_g, color_component_max);
+                b = std::min(b + second_b, color_component_max);
+            } else {
+                const auto ratio = is_ratio_from_second_ ? second_line.ratio[x] : top_line.ratio[x];
+                r                = (r * (color_calculation_ratio_max - ratio) + second_r * (ratio + 1)) >> 5;
+                g                = (g * (color_calculation_ratio_max - ratio) + second_g * (ratio + 1)) >> 5;
+                b                = (b * (color_calculation_ratio_max - ratio) + second_b * (ratio + 1)) >> 5;
+            }
+        }
+
+        const auto& offset = color_offsets_[top];
+        r                  = std::clamp(r + offset[0], 0, color_component_max);
+        g                  = std::clamp(g + offset[1], 0, color_component_max);
+        b                  = std::clamp(b + offset[2], 0, color_component_max);
+
+        destination[x * 4]     = static_cast<u8>(r);
+        destination[x * 4 + 1] = static_cast<u8>(g);
+        destination[x * 4 + 2] = static_cast<u8>(b);
+        destination[x * 4 + 3] = 0xFF;
+    }
+}
+
+auto SoftwareRenderer::vram() const -> std::span<const u8> { return modules_.memory()->vdp2_vram_; }
+
+auto SoftwareRenderer::cram() const -> std::span<const u8> { return modules_.memory()->vdp2_cram_; }
+
+} // namespace saturnin::video
@@ -0,0 +1,458 @@
+//
+// software_renderer.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	software_renderer.h
+///
+/// \brief	Declares the SoftwareRenderer class, a CPU only VDP2 compositor.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>  // array
+#include <memory> // unique_ptr
+#include <span>   // span
+#include <vector> // vector
+#include <saturnin/src/emulator_defs.h>    // u8, u16, u32, Size
+#include <saturnin/src/emulator_modules.h> // EmulatorModules
+#include <saturnin/src/triple_buffer.h>    // TripleBuffer
+#include <saturnin/src/video/vdp2/vdp2.h>          // ScrollScreenStatus, PatternNameData
+#include <saturnin/src/video/vdp2/vdp2_rotation.h> // CoefficientTableSetting
+
+namespace saturnin::video {
+
+using core::EmulatorModules;
+
+constexpr auto software_max_line_width = u16{horizontal_res_704};
+constexpr auto software_band_height    = u16{16}; ///< Number of lines rendered by one thread pool task.
+constexpr auto software_layers_number  = u8{7};   ///< Sprite, RBG0, NBG0/RBG1, NBG1, NBG2, NBG3 and back screen.
+
+// Indexes of the layers in the line buffers, ordered by display precedence when priorities are equal.
+enum class SoftwareLayer : u8 { sprite = 0, rbg0 = 1, nbg0 = 2, nbg1 = 3, nbg2 = 4, nbg3 = 5, back = 6 };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct WindowSetting
+///
+/// \brief  Normal windows (W0 / W1) usage of a layer or of the color calculation process.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct WindowSetting {
+    bool is_w0_enabled{}; ///< W0 is used.
+    bool is_w0_outside{}; ///< The outside of W0 is the window area.
+    bool is_w1_enabled{}; ///< W1 is used.
+    bool is_w1_outside{}; ///< The outside of W1 is the window area.
+    bool is_logic_and{};  ///< Both windows areas are combined with AND instead of OR.
+
+    [[nodiscard]] auto isUsed() const -> bool { return is_w0_enabled || is_w1_enabled; }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct WindowSpan
+///
+/// \brief  Horizontal span covered by a normal window on the current line.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct WindowSpan {
+    bool is_line_inside{}; ///< True when the line is between the vertical start and end positions.
+    s32  start{};          ///< Horizontal start position.
+    s32  end{};            ///< Horizontal end position (included).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct RotationSetup
+///
+/// \brief  Rotation parameters configuration of a rotation scroll screen. Index 0 is parameter A, 1 is B.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RotationSetup {
+    using RotationParametersMode = Vdp2Regs::Rpmd::RotationParametersMode;
+    using ScreenOverProcess      = Vdp2Regs::Plsz::ScreenOverProcess;
+
+    u32                                    table_address{};      ///< Rotation parameter table address, relative to VRAM.
+    RotationParametersMode                 mode{};               ///< Rotation parameters used by the screen.
+    std::array<CoefficientTableSetting, 2> coefficients{};       ///< Coefficient table settings.
+    std::array<ScreenOverProcess, 2>       screen_over{};        ///< Process applied outside of the display area.
+    std::array<u16, 2>                     over_pattern_names{}; ///< Screen over pattern name data.
+    WindowSetting                          parameter_window;     ///< Window used to switch between the parameters.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct LayerSetup
+///
+/// \brief  Frame data of a scroll screen, extracted from the VDP2 state before rendering.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct LayerSetup {
+    using PatternNameDataReader = PatternNameData (*)(const u32, const ScrollScreenStatus&);
+
+    bool                  is_displayed{};           ///< True when the layer has to be rendered.
+    bool                  is_rotation{};            ///< True for rotation scroll screens.
+    ScrollScreenStatus    screen;                   ///< Copy of the scroll screen status.
+    std::array<u32, 16>   plane_addresses{};        ///< Planes start addresses, relative to VRAM (A to P).
+    u8                    map_width{};              ///< Number of planes in a map row or column (2 for NBG, 4 for RBG).
+    u16                   plane_width{};            ///< Width of a plane in dots.
+    u16                   plane_height{};           ///< Height of a plane in dots.
+    u16                   bitmap_width{};           ///< Width of the bitmap in dots.
+    u16                   bitmap_height{};          ///< Height of the bitmap in dots.
+    u32                   bitmap_address{};         ///< Bitmap start address, relative to VRAM.
+    u8                    character_size{};         ///< Width of a character pattern in dots (8 or 16).
+    u8                    pattern_name_data_size{}; ///< Size of a pattern name data entry in bytes (2 or 4).
+    u16                   character_mask{};         ///< Mask applied to the character number.
+    PatternNameDataReader read_pattern_name_data{}; ///< Pattern name data decoder.
+
+    // Scrolling, 8 bits fixed point values
+    s32  scroll_x{};                    ///< Horizontal screen scroll value.
+    s32  scroll_y{};                    ///< Vertical screen scroll value.
+    s32  increment_x{};                 ///< Horizontal coordinate increment.
+    s32  increment_y{};                 ///< Vertical coordinate increment.
+    bool is_line_scroll_x{};            ///< Horizontal line scroll is enabled.
+    bool is_line_scroll_y{};            ///< Vertical line scroll is enabled.
+    bool is_line_zoom{};                ///< Horizontal line zoom is enabled.
+    u8   line_scroll_interval{};        ///< Line scroll table entries are applied every 2^interval lines.
+    u32  line_scroll_table{};           ///< Line scroll table address, relative to VRAM.
+    bool is_vertical_cell_scroll{};     ///< Vertical cell scroll is enabled.
+    u32  vertical_cell_scroll_table{};  ///< Vertical cell scroll table address, relative to VRAM.
+    u8   vertical_cell_scroll_stride{}; ///< Number of entries in a vertical cell scroll table column.
+    u8   vertical_cell_scroll_index{};  ///< Index of the layer entry in a vertical cell scroll table column.
+
+    // Rotation
+    RotationSetup rotation; ///< Rotation parameters configuration (RBG only).
+
+    // Mosaic
+    u8 mosaic_width{1};  ///< Horizontal mosaic size.
+    u8 mosaic_height{1}; ///< Vertical mosaic size.
+
+    // Display
+    WindowSetting window;                         ///< Transparent window setting.
+    bool          is_special_priority{};          ///< Priority LSB is taken from the pattern name data.
+    bool          is_special_color_calculation{}; ///< Color calculation is enabled per character.
+    bool          is_color_calculation_enabled{}; ///< Color calculation is enabled.
+    u8            color_calculation_ratio{};      ///< Color calculation ratio (0 to 31).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct LayerLine
+///
+/// \brief  One line of a layer, stored as a structure of arrays to help vectorization.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct LayerLine {
+    alignas(32) std::array<u32, software_max_line_width> color;              ///< Color as 0xAABBGGRR.
+    alignas(32) std::array<u8, software_max_line_width> priority;            ///< Priority, 0 means transparent.
+    alignas(32) std::array<u8, software_max_line_width> ratio;               ///< Color calculation ratio.
+    alignas(32) std::array<u8, software_max_line_width> is_color_calculated; ///< 1 when color calculation applies.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct LineBuffers
+///
+/// \brief  Working buffers used by a thread pool task to render its lines.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct LineBuffers {
+    std::array<LayerLine, software_layers_number>        layers;                ///< Lines of every layer.
+    alignas(32) std::array<s32, software_max_line_width> sample_x;              ///< Horizontal dot coordinates in the scroll screen.
+    alignas(32) std::array<s32, software_max_line_width> sample_y;              ///< Vertical dot coordinates in the scroll screen.
+    alignas(32) std::array<u8, software_max_line_width>  sample_parameter;      ///< Rotation parameter used by the dot.
+    alignas(32) std::array<u8, software_max_line_width>  is_sample_transparent; ///< 1 when the coefficient hides the dot.
+    alignas(32) std::array<s32, software_max_line_width> rotation_x;            ///< Parameter B horizontal coordinates.
+    alignas(32) std::array<s32, software_max_line_width> rotation_y;            ///< Parameter B vertical coordinates.
+    alignas(32) std::array<u8, software_max_line_width>  rotation_transparent;  ///< Parameter B coefficient transparency.
+    alignas(32) std::array<u8, software_max_line_width>  mask;                  ///< Window mask, 1 when the dot is in the window area.
+    std::array<WindowSpan, 2>                            windows;               ///< W0 and W1 spans for the current line.
+    std::array<u8, software_layers_number>               active_layers;         ///< Layers drawn on the current line.
+    u8                                                   active_layers_number;  ///< Number of layers drawn on the line.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct RenderedFrame
+///
+/// \brief  A frame rendered by the software renderer.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RenderedFrame {
+    u32             number{}; ///< Frame number, incremented for each rendered frame.
+    Size            size{};   ///< Frame size in dots.
+    std::vector<u8> rgba;     ///< Frame data, 4 bytes per dot.
+};
+
+class SoftwareRenderer {
+  public:
+    ///@{
+    /// Constructors / Destructors
+    SoftwareRenderer() = delete;
+    explicit SoftwareRenderer(core::EmulatorContext* ec) : modules_(ec) {};
+    SoftwareRenderer(const SoftwareRenderer&)                      = delete;
+    SoftwareRenderer(SoftwareRenderer&&)                           = delete;
+    auto operator=(const SoftwareRenderer&) & -> SoftwareRenderer& = delete;
+    auto operator=(SoftwareRenderer&&) & -> SoftwareRenderer&      = delete;
+    ~SoftwareRenderer()                                            = default;
+    ///@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SoftwareRenderer::render();
+    ///
+    /// \brief  Renders the current VDP2 state. Bands of lines are dispatched to the thread pool, the
+    ///         function returns when the whole frame is rendered.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void render();
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SoftwareRenderer::acquireFrame() -> bool;
+    ///
+    /// \brief  Makes the last rendered frame available through frame(). Must be called from the display thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if a new frame was rendered since the last call.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto acquireFrame() -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SoftwareRenderer::frame() const -> const RenderedFrame&;
+    ///
+    /// \brief  Returns the last acquired frame. It stays valid until the next call to acquireFrame().
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The last acquired frame.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto frame() const -> const RenderedFrame&;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SoftwareRenderer::frameHashing(const bool is_enabled)
+    ///
+    /// \brief  Enables the calculation of a hash of each rendered frame, used to check the output of
+    ///         benchmark runs.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  is_enabled  True to calculate the hashes.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void frameHashing(const bool is_enabled) { is_frame_hashed_ = is_enabled; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SoftwareRenderer::lastFrameHash() const -> u64
+    ///
+    /// \brief  Returns the hash of the last rendered frame. Must be called from the emulation thread.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The hash, 0 if frame hashing is disabled.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto lastFrameHash() const -> u64 { return last_frame_hash_; }
+
+  private:
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SoftwareRenderer::setupFrame();
+    ///
+    /// \brief  Extracts from the VDP2 state everything needed to render the frame. This data is only
+    ///         read while the bands are rendered.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void setupFrame();
+
+    void setupLayer(const ScrollScreen s);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SoftwareRenderer::renderLines(const u16 first_line, const u16 last_line);
+    ///
+    /// \brief  Renders a range of lines sharing the current setup, split in bands over the thread pool.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  first_line  First line of the range.
+    /// \param  last_line   Last line of the range (excluded).
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void renderLines(const u16 first_line, const u16 last_line);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SoftwareRenderer::renderBand(const u16 first_line, const u16 last_line, LineBuffers& buffers);
+    ///
+    /// \brief  Renders a band of lines, called from a thread pool task.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          first_line  First line of the band.
+    /// \param          last_line   Last line of the band (excluded).
+    /// \param [in,out] buffers     Working buffers owned by the band.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void renderBand(const u16 first_line, const u16 last_line, LineBuffers& buffers);
+
+    void renderLine(const u16 line, LineBuffers& buffers);
+
+    ///@{
+    /// \name Per layer line rendering
+    void drawNormalScrollScreenLine(const LayerSetup& layer, const u16 line, LineBuffers& buffers, LayerLine& out) const;
+    void drawRotationScrollScreenLine(const LayerSetup& layer, const u16 line, LineBuffers& buffers, LayerLine& out) const;
+    void drawSpriteLine(const u16 line, LineBuffers& buffers, LayerLine& out) const;
+    void drawBackScreenLine(const u16 line, LayerLine& out) const;
+    ///@}
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void SoftwareRenderer::fetchDots(const LayerSetup& layer, const LineBuffers& buffers, LayerLine& out) const;
+    ///
+    /// \brief  Reads the dots of a scroll screen at the coordinates previously calculated for the line.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          layer   The layer setup.
+    /// \param          buffers The line buffers holding the dots coordinates.
+    /// \param [in,out] out     The layer line to fill.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void fetchDots(const LayerSetup& layer, const LineBuffers& buffers, LayerLine& out) const;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SoftwareRenderer::isRotationDotVisible(const LayerSetup& layer, const LineBuffers& buffers, const u16 x, const u32 area_width, const u32 area_height, bool& is_over_pattern) const -> bool;
+    ///
+    /// \brief  Applies the coefficient transparency and the screen over process to a rotation screen dot.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          layer           The layer setup.
+    /// \param          buffers         The line buffers holding the dots coordinates.
+    /// \param          x               Dot position in the line.
+    /// \param          area_width      Width of the display area (map or bitmap).
+    /// \param          area_height     Height of the display area (map or bitmap).
+    /// \param [in,out] is_over_pattern Set to true when the screen over pattern name must be used.
+    ///
+    /// \returns    False when the dot is transparent.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto isRotationDotVisible(const LayerSetup&  layer,
+                              const LineBuffers& buffers,
+                              const u16          x,
+                              const u32          area_width,
+                              const u32          area_height,
+                              bool&              is_over_pattern) const -> bool;
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn auto SoftwareRenderer::readDot(const LayerSetup& layer, const u32 address, const u32 index, const u16 palette, u32& color) const -> bool;
+    ///
+    /// \brief  Reads a dot of character pattern or bitmap data and converts it to a color.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param          layer   The layer setup.
+    /// \param          address Start address of the data, relative to VRAM.
+    /// \param          index   Index of the dot in the data.
+    /// \param          palette Color RAM index of the first color of the palette.
+    /// \param [in,out] color   The dot color.
+    ///
+    /// \returns    False when the dot is transparent.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    auto readDot(const LayerSetup& layer, const u32 address, const u32 index, const u16 palette, u32& color) const -> bool;
+
+    auto readColorRam(const u32 offset, const u32 index) const -> u32;
+
+    void updateWindowSpans(const u16 line, LineBuffers& buffers) const;
+    void applyWindow(const WindowSetting& setting, LineBuffers& buffers, LayerLine& out) const;
+    void calculateWindowMask(const WindowSetting& setting, LineBuffers& buffers) const;
+
+    void compositeLine(const u16 line, LineBuffers& buffers);
+
+    auto vram() const -> std::span<const u8>;
+    auto cram() const -> std::span<const u8>;
+
+    EmulatorModules modules_; ///< Modules of the emulator.
+
+    // Frame setup
+    std::array<LayerSetup, 6>                              layers_setup_{};  ///< Scroll screens setup, by ScrollScreen.
+    std::array<std::array<s16, 3>, software_layers_number> color_offsets_{}; ///< Color offsets, by SoftwareLayer.
+    std::array<u8, software_layers_number>                 ratios_{};        ///< Color calculation ratios, by SoftwareLayer.
+
+    u16               sprite_control_{};                      ///< Sprite control register raw value.
+    std::array<u8, 8> sprite_priorities_{};                   ///< Sprite priority registers.
+    std::array<u8, 8> sprite_ratios_{};                       ///< Sprite color calculation ratio registers.
+    u16               sprite_color_offset_{};                 ///< Sprite color RAM address offset.
+    bool              is_sprite_color_calculation_enabled_{}; ///< Sprite color calculation is enabled.
+
+    WindowSetting sprite_window_{};           ///< Sprite transparent window setting.
+    u32           back_screen_table_{};       ///< Back screen color table address, relative to VRAM.
+    bool          is_back_screen_per_line_{}; ///< The back screen color is selected per line.
+
+    std::array<s32, 2>  window_start_x_{};     ///< W0 / W1 horizontal start positions.
+    std::array<s32, 2>  window_end_x_{};       ///< W0 / W1 horizontal end positions.
+    std::array<s32, 2>  window_start_y_{};     ///< W0 / W1 vertical start positions.
+    std::array<s32, 2>  window_end_y_{};       ///< W0 / W1 vertical end positions.
+    std::array<bool, 2> is_line_window_{};     ///< W0 / W1 horizontal positions are read from a line window table.
+    std::array<u32, 2>  line_window_tables_{}; ///< W0 / W1 line window tables addresses, relative to VRAM.
+
+    Size          frame_size_{};               ///< Size of the frame being rendered.
+    bool          is_hi_res_{};                ///< True in hi-res and exclusive modes.
+    bool          is_cram_32_bits_{};          ///< True when color RAM entries are 32 bits wide.
+    bool          is_rbg1_displayed_{};        ///< RBG1 is displayed, using the NBG0 slot.
+    WindowSetting color_calculation_window_{}; ///< Color calculation window setting.
+    bool          is_add_as_is_{};             ///< Colors are added as is instead of using the ratio.
+    bool          is_ratio_from_second_{};     ///< Ratio is taken from the second screen instead of the top one.
+
+    std::vector<u8>                           rendered_frame_;    ///< Frame being rendered by the thread pool tasks.
+    std::vector<std::unique_ptr<LineBuffers>> band_buffers_;      ///< Working buffers, by band, kept between frames.
+    u32                                       frame_number_{};    ///< Number of rendered frames.
+    bool                                      is_frame_hashed_{}; ///< True when a hash of each rendered frame is calculated.
+    u64                                       last_frame_hash_{}; ///< Hash of the last rendered frame.
+    core::TripleBuffer<RenderedFrame>         frames_;            ///< Completed frames, handed over to the display thread.
+};
+
+} // namespace saturnin::video
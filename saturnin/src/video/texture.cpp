@@ -33,6 +33,8 @@ using core::tr;
 std::unordered_map<size_t, Texture> Texture::texture_storage_;
 SharedMutex                         Texture::storage_mutex_;
 AddressToPlaneData                  Texture::address_to_plane_data_;
+std::atomic<u64>                    Texture::cache_hits_{};
+std::atomic<u64>                    Texture::cache_misses_{};
 
 Texture::Texture(const VdpType    vp,
                  const VdpLayer   layer,
@@ -96,19 +98,25 @@ void Texture::deleteTextureData(Texture& t) {
 }
 
 auto Texture::isTextureLoadingNeeded(const size_t key) -> bool {
-    if (!isTextureKeyStored(key)) { return true; }
+    if (!isTextureKeyStored(key)) {
+        cache_misses_.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
 
     if (auto t = Texture::getTexture(key); t) {
         if ((*t)->isDiscarded()) {
             UpdatableLock lock(storage_mutex_);
             (*t)->isDiscarded(false);
+            cache_misses_.fetch_add(1, std::memory_order_relaxed);
             return true;
         }
         UpdatableLock lock(storage_mutex_);
         (*t)->isRecentlyUsed(true);
+        cache_hits_.fetch_add(1, std::memory_order_relaxed);
         return false;
     }
 
+    cache_misses_.fetch_add(1, std::memory_order_relaxed);
     return true;
 }
 
@@ -207,6 +215,10 @@ auto Texture::calculateTextureSize(const Size& max_size, const size_t texture_ke
     return Size{static_cast<u16>(width), static_cast<u16>(height)};
 }
 
+auto Texture::cacheCounters() -> TextureCacheCounters {
+    return {cache_hits_.load(std::memory_order_relaxed), cache_misses_.load(std::memory_order_relaxed)};
+}
+
 auto Texture::statistics() -> std::vector<std::string> {
     ReadOnlyLock lock(storage_mutex_);
     auto         stats = std::vector<std::string>{};
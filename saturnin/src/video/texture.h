@@ -25,6 +25,7 @@
 
 #pragma once
 
+#include <atomic> // atomic
 #include <vector> // vector
 #include <saturnin/src/emulator_defs.h>
 #include <saturnin/src/video/vdp2/vdp2.h> // ColorCount
@@ -37,6 +38,20 @@ using DebugKey = std::pair<std::string, size_t>; // Debug information of the tex
 
 enum class StorageType { current, previous };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct TextureCacheCounters
+///
+/// \brief  Texture cache lookups since the program start.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct TextureCacheCounters {
+    u64 hits;   ///< Lookups where the stored texture was reused.
+    u64 misses; ///< Lookups where the texture had to be (re)loaded.
+};
+
 class Texture {
   public:
     ///@{
@@ -302,10 +317,25 @@ class Texture {
 
     static auto calculateTextureSize(const Size& max_size, const size_t texture_key) -> Size;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn static auto Texture::cacheCounters() -> TextureCacheCounters;
+    ///
+    /// \brief  Returns the texture cache hits and misses, as counted by isTextureLoadingNeeded().
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    The counters.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static auto cacheCounters() -> TextureCacheCounters;
+
   private:
     static std::unordered_map<size_t, Texture> texture_storage_;       ///< The current texture storage.
     static SharedMutex                         storage_mutex_;         ///< Used for multithreading access to the texture pool.
     static AddressToPlaneData                  address_to_plane_data_; ///< Information describing the address to plane
+    static std::atomic<u64>                    cache_hits_;            ///< Number of texture cache hits.
+    static std::atomic<u64>                    cache_misses_;          ///< Number of texture cache misses.
 
     VdpType  vdp_type_{VdpType::not_set}; ///< What kind of VDP type is linked to this texture.
     VdpLayer layer_;                      ///< Layer linked to this texture.
@@ -29,7 +29,9 @@
 #include <saturnin/src/emulator_modules.h>
 #include <saturnin/src/interrupt_sources.h>
 #include <saturnin/src/memory.h>        // rawRead
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/scu_registers.h> // StartingFactorSelect
+#include <saturnin/src/timing.h>
 #include <saturnin/src/video/texture.h>
 #include <saturnin/src/video/vdp1.h>
 #include <saturnin/src/video/vdp1_part.h>
@@ -75,18 +77,20 @@ auto Vdp1::intializeFramebuffer() -> bool {
 void Vdp1::onVblankIn() {
     using Ptmr = Vdp1Regs::Ptmr;
 
-    Texture::cleanCache(modules_.opengl(), VdpType::vdp1);
-    Texture::setCache(VdpType::vdp1);
+    if (!modules_.vdp2()->isFrameSkipped()) {
+        Texture::cleanCache(modules_.opengl(), VdpType::vdp1);
+        Texture::setCache(VdpType::vdp1);
+    }
     updateResolution();
 
     switch (regs_.ptmr >> Ptmr::ptm_enum) {
         using enum Ptmr::PlotTriggerMode;
         case idle_at_frame_change: {
-            Log::debug(Logger::vdp1, tr("Idle at frame change"));
+            LOG_DEBUG(Logger::vdp1, tr("Idle at frame change"));
             break;
         }
         case starts_drawing_at_frame_change: {
-            Log::debug(Logger::vdp1, tr("Starts drawing automatically at frame change"));
+            LOG_DEBUG(Logger::vdp1, tr("Starts drawing automatically at frame change"));
             populateRenderData();
             break;
         }
@@ -118,6 +122,13 @@ auto Vdp1::getDebugDrawList() const -> std::vector<std::string> {
 void Vdp1::updateResolution() { color_ram_address_offset_ = modules_.vdp2()->getSpriteColorAddressOffset(); };
 
 void Vdp1::populateRenderData() {
+    TIMING_ZONE(core::TimingZone::vdp1_populate_render_data);
+    if (modules_.vdp2()->isFrameSkipped()) {
+        // The frame won't be displayed, command tables aren't parsed but the program still waits for the end of drawing.
+        signalDrawEnd();
+        return;
+    }
+
     auto current_table_address = vdp1_ram_start_address;
     auto next_table_address    = current_table_address;
     auto return_address        = u32{};
@@ -133,48 +144,48 @@ void Vdp1::populateRenderData() {
         switch (cmdctrl >> CmdCtrl::js_enum) {
             using enum CmdCtrl::JumpSelect;
             case jump_next: {
-                Log::debug(Logger::vdp1, tr("Jump next"));
+                LOG_DEBUG(Logger::vdp1, tr("Jump next"));
                 next_table_address += table_size;
                 break;
             }
             case jump_assign: {
-                Log::debug(Logger::vdp1, tr("Jump assign"));
+                LOG_DEBUG(Logger::vdp1, tr("Jump assign"));
                 next_table_address = vdp1_ram_start_address + cmdlink.data() * vdp1_address_multiplier;
                 break;
             }
             case jump_call: {
-                Log::debug(Logger::vdp1, tr("Jump call"));
+                LOG_DEBUG(Logger::vdp1, tr("Jump call"));
                 next_table_address = vdp1_ram_start_address + cmdlink.data() * vdp1_address_multiplier;
                 return_address     = current_table_address + table_size;
                 break;
             }
             case jump_return: {
-                Log::debug(Logger::vdp1, tr("Jump return"));
+                LOG_DEBUG(Logger::vdp1, tr("Jump return"));
                 next_table_address = return_address;
                 return_address     = 0;
                 break;
             }
             case skip_next: {
-                Log::debug(Logger::vdp1, tr("Skip next"));
+                LOG_DEBUG(Logger::vdp1, tr("Skip next"));
                 next_table_address += table_size;
                 skip_table = true;
                 break;
             }
             case skip_assign: {
-                Log::debug(Logger::vdp1, tr("Skip assign"));
+                LOG_DEBUG(Logger::vdp1, tr("Skip assign"));
                 next_table_address = vdp1_ram_start_address + cmdlink.data() * vdp1_address_multiplier;
                 skip_table         = true;
                 break;
             }
             case skip_call: {
-                Log::debug(Logger::vdp1, tr("Skip call"));
+                LOG_DEBUG(Logger::vdp1, tr("Skip call"));
                 next_table_address = vdp1_ram_start_address + cmdlink.data() * vdp1_address_multiplier;
                 return_address     = current_table_address + table_size;
                 skip_table         = true;
                 break;
             }
             case skip_return: {
-                Log::debug(Logger::vdp1, tr("Skip return"));
+                LOG_DEBUG(Logger::vdp1, tr("Skip return"));
                 next_table_address = return_address;
                 return_address     = 0;
                 skip_table         = true;
@@ -186,11 +197,11 @@ void Vdp1::populateRenderData() {
             switch (cmdctrl >> CmdCtrl::comm_enum) {
                 using enum CmdCtrl::CommandSelect;
                 case system_clipping: {
-                    Log::unimplemented(tr("VDP1 command - System clipping coordinate set"));
+                    LOG_UNIMPLEMENTED(tr("VDP1 command - System clipping coordinate set"));
                     break;
                 }
                 case user_clipping: {
-                    Log::unimplemented(tr("VDP1 command - User clipping coordinate set"));
+                    LOG_UNIMPLEMENTED(tr("VDP1 command - User clipping coordinate set"));
                     break;
                 }
                 case local_coordinate: {
@@ -253,14 +264,18 @@ void Vdp1::populateRenderData() {
         current_table_address = next_table_address;
     }
 
-    Log::debug(Logger::vdp1, tr("-= Draw End command =-"));
+    LOG_DEBUG(Logger::vdp1, tr("-= Draw End command =-"));
+
+    signalDrawEnd();
+}
 
+void Vdp1::signalDrawEnd() {
     using Edsr = Vdp1Regs::Edsr;
     regs_.edsr.upd(Edsr::cef_enum, Edsr::CurrentEndBitFetchStatus::end_bit_fetched);
     regs_.edsr.upd(Edsr::bef_enum, Edsr::BeforeEndBitFetchStatus::end_bit_fetched); // Needs rework
 
     using namespace saturnin::core::interrupt_source;
-    Log::debug(Logger::vdp1, tr("Interrupt request"));
+    LOG_DEBUG(Logger::vdp1, tr("Interrupt request"));
     modules_.scu()->generateInterrupt(sprite_draw_end);
     modules_.scu()->sendStartFactor(core::ScuRegs::Dxmd::StartingFactorSelect::sprite_draw_end);
 }
@@ -286,7 +301,7 @@ void Vdp1::write16(const u32 addr, const u16 data) {
             regs_.ptmr = data;
             if ((regs_.ptmr >> Ptmr::ptm_enum) == Ptmr::PlotTriggerMode::starts_drawing_when_written) {
                 // Drawing starts from the beginning of the table
-                Log::debug(Logger::vdp1, tr("Drawing started at register write"));
+                LOG_DEBUG(Logger::vdp1, tr("Drawing started at register write"));
                 populateRenderData();
             }
             break;
@@ -300,4 +315,14 @@ void Vdp1::write16(const u32 addr, const u16 data) {
 
 auto Vdp1::vdp2() const -> const Vdp2* { return modules_.vdp2(); }
 
+template<typename Archive>
+void Vdp1::serialize(Archive& ar) {
+    ar.value(regs_);
+    ar.value(color_ram_address_offset_);
+    ar.value(color_offset_);
+}
+
+template void Vdp1::serialize(core::StateWriter&);
+template void Vdp1::serialize(core::StateReader&);
+
 } // namespace saturnin::video
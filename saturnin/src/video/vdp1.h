@@ -33,6 +33,11 @@
 #include <saturnin/src/video/vdp1_registers.h>
 #include <saturnin/src/video/vdp1_part.h> // Vdp1Part
 
+// Forward declaration
+namespace saturnin::tests {
+class Microbenchmarks;
+} // namespace saturnin::tests
+
 namespace saturnin::video {
 
 // Forward declaration
@@ -158,6 +163,19 @@ class Vdp1 {
 
     auto vdp1Parts(const u8 priority) const -> std::vector<Vdp1Part>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn [[nodiscard]] auto Vdp1::hasParts() const -> bool
+    ///
+    /// \brief  Query if the current VDP1 draw list isn't empty, without copying it.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if VDP1 has parts to draw.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto hasParts() const -> bool { return !vdp1_parts_.empty(); }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn auto Vdp1::getDebugDrawList() const -> std::vector<std::string>;
     ///
@@ -171,7 +189,25 @@ class Vdp1 {
 
     auto getDebugDrawList() const -> std::vector<std::string>;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Vdp1::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the registers and the sprite color settings. The draw list is
+    ///         rebuilt from the VRAM at the next frame end, it isn't part of the state.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
   private:
+    friend class tests::Microbenchmarks;
+
     /// \name Vdp1 registers accessors
     //@{
     void               write16(u32 addr, u16 data);
@@ -202,6 +238,17 @@ class Vdp1 {
 
     void populateRenderData();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Vdp1::signalDrawEnd();
+    ///
+    /// \brief  Updates the end status register and requests the sprite draw end interrupt.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void signalDrawEnd();
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn void Vdp1::updateResolution();
     ///
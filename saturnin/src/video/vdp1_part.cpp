@@ -25,6 +25,7 @@
 #include <saturnin/src/video/vdp1.h>
 #include <saturnin/src/emulator_modules.h>
 #include <saturnin/src/locale.h>    // tr
+#include <saturnin/src/timing.h>
 #include <saturnin/src/utilities.h> // format, toUnderlying
 
 namespace uti   = saturnin::utilities;
@@ -35,6 +36,7 @@ namespace saturnin::video {
 using core::EmulatorModules;
 // using core::rawRead;
 // using core::rawWrite;
+using core::internTr;
 using core::tr;
 using utilities::readAs16;
 using utilities::toUnderlying;
@@ -129,47 +131,56 @@ void Vdp1Part::generatePartData(const EmulatorModules& modules) {
         using enum CmdCtrl::CommandSelect;
         case system_clipping: {
             // Not implemented
-            debug_header_ = tr("Set system clipping coordinates");
+            static const auto header = internTr("Set system clipping coordinates");
+            debug_header_            = tr(header);
             break;
         }
         case user_clipping: {
             // Not implemented
-            debug_header_ = tr("Set user clipping coordinates");
+            static const auto header = internTr("Set user clipping coordinates");
+            debug_header_            = tr(header);
             break;
         }
         case local_coordinate: {
             SetLocalCoordinates(twosComplement(cmdxa_.data()), twosComplement(cmdya_.data()));
-            debug_header_ = tr("Set local coordinates");
+            static const auto header = internTr("Set local coordinates");
+            debug_header_            = tr(header);
             break;
         }
         case normal_sprite_draw: {
             normalSpriteDraw(modules, *this);
-            debug_header_ = tr("Normal sprite draw");
+            static const auto header = internTr("Normal sprite draw");
+            debug_header_            = tr(header);
             break;
         }
         case scaled_sprite_draw: {
             scaledSpriteDraw(modules, *this);
-            debug_header_ = tr("Scaled sprite draw");
+            static const auto header = internTr("Scaled sprite draw");
+            debug_header_            = tr(header);
             break;
         }
         case distorted_sprite_draw: {
             distortedSpriteDraw(modules, *this);
-            debug_header_ = tr("Distorted sprite draw");
+            static const auto header = internTr("Distorted sprite draw");
+            debug_header_            = tr(header);
             break;
         }
         case polygon_draw: {
             polyDraw(modules, *this, polygon_draw);
-            debug_header_ = tr("Polygon draw");
+            static const auto header = internTr("Polygon draw");
+            debug_header_            = tr(header);
             break;
         }
         case polyline_draw: {
             polyDraw(modules, *this, polyline_draw);
-            debug_header_ = tr("Polyline draw");
+            static const auto header = internTr("Polyline draw");
+            debug_header_            = tr(header);
             break;
         }
         case line_draw: {
             lineDraw(modules, *this);
-            debug_header_ = tr("Line draw");
+            static const auto header = internTr("Line draw");
+            debug_header_            = tr(header);
             break;
         }
     }
@@ -350,8 +361,8 @@ auto Vdp1Part::getPriorityRegister(const EmulatorModules& modules, const u8 prio
 }
 
 void Vdp1Part::SetLocalCoordinates(const s16 x, const s16 y) {
-    Log::debug(Logger::vdp1, tr("Command - Local coordinate set"));
-    Log::debug(Logger::vdp1, tr("Local coordinates are now ({},{})"), x, y);
+    LOG_DEBUG(Logger::vdp1, tr("Command - Local coordinate set"));
+    LOG_DEBUG(Logger::vdp1, tr("Local coordinates are now ({},{})"), x, y);
     Vdp1Part::local_coordinate_x_ = x;
     Vdp1Part::local_coordinate_y_ = y;
 }
@@ -558,7 +569,7 @@ auto Vdp1Part::calculatedXD() const -> s16 { return twosComplement(cmdxd_.data()
 auto Vdp1Part::calculatedYD() const -> s16 { return twosComplement(cmdyd_.data()) + local_coordinate_y_; }
 
 void normalSpriteDraw(const EmulatorModules& modules, Vdp1Part& part) {
-    Log::debug(Logger::vdp1, tr("Command - Normal sprite draw"));
+    LOG_DEBUG(Logger::vdp1, tr("Command - Normal sprite draw"));
     const auto size_x = static_cast<s16>((part.cmdsize_ >> CmdSize::chszx_shft) * horizontal_multiplier);
     const auto size_y = static_cast<s16>(part.cmdsize_ >> CmdSize::chszy_shft);
 
@@ -591,7 +602,7 @@ void normalSpriteDraw(const EmulatorModules& modules, Vdp1Part& part) {
 }
 
 void scaledSpriteDraw(const EmulatorModules& modules, Vdp1Part& part) {
-    Log::debug(Logger::vdp1, tr("Command - Scaled sprite draw"));
+    LOG_DEBUG(Logger::vdp1, tr("Command - Scaled sprite draw"));
 
     loadTextureData(modules, part);
 
@@ -607,7 +618,7 @@ void scaledSpriteDraw(const EmulatorModules& modules, Vdp1Part& part) {
         case two_coordinates: {
             const auto size_x = static_cast<s16>((part.cmdsize_ >> CmdSize::chszx_shft) * 8);
             const auto size_y = static_cast<s16>(part.cmdsize_ >> CmdSize::chszy_shft);
-            Log::debug(Logger::vdp1, "Character size {} * {}", size_x, size_y);
+            LOG_DEBUG(Logger::vdp1, "Character size {} * {}", size_x, size_y);
             vertexes_pos.emplace_back(part.calculatedXA(), part.calculatedYA());
             vertexes_pos.emplace_back(part.calculatedXA() + size_x, part.calculatedYA());
             vertexes_pos.emplace_back(part.calculatedXA() + size_x, part.calculatedYA() + size_y);
@@ -731,7 +742,7 @@ void scaledSpriteDraw(const EmulatorModules& modules, Vdp1Part& part) {
 }
 
 void distortedSpriteDraw(const EmulatorModules& modules, Vdp1Part& part) {
-    Log::debug(Logger::vdp1, tr("Command - Distorted sprite draw"));
+    LOG_DEBUG(Logger::vdp1, tr("Command - Distorted sprite draw"));
 
     loadTextureData(modules, part);
 
@@ -796,12 +807,12 @@ void polyDraw(const EmulatorModules& modules, Vdp1Part& part, CmdCtrl::CommandSe
         using enum CmdCtrl::CommandSelect;
         using enum Logger;
         case polygon_draw: {
-            Log::debug(vdp1, tr("Command - Polygon draw"));
+            LOG_DEBUG(vdp1, tr("Command - Polygon draw"));
             part.common_vdp_data_.draw_type = DrawType::non_textured_polygon;
             break;
         }
         case polyline_draw: {
-            Log::debug(vdp1, tr("Command - Polyline draw"));
+            LOG_DEBUG(vdp1, tr("Command - Polyline draw"));
             part.common_vdp_data_.draw_type = DrawType::polyline;
             break;
         }
@@ -859,7 +870,7 @@ void polyDraw(const EmulatorModules& modules, Vdp1Part& part, CmdCtrl::CommandSe
 }
 
 void lineDraw(const EmulatorModules& modules, Vdp1Part& part) {
-    Log::debug(Logger::vdp1, tr("Command - Line draw"));
+    LOG_DEBUG(Logger::vdp1, tr("Command - Line draw"));
 
     part.common_vdp_data_.draw_type = DrawType::line;
 
@@ -892,6 +903,7 @@ void lineDraw(const EmulatorModules& modules, Vdp1Part& part) {
 }
 
 void loadTextureData(const EmulatorModules& modules, Vdp1Part& part) {
+    TIMING_ZONE(core::TimingZone::vdp1_texture_decoding);
     const auto      color_ram_address_offset = modules.vdp1()->getColorRamAddressOffset();
     auto            start_address            = vdp1_vram_start_address + part.cmdsrca_.data() * vdp1_address_multiplier;
     const auto      texture_width            = (part.cmdsize_ >> CmdSize::chszx_shft) * 8;
@@ -1034,7 +1046,7 @@ void checkColorCalculation(const Vdp1Part& part) {
         case mode_0: break;
         case mode_4: break;
         default: {
-            Log::unimplemented("Vdp1 - Color calculation {}", part.cmdpmod_ >> CmdPmod::cc_shft);
+            LOG_UNIMPLEMENTED("Vdp1 - Color calculation {}", part.cmdpmod_ >> CmdPmod::cc_shft);
         }
     }
 }
@@ -121,9 +121,8 @@ class Vdp1Part {
     CommonVdpData common_vdp_data_; ///< Data shared between different VDP parts.
 
     ///@{
-    /// Accessors / mutators
-    void debugHeader(std::string_view s) { debug_header_ = s; }
-    auto debugHeader() const -> std::string { return debug_header_; }
+    /// Accessors
+    auto debugHeader() const -> std::string_view { return debug_header_; }
     ///@}
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,7 +203,7 @@ class Vdp1Part {
     static s16 local_coordinate_y_;
     ///@}
 
-    std::string debug_header_{}; ///< Debug header of the part
+    std::string_view debug_header_{}; ///< Debug header of the part, points to an interned translation.
 };
 
 void normalSpriteDraw(const EmulatorModules& modules, Vdp1Part& part);
@@ -25,13 +25,20 @@
 #include <set>
 #include <unordered_set>
 #include <variant> // variant
+#include <saturnin/src/benchmark.h>
 #include <saturnin/src/config.h>
+#include <saturnin/src/headless.h>
 #include <saturnin/src/interrupt_sources.h>
+#include <saturnin/src/rewind.h>
+#include <saturnin/src/save_state.h>
 #include <saturnin/src/scu_registers.h>
+#include <saturnin/src/sound/scsp.h>
 #include <saturnin/src/timer.h>
 #include <saturnin/src/utilities.h> // toUnderlying
 #include <saturnin/src/video/opengl/opengl.h>
 #include <saturnin/src/video/opengl/opengl_render.h>
+#include <saturnin/src/timing.h>
+#include <saturnin/src/video/software_renderer.h>
 #include <saturnin/src/video/texture.h>
 #include <saturnin/src/video/vdp1.h>
 #include <saturnin/src/video/vdp2/vdp2_registers.h>
@@ -51,6 +58,8 @@ using util::toUnderlying;
 
 static std::vector<long long> measures;
 
+constexpr auto audio_polling_period = std::chrono::milliseconds(1);
+
 //--------------------------------------------------------------------------------------------------------------
 // PUBLIC section
 //--------------------------------------------------------------------------------------------------------------
@@ -70,6 +79,14 @@ void Vdp2::initialize() {
     }
     calculateDisplayDuration();
 
+    const std::string renderer = modules_.config()->readValue(core::AccessKeys::cfg_rendering_renderer);
+    renderer_type_             = modules_.config()->getRenderer(renderer);
+    // Without OpenGL context, frames can only be rendered by the software renderer.
+    if (modules_.context()->isHeadless()) { renderer_type_ = RendererType::renderer_software; }
+
+    const s32 frame_skip     = modules_.config()->readValue(core::AccessKeys::cfg_rendering_fast_forward_frame_skip);
+    fast_forward_frame_skip_ = frame_skip;
+
     disabled_scroll_screens_[ScrollScreen::nbg0] = false;
     disabled_scroll_screens_[ScrollScreen::nbg1] = false;
     disabled_scroll_screens_[ScrollScreen::nbg2] = false;
@@ -79,6 +96,7 @@ void Vdp2::initialize() {
 }
 
 void Vdp2::run(const u8 cycles) {
+    TIMING_ZONE(core::TimingZone::vdp2_run);
     using Tvmd   = Vdp2Regs::Tvmd;
     using Tvstat = Vdp2Regs::Tvstat;
 
@@ -86,18 +104,36 @@ void Vdp2::run(const u8 cycles) {
     if (elapsed_frame_cycles_ > cycles_per_vactive_) {
         if (!is_vblank_current_) {
             // Entering vertical blanking
-            is_vblank_current_ = true;
+            is_vblank_current_        = true;
+            is_register_write_logged_ = false;
             regs_.tvstat.upd(Tvstat::vblank_enum, Tvstat::VerticalBlankFlag::during_vertical_retrace);
             regs_.tvmd.upd(Tvmd::disp_enum, Tvmd::Display::not_displayed);
 
-            Log::debug(Logger::vdp2, tr("VBlankIn interrupt request"));
+            LOG_DEBUG(Logger::vdp2, tr("VBlankIn interrupt request"));
 
             modules_.vdp1()->onVblankIn();
             this->onVblankIn();
 
             modules_.scu()->onVblankIn();
 
-            modules_.opengl()->render()->displayFramebuffer(*(modules_.context()));
+            if (!is_frame_skipped_) {
+                if (renderer_type_ == RendererType::renderer_software) {
+                    modules_.softwareRenderer()->render();
+                } else {
+                    modules_.opengl()->render()->displayFramebuffer(*(modules_.context()));
+                }
+            }
+            auto* benchmark = modules_.context()->benchmark();
+            if (benchmark != nullptr) { benchmark->onFrameEnd(); }
+            if constexpr (core::are_timing_zones_compiled) { core::Timing::onFrameEnd(); }
+            modules_.context()->rewind()->onFrameEnd();
+            if (modules_.context()->isHeadless()) {
+                // Headless mode runs as fast as possible.
+                modules_.context()->headless()->onFrameEnd();
+            } else if (benchmark == nullptr && !modules_.context()->isFastForwardEnabled()) {
+                TIMING_ZONE(core::TimingZone::frame_limiter);
+                limitFrameRate();
+            }
             if (modules_.context()->debugStatus() == core::DebugStatus::next_frame) {
                 modules_.context()->debugStatus(core::DebugStatus::paused);
             }
@@ -111,12 +147,15 @@ void Vdp2::run(const u8 cycles) {
         regs_.tvstat.upd(Tvstat::vblank_enum, Tvstat::VerticalBlankFlag::during_vertical_scan);
 
         elapsed_line_cycles_ = 0;
+        current_line_        = 0;
         is_hblank_current_   = false;
         regs_.tvstat.upd(Tvstat::hblank_enum, Tvstat::HorizontalBlankFlag::during_horizontal_scan);
 
         regs_.tvmd.upd(Tvmd::disp_enum, Tvmd::Display::displayed);
+        startRegisterWriteLog();
+        updateFrameSkip();
 
-        Log::debug(Logger::vdp2, tr("VBlankOut interrupt request"));
+        LOG_DEBUG(Logger::vdp2, tr("VBlankOut interrupt request"));
         modules_.scu()->onVblankOut();
 
         modules_.smpc()->clearStvSwitchs();
@@ -149,6 +188,7 @@ void Vdp2::run(const u8 cycles) {
     if (elapsed_line_cycles_ > cycles_per_line_) {
         // End of line display (active + hblank)
         elapsed_line_cycles_ = 0;
+        ++current_line_;
         is_hblank_current_   = false;
         regs_.tvstat.upd(Tvstat::hblank_enum, Tvstat::HorizontalBlankFlag::during_horizontal_scan);
     }
@@ -177,6 +217,7 @@ void Vdp2::calculateDisplayDuration() {
         case pal: {
             constexpr auto frame_duration = seconds{1.0 / 50.0};
             cycles_per_frame_             = modules_.smpc()->calculateCyclesNumber(frame_duration);
+            frame_duration_               = frame_duration;
 
             constexpr auto total_lines   = u16{313};
             auto           visible_lines = u16{};
@@ -207,6 +248,7 @@ void Vdp2::calculateDisplayDuration() {
         case ntsc: {
             constexpr auto frame_duration = seconds{1.0 / 60.0};
             cycles_per_frame_             = modules_.smpc()->calculateCyclesNumber(frame_duration);
+            frame_duration_               = frame_duration;
 
             constexpr auto total_lines   = u16{263};
             auto           visible_lines = u16{};
@@ -234,6 +276,19 @@ void Vdp2::calculateDisplayDuration() {
 void Vdp2::onVblankIn() {
     using enum VdpType;
     calculateFps();
+    if (renderer_type_ == RendererType::renderer_software) {
+        // Frame data is read directly from VRAM by the software renderer, textures aren't needed.
+        updateResolution();
+        updateRamStatus();
+        updateSoftwareRenderingStatus();
+        return;
+    }
+    if (is_frame_skipped_) {
+        // Memory accesses keep being tracked until the next displayed frame, which will reload the modified textures.
+        updateResolution();
+        updateRamStatus();
+        return;
+    }
     Texture::cleanCache(modules_.opengl(), vdp2_cell);
     Texture::cleanCache(modules_.opengl(), vdp2_bitmap);
     updateResolution();
@@ -393,6 +448,32 @@ auto Vdp2::fps() -> std::string {
     return fps_;
 }
 
+template<typename Archive>
+void Vdp2::serialize(Archive& ar) {
+    ar.value(regs_);
+    ar.value(frame_start_regs_);
+    ar.vector(register_writes_);
+    ar.value(elapsed_frame_cycles_);
+    ar.value(elapsed_line_cycles_);
+    ar.value(current_line_);
+    ar.value(cycles_per_frame_);
+    ar.value(cycles_per_vblank_);
+    ar.value(cycles_per_vactive_);
+    ar.value(cycles_per_line_);
+    ar.value(cycles_per_hblank_);
+    ar.value(cycles_per_hactive_);
+    ar.value(frame_duration_);
+    ar.value(is_vblank_current_);
+    ar.value(is_hblank_current_);
+    ar.value(timer_0_counter_);
+    ar.value(timer_1_counter_);
+    ar.value(tv_screen_status_);
+    ar.value(ram_status_);
+}
+
+template void Vdp2::serialize(core::StateWriter&);
+template void Vdp2::serialize(core::StateReader&);
+
 //--------------------------------------------------------------------------------------------------------------
 // PRIVATE section
 //--------------------------------------------------------------------------------------------------------------
@@ -814,6 +895,47 @@ auto Vdp2::getColorRamAddressOffset(const u8 register_offset) const -> u16 {
     return ((register_offset & register_mask) << 8) * color_size;
 };
 
+void Vdp2::limitFrameRate() {
+    // Rendering doesn't block the emulation thread, frames are paced against the TV standard frame rate instead.
+    using clock         = std::chrono::steady_clock;
+    const auto now      = clock::now();
+    const auto duration = std::chrono::duration_cast<clock::duration>(frame_duration_);
+    if (modules_.scsp()->isAudioPaced() && modules_.smpc()->isSoundOn()) {
+        // The host audio device consumes the samples at its own rate : waiting for the output level to get back to its
+        // target keeps video in step with audio, the two clocks can't drift apart. A stalled device only holds a frame
+        // for twice its duration. No samples are produced while the sound CPU is off, the TV rate is used then.
+        const auto deadline = now + 2 * duration;
+        while (modules_.scsp()->isOutputAhead() && (clock::now() < deadline)) {
+            std::this_thread::sleep_for(audio_polling_period);
+        }
+        next_frame_time_ = clock::now() + duration;
+        return;
+    }
+    if (next_frame_time_ + duration <= now) {
+        // More than a frame late (startup, pause, slowdown) : pacing restarts from now instead of catching up.
+        next_frame_time_ = now + duration;
+        return;
+    }
+    std::this_thread::sleep_until(next_frame_time_);
+    next_frame_time_ += duration;
+}
+
+void Vdp2::updateFrameSkip() {
+    if (!modules_.context()->isFastForwardEnabled()) {
+        is_frame_skipped_     = false;
+        skipped_frames_count_ = 0;
+        return;
+    }
+
+    if (std::cmp_less(skipped_frames_count_, fast_forward_frame_skip_.load())) {
+        ++skipped_frames_count_;
+        is_frame_skipped_ = true;
+    } else {
+        skipped_frames_count_ = 0;
+        is_frame_skipped_     = false;
+    }
+}
+
 void Vdp2::calculateFps() {
     using namespace std::literals::chrono_literals;
 
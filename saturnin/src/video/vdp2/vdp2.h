@@ -26,7 +26,10 @@
 #pragma once
 
 #include <array>                           // array
+#include <atomic>                          // atomic
 #include <chrono>                          // duration
+#include <functional>                      // function
+#include <vector>                          // vector
 #include <saturnin/src/emulator_defs.h>    // u8, u16, u32
 #include <saturnin/src/emulator_context.h> // EmulatorContext
 #include <saturnin/src/emulator_modules.h> // EmulatorModules
@@ -35,10 +38,16 @@
 #include <saturnin/src/memory.h>
 #include <saturnin/src/thread_pool.h> // ThreadPool
 #include <saturnin/src/utilities.h>   // toUnderlying
+#include <saturnin/src/video/renderer.h> // RendererType
 #include <saturnin/src/video/vdp_common.h>
 #include <saturnin/src/video/vdp2/vdp2_part.h> // ScrollScreenPos
 #include <saturnin/src/video/vdp2/vdp2_registers.h>
 
+// Forward declaration
+namespace saturnin::tests {
+class Microbenchmarks;
+} // namespace saturnin::tests
+
 namespace saturnin::video {
 
 using saturnin::core::EmulatorContext;
@@ -210,6 +219,21 @@ struct TvScreenStatus {
     u16                             vertical_res{};
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct RegisterWrite
+///
+/// \brief  A VDP2 register write done during the active display, used to render mid-frame raster effects.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RegisterWrite {
+    u16 line{};    ///< First line displayed with the written value.
+    u16 address{}; ///< Register address, relative to the registers area.
+    u16 data{};    ///< Written value.
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 /// \struct RamStatus
 ///
@@ -650,6 +674,48 @@ class Vdp2 {
 
     void onVblankIn();
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn    auto Vdp2::rendererType() const -> RendererType
+    ///
+    /// \brief  Returns the renderer used to display the frames, read from the configuration at initialization.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    A RendererType.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto rendererType() const -> RendererType { return renderer_type_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn    auto Vdp2::isFrameSkipped() const -> bool
+    ///
+    /// \brief  Checks if the current frame is skipped by the fast forward mode. Render data isn't built for skipped
+    ///         frames, only memory accesses are tracked.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \returns    True if the frame won't be displayed.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    [[nodiscard]] auto isFrameSkipped() const -> bool { return is_frame_skipped_; }
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn    void Vdp2::fastForwardFrameSkip(const s32 frame_skip)
+    ///
+    /// \brief  Sets the number of frames skipped between two displayed ones in fast forward mode. Called
+    ///         from the GUI thread when the setting changes, it's read from the configuration at
+    ///         initialization.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  frame_skip  The number of skipped frames.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void fastForwardFrameSkip(const s32 frame_skip) { fast_forward_frame_skip_ = frame_skip; }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////
     /// \fn auto Vdp2::vdp2Parts(const ScrollScreen s, const VdpType t)  const -> std::vector<video::Vdp2Part>
     ///
@@ -817,6 +883,22 @@ class Vdp2 {
 
     auto fps() -> std::string;
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn template<typename Archive> void Vdp2::serialize(Archive& ar);
+    ///
+    /// \brief  Saves or restores the registers, the display timings and the beam position. Render data
+    ///         is rebuilt from the VRAM at the next frame end, it isn't part of the state.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \tparam Archive     StateWriter or StateReader.
+    /// \param [in,out] ar  The archive.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    template<typename Archive>
+    void serialize(Archive& ar);
+
     //--------------------------------------------------------------------------------------------------------------
     // DEBUG methods, defined in vdp2_debug.cpp
     //--------------------------------------------------------------------------------------------------------------
@@ -839,6 +921,9 @@ class Vdp2 {
     ///@}
 
   private:
+    friend class SoftwareRenderer;
+    friend class tests::Microbenchmarks;
+
     //--------------------------------------------------------------------------------------------------------------
     // MEMORY ACCESS methods
     //--------------------------------------------------------------------------------------------------------------
@@ -851,6 +936,46 @@ class Vdp2 {
     void               write32(u32 addr, u32 data);
     ///@}
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Vdp2::storeRegister16(u32 addr, u16 data);
+    ///
+    /// \brief  Stores a 16 bits register value, without the logging and tracing done by write16().
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  addr    The register address.
+    /// \param  data    The value to store.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void storeRegister16(u32 addr, u16 data);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Vdp2::logRegisterWrite(u32 addr, u16 data);
+    ///
+    /// \brief  Adds a register write to the current frame log, when it changes the register value during
+    ///         the active display.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ///
+    /// \param  addr    The register address.
+    /// \param  data    The written value.
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void logRegisterWrite(u32 addr, u16 data);
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// \fn void Vdp2::startRegisterWriteLog();
+    ///
+    /// \brief  Saves the registers state at the start of the frame and clears the write log.
+    ///
+    /// \author Runik
+    /// \date   19/10/2026
+    ////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void startRegisterWriteLog();
+
     //--------------------------------------------------------------------------------------------------------------
     // MISC methods
     //--------------------------------------------------------------------------------------------------------------
@@ -1219,6 +1344,15 @@ class Vdp2 {
     // Populates data from normal background screens (NBG)
     void populateNbgScreens();
 
+    // Updates the scroll screens status used by the software renderer, without generating render parts.
+    void updateSoftwareRenderingStatus();
+
+    // True when registers were modified during the display of the first lines_number lines.
+    [[nodiscard]] auto hasMidFrameRegisterWrites(u16 lines_number) const -> bool;
+
+    // Replays the frame register writes, render_span is called for each range of lines sharing the same registers state.
+    void replayRegisterWrites(u16 lines_number, const std::function<void(u16, u16)>& render_span);
+
     // Determines if scroll screen is displayable, based on others scroll screens configuration
     auto isScrollScreenDisplayable(const ScrollScreen s) const -> bool;
 
@@ -1677,8 +1811,10 @@ class Vdp2 {
         constexpr auto chunk_size     = u32{0x1000};
         auto           texture_offset = u32{};
 
+        // Only the chunks are waited for, other users of the pool keep running.
+        auto chunks = ThreadPool::multi_future<void>{};
         for (u32 i = screen.bitmap_start_address; i < end_address; i += chunk_size) {
-            ThreadPool::pool_.detach_task([this, current_address, texture_offset, &texture_data, &screen, &palette] {
+            auto chunk = ThreadPool::pool_.submit_task([this, current_address, texture_offset, &texture_data, &screen, &palette] {
                 auto       local_texture      = std::vector<u8>{};
                 const auto local_texture_size = chunk_size / offset * 0x10;
                 local_texture.reserve(local_texture_size);
@@ -1709,11 +1845,12 @@ class Vdp2 {
                 }
                 std::ranges::copy(local_texture, &texture_data[0] + texture_offset * 4);
             });
+            chunks.push_back(std::move(chunk));
 
             current_address += chunk_size;
             texture_offset += chunk_size;
         }
-        ThreadPool::pool_.wait();
+        chunks.wait();
     }
 
     template<typename T>
@@ -1832,6 +1969,13 @@ class Vdp2 {
 
     void calculateFps();
 
+    // Waits until the next frame is due, keeping the emulation at the TV standard frame rate, or at the host audio rate
+    // when a real time audio sink is attached.
+    void limitFrameRate();
+
+    // Decides if the next frame is built or skipped, depending on the fast forward mode.
+    void updateFrameSkip();
+
     auto getVram() const -> std::span<const u8> { return std::span<const u8>{modules_.memory()->vdp2_vram_}; };
     auto getCram() const -> std::span<const u8> { return std::span<const u8>{modules_.memory()->vdp2_cram_}; };
 
@@ -1841,8 +1985,10 @@ class Vdp2 {
 
     u32 elapsed_frame_cycles_{}; ///< Elapsed cycles for the current frame.
     u32 elapsed_line_cycles_{};  ///< Elapsed cycles for the current line.
+    u16 current_line_{};         ///< Line currently displayed, counted from the start of the frame.
 
     u32 cycles_per_frame_{};   ///< Number of SH2 cycles needed to display one frame (active + blanking).
+
     u32 cycles_per_vblank_{};  ///< Number of SH2 cycles needed for VBlank duration.
     u32 cycles_per_vactive_{}; ///< Number of SH2 cycles needed to display the visible part of the frame
 
@@ -1850,6 +1996,14 @@ class Vdp2 {
     u32 cycles_per_hblank_{};  ///< Number of SH2 cycles needed for HBlank duration.
     u32 cycles_per_hactive_{}; ///< Number of SH2 cycles needed to display the visible part of a line.
 
+    seconds                               frame_duration_{};  ///< Duration of a frame for the current TV standard.
+    std::chrono::steady_clock::time_point next_frame_time_{}; ///< Time at which the next frame is due.
+
+    bool is_frame_skipped_{};     ///< True if the current frame isn't displayed (fast forward).
+    u32  skipped_frames_count_{}; ///< Number of frames skipped since the last displayed one.
+
+    std::atomic<s32> fast_forward_frame_skip_{}; ///< Frames skipped between two displayed ones, set from the GUI thread.
+
     bool is_vblank_current_{}; ///< True if VBlank is current.
     bool is_hblank_current_{}; ///< True if HBlank is current.
 
@@ -1858,6 +2012,7 @@ class Vdp2 {
 
     TvScreenStatus tv_screen_status_; ///< The TV screen status.
     RamStatus      ram_status_;       ///< The RAM status
+    RendererType   renderer_type_{RendererType::renderer_opengl_legacy}; ///< Renderer used to display the frames.
 
     std::array<ScrollScreenStatus, 6> bg_;       ///< The backgrounds status.
     std::array<ScrollScreenStatus, 6> saved_bg_; /// \brief  The backgrounds status from the previous frame.
@@ -1879,6 +2034,10 @@ class Vdp2 {
     std::string fps_;       ///< The FPS
 
     Vdp2Regs regs_; ///< VDP2 registers
+
+    Vdp2Regs                   frame_start_regs_;           ///< VDP2 registers at the start of the current frame.
+    std::vector<RegisterWrite> register_writes_;            ///< Register writes done during the current frame display.
+    bool                       is_register_write_logged_{}; ///< True while register writes are logged.
 };
 
 ///@{
@@ -156,12 +156,12 @@ auto Vdp2::isScreenDisplayed(ScrollScreen s) -> bool {
         }
         case rbg0: {
             if ((regs_.bgon >> Bgon::r0on_enum) == Bgon::ScreenDisplayEnableBit::cannot_display) { return false; }
-            core::Log::unimplemented(core::tr("VDP2 RBG0 display"));
+            LOG_UNIMPLEMENTED(core::tr("VDP2 RBG0 display"));
             break;
         }
         case rbg1: {
             if ((regs_.bgon >> Bgon::r1on_enum) == Bgon::ScreenDisplayEnableBit::cannot_display) { return false; }
-            core::Log::unimplemented(core::tr("VDP2 RBG1 display"));
+            LOG_UNIMPLEMENTED(core::tr("VDP2 RBG1 display"));
             break;
         }
         default: {
@@ -323,7 +323,7 @@ auto Vdp2::getVramAccessByCommand(const Vdp2Regs::VramAccessCommand command, con
         }
         case nbg0_vertical_cell_scroll_table_data_read:
         case nbg1_vertical_cell_scroll_table_data_read: {
-            core::Log::unimplemented(core::tr("VDP2 vertical cell scroll table data read"));
+            LOG_UNIMPLEMENTED(core::tr("VDP2 vertical cell scroll table data read"));
             break;
         }
         case cpu_read_write: {
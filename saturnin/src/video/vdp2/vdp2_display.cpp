@@ -20,6 +20,7 @@
 #include <saturnin/src/pch.h>
 #include <saturnin/src/video/vdp2/vdp2.h>
 #include <saturnin/src/video/opengl/opengl_texturing.h>
+#include <saturnin/src/timing.h>
 #include <saturnin/src/video/texture.h>
 #include <saturnin/src/utilities.h> // toUnderlying
 
@@ -41,6 +42,7 @@ constexpr auto bits_in_a_byte                = u8{8};
 void Vdp2::clearRenderData(const ScrollScreen s) { std::vector<video::Vdp2Part>().swap(vdp2_parts_[toUnderlying(s)]); }
 
 void Vdp2::populateRenderData() {
+    TIMING_ZONE(core::TimingZone::vdp2_populate_render_data);
     // Desactivated while testing rendering to sprites using FBOs
     populateRbgScreens();
     populateNbgScreens();
@@ -89,6 +91,52 @@ void Vdp2::populateNbgScreens() {
     }
 }
 
+void Vdp2::updateSoftwareRenderingStatus() {
+    using enum ScrollScreen;
+    for (const auto rbg : {rbg1, rbg0}) {
+        if (isScreenDisplayed(rbg)) { updateScrollScreenStatus(rbg); }
+    }
+
+    const auto is_nbg_displayed = !(getScreen(rbg0).is_display_enabled && getScreen(rbg1).is_display_enabled);
+    for (const auto nbg : {nbg0, nbg1, nbg2, nbg3}) {
+        if (is_nbg_displayed && isScrollScreenDisplayable(nbg) && isScreenDisplayed(nbg)) {
+            updateScrollScreenStatus(nbg);
+        } else {
+            getScreen(nbg).is_display_enabled = false;
+        }
+    }
+}
+
+auto Vdp2::hasMidFrameRegisterWrites(const u16 lines_number) const -> bool {
+    // Writes applying after the last displayed line are already part of the current registers state.
+    return std::ranges::any_of(register_writes_, [lines_number](const RegisterWrite& w) { return w.line != 0 && w.line < lines_number; });
+}
+
+void Vdp2::replayRegisterWrites(const u16 lines_number, const std::function<void(u16, u16)>& render_span) {
+    const auto frame_end_regs = regs_;
+    regs_                     = frame_start_regs_;
+
+    auto write      = register_writes_.cbegin();
+    auto first_line = u16{};
+    while (first_line < lines_number) {
+        while (write != register_writes_.cend() && write->line <= first_line) {
+            // The writes were already logged and traced when the game made them.
+            storeRegister16(write->address, write->data);
+            ++write;
+        }
+        const auto last_line = (write == register_writes_.cend()) ? lines_number : std::min(write->line, lines_number);
+
+        updateRamStatus();
+        updateSoftwareRenderingStatus();
+        render_span(first_line, last_line);
+        first_line = last_line;
+    }
+
+    regs_ = frame_end_regs;
+    updateRamStatus();
+    updateSoftwareRenderingStatus();
+}
+
 auto Vdp2::isScrollScreenDisplayable(const ScrollScreen s) const -> bool {
     const auto nbg0_color_nb = getScreen(ScrollScreen::nbg0).character_color_number;
     const auto nbg1_color_nb = getScreen(ScrollScreen::nbg1).character_color_number;
@@ -721,9 +769,11 @@ void Vdp2::updateScrollScreenStatus(const ScrollScreen s) {
         return screen.screen_scroll_vertical_integer % (plane_height * nb_of_planes);
     }();
 
-    if (isCacheDirty(s)) { discardCache(s); }
-    clearRenderData(s);
-    vdp2_parts_[util::toUnderlying(s)].reserve(screen.cells_number);
+    if (renderer_type_ != RendererType::renderer_software) {
+        if (isCacheDirty(s)) { discardCache(s); }
+        clearRenderData(s);
+        vdp2_parts_[util::toUnderlying(s)].reserve(screen.cells_number);
+    }
 
     saved_bg_[util::toUnderlying(s)] = screen;
 }
@@ -981,6 +1031,7 @@ void Vdp2::readScrollScreenData(const ScrollScreen s) {
 }
 
 void Vdp2::readBitmapData(const ScrollScreenStatus& screen) {
+    TIMING_ZONE(core::TimingZone::vdp2_bitmap_decoding);
     constexpr auto width_512      = u16{512};
     constexpr auto width_1024     = u16{1024};
     constexpr auto height_256     = u16{256};
@@ -1351,6 +1402,7 @@ void Vdp2::readCellDispatch(const ScrollScreenStatus& screen,
 }
 
 void Vdp2::readCell(const ScrollScreenStatus& screen, const PatternNameData& pnd, const u32 cell_address, const size_t key) {
+    TIMING_ZONE(core::TimingZone::vdp2_cell_decoding);
     constexpr auto  texture_width  = u16{8};
     constexpr auto  texture_height = u16{8};
     constexpr auto  texture_size   = texture_width * texture_height * 4;
@@ -1415,6 +1467,7 @@ void Vdp2::readCellMT(const ScrollScreenStatus& screen,
                       const size_t              key,
                       const std::span<const u8> vram,
                       const std::span<const u8> cram) {
+    TIMING_ZONE(core::TimingZone::vdp2_cell_decoding);
     constexpr auto  texture_width  = u16{8};
     constexpr auto  texture_height = u16{8};
     constexpr auto  texture_size   = texture_width * texture_height * 4;
@@ -20,6 +20,7 @@
 #include <saturnin/src/pch.h>
 #include <saturnin/src/video/vdp2/vdp2.h>
 #include <saturnin/src/video/vdp2/vdp2_registers.h>
+#include <saturnin/src/trace.h> // Trace
 
 namespace saturnin::video {
 
@@ -480,6 +481,12 @@ void Vdp2::write8(const u32 addr, const u8 data) {
 
 // NOLINTNEXTLINE(readability-convert-member-functions-to-static)
 void Vdp2::write16(const u32 addr, const u16 data) {
+    if (is_register_write_logged_) { logRegisterWrite(addr, data); }
+    core::Trace::record(core::TraceEvent::vdp2_register_write, (addr & core::vdp2_registers_memory_mask) << 16 | data);
+    storeRegister16(addr, data);
+}
+
+void Vdp2::storeRegister16(const u32 addr, const u16 data) {
     switch (addr & core::vdp2_registers_memory_mask) {
         case tv_screen_mode: regs_.tvmd = data; break;
         case external_signal_enable: regs_.exten = data; break;
@@ -633,6 +640,10 @@ void Vdp2::write16(const u32 addr, const u16 data) {
 void Vdp2::write32(const u32 addr, const u32 data) {
     const auto h = static_cast<u16>(data >> 16);
     const auto l = static_cast<u16>(data & 0xFFFF);
+    if (is_register_write_logged_) {
+        logRegisterWrite(addr, h);
+        logRegisterWrite(addr + 2, l);
+    }
     switch (addr & core::vdp2_registers_memory_mask) {
         case vram_cycle_pattern_bank_a0_lower:
             regs_.cyca0l = h;
@@ -910,4 +921,18 @@ void Vdp2::write32(const u32 addr, const u32 data) {
     }
 }
 
+void Vdp2::logRegisterWrite(const u32 addr, const u16 data) {
+    if (read16(addr) == data) { return; }
+
+    // Registers are latched at the start of a line, a write done while a line is displayed applies to the next one.
+    const auto line = (elapsed_line_cycles_ == 0) ? current_line_ : static_cast<u16>(current_line_ + 1);
+    register_writes_.push_back({.line = line, .address = static_cast<u16>(addr & core::vdp2_registers_memory_mask), .data = data});
+}
+
+void Vdp2::startRegisterWriteLog() {
+    frame_start_regs_ = regs_;
+    register_writes_.clear();
+    is_register_write_logged_ = (renderer_type_ == RendererType::renderer_software);
+}
+
 } // namespace saturnin::video
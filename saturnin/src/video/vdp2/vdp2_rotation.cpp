@@ -0,0 +1,194 @@
+//
+// vdp2_rotation.cpp
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <saturnin/src/pch.h>
+#include <saturnin/src/video/vdp2/vdp2_rotation.h>
+#include <saturnin/src/memory.h>    // vdp2_vram_memory_mask
+#include <saturnin/src/utilities.h> // signExtend
+
+namespace saturnin::video {
+
+namespace util = saturnin::utilities;
+
+constexpr auto color_ram_coefficient_offset = u32{0x800}; // Coefficients use the upper half of the color RAM.
+constexpr auto color_ram_coefficient_mask   = u32{0x7FF};
+
+inline auto readTable16(const std::span<const u8> data, const u32 address, const u32 mask) -> u32 {
+    return static_cast<u32>(data[address & mask] << 8 | data[(address + 1) & mask]);
+}
+
+inline auto readTable32(const std::span<const u8> data, const u32 address, const u32 mask) -> u32 {
+    return readTable16(data, address, mask) << 16 | readTable16(data, address + 2, mask);
+}
+
+auto readRotationParameter(const std::span<const u8> vram, const u32 address) -> RotationParameter {
+    // NOLINTBEGIN(readability-magic-numbers)
+    const auto read32 = [&](const u32 offset) { return readTable32(vram, address + offset, core::vdp2_vram_memory_mask); };
+    const auto read16 = [&](const u32 offset) { return readTable16(vram, address + offset, core::vdp2_vram_memory_mask); };
+
+    // Fixed point values are stored from bit 6 upward, the unused bits are ignored.
+    const auto coordinate = [&](const u32 offset) { return util::signExtend<s32, 23>(static_cast<s32>(read32(offset) >> 6)); };
+    const auto increment  = [&](const u32 offset) { return util::signExtend<s32, 13>(static_cast<s32>(read32(offset) >> 6)); };
+    const auto matrix     = [&](const u32 offset) { return util::signExtend<s32, 14>(static_cast<s32>(read32(offset) >> 6)); };
+    const auto position   = [&](const u32 offset) { return util::signExtend<s32, 14>(static_cast<s32>(read16(offset))); };
+    const auto shift      = [&](const u32 offset) { return util::signExtend<s32, 24>(static_cast<s32>(read32(offset) >> 6)); };
+    const auto scale      = [&](const u32 offset) { return util::signExtend<s32, 24>(static_cast<s32>(read32(offset))); };
+    const auto ka_delta   = [&](const u32 offset) { return util::signExtend<s32, 20>(static_cast<s32>(read32(offset) >> 6)); };
+
+    auto parameter       = RotationParameter{};
+    parameter.xst        = coordinate(0x00);
+    parameter.yst        = coordinate(0x04);
+    parameter.zst        = coordinate(0x08);
+    parameter.delta_xst  = increment(0x0C);
+    parameter.delta_yst  = increment(0x10);
+    parameter.delta_x    = increment(0x14);
+    parameter.delta_y    = increment(0x18);
+    parameter.matrix     = {matrix(0x1C), matrix(0x20), matrix(0x24), matrix(0x28), matrix(0x2C), matrix(0x30)};
+    parameter.px         = position(0x34);
+    parameter.py         = position(0x36);
+    parameter.pz         = position(0x38);
+    parameter.cx         = position(0x3C);
+    parameter.cy         = position(0x3E);
+    parameter.cz         = position(0x40);
+    parameter.mx         = shift(0x44);
+    parameter.my         = shift(0x48);
+    parameter.kx         = scale(0x4C);
+    parameter.ky         = scale(0x50);
+    parameter.kast       = read32(0x54) >> 6;
+    parameter.delta_kast = ka_delta(0x58);
+    parameter.delta_kax  = ka_delta(0x5C);
+    // NOLINTEND(readability-magic-numbers)
+
+    return parameter;
+}
+
+auto setupRotationLine(const RotationParameter& parameter, const u16 line) -> RotationLine {
+    const auto& m = parameter.matrix;
+
+    // Screen coordinates of the first dot of the line, relative to the viewpoint.
+    const auto xs = s64{parameter.xst} + s64{parameter.delta_xst} * line - (s64{parameter.px} << rotation_fixed_point_shift);
+    const auto ys = s64{parameter.yst} + s64{parameter.delta_yst} * line - (s64{parameter.py} << rotation_fixed_point_shift);
+    const auto zs = s64{parameter.zst} - (s64{parameter.pz} << rotation_fixed_point_shift);
+
+    // Viewpoint relative to the rotation center.
+    const auto vx = s64{parameter.px - parameter.cx} << rotation_fixed_point_shift;
+    const auto vy = s64{parameter.py - parameter.cy} << rotation_fixed_point_shift;
+    const auto vz = s64{parameter.pz - parameter.cz} << rotation_fixed_point_shift;
+
+    auto rotation_line      = RotationLine{};
+    rotation_line.xsp       = (m[0] * xs + m[1] * ys + m[2] * zs) >> rotation_fixed_point_shift;
+    rotation_line.ysp       = (m[3] * xs + m[4] * ys + m[5] * zs) >> rotation_fixed_point_shift;
+    rotation_line.xp        = ((m[0] * vx + m[1] * vy + m[2] * vz) >> rotation_fixed_point_shift)
+                       + (s64{parameter.cx} << rotation_fixed_point_shift) + parameter.mx;
+    rotation_line.yp        = ((m[3] * vx + m[4] * vy + m[5] * vz) >> rotation_fixed_point_shift)
+                       + (s64{parameter.cy} << rotation_fixed_point_shift) + parameter.my;
+    rotation_line.dx        = (s64{m[0]} * parameter.delta_x + s64{m[1]} * parameter.delta_y) >> rotation_fixed_point_shift;
+    rotation_line.dy        = (s64{m[3]} * parameter.delta_x + s64{m[4]} * parameter.delta_y) >> rotation_fixed_point_shift;
+    rotation_line.ka        = s64{parameter.kast} + s64{parameter.delta_kast} * line;
+    rotation_line.delta_kax = parameter.delta_kax;
+
+    return rotation_line;
+}
+
+auto readCoefficient(const std::span<const u8> data, const CoefficientTableSetting& setting, const u32 index) -> Coefficient {
+    // NOLINTBEGIN(readability-magic-numbers)
+    const auto entry_size = setting.is_one_word ? u32{2} : u32{4};
+    auto       address    = u32{};
+    auto       mask       = u32{};
+    if (setting.is_in_color_ram) {
+        address = color_ram_coefficient_offset + ((index * entry_size) & color_ram_coefficient_mask);
+        mask    = core::vdp2_cram_memory_mask;
+    } else {
+        address = ((setting.address_offset << 16) + index) * entry_size;
+        mask    = core::vdp2_vram_memory_mask;
+    }
+
+    auto coefficient = Coefficient{};
+    if (setting.is_one_word) {
+        // Signed 5.10 value, converted to 16 bits fractional part.
+        const auto raw             = readTable16(data, address, mask);
+        coefficient.is_transparent = (raw & 0x8000) != 0;
+        coefficient.value          = util::signExtend<s32, 15>(static_cast<s32>(raw & 0x7FFF)) << 6;
+    } else {
+        const auto raw             = readTable32(data, address, mask);
+        coefficient.is_transparent = (raw & 0x80000000) != 0;
+        coefficient.line_color     = static_cast<u8>((raw >> 24) & 0x7F);
+        coefficient.value          = util::signExtend<s32, 24>(static_cast<s32>(raw & 0xFFFFFF));
+    }
+    // NOLINTEND(readability-magic-numbers)
+
+    return coefficient;
+}
+
+void calculateRotationCoordinates(const RotationParameter&       parameter,
+                                  const RotationLine&            line,
+                                  const CoefficientTableSetting& setting,
+                                  const std::span<const u8>      coefficient_data,
+                                  std::span<s32>                 x,
+                                  std::span<s32>                 y,
+                                  std::span<u8>                  is_transparent) {
+    using CoefficientMode = CoefficientTableSetting::CoefficientMode;
+    constexpr auto shift  = rotation_fixed_point_shift + coefficient_fixed_point_shift;
+    const auto     width  = static_cast<s32>(x.size());
+
+    if (!setting.is_enabled) {
+        // Scaling is constant over the line, coordinates are a linear function of the dot position.
+        const auto base_x = s64{parameter.kx} * line.xsp + (line.xp << coefficient_fixed_point_shift);
+        const auto base_y = s64{parameter.ky} * line.ysp + (line.yp << coefficient_fixed_point_shift);
+        const auto step_x = s64{parameter.kx} * line.dx;
+        const auto step_y = s64{parameter.ky} * line.dy;
+        for (s32 h = 0; h < width; ++h) {
+            x[h] = static_cast<s32>((base_x + step_x * h) >> shift);
+            y[h] = static_cast<s32>((base_y + step_y * h) >> shift);
+        }
+        std::ranges::fill(is_transparent, u8{0});
+        return;
+    }
+
+    // The coefficient address usually advances slowly, the last read entry is kept.
+    auto ka          = line.ka;
+    auto last_index  = u32{0xFFFFFFFF};
+    auto coefficient = Coefficient{};
+    for (s32 h = 0; h < width; ++h) {
+        const auto index = static_cast<u32>(ka >> rotation_fixed_point_shift);
+        if (index != last_index) {
+            coefficient = readCoefficient(coefficient_data, setting, index);
+            last_index  = index;
+        }
+        ka += line.delta_kax;
+
+        auto kx = s64{parameter.kx};
+        auto ky = s64{parameter.ky};
+        auto xp = line.xp;
+        switch (setting.mode) {
+            using enum CoefficientMode;
+            case use_as_scale_coeff_kx_ky: kx = ky = coefficient.value; break;
+            case use_as_scale_coeff_kx: kx = coefficient.value; break;
+            case use_as_scale_coeff_ky: ky = coefficient.value; break;
+            case use_as_viewpoint_xp_after_rotation_conversion:
+                xp = coefficient.value >> (coefficient_fixed_point_shift - rotation_fixed_point_shift);
+                break;
+        }
+        x[h]              = static_cast<s32>((kx * (line.xsp + line.dx * h) + (xp << coefficient_fixed_point_shift)) >> shift);
+        y[h]              = static_cast<s32>((ky * (line.ysp + line.dy * h) + (line.yp << coefficient_fixed_point_shift)) >> shift);
+        is_transparent[h] = static_cast<u8>(coefficient.is_transparent);
+    }
+}
+
+} // namespace saturnin::video
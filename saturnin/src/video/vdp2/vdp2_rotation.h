@@ -0,0 +1,202 @@
+//
+// vdp2_rotation.h
+// Saturnin
+//
+// Copyright (c) 2026 Renaud Toumazet
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \file	vdp2_rotation.h
+///
+/// \brief	Declares the rotation scroll screens (RBG) coordinates calculation.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <array>                                    // array
+#include <span>                                     // span
+#include <saturnin/src/emulator_defs.h>             // u8, u16, u32
+#include <saturnin/src/video/vdp2/vdp2_registers.h> // Vdp2Regs
+
+namespace saturnin::video {
+
+constexpr auto rotation_parameter_b_offset   = u32{0x80}; ///< Offset of the parameter B table from the parameter A one.
+constexpr auto rotation_fixed_point_shift    = u8{10};     ///< Fractional bits of the rotation values.
+constexpr auto coefficient_fixed_point_shift = u8{16};     ///< Fractional bits of the scale coefficients.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct RotationParameter
+///
+/// \brief  Content of a rotation parameter table, converted to signed fixed point values.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RotationParameter {
+    s32                xst{};        ///< Screen start coordinate X (10 bits fractional part).
+    s32                yst{};        ///< Screen start coordinate Y (10 bits fractional part).
+    s32                zst{};        ///< Screen start coordinate Z (10 bits fractional part).
+    s32                delta_xst{};  ///< Screen vertical coordinate increment X (10 bits fractional part).
+    s32                delta_yst{};  ///< Screen vertical coordinate increment Y (10 bits fractional part).
+    s32                delta_x{};    ///< Screen horizontal coordinate increment X (10 bits fractional part).
+    s32                delta_y{};    ///< Screen horizontal coordinate increment Y (10 bits fractional part).
+    std::array<s32, 6> matrix{};     ///< Rotation matrix parameters A to F (10 bits fractional part).
+    s32                px{};         ///< Viewpoint coordinate X.
+    s32                py{};         ///< Viewpoint coordinate Y.
+    s32                pz{};         ///< Viewpoint coordinate Z.
+    s32                cx{};         ///< Center coordinate X.
+    s32                cy{};         ///< Center coordinate Y.
+    s32                cz{};         ///< Center coordinate Z.
+    s32                mx{};         ///< Amount of horizontal shifting (10 bits fractional part).
+    s32                my{};         ///< Amount of vertical shifting (10 bits fractional part).
+    s32                kx{};         ///< Horizontal scaling coefficient (16 bits fractional part).
+    s32                ky{};         ///< Vertical scaling coefficient (16 bits fractional part).
+    u32                kast{};       ///< Coefficient table start address (10 bits fractional part).
+    s32                delta_kast{}; ///< Coefficient table vertical address increment (10 bits fractional part).
+    s32                delta_kax{};  ///< Coefficient table horizontal address increment (10 bits fractional part).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct RotationLine
+///
+/// \brief  Values of a rotation parameter that stay constant for a whole line. Coordinates of the dot h
+///         of the line are kx * (xsp + dx * h) + xp and ky * (ysp + dy * h) + yp.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct RotationLine {
+    s64 xsp{};       ///< Screen X coordinate of the first dot after rotation (10 bits fractional part).
+    s64 ysp{};       ///< Screen Y coordinate of the first dot after rotation (10 bits fractional part).
+    s64 xp{};        ///< Viewpoint X coordinate after rotation (10 bits fractional part).
+    s64 yp{};        ///< Viewpoint Y coordinate after rotation (10 bits fractional part).
+    s64 dx{};        ///< Horizontal increment of X (10 bits fractional part).
+    s64 dy{};        ///< Horizontal increment of Y (10 bits fractional part).
+    s64 ka{};        ///< Coefficient table address of the first dot (10 bits fractional part).
+    s64 delta_kax{}; ///< Coefficient table address increment (10 bits fractional part).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct CoefficientTableSetting
+///
+/// \brief  Coefficient table configuration of a rotation parameter.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct CoefficientTableSetting {
+    using CoefficientMode = Vdp2Regs::Ktctl::CoefficientMode;
+
+    bool            is_enabled{};            ///< The coefficient table is used.
+    bool            is_one_word{};           ///< Coefficient data is 1 word instead of 2.
+    bool            is_in_color_ram{};       ///< Coefficient table is stored in the upper half of the color RAM.
+    bool            is_line_color_enabled{}; ///< Line color data of the coefficients is used.
+    CoefficientMode mode{};                  ///< Parameters replaced by the coefficient data.
+    u32             address_offset{};        ///< Coefficient table address offset (KTAOS).
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \struct Coefficient
+///
+/// \brief  A decoded coefficient table entry.
+///
+/// \author Runik
+/// \date   19/10/2026
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct Coefficient {
+    s32  value{};          ///< Coefficient value (16 bits fractional part).
+    u8   line_color{};     ///< Line color screen data (2 words coefficients only).
+    bool is_transparent{}; ///< The dots using this coefficient are transparent.
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn auto readRotationParameter(std::span<const u8> vram, u32 address) -> RotationParameter;
+///
+/// \brief  Reads a rotation parameter table from VRAM.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  vram    VRAM content.
+/// \param  address Address of the table, relative to VRAM.
+///
+/// \returns    The rotation parameter.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+auto readRotationParameter(std::span<const u8> vram, u32 address) -> RotationParameter;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn auto setupRotationLine(const RotationParameter& parameter, u16 line) -> RotationLine;
+///
+/// \brief  Evaluates the rotation matrix for a line.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  parameter   The rotation parameter.
+/// \param  line        The line number.
+///
+/// \returns    The line values.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+auto setupRotationLine(const RotationParameter& parameter, u16 line) -> RotationLine;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn auto readCoefficient(std::span<const u8> data, const CoefficientTableSetting& setting, u32 index) -> Coefficient;
+///
+/// \brief  Reads a coefficient table entry.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param  data    VRAM or color RAM content, depending on the coefficient table storage.
+/// \param  setting The coefficient table setting.
+/// \param  index   Integer part of the coefficient table address.
+///
+/// \returns    The coefficient.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+auto readCoefficient(std::span<const u8> data, const CoefficientTableSetting& setting, u32 index) -> Coefficient;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+/// \fn void calculateRotationCoordinates(const RotationParameter& parameter, const RotationLine& line, const CoefficientTableSetting& setting, std::span<const u8> coefficient_data, std::span<s32> x, std::span<s32> y, std::span<u8> is_transparent);
+///
+/// \brief  Calculates the scroll screen coordinates of every dot of a line.
+///
+/// \author Runik
+/// \date   19/10/2026
+///
+/// \param          parameter           The rotation parameter.
+/// \param          line                The line values of the parameter.
+/// \param          setting             The coefficient table setting.
+/// \param          coefficient_data    VRAM or color RAM content, depending on the coefficient table storage.
+/// \param [in,out] x                   Horizontal integer coordinates, one per dot of the line.
+/// \param [in,out] y                   Vertical integer coordinates, one per dot of the line.
+/// \param [in,out] is_transparent      Set to 1 for dots made transparent by the coefficient table.
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void calculateRotationCoordinates(const RotationParameter&       parameter,
+                                  const RotationLine&            line,
+                                  const CoefficientTableSetting& setting,
+                                  std::span<const u8>            coefficient_data,
+                                  std::span<s32>                 x,
+                                  std::span<s32>                 y,
+                                  std::span<u8>                  is_transparent);
+
+} // namespace saturnin::video